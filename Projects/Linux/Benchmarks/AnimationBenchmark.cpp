@@ -0,0 +1,221 @@
+//
+//  AnimationBenchmark.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include "BenchmarkApplication.h"
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Math/MathUtils.h>
+#include <ChilliSource/Core/Resource/ResourcePool.h>
+#include <ChilliSource/Core/Scene/Scene.h>
+#include <ChilliSource/Core/State/State.h>
+#include <ChilliSource/Core/String/ToString.h>
+#include <ChilliSource/Rendering/Base/RenderComponentFactory.h>
+#include <ChilliSource/Rendering/Camera/PerspectiveCameraComponent.h>
+#include <ChilliSource/Rendering/Material/Material.h>
+#include <ChilliSource/Rendering/Material/MaterialFactory.h>
+#include <ChilliSource/Rendering/Model/AnimatedMeshComponent.h>
+#include <ChilliSource/Rendering/Model/Mesh.h>
+#include <ChilliSource/Rendering/Model/MeshDescriptor.h>
+#include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
+#include <ChilliSource/Rendering/Texture/Texture.h>
+
+#include <cmath>
+
+//-----------------------------------------------------------
+/// Measures how skinned animation evaluation scales with the
+/// number of cores, on a synthetic scene of characters which
+/// each play a looping animation on their own skeleton. The
+/// characters are offset in time so that no two share a pose.
+//-----------------------------------------------------------
+namespace
+{
+	const u32 k_numCharacters = 1000;
+	const u32 k_numBones = 64;
+	const u32 k_numAnimationFrames = 30;
+	const f32 k_animationFrameTime = 1.0f / 30.0f;
+	const f32 k_boneLength = 0.1f;
+	const f32 k_characterSpacing = 2.0f;
+
+	//-----------------------------------------------------------
+	/// @return A skinned mesh which is a strip along the y axis
+	/// with one bone per segment, each bone a child of the one
+	/// before it.
+	//-----------------------------------------------------------
+	CSRendering::MeshCSPtr CreateSkinnedMesh()
+	{
+		struct Vertex
+		{
+			CSCore::Vector4 m_position;
+			CSCore::Vector3 m_normal;
+			CSCore::Vector2 m_uv;
+			CSCore::Vector4 m_weights;
+			u8 m_jointIndices[4];
+		};
+
+		const CSRendering::VertexElement elements[] =
+		{
+			{CSRendering::VertexDataType::k_float4, CSRendering::VertexDataSemantic::k_position},
+			{CSRendering::VertexDataType::k_float3, CSRendering::VertexDataSemantic::k_normal},
+			{CSRendering::VertexDataType::k_float2, CSRendering::VertexDataSemantic::k_uv},
+			{CSRendering::VertexDataType::k_float4, CSRendering::VertexDataSemantic::k_weight},
+			{CSRendering::VertexDataType::k_byte4, CSRendering::VertexDataSemantic::k_jointIndex}
+		};
+
+		std::vector<Vertex> vertices(k_numBones * 2);
+		for (u32 i = 0; i < vertices.size(); ++i)
+		{
+			u32 bone = i / 2;
+			vertices[i].m_position = CSCore::Vector4((i % 2 == 0) ? -0.1f : 0.1f, bone * k_boneLength, 0.0f, 1.0f);
+			vertices[i].m_normal = CSCore::Vector3::k_unitPositiveZ;
+			vertices[i].m_uv = CSCore::Vector2((f32)(i % 2), (f32)bone / (f32)k_numBones);
+			vertices[i].m_weights = CSCore::Vector4(1.0f, 0.0f, 0.0f, 0.0f);
+			vertices[i].m_jointIndices[0] = (u8)bone;
+			vertices[i].m_jointIndices[1] = 0;
+			vertices[i].m_jointIndices[2] = 0;
+			vertices[i].m_jointIndices[3] = 0;
+		}
+
+		std::vector<u16> indices;
+		for (u32 bone = 0; bone + 1 < k_numBones; ++bone)
+		{
+			u16 first = (u16)(bone * 2);
+			indices.insert(indices.end(), {first, (u16)(first + 1), (u16)(first + 2), (u16)(first + 1), (u16)(first + 3), (u16)(first + 2)});
+		}
+
+		CSRendering::MeshDescriptor meshDesc;
+		meshDesc.mFeatures.mbHasAnimationData = true;
+		for (u32 bone = 0; bone < k_numBones; ++bone)
+		{
+			meshDesc.m_skeletonDesc.m_nodeNames.push_back("Bone" + CSCore::ToString(bone));
+			meshDesc.m_skeletonDesc.m_parentNodeIndices.push_back((s32)bone - 1);
+			meshDesc.m_skeletonDesc.m_jointIndices.push_back((s32)bone);
+		}
+
+		CSRendering::SubMeshDescriptor subMeshDesc;
+		subMeshDesc.mstrName = "Strip";
+		subMeshDesc.mudwNumVertices = (u32)vertices.size();
+		subMeshDesc.mudwNumIndices = (u32)indices.size();
+		subMeshDesc.mvMinBounds = CSCore::Vector3(-0.1f, 0.0f, 0.0f);
+		subMeshDesc.mvMaxBounds = CSCore::Vector3(0.1f, k_numBones * k_boneLength, 0.0f);
+		subMeshDesc.mpVertexData = reinterpret_cast<u8*>(vertices.data());
+		subMeshDesc.mpIndexData = reinterpret_cast<u8*>(indices.data());
+		subMeshDesc.ePrimitiveType = CSRendering::PrimitiveType::k_tri;
+		for (u32 bone = 0; bone < k_numBones; ++bone)
+		{
+			subMeshDesc.mInverseBindPoseMatrices.push_back(CSCore::Matrix4::CreateTranslation(0.0f, -(bone * k_boneLength), 0.0f));
+		}
+
+		meshDesc.mMeshes.push_back(subMeshDesc);
+		meshDesc.mVertexDeclaration = CSRendering::VertexDeclaration(5, elements);
+		meshDesc.mvMinBounds = subMeshDesc.mvMinBounds;
+		meshDesc.mvMaxBounds = subMeshDesc.mvMaxBounds;
+		meshDesc.mudwIndexSize = sizeof(u16);
+
+		CSRendering::MeshSPtr mesh = CSCore::Application::Get()->GetResourcePool()->CreateResource<CSRendering::Mesh>("_BenchmarkSkinnedStrip");
+		mesh->Build(meshDesc);
+		mesh->SetLoadState(CSCore::Resource::LoadState::k_loaded);
+		return mesh;
+	}
+	//-----------------------------------------------------------
+	/// @return A looping animation which sways every bone of the
+	/// skinned mesh back and forth.
+	//-----------------------------------------------------------
+	CSRendering::SkinnedAnimationCSPtr CreateSwayAnimation()
+	{
+		CSRendering::SkinnedAnimationSPtr animation = CSCore::Application::Get()->GetResourcePool()->CreateResource<CSRendering::SkinnedAnimation>("_BenchmarkSway");
+		animation->SetFrameTime(k_animationFrameTime);
+
+		for (u32 frameIndex = 0; frameIndex < k_numAnimationFrames; ++frameIndex)
+		{
+			f32 angle = 0.2f * std::sin(2.0f * CSCore::MathUtils::k_pi * (f32)frameIndex / (f32)k_numAnimationFrames);
+
+			CSRendering::SkinnedAnimation::FrameUPtr frame(new CSRendering::SkinnedAnimation::Frame());
+			for (u32 bone = 0; bone < k_numBones; ++bone)
+			{
+				frame->m_nodeTranslations.push_back(CSCore::Vector3(0.0f, (bone == 0) ? 0.0f : k_boneLength, 0.0f));
+				frame->m_nodeOrientations.push_back(CSCore::Quaternion(CSCore::Vector3::k_unitPositiveZ, angle));
+				frame->m_nodeScales.push_back(CSCore::Vector3::k_one);
+			}
+			animation->AddFrame(std::move(frame));
+		}
+
+		animation->SetLoadState(CSCore::Resource::LoadState::k_loaded);
+		return animation;
+	}
+	//-----------------------------------------------------------
+	/// Builds the scene of animated characters.
+	//-----------------------------------------------------------
+	class AnimationState final : public CSCore::State
+	{
+	private:
+		//-----------------------------------------------------------
+		/// Creates the camera and characters.
+		//-----------------------------------------------------------
+		void OnInit() override
+		{
+			CSCore::ResourcePool* resourcePool = CSCore::Application::Get()->GetResourcePool();
+			CSRendering::RenderComponentFactory* renderFactory = CSCore::Application::Get()->GetSystem<CSRendering::RenderComponentFactory>();
+			CSRendering::MaterialFactory* materialFactory = CSCore::Application::Get()->GetSystem<CSRendering::MaterialFactory>();
+
+			CSRendering::TextureCSPtr texture = resourcePool->LoadResource<CSRendering::Texture>(CSCore::StorageLocation::k_chilliSource, "Textures/Blank.csimage");
+			CSRendering::MaterialCSPtr material = materialFactory->CreateAnimated("_BenchmarkAnimatedMaterial", texture);
+			CSRendering::MeshCSPtr mesh = CreateSkinnedMesh();
+			CSRendering::SkinnedAnimationCSPtr animation = CreateSwayAnimation();
+
+			u32 gridSize = (u32)std::ceil(std::sqrt((f32)k_numCharacters));
+			for (u32 i = 0; i < k_numCharacters; ++i)
+			{
+				CSRendering::AnimatedMeshComponentSPtr animatedMesh = renderFactory->CreateAnimatedMeshComponent(mesh, material);
+				animatedMesh->AttachAnimation(animation);
+				animatedMesh->SetPlaybackType(CSRendering::AnimationPlaybackType::k_looping);
+
+				CSCore::EntitySPtr entity = CSCore::Entity::Create();
+				entity->GetTransform().SetPosition((i % gridSize) * k_characterSpacing, 0.0f, (i / gridSize) * k_characterSpacing);
+				entity->AddComponent(animatedMesh);
+				GetScene()->Add(entity);
+
+				//the playback position is reset when added to the scene.
+				animatedMesh->SetPlaybackPositionNormalised((f32)i / (f32)k_numCharacters);
+			}
+
+			f32 gridExtent = gridSize * k_characterSpacing;
+			CSCore::EntitySPtr camera = CSCore::Entity::Create();
+			camera->AddComponent(renderFactory->CreatePerspectiveCameraComponent(CSCore::MathUtils::k_pi / 2.0f, 1.0f, gridExtent * 2.0f));
+			camera->GetTransform().SetLookAt(CSCore::Vector3(gridExtent * 0.5f, gridExtent * 0.5f, -gridExtent * 0.25f), CSCore::Vector3(gridExtent * 0.5f, 0.0f, gridExtent * 0.5f), CSCore::Vector3::k_unitPositiveY);
+			GetScene()->Add(camera);
+		}
+	};
+}
+
+//-----------------------------------------------------------
+//-----------------------------------------------------------
+CSCore::Application* CreateApplication()
+{
+	return new Benchmarks::BenchmarkApplication("Animation (" + CSCore::ToString(k_numCharacters) + " characters x " + CSCore::ToString(k_numBones) + " bones)", []() { return CSCore::StateSPtr(new AnimationState()); },
+		{"StateManager::UpdateStates", "AnimationUpdateSystem::ProcessQueuedUpdates", "Application::Update", "Application::Render"});
+}
@@ -0,0 +1,90 @@
+//
+//  BenchmarkApplication.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include "BenchmarkApplication.h"
+
+#include <ChilliSource/Core/Base/Device.h>
+#include <ChilliSource/Core/State/State.h>
+#include <ChilliSource/Core/State/StateManager.h>
+#include <ChilliSource/Core/String/ToString.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/Profiler.h>
+
+#include <iostream>
+
+namespace Benchmarks
+{
+	//-------------------------------------------------
+	//-------------------------------------------------
+	BenchmarkApplication::BenchmarkApplication(const std::string& in_name, const StateFactory& in_stateFactory, const std::vector<std::string>& in_markerNames)
+		: m_name(in_name), m_stateFactory(in_stateFactory), m_markerNames(in_markerNames)
+	{
+	}
+	//-------------------------------------------------
+	//-------------------------------------------------
+	void BenchmarkApplication::CreateSystems()
+	{
+	}
+	//-------------------------------------------------
+	//-------------------------------------------------
+	void BenchmarkApplication::OnInit()
+	{
+		const u32 numCores = GetSystem<CSCore::Device>()->GetNumberOfCPUCores();
+		const u32 numChunks = GetTaskScheduler()->GetMaxNumParallelChunks();
+		std::cout << "[Benchmark] " << m_name << " with " << numCores << " cores, up to " << numChunks << " parallel chunks" << std::endl;
+	}
+	//-------------------------------------------------
+	//-------------------------------------------------
+	void BenchmarkApplication::PushInitialState()
+	{
+		GetStateManager()->Push(m_stateFactory());
+	}
+	//-------------------------------------------------
+	//-------------------------------------------------
+	void BenchmarkApplication::OnDestroy()
+	{
+#ifdef CS_ENABLE_PROFILING
+		std::vector<CSCore::Profiler::MarkerStats> markerStats = CSCore::Profiler::Get()->GetMarkerStats();
+		for (const auto& markerName : m_markerNames)
+		{
+			for (const auto& stats : markerStats)
+			{
+				if (stats.m_name == markerName)
+				{
+					std::cout << "[Benchmark] " << markerName << ": average " << CSCore::ToString((f32)stats.m_averageMS) << "ms, min " << CSCore::ToString((f32)stats.m_minMS)
+						<< "ms, max " << CSCore::ToString((f32)stats.m_maxMS) << "ms" << std::endl;
+				}
+			}
+		}
+#else
+		if (m_markerNames.empty() == false)
+		{
+			std::cout << "[Benchmark] Build with CS_ENABLE_PROFILING for per stage timings." << std::endl;
+		}
+#endif
+	}
+}
@@ -0,0 +1,90 @@
+//
+//  BenchmarkApplication.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _BENCHMARKS_BENCHMARKAPPLICATION_H_
+#define _BENCHMARKS_BENCHMARKAPPLICATION_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/Application.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Benchmarks
+{
+	//---------------------------------------------------------
+	/// An application which runs a single benchmark state on
+	/// the headless Linux backend. The benchmark is run with
+	/// the main loop options, typically:
+	///
+	///	--frames 300 --timestep 0.016 --uncapped --cores <n>
+	///
+	/// The main loop reports the average frame time on exit.
+	/// If the engine was built with the profiler enabled, the
+	/// average time of each of the given markers over the last
+	/// frames is also reported, isolating the stage of the
+	/// frame being benchmarked.
+	//---------------------------------------------------------
+	class BenchmarkApplication final : public CSCore::Application
+	{
+	public:
+		using StateFactory = std::function<CSCore::StateSPtr()>;
+		//-------------------------------------------------
+		/// @param The name of the benchmark.
+		/// @param Creates the state which builds and runs
+		/// the benchmark scene.
+		/// @param The names of the profile markers to report.
+		//-------------------------------------------------
+		BenchmarkApplication(const std::string& in_name, const StateFactory& in_stateFactory, const std::vector<std::string>& in_markerNames);
+
+	private:
+		//-------------------------------------------------
+		/// No additional systems are needed.
+		//-------------------------------------------------
+		void CreateSystems() override;
+		//-------------------------------------------------
+		/// Reports the benchmark configuration.
+		//-------------------------------------------------
+		void OnInit() override;
+		//-------------------------------------------------
+		/// Pushes the benchmark state.
+		//-------------------------------------------------
+		void PushInitialState() override;
+		//-------------------------------------------------
+		/// Reports the profile marker timings, if the
+		/// profiler is enabled.
+		//-------------------------------------------------
+		void OnDestroy() override;
+
+		std::string m_name;
+		StateFactory m_stateFactory;
+		std::vector<std::string> m_markerNames;
+	};
+}
+
+#endif
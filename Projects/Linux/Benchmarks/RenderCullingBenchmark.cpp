@@ -0,0 +1,182 @@
+//
+//  RenderCullingBenchmark.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include "BenchmarkApplication.h"
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Math/MathUtils.h>
+#include <ChilliSource/Core/Resource/ResourcePool.h>
+#include <ChilliSource/Core/Scene/Scene.h>
+#include <ChilliSource/Core/State/State.h>
+#include <ChilliSource/Core/String/ToString.h>
+#include <ChilliSource/Rendering/Base/RenderComponentFactory.h>
+#include <ChilliSource/Rendering/Camera/PerspectiveCameraComponent.h>
+#include <ChilliSource/Rendering/Material/Material.h>
+#include <ChilliSource/Rendering/Material/MaterialFactory.h>
+#include <ChilliSource/Rendering/Model/Mesh.h>
+#include <ChilliSource/Rendering/Model/MeshDescriptor.h>
+#include <ChilliSource/Rendering/Model/StaticMeshComponent.h>
+#include <ChilliSource/Rendering/Texture/Texture.h>
+
+//-----------------------------------------------------------
+/// Measures how the renderer's culling and sort key
+/// generation scale with the number of cores, on a synthetic
+/// scene of static meshes spread around a rotating camera so
+/// that roughly a quarter of them are visible each frame.
+//-----------------------------------------------------------
+namespace
+{
+	const u32 k_numRenderables = 50000;
+	const u32 k_numMaterials = 16;
+	const f32 k_sceneExtent = 200.0f;
+	const f32 k_cameraRotationSpeed = 0.5f;
+
+	//-----------------------------------------------------------
+	/// @return A unit cube mesh with positions, normals and uvs.
+	//-----------------------------------------------------------
+	CSRendering::MeshCSPtr CreateCubeMesh()
+	{
+		struct Vertex
+		{
+			CSCore::Vector3 m_position;
+			CSCore::Vector3 m_normal;
+			CSCore::Vector2 m_uv;
+		};
+
+		const CSRendering::VertexElement elements[] =
+		{
+			{CSRendering::VertexDataType::k_float3, CSRendering::VertexDataSemantic::k_position},
+			{CSRendering::VertexDataType::k_float3, CSRendering::VertexDataSemantic::k_normal},
+			{CSRendering::VertexDataType::k_float2, CSRendering::VertexDataSemantic::k_uv}
+		};
+
+		Vertex vertices[8];
+		for (u32 i = 0; i < 8; ++i)
+		{
+			vertices[i].m_position = CSCore::Vector3((i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f);
+			vertices[i].m_normal = CSCore::Vector3::Normalise(vertices[i].m_position);
+			vertices[i].m_uv = CSCore::Vector2((i & 1) ? 1.0f : 0.0f, (i & 2) ? 1.0f : 0.0f);
+		}
+
+		u16 indices[] =
+		{
+			0, 2, 1, 1, 2, 3,
+			4, 5, 6, 5, 7, 6,
+			0, 1, 4, 1, 5, 4,
+			2, 6, 3, 3, 6, 7,
+			0, 4, 2, 2, 4, 6,
+			1, 3, 5, 3, 7, 5
+		};
+
+		CSRendering::SubMeshDescriptor subMeshDesc;
+		subMeshDesc.mstrName = "Cube";
+		subMeshDesc.mudwNumVertices = 8;
+		subMeshDesc.mudwNumIndices = 36;
+		subMeshDesc.mvMinBounds = CSCore::Vector3(-0.5f, -0.5f, -0.5f);
+		subMeshDesc.mvMaxBounds = CSCore::Vector3(0.5f, 0.5f, 0.5f);
+		subMeshDesc.mpVertexData = reinterpret_cast<u8*>(vertices);
+		subMeshDesc.mpIndexData = reinterpret_cast<u8*>(indices);
+		subMeshDesc.ePrimitiveType = CSRendering::PrimitiveType::k_tri;
+
+		CSRendering::MeshDescriptor meshDesc;
+		meshDesc.mMeshes.push_back(subMeshDesc);
+		meshDesc.mVertexDeclaration = CSRendering::VertexDeclaration(3, elements);
+		meshDesc.mvMinBounds = subMeshDesc.mvMinBounds;
+		meshDesc.mvMaxBounds = subMeshDesc.mvMaxBounds;
+		meshDesc.mudwIndexSize = sizeof(u16);
+
+		CSRendering::MeshSPtr mesh = CSCore::Application::Get()->GetResourcePool()->CreateResource<CSRendering::Mesh>("_BenchmarkCube");
+		mesh->Build(meshDesc);
+		mesh->SetLoadState(CSCore::Resource::LoadState::k_loaded);
+		return mesh;
+	}
+	//-----------------------------------------------------------
+	/// Builds the scene and rotates the camera each frame.
+	//-----------------------------------------------------------
+	class RenderCullingState final : public CSCore::State
+	{
+	private:
+		//-----------------------------------------------------------
+		/// Creates the camera and renderables.
+		//-----------------------------------------------------------
+		void OnInit() override
+		{
+			CSCore::ResourcePool* resourcePool = CSCore::Application::Get()->GetResourcePool();
+			CSRendering::RenderComponentFactory* renderFactory = CSCore::Application::Get()->GetSystem<CSRendering::RenderComponentFactory>();
+			CSRendering::MaterialFactory* materialFactory = CSCore::Application::Get()->GetSystem<CSRendering::MaterialFactory>();
+
+			CSRendering::TextureCSPtr texture = resourcePool->LoadResource<CSRendering::Texture>(CSCore::StorageLocation::k_chilliSource, "Textures/Blank.csimage");
+			std::vector<CSRendering::MaterialCSPtr> materials;
+			for (u32 i = 0; i < k_numMaterials; ++i)
+			{
+				materials.push_back(materialFactory->CreateStatic("_BenchmarkMaterial" + CSCore::ToString(i), texture));
+			}
+
+			CSRendering::MeshCSPtr mesh = CreateCubeMesh();
+
+			//A fixed seed keeps the scene the same between runs.
+			u32 seed = 12345;
+			auto nextRandom = [&seed]() -> f32
+			{
+				seed = seed * 1664525 + 1013904223;
+				return (f32)(seed >> 8) / (f32)(1 << 24);
+			};
+
+			for (u32 i = 0; i < k_numRenderables; ++i)
+			{
+				CSCore::EntitySPtr entity = CSCore::Entity::Create();
+				entity->GetTransform().SetPosition((nextRandom() - 0.5f) * k_sceneExtent, (nextRandom() - 0.5f) * k_sceneExtent * 0.1f, (nextRandom() - 0.5f) * k_sceneExtent);
+				entity->AddComponent(renderFactory->CreateStaticMeshComponent(mesh, materials[i % k_numMaterials]));
+				GetScene()->Add(entity);
+			}
+
+			m_camera = CSCore::Entity::Create();
+			m_camera->AddComponent(renderFactory->CreatePerspectiveCameraComponent(CSCore::MathUtils::k_pi / 2.0f, 1.0f, k_sceneExtent));
+			GetScene()->Add(m_camera);
+		}
+		//-----------------------------------------------------------
+		/// Rotates the camera so the visible set changes.
+		///
+		/// @param The time since the last update.
+		//-----------------------------------------------------------
+		void OnUpdate(f32 in_deltaTime) override
+		{
+			m_camera->GetTransform().RotateBy(CSCore::Vector3::k_unitPositiveY, k_cameraRotationSpeed * in_deltaTime);
+		}
+
+		CSCore::EntitySPtr m_camera;
+	};
+}
+
+//-----------------------------------------------------------
+//-----------------------------------------------------------
+CSCore::Application* CreateApplication()
+{
+	return new Benchmarks::BenchmarkApplication("RenderCulling", []() { return CSCore::StateSPtr(new RenderCullingState()); },
+		{"Renderer::UpdateWorldTransforms", "Renderer::Cull", "Renderer::OpaquePass", "Application::Render"});
+}
@@ -0,0 +1,52 @@
+#!/bin/sh
+#
+#  RunBenchmarks.sh
+#  Chilli Source
+#
+#  The MIT License (MIT)
+#
+#  Copyright (c) 2026 Tag Games Limited
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a copy
+#  of this software and associated documentation files (the "Software"), to deal
+#  in the Software without restriction, including without limitation the rights
+#  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#  copies of the Software, and to permit persons to whom the Software is
+#  furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included in
+#  all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+#  THE SOFTWARE.
+#
+
+#Runs a benchmark once for each core count from 1 up to the number of cores on the machine.
+#Each run is pinned to that many cores with taskset, where available, as well as sizing the
+#thread pool with --cores.
+#
+#Usage: RunBenchmarks.sh <benchmark executable> [frames]
+
+if [ $# -lt 1 ]; then
+    echo "Usage: $0 <benchmark executable> [frames]"
+    exit 1
+fi
+
+BENCHMARK="$1"
+FRAMES="${2:-300}"
+MAX_CORES=$(nproc)
+
+for CORES in $(seq 1 "$MAX_CORES"); do
+    if command -v taskset > /dev/null; then
+        PIN="taskset -c 0-$((CORES - 1))"
+    else
+        PIN=""
+    fi
+
+    $PIN "$BENCHMARK" --frames "$FRAMES" --timestep 0.016 --uncapped --cores "$CORES" 2>&1 | grep -E "^\[Benchmark\]|Ran [0-9]+ frames"
+done
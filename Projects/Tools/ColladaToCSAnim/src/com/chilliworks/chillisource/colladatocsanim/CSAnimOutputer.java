@@ -28,8 +28,10 @@
 
 package com.chilliworks.chillisource.colladatocsanim;
 
+import java.io.ByteArrayOutputStream;
 import java.io.DataOutputStream;
 import java.io.FileOutputStream;
+import java.util.ArrayList;
 
 import com.chilliworks.chillisource.colladatocsanim.csanim.*;
 import com.chilliworks.chillisource.coreutils.LittleEndianWriterUtils;
@@ -44,6 +46,11 @@ public class CSAnimOutputer
 	 */
 	private static final int ENDIANESS_CHECK_VALUE = 7777;
 	private static final int VERSION_NUMBER = 4;
+	private static final int COMPRESSED_VERSION_NUMBER = 5;
+	private static final int TRACK_HEADER_SIZE = 8;
+	private static final double TRANSLATION_TOLERANCE = 0.0001;
+	private static final double ORIENTATION_TOLERANCE = 0.0005;
+	private static final double SCALE_TOLERANCE = 0.0001;
 	
 	/**
 	 * Private Data
@@ -111,7 +118,7 @@ public class CSAnimOutputer
 	{
 		//write endianness check and version number
 		LittleEndianWriterUtils.writeUInt32(mStream, ENDIANESS_CHECK_VALUE);
-		LittleEndianWriterUtils.writeUInt32(mStream, VERSION_NUMBER);
+		LittleEndianWriterUtils.writeUInt32(mStream, (inConversionParams.m_compress == true) ? COMPRESSED_VERSION_NUMBER : VERSION_NUMBER);
 		
 		//declare that there are no features
 		mStream.writeByte((byte)0);
@@ -134,6 +141,11 @@ public class CSAnimOutputer
 	 */
 	public boolean WriteBody(ColladaToCSAnimOptions inConversionParams, CSAnim inAnim) throws Exception
 	{
+		if (inConversionParams.m_compress == true)
+		{
+			return WriteCompressedBody(inAnim);
+		}
+		
 		//loop through each joint in each frame
 		for (int i = 0; i < inAnim.mFrames.size(); i++)
 		{
@@ -163,4 +175,65 @@ public class CSAnimOutputer
 		return true;
 	}
 	
+	/**
+	 * Writes the compressed MoAnim body. This is the size of the track data
+	 * followed by the track data itself: a header for the translation,
+	 * orientation and scale track of each joint in turn, followed by the
+	 * keys for each track.
+	 * 
+	 * @param inAnim
+	 * @return
+	 */
+	public boolean WriteCompressedBody(CSAnim inAnim) throws Exception
+	{
+		int numFrames = inAnim.mFrames.size();
+		int numJoints = inAnim.mSkeleton.mNodeList.size();
+		
+		ArrayList<CSAnimTrackCompressor.Track> tracks = new ArrayList<CSAnimTrackCompressor.Track>();
+		for (int j = 0; j < numJoints; j++)
+		{
+			double[][] translations = new double[numFrames][];
+			double[][] orientations = new double[numFrames][];
+			double[][] scales = new double[numFrames][];
+			
+			int i = 0;
+			for (CSAnimFrame frame : inAnim.mFrames)
+			{
+				Vector3 translation = frame.mNodeTranslations.get(j);
+				Quaternion orientation = frame.mNodeOrienations.get(j);
+				Vector3 scale = frame.mNodeScalings.get(j);
+				
+				translations[i] = new double[] { translation.getX(), translation.getY(), translation.getZ() };
+				orientations[i] = new double[] { orientation.getX(), orientation.getY(), orientation.getZ(), orientation.getW() };
+				scales[i] = new double[] { scale.getX(), scale.getY(), scale.getZ() };
+				i++;
+			}
+			
+			tracks.add(CSAnimTrackCompressor.buildVectorTrack(translations, TRANSLATION_TOLERANCE));
+			tracks.add(CSAnimTrackCompressor.buildOrientationTrack(orientations, ORIENTATION_TOLERANCE));
+			tracks.add(CSAnimTrackCompressor.buildVectorTrack(scales, SCALE_TOLERANCE));
+		}
+		
+		//build the track data, starting with the headers
+		ByteArrayOutputStream trackData = new ByteArrayOutputStream();
+		long dataOffset = tracks.size() * TRACK_HEADER_SIZE;
+		for (CSAnimTrackCompressor.Track track : tracks)
+		{
+			LittleEndianWriterUtils.writeUInt16(trackData, track.m_numKeys);
+			LittleEndianWriterUtils.writeUInt16(trackData, 0);
+			LittleEndianWriterUtils.writeUInt32(trackData, dataOffset);
+			dataOffset += track.m_data.length;
+		}
+		for (CSAnimTrackCompressor.Track track : tracks)
+		{
+			trackData.write(track.m_data);
+		}
+		
+		LittleEndianWriterUtils.writeUInt32(mStream, trackData.size());
+		trackData.writeTo(mStream);
+		
+		Logging.logVerbose(" Compressed track data: " + trackData.size() + " bytes");
+		
+		return true;
+	}
 }
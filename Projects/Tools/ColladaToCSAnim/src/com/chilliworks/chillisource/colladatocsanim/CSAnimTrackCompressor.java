@@ -0,0 +1,404 @@
+/**
+ * CSAnimTrackCompressor.java
+ * Chilli Source
+ * 
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2026 Tag Games Limited
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+package com.chilliworks.chillisource.colladatocsanim;
+
+import java.io.ByteArrayOutputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.util.ArrayList;
+
+import com.chilliworks.chillisource.coreutils.LittleEndianWriterUtils;
+
+/**
+ * Builds the compressed tracks written to version 5 CSAnim files. Each track
+ * is reduced to the fewest keys which reproduce every frame within a tolerance
+ * when interpolated, and tracks which don't change are stored as a single
+ * constant key. Orientations are packed as 48-bit smallest-three quaternions
+ * and animated translations and scales are quantised to 16-bits per component
+ * over the range of the track.
+ * 
+ * The layout must match CompressedAnimationData in the engine.
+ */
+public final class CSAnimTrackCompressor 
+{
+	private static final double SMALLEST_THREE_RANGE = 1.0 / Math.sqrt(2.0);
+	private static final int SMALLEST_THREE_MAX_VALUE = 32767;
+	private static final int VECTOR_MAX_VALUE = 65535;
+	private static final double NLERP_THRESHOLD = 0.9999;
+	
+	/**
+	 * A single compressed track.
+	 */
+	public static final class Track
+	{
+		public int m_numKeys = 0;
+		public byte[] m_data = null;
+	}
+	
+	/**
+	 * Builds a compressed translation or scale track.
+	 * 
+	 * @param in_values - The x, y and z of the vector in each frame.
+	 * @param in_tolerance - The maximum error allowed in any component.
+	 * 
+	 * @return The compressed track.
+	 */
+	public static Track buildVectorTrack(double[][] in_values, double in_tolerance) throws IOException
+	{
+		ArrayList<Integer> keys = reduceKeys(in_values, false, in_tolerance);
+		
+		ByteArrayOutputStream byteStream = new ByteArrayOutputStream();
+		DataOutputStream stream = new DataOutputStream(byteStream);
+		
+		if (keys.size() == 1)
+		{
+			for (int i = 0; i < 3; ++i)
+			{
+				LittleEndianWriterUtils.writeFloat32(stream, (float)in_values[0][i]);
+			}
+		}
+		else
+		{
+			double[] min = new double[] { Double.MAX_VALUE, Double.MAX_VALUE, Double.MAX_VALUE };
+			double[] max = new double[] { -Double.MAX_VALUE, -Double.MAX_VALUE, -Double.MAX_VALUE };
+			for (int key : keys)
+			{
+				for (int i = 0; i < 3; ++i)
+				{
+					min[i] = Math.min(min[i], in_values[key][i]);
+					max[i] = Math.max(max[i], in_values[key][i]);
+				}
+			}
+			
+			for (int i = 0; i < 3; ++i)
+			{
+				LittleEndianWriterUtils.writeFloat32(stream, (float)min[i]);
+			}
+			for (int i = 0; i < 3; ++i)
+			{
+				LittleEndianWriterUtils.writeFloat32(stream, (float)(max[i] - min[i]));
+			}
+			
+			writeKeyFrames(stream, keys);
+			
+			for (int key : keys)
+			{
+				for (int i = 0; i < 3; ++i)
+				{
+					double extent = max[i] - min[i];
+					int quantised = (extent > 0.0) ? (int)Math.round((in_values[key][i] - min[i]) / extent * VECTOR_MAX_VALUE) : 0;
+					LittleEndianWriterUtils.writeUInt16(stream, Math.min(Math.max(quantised, 0), VECTOR_MAX_VALUE));
+				}
+			}
+		}
+		
+		return createTrack(keys.size(), byteStream);
+	}
+	
+	/**
+	 * Builds a compressed orientation track.
+	 * 
+	 * @param in_values - The x, y, z and w of the orientation in each frame.
+	 * These are normalised and made continuous in place.
+	 * @param in_tolerance - The maximum error allowed in radians.
+	 * 
+	 * @return The compressed track.
+	 */
+	public static Track buildOrientationTrack(double[][] in_values, double in_tolerance) throws IOException
+	{
+		//normalise and ensure each frame takes the shortest path from the last so keys interpolate as expected.
+		for (int frame = 0; frame < in_values.length; ++frame)
+		{
+			double length = Math.sqrt(dot(in_values[frame], in_values[frame]));
+			double sign = (frame > 0 && dot(in_values[frame], in_values[frame - 1]) < 0.0) ? -1.0 : 1.0;
+			for (int i = 0; i < 4; ++i)
+			{
+				in_values[frame][i] *= sign / length;
+			}
+		}
+		
+		ArrayList<Integer> keys = reduceKeys(in_values, true, in_tolerance);
+		
+		ByteArrayOutputStream byteStream = new ByteArrayOutputStream();
+		DataOutputStream stream = new DataOutputStream(byteStream);
+		
+		if (keys.size() > 1)
+		{
+			writeKeyFrames(stream, keys);
+		}
+		
+		for (int key : keys)
+		{
+			for (int packed : packOrientation(in_values[key]))
+			{
+				LittleEndianWriterUtils.writeUInt16(stream, packed);
+			}
+		}
+		
+		return createTrack(keys.size(), byteStream);
+	}
+	
+	/**
+	 * Finds the fewest frames which need to be kept as keys so that every frame
+	 * can be rebuilt by interpolating between the keys either side of it. If
+	 * every frame is the same only the first is kept.
+	 * 
+	 * @param in_values - The value of the track in each frame.
+	 * @param in_isOrientation - Whether the values are orientations.
+	 * @param in_tolerance - The maximum error allowed.
+	 * 
+	 * @return The frame index of each key.
+	 */
+	private static ArrayList<Integer> reduceKeys(double[][] in_values, boolean in_isOrientation, double in_tolerance)
+	{
+		ArrayList<Integer> keys = new ArrayList<Integer>();
+		keys.add(0);
+		
+		boolean isConstant = true;
+		for (int frame = 1; frame < in_values.length && isConstant == true; ++frame)
+		{
+			isConstant = (calcError(in_values[0], in_values[frame], in_isOrientation) <= in_tolerance);
+		}
+		
+		if (isConstant == true)
+		{
+			return keys;
+		}
+		
+		int startFrame = 0;
+		while (startFrame < in_values.length - 1)
+		{
+			int endFrame = startFrame + 1;
+			while (endFrame + 1 < in_values.length && canInterpolate(in_values, startFrame, endFrame + 1, in_isOrientation, in_tolerance) == true)
+			{
+				++endFrame;
+			}
+			
+			keys.add(endFrame);
+			startFrame = endFrame;
+		}
+		
+		return keys;
+	}
+	
+	/**
+	 * @param in_values - The value of the track in each frame.
+	 * @param in_startFrame - The frame to interpolate from.
+	 * @param in_endFrame - The frame to interpolate to.
+	 * @param in_isOrientation - Whether the values are orientations.
+	 * @param in_tolerance - The maximum error allowed.
+	 * 
+	 * @return Whether every frame between the two given frames can be rebuilt
+	 * within the tolerance by interpolating between them.
+	 */
+	private static boolean canInterpolate(double[][] in_values, int in_startFrame, int in_endFrame, boolean in_isOrientation, double in_tolerance)
+	{
+		for (int frame = in_startFrame + 1; frame < in_endFrame; ++frame)
+		{
+			double t = (double)(frame - in_startFrame) / (double)(in_endFrame - in_startFrame);
+			double[] interpolated = (in_isOrientation == true) ? slerp(in_values[in_startFrame], in_values[in_endFrame], t) : lerp(in_values[in_startFrame], in_values[in_endFrame], t);
+			
+			if (calcError(interpolated, in_values[frame], in_isOrientation) > in_tolerance)
+			{
+				return false;
+			}
+		}
+		
+		return true;
+	}
+	
+	/**
+	 * @param in_a - The first value.
+	 * @param in_b - The second value.
+	 * @param in_isOrientation - Whether the values are orientations.
+	 * 
+	 * @return The angle between two orientations in radians, or the largest
+	 * difference in any component of two vectors.
+	 */
+	private static double calcError(double[] in_a, double[] in_b, boolean in_isOrientation)
+	{
+		if (in_isOrientation == true)
+		{
+			return 2.0 * Math.acos(Math.min(Math.abs(dot(in_a, in_b)), 1.0));
+		}
+		
+		double error = 0.0;
+		for (int i = 0; i < in_a.length; ++i)
+		{
+			error = Math.max(error, Math.abs(in_a[i] - in_b[i]));
+		}
+		return error;
+	}
+	
+	/**
+	 * @param in_a - The value to interpolate from.
+	 * @param in_b - The value to interpolate to.
+	 * @param in_t - The interpolation factor.
+	 * 
+	 * @return The linearly interpolated value.
+	 */
+	private static double[] lerp(double[] in_a, double[] in_b, double in_t)
+	{
+		double[] output = new double[in_a.length];
+		for (int i = 0; i < in_a.length; ++i)
+		{
+			output[i] = in_a[i] + (in_b[i] - in_a[i]) * in_t;
+		}
+		return output;
+	}
+	
+	/**
+	 * Spherically interpolates between two unit quaternions along the
+	 * shortest path, matching the interpolation performed by the engine.
+	 * 
+	 * @param in_a - The orientation to interpolate from.
+	 * @param in_b - The orientation to interpolate to.
+	 * @param in_t - The interpolation factor.
+	 * 
+	 * @return The interpolated orientation.
+	 */
+	private static double[] slerp(double[] in_a, double[] in_b, double in_t)
+	{
+		double cosTheta = dot(in_a, in_b);
+		double sign = (cosTheta < 0.0) ? -1.0 : 1.0;
+		cosTheta *= sign;
+		
+		double weightA = 1.0 - in_t;
+		double weightB = in_t;
+		if (cosTheta < NLERP_THRESHOLD)
+		{
+			double theta = Math.acos(cosTheta);
+			double sinTheta = Math.sin(theta);
+			weightA = Math.sin(weightA * theta) / sinTheta;
+			weightB = Math.sin(weightB * theta) / sinTheta;
+		}
+		
+		double[] output = new double[4];
+		for (int i = 0; i < 4; ++i)
+		{
+			output[i] = in_a[i] * weightA + in_b[i] * weightB * sign;
+		}
+		
+		double length = Math.sqrt(dot(output, output));
+		for (int i = 0; i < 4; ++i)
+		{
+			output[i] /= length;
+		}
+		return output;
+	}
+	
+	/**
+	 * Packs a unit quaternion using the smallest-three encoding. The largest
+	 * component is dropped, after flipping the sign of the quaternion so that
+	 * it is positive, and the other three are quantised to 15-bits. The index
+	 * of the dropped component is stored in the top bit of the first two
+	 * values.
+	 * 
+	 * @param in_orientation - The x, y, z and w of the orientation.
+	 * 
+	 * @return The three packed 16-bit values.
+	 */
+	private static int[] packOrientation(double[] in_orientation)
+	{
+		int largestIndex = 0;
+		for (int i = 1; i < 4; ++i)
+		{
+			if (Math.abs(in_orientation[i]) > Math.abs(in_orientation[largestIndex]))
+			{
+				largestIndex = i;
+			}
+		}
+		double sign = (in_orientation[largestIndex] < 0.0) ? -1.0 : 1.0;
+		
+		int[] packed = new int[3];
+		int packedIndex = 0;
+		for (int i = 0; i < 4; ++i)
+		{
+			if (i != largestIndex)
+			{
+				double normalised = (in_orientation[i] * sign / SMALLEST_THREE_RANGE + 1.0) * 0.5;
+				int quantised = (int)Math.round(normalised * SMALLEST_THREE_MAX_VALUE);
+				packed[packedIndex++] = Math.min(Math.max(quantised, 0), SMALLEST_THREE_MAX_VALUE);
+			}
+		}
+		
+		packed[0] |= (largestIndex >> 1) << 15;
+		packed[1] |= (largestIndex & 1) << 15;
+		return packed;
+	}
+	
+	/**
+	 * @param in_stream - The stream to write to.
+	 * @param in_keys - The frame index of each key.
+	 */
+	private static void writeKeyFrames(DataOutputStream in_stream, ArrayList<Integer> in_keys) throws IOException
+	{
+		for (int key : in_keys)
+		{
+			LittleEndianWriterUtils.writeUInt16(in_stream, key);
+		}
+	}
+	
+	/**
+	 * Creates a track from the written data, padding it to a multiple of 4
+	 * bytes so the following track is aligned.
+	 * 
+	 * @param in_numKeys - The number of keys in the track.
+	 * @param in_byteStream - The written track data.
+	 * 
+	 * @return The track.
+	 */
+	private static Track createTrack(int in_numKeys, ByteArrayOutputStream in_byteStream)
+	{
+		while (in_byteStream.size() % 4 != 0)
+		{
+			in_byteStream.write(0);
+		}
+		
+		Track track = new Track();
+		track.m_numKeys = in_numKeys;
+		track.m_data = in_byteStream.toByteArray();
+		return track;
+	}
+	
+	/**
+	 * @param in_a - The first value.
+	 * @param in_b - The second value.
+	 * 
+	 * @return The dot product of the two values.
+	 */
+	private static double dot(double[] in_a, double[] in_b)
+	{
+		double output = 0.0;
+		for (int i = 0; i < in_a.length; ++i)
+		{
+			output += in_a[i] * in_b[i];
+		}
+		return output;
+	}
+}
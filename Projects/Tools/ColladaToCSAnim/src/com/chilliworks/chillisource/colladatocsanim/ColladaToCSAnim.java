@@ -147,6 +147,7 @@ public final class ColladaToCSAnim
 		Logging.logVerbose(" Transforms");
 		Logging.logVerbose("  Swap Handedness: " + Boolean.toString(in_options.m_swapHandedness));
 		Logging.logVerbose("  Swap Y and Z: " + Boolean.toString(in_options.m_swapYAndZ));
+		Logging.logVerbose("  Compressed: " + Boolean.toString(in_options.m_compress));
 		Logging.logVerbose(" ");
 	}
 }
@@ -39,4 +39,5 @@ public final class ColladaToCSAnimOptions
 	public String m_outputFilePath = new String();
 	public boolean m_swapHandedness = false;
 	public boolean m_swapYAndZ = false;
+	public boolean m_compress = false;
 }
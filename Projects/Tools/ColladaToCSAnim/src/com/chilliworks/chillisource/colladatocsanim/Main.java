@@ -43,11 +43,13 @@ public final class Main
 	private static final String k_paramNameOutput = "--output";
 	private static final String k_paramNameSwapHandedness = "--swaphandedness";
 	private static final String k_paramNameSwapYAndZ = "--swapyandz";
+	private static final String k_paramNameCompress = "--compress";
 	private static final String k_paramNameHelp = "--help";
 	private static final String k_shortParamNameInput = "-i";
 	private static final String k_shortParamNameOutput = "-o";
 	private static final String k_shortParamNameSwapHandedness = "-sh";
 	private static final String k_shortParamNameSwapYAndZ = "-sy";
+	private static final String k_shortParamNameCompress = "-c";
 	private static final String k_shortParamNameHelp = "-h";
 
 	/**
@@ -105,6 +107,12 @@ public final class Main
 				params.m_swapYAndZ = true;
 			}
 			
+			//compress
+			else if (arguments[i].equalsIgnoreCase(k_paramNameCompress) == true || arguments[i].equalsIgnoreCase(k_shortParamNameCompress) == true)
+			{
+				params.m_compress = true;
+			}
+			
 			//help
 			else if (arguments[i].equalsIgnoreCase(k_paramNameHelp) == true || arguments[i].equalsIgnoreCase(k_shortParamNameHelp) == true)
 			{
@@ -137,12 +145,13 @@ public final class Main
 	public static void printHelpText()
 	{
 		Logging.setLoggingLevel(LoggingLevel.VERBOSE);
-		Logging.logVerbose("Usage: java -jar ColladaToCSAnim.jar " + k_paramNameInput + " <file path> " + k_paramNameOutput + " <file path> [" + k_paramNameSwapHandedness + "] [" + k_paramNameSwapYAndZ + "] [" + k_paramNameHelp + "] [" + Logging.PARAM_LOGGING_LEVEL + " <level>]");
+		Logging.logVerbose("Usage: java -jar ColladaToCSAnim.jar " + k_paramNameInput + " <file path> " + k_paramNameOutput + " <file path> [" + k_paramNameSwapHandedness + "] [" + k_paramNameSwapYAndZ + "] [" + k_paramNameCompress + "] [" + k_paramNameHelp + "] [" + Logging.PARAM_LOGGING_LEVEL + " <level>]");
 		Logging.logVerbose("Parameters:");
 		Logging.logVerbose(" " + k_paramNameInput + "(" + k_shortParamNameInput + "): The input filename.");
 		Logging.logVerbose(" " + k_paramNameOutput + "(" + k_shortParamNameOutput + "): The output filename.");
 		Logging.logVerbose(" " + k_paramNameSwapHandedness + "(" + k_shortParamNameSwapHandedness + "): [Optional] Swaps the handedness of the output coordinate system.");
 		Logging.logVerbose(" " + k_paramNameSwapYAndZ + "(" + k_shortParamNameSwapYAndZ + "): [Optional] Swaps the Y and Z of the output coordinate system.");
+		Logging.logVerbose(" " + k_paramNameCompress + "(" + k_shortParamNameCompress + "): [Optional] Outputs the compressed version 5 format, which requires a newer version of the engine.");
 		Logging.logVerbose(" " + Logging.PARAM_LOGGING_LEVEL + "(" + Logging.SHORT_PARAM_LOGGING_LEVEL + "): [Optional] The level of messages to log.");
 		Logging.logVerbose(" " + k_paramNameHelp + "(" + k_shortParamNameHelp + "): [Optional] Display this help message.");
 		Logging.logVerbose("Logging Levels:");
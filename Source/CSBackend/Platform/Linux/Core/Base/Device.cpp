@@ -0,0 +1,206 @@
+//
+//  Device.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#include <CSBackend/Platform/Linux/Core/Base/Device.h>
+
+#include <CSBackend/Platform/Linux/Core/Base/MainLoop.h>
+#include <ChilliSource/Core/String/StringUtils.h>
+
+#include <cstdlib>
+#include <fstream>
+
+#include <sys/utsname.h>
+#include <unistd.h>
+
+namespace CSBackend
+{
+	namespace Linux
+	{
+		namespace
+		{
+			const std::string k_defaultLocale = "en_US";
+			const std::string k_defaultLanguage = "en";
+			const std::string k_machineIdPath = "/etc/machine-id";
+
+			//----------------------------------------------
+			/// @return The current locale, read from the
+			/// environment with any encoding or modifier
+			/// removed.
+			//----------------------------------------------
+			std::string GetLocale()
+			{
+				const char* environmentVariables[] = { "LC_ALL", "LC_MESSAGES", "LANG" };
+				for (const char* environmentVariable : environmentVariables)
+				{
+					const char* value = getenv(environmentVariable);
+					if (value != nullptr && value[0] != '\0')
+					{
+						std::string locale(value);
+						locale = locale.substr(0, locale.find_first_of(".@"));
+
+						//The C and POSIX locales carry no language information.
+						if (locale.empty() == false && locale != "C" && locale != "POSIX")
+						{
+							return locale;
+						}
+					}
+				}
+
+				return k_defaultLocale;
+			}
+			//----------------------------------------------------
+			/// Returns the language portion of a locale code.
+			///
+			/// @param The locale code.
+			///
+			/// @return The language code.
+			//----------------------------------------------------
+			std::string ParseLanguageFromLocale(const std::string& in_locale)
+			{
+				std::vector<std::string> strLocaleBrokenUp = CSCore::StringUtils::Split(in_locale, "_", 0);
+
+				if (strLocaleBrokenUp.size() > 0)
+				{
+					return strLocaleBrokenUp[0];
+				}
+				else
+				{
+					return k_defaultLanguage;
+				}
+			}
+			//----------------------------------------------
+			/// @return The machine id, or an empty string if
+			/// it could not be read.
+			//----------------------------------------------
+			std::string GetUDID()
+			{
+				std::ifstream file(k_machineIdPath);
+				std::string udid;
+				if (file.good() == true)
+				{
+					std::getline(file, udid);
+				}
+
+				if (udid.empty() == true)
+				{
+					CS_LOG_ERROR("Could not read the machine id from " + k_machineIdPath);
+				}
+
+				return udid;
+			}
+			//----------------------------------------------
+			/// @return The number of cores.
+			//----------------------------------------------
+			u32 GetNumberOfCPUCores()
+			{
+				long numCores = sysconf(_SC_NPROCESSORS_ONLN);
+				return (numCores > 0) ? (u32)numCores : 1;
+			}
+		}
+
+		CS_DEFINE_NAMEDTYPE(Device);
+		//----------------------------------------------------
+		//----------------------------------------------------
+		Device::Device()
+			: m_model("Linux"), m_modelType("PC"), m_manufacturer("Unknown"), m_locale(k_defaultLocale), m_language(k_defaultLanguage)
+		{
+			utsname systemName;
+			if (uname(&systemName) == 0)
+			{
+				m_modelType = systemName.machine;
+				m_osVersion = systemName.release;
+			}
+
+			m_locale = CSBackend::Linux::GetLocale();
+			m_language = CSBackend::Linux::ParseLanguageFromLocale(m_locale);
+			m_udid = CSBackend::Linux::GetUDID();
+			m_numCPUCores = MainLoop::Get()->GetNumCPUCores();
+			if (m_numCPUCores == 0)
+			{
+				m_numCPUCores = CSBackend::Linux::GetNumberOfCPUCores();
+			}
+		}
+		//-------------------------------------------------------
+		//-------------------------------------------------------
+		bool Device::IsA(CSCore::InterfaceIDType in_interfaceId) const
+		{
+			return (CSCore::Device::InterfaceID == in_interfaceId || Device::InterfaceID == in_interfaceId);
+		}
+		//---------------------------------------------------
+		//---------------------------------------------------
+		const std::string& Device::GetModel() const
+		{
+			return m_model;
+		}
+		//---------------------------------------------------
+		//---------------------------------------------------
+		const std::string& Device::GetModelType() const
+		{
+			return m_modelType;
+		}
+		//---------------------------------------------------
+		//---------------------------------------------------
+		const std::string& Device::GetManufacturer() const
+		{
+			return m_manufacturer;
+		}
+		//---------------------------------------------------
+		//---------------------------------------------------
+		const std::string& Device::GetLocale() const
+		{
+			return m_locale;
+		}
+		//---------------------------------------------------
+		//---------------------------------------------------
+		const std::string& Device::GetLanguage() const
+		{
+			return m_language;
+		}
+		//---------------------------------------------------
+		//---------------------------------------------------
+		const std::string& Device::GetOSVersion() const
+		{
+			return m_osVersion;
+		}
+		//---------------------------------------------------
+		//---------------------------------------------------
+		const std::string& Device::GetUDID() const
+		{
+			return m_udid;
+		}
+		//---------------------------------------------------
+		//---------------------------------------------------
+		u32 Device::GetNumberOfCPUCores() const
+		{
+			return m_numCPUCores;
+		}
+	}
+}
+
+#endif
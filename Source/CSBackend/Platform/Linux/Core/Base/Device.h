@@ -0,0 +1,111 @@
+//
+//  Device.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#ifndef _CSBACKEND_PLATFORM_LINUX_CORE_BASE_DEVICE_H_
+#define _CSBACKEND_PLATFORM_LINUX_CORE_BASE_DEVICE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Platform/Linux/ForwardDeclarations.h>
+#include <ChilliSource/Core/Base/Device.h>
+
+namespace CSBackend
+{
+	namespace Linux
+	{
+		//---------------------------------------------------------
+		/// The Linux backend for the device system. This provides
+		/// information on the machine the application is running
+		/// on.
+		//---------------------------------------------------------
+		class Device final : public CSCore::Device
+		{
+		public:
+			CS_DECLARE_NAMEDTYPE(Device);
+			//-------------------------------------------------------
+			/// @param The interface Id.
+			///
+			/// @return Whether system is of given type.
+			//-------------------------------------------------------
+			bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+			//---------------------------------------------------
+			/// @return The device model name.
+			//---------------------------------------------------
+			const std::string& GetModel() const override;
+			//---------------------------------------------------
+			/// @return The machine architecture.
+			//---------------------------------------------------
+			const std::string& GetModelType() const override;
+			//---------------------------------------------------
+			/// @return The name of the device manufacturer.
+			//---------------------------------------------------
+			const std::string& GetManufacturer() const override;
+			//---------------------------------------------------
+			/// @return The locale code registered with the
+			/// environment.
+			//---------------------------------------------------
+			const std::string& GetLocale() const override;
+			//---------------------------------------------------
+			/// @return The language portion of the locale code.
+			//---------------------------------------------------
+			const std::string& GetLanguage() const override;
+			//---------------------------------------------------
+			/// @return The kernel release.
+			//---------------------------------------------------
+			const std::string& GetOSVersion() const override;
+			//---------------------------------------------------
+			/// @return The machine id.
+			//---------------------------------------------------
+			const std::string& GetUDID() const override;
+			//---------------------------------------------------
+			/// @return The number of online CPU cores.
+			//--------------------------------------------------
+			u32 GetNumberOfCPUCores() const override;
+		private:
+			friend CSCore::DeviceUPtr CSCore::Device::Create();
+			//----------------------------------------------------
+			/// Private constructor to enforce use of the factory
+			/// method.
+			//----------------------------------------------------
+			Device();
+
+			std::string m_model;
+			std::string m_modelType;
+			std::string m_manufacturer;
+			std::string m_udid;
+			std::string m_locale;
+			std::string m_language;
+			std::string m_osVersion;
+			u32 m_numCPUCores;
+		};
+	}
+}
+
+#endif
+
+#endif
@@ -0,0 +1,204 @@
+//
+//  MainLoop.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#include <CSBackend/Platform/Linux/Core/Base/MainLoop.h>
+
+#include <ChilliSource/Core/Base/AppConfig.h>
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/String/ToString.h>
+#include <ChilliSource/Rendering/Base/RenderSystem.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+namespace CSBackend
+{
+	namespace Linux
+	{
+		namespace
+		{
+			using Clock = std::chrono::steady_clock;
+
+			//-------------------------------------------------
+			/// @param The start time point.
+			/// @param The end time point.
+			///
+			/// @return The seconds between the two time points.
+			//-------------------------------------------------
+			f64 GetSecondsBetween(const Clock::time_point& in_start, const Clock::time_point& in_end)
+			{
+				return std::chrono::duration_cast<std::chrono::duration<f64>>(in_end - in_start).count();
+			}
+			//-------------------------------------------------
+			/// Adds the counts reported in the run summary from
+			/// the second set of render stats to the first.
+			///
+			/// @param [Out] The stats to add to.
+			/// @param The stats to add.
+			//-------------------------------------------------
+			void AccumulateRenderStats(CSRendering::RenderStats::FrameStats& out_total, const CSRendering::RenderStats::FrameStats& in_stats)
+			{
+				out_total.m_numDrawCalls += in_stats.m_numDrawCalls;
+				out_total.m_numVerticesDrawn += in_stats.m_numVerticesDrawn;
+				out_total.m_numIndicesDrawn += in_stats.m_numIndicesDrawn;
+				out_total.m_numMaterialChanges += in_stats.m_numMaterialChanges;
+				out_total.m_numShaderBinds += in_stats.m_numShaderBinds;
+				out_total.m_numTextureBinds += in_stats.m_numTextureBinds;
+				out_total.m_numStateChanges += in_stats.m_numStateChanges;
+				out_total.m_numRenderTargetPasses += in_stats.m_numRenderTargetPasses;
+				out_total.m_numVertexBytesUploaded += in_stats.m_numVertexBytesUploaded;
+				out_total.m_numIndexBytesUploaded += in_stats.m_numIndexBytesUploaded;
+				out_total.m_numTextureBytesUploaded += in_stats.m_numTextureBytesUploaded;
+			}
+		}
+
+		//-------------------------------------------------
+		//-------------------------------------------------
+		MainLoop::MainLoop(const Options& in_options)
+			: m_options(in_options)
+		{
+			m_options.m_resolution = CSCore::Integer2::Max(m_options.m_resolution, CSCore::Integer2::k_one);
+		}
+		//-------------------------------------------------
+		//-------------------------------------------------
+		void MainLoop::Run()
+		{
+			CSCore::Application* app = CreateApplication();
+			app->Init();
+			app->Resume();
+			app->Foreground();
+
+			m_preferredFPS = CSCore::Application::Get()->GetAppConfig()->GetPreferredFPS();
+
+			const Clock::time_point appStartTime = Clock::now();
+			Clock::time_point frameStartTime = appStartTime;
+			f64 runningTime = 0.0;
+			u32 numFrames = 0;
+			CSRendering::RenderStats::FrameStats renderTotals;
+
+			while (m_isQuitRequested == false && (m_options.m_maxFrames == 0 || numFrames < m_options.m_maxFrames))
+			{
+				const Clock::time_point currentTime = Clock::now();
+				f32 deltaTime = (f32)GetSecondsBetween(frameStartTime, currentTime);
+				if (m_options.m_fixedTimeStep > 0.0f)
+				{
+					deltaTime = m_options.m_fixedTimeStep;
+				}
+				frameStartTime = currentTime;
+
+				app->Update(deltaTime, runningTime);
+				app->Render();
+				AccumulateRenderStats(renderTotals, app->GetRenderSystem()->GetRenderStats().GetLastFrame());
+
+				runningTime += deltaTime;
+				++numFrames;
+
+				if (m_options.m_isFrameRateCapped == true && m_preferredFPS > 0)
+				{
+					std::this_thread::sleep_until(frameStartTime + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<f64>(1.0 / m_preferredFPS)));
+				}
+			}
+
+			std::string summary = BuildSummary(numFrames, GetSecondsBetween(appStartTime, Clock::now()), renderTotals);
+
+			app->Background();
+			app->Suspend();
+			app->Destroy();
+			delete app;
+
+			std::cout << summary << std::endl;
+		}
+		//-------------------------------------------------
+		//-------------------------------------------------
+		void MainLoop::Quit()
+		{
+			m_isQuitRequested = true;
+		}
+		//-------------------------------------------------
+		//-------------------------------------------------
+		void MainLoop::SetPreferredFPS(u32 in_fps)
+		{
+			m_preferredFPS = in_fps;
+		}
+		//-------------------------------------------------
+		//-------------------------------------------------
+		const CSCore::Integer2& MainLoop::GetResolution() const
+		{
+			return m_options.m_resolution;
+		}
+		//-------------------------------------------------
+		//-------------------------------------------------
+		void MainLoop::SetResolution(const CSCore::Integer2& in_resolution)
+		{
+			m_options.m_resolution = CSCore::Integer2::Max(in_resolution, CSCore::Integer2::k_one);
+			m_resolutionChangedEvent.NotifyConnections(m_options.m_resolution);
+		}
+		//-------------------------------------------------
+		//-------------------------------------------------
+		CSCore::IConnectableEvent<MainLoop::ResolutionChangedDelegate>& MainLoop::GetResolutionChangedEvent()
+		{
+			return m_resolutionChangedEvent;
+		}
+		//-------------------------------------------------
+		//-------------------------------------------------
+		u32 MainLoop::GetNumCPUCores() const
+		{
+			return m_options.m_numCPUCores;
+		}
+		//-------------------------------------------------
+		//-------------------------------------------------
+		std::string MainLoop::BuildSummary(u32 in_numFrames, f64 in_wallTime, const CSRendering::RenderStats::FrameStats& in_renderTotals) const
+		{
+			std::string summary = "[Chilli Source] Ran " + CSCore::ToString(in_numFrames) + " frames in " + CSCore::ToString((f32)in_wallTime) + "s";
+			if (in_numFrames > 0)
+			{
+				summary += " (" + CSCore::ToString((f32)(in_wallTime * 1000.0 / in_numFrames)) + "ms per frame)";
+			}
+
+			if (in_numFrames > 0)
+			{
+				summary += "\n[Chilli Source] Per frame:";
+				summary += " draw calls " + CSCore::ToString((f32)in_renderTotals.m_numDrawCalls / in_numFrames);
+				summary += ", vertices " + CSCore::ToString((f32)in_renderTotals.m_numVerticesDrawn / in_numFrames);
+				summary += ", indices " + CSCore::ToString((f32)in_renderTotals.m_numIndicesDrawn / in_numFrames);
+				summary += ", material changes " + CSCore::ToString((f32)in_renderTotals.m_numMaterialChanges / in_numFrames);
+				summary += ", shader binds " + CSCore::ToString((f32)in_renderTotals.m_numShaderBinds / in_numFrames);
+				summary += ", texture binds " + CSCore::ToString((f32)in_renderTotals.m_numTextureBinds / in_numFrames);
+				summary += ", state changes " + CSCore::ToString((f32)in_renderTotals.m_numStateChanges / in_numFrames);
+				summary += ", render target passes " + CSCore::ToString((f32)in_renderTotals.m_numRenderTargetPasses / in_numFrames);
+				summary += "\n[Chilli Source] Uploaded: vertices " + CSCore::ToString(in_renderTotals.m_numVertexBytesUploaded) + " bytes, indices " + CSCore::ToString(in_renderTotals.m_numIndexBytesUploaded) + " bytes, textures " + CSCore::ToString(in_renderTotals.m_numTextureBytesUploaded) + " bytes";
+			}
+
+			return summary;
+		}
+	}
+}
+
+#endif
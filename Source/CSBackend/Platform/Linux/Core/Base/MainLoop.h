@@ -0,0 +1,146 @@
+//
+//  MainLoop.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#ifndef _CSBACKEND_PLATFORM_LINUX_CORE_BASE_MAINLOOP_H_
+#define _CSBACKEND_PLATFORM_LINUX_CORE_BASE_MAINLOOP_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Platform/Linux/ForwardDeclarations.h>
+#include <ChilliSource/Core/Base/Singleton.h>
+#include <ChilliSource/Core/Event/Event.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Rendering/Base/RenderStats.h>
+
+#include <functional>
+
+namespace CSBackend
+{
+	namespace Linux
+	{
+		//---------------------------------------------------------
+		/// Drives the application on Linux without a window or a
+		/// GPU. The application is created and updated in a fixed
+		/// or real time loop and rendered through the null render
+		/// system, allowing scene, UI and particle workloads to be
+		/// run and profiled headless, for example on a CI machine.
+		///
+		/// A summary of the run is written to standard output once
+		/// the application has quit.
+		//---------------------------------------------------------
+		class MainLoop final : public CSCore::Singleton<MainLoop>
+		{
+		public:
+			//-----------------------------------------------------------
+			/// Delegate called when the virtual screen is resized.
+			///
+			/// @param The new resolution.
+			//-----------------------------------------------------------
+			using ResolutionChangedDelegate = std::function<void(const CSCore::Integer2&)>;
+			//-----------------------------------------------------------
+			/// Options describing how the loop should be run.
+			//-----------------------------------------------------------
+			struct Options
+			{
+				CSCore::Integer2 m_resolution = CSCore::Integer2(1280, 720);
+				f32 m_fixedTimeStep = 0.0f;
+				bool m_isFrameRateCapped = true;
+				u32 m_maxFrames = 0;
+				u32 m_numCPUCores = 0;
+			};
+			//-------------------------------------------------
+			/// @param The options the loop will run with. If
+			/// the fixed time step is zero the loop runs in
+			/// real time. If the max number of frames is zero
+			/// the loop runs until the application quits. If
+			/// the number of CPU cores is zero the number of
+			/// online cores is used.
+			//-------------------------------------------------
+			MainLoop(const Options& in_options);
+			//-------------------------------------------------
+			/// Creates the application and runs the loop until
+			/// the application quits or the maximum number of
+			/// frames is reached.
+			//-------------------------------------------------
+			void Run();
+			//-------------------------------------------------
+			/// Requests that the loop stops after the current
+			/// frame. The application is then torn down.
+			//-------------------------------------------------
+			void Quit();
+			//-------------------------------------------------
+			/// @param The maximum frames per second. This is
+			/// ignored if the frame rate isn't capped.
+			//-------------------------------------------------
+			void SetPreferredFPS(u32 in_fps);
+			//-------------------------------------------------
+			/// @return The resolution of the virtual screen.
+			//-------------------------------------------------
+			const CSCore::Integer2& GetResolution() const;
+			//-------------------------------------------------
+			/// @param The new resolution of the virtual screen.
+			//-------------------------------------------------
+			void SetResolution(const CSCore::Integer2& in_resolution);
+			//-------------------------------------------------
+			/// @return Event triggered when the resolution of
+			/// the virtual screen changes.
+			//-------------------------------------------------
+			CSCore::IConnectableEvent<ResolutionChangedDelegate>& GetResolutionChangedEvent();
+			//-------------------------------------------------
+			/// @return The number of CPU cores the device
+			/// should report, or zero if it should report the
+			/// number of online cores. Limiting this allows
+			/// multi-threaded workloads to be measured at
+			/// different core counts.
+			//-------------------------------------------------
+			u32 GetNumCPUCores() const;
+
+		private:
+			//-------------------------------------------------
+			/// Builds a summary of the run.
+			///
+			/// @param The number of frames run.
+			/// @param The wall time of the run in seconds.
+			/// @param The render stats summed over every
+			/// frame.
+			///
+			/// @return The summary.
+			//-------------------------------------------------
+			std::string BuildSummary(u32 in_numFrames, f64 in_wallTime, const CSRendering::RenderStats::FrameStats& in_renderTotals) const;
+
+			Options m_options;
+			u32 m_preferredFPS = 60;
+			bool m_isQuitRequested = false;
+			CSCore::Event<ResolutionChangedDelegate> m_resolutionChangedEvent;
+		};
+	}
+}
+
+#endif
+
+#endif
@@ -0,0 +1,104 @@
+//
+//  PlatformSystem.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#ifndef _CSBACKEND_PLATFORM_LINUX_CORE_BASE_PLATFORMSYSTEM_H_
+#define _CSBACKEND_PLATFORM_LINUX_CORE_BASE_PLATFORMSYSTEM_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Platform/Linux/ForwardDeclarations.h>
+#include <ChilliSource/Core/Base/PlatformSystem.h>
+
+namespace CSBackend
+{
+	namespace Linux
+	{
+		//-------------------------------------------------------------
+		/// The Linux backend for the platform system. This creates the
+		/// default systems required by the null render system and
+		/// forwards loop control to the main loop.
+		//-------------------------------------------------------------
+		class PlatformSystem final : public CSCore::PlatformSystem
+		{
+		public:
+			CS_DECLARE_NAMEDTYPE(PlatformSystem);
+			//--------------------------------------------------
+			/// Queries whether or not this system implements the
+			/// interface with the given Id.
+			///
+			/// @param The interface Id.
+			/// @param Whether system is of given type.
+			//--------------------------------------------------
+			bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+			//-------------------------------------------------
+			/// Adds default systems to the applications system
+			/// list.
+			///
+			/// @param the system list
+			//-------------------------------------------------
+			void CreateDefaultSystems(CSCore::Application* in_application) override;
+			//-------------------------------------------------
+			/// @param The maximum frames per second to clamp
+			/// to.
+			//-------------------------------------------------
+			void SetPreferredFPS(u32 in_fps) override;
+			//---------------------------------------------------
+			/// There is no display to synchronise with so this
+			/// does nothing.
+			///
+			/// @param Enable/Disable
+			//---------------------------------------------------
+			void SetVSyncEnabled(bool in_enabled) override;
+			//-------------------------------------------------
+			/// Stops the main loop after the current frame,
+			/// causing the application to terminate.
+			//-------------------------------------------------
+			void Quit() override;
+			//-------------------------------------------------
+			/// @return The version of the application
+			//-------------------------------------------------
+			std::string GetAppVersion() const override;
+			//------------------------------------------------
+			/// @return the current monotonic time in
+			/// milliseconds
+			//-------------------------------------------------
+			u64 GetSystemTimeMS() const override;
+		private:
+			friend CSCore::PlatformSystemUPtr CSCore::PlatformSystem::Create();
+			//--------------------------------------------------
+			/// Private constructor to enforce use of create
+			/// method.
+			//-------------------------------------------------
+			PlatformSystem() = default;
+		};
+	}
+}
+
+#endif
+
+#endif
@@ -0,0 +1,123 @@
+//
+//  Screen.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#ifndef _CSBACKEND_PLATFORM_LINUX_CORE_BASE_SCREEN_H_
+#define _CSBACKEND_PLATFORM_LINUX_CORE_BASE_SCREEN_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Platform/Linux/ForwardDeclarations.h>
+#include <ChilliSource/Core/Base/Screen.h>
+#include <ChilliSource/Core/Event/Event.h>
+
+namespace CSBackend
+{
+	namespace Linux
+	{
+		//----------------------------------------------------------------
+		/// The Linux backend for the screen system. There is no display
+		/// so this describes the virtual screen owned by the main loop.
+		//----------------------------------------------------------------
+		class Screen final : public CSCore::Screen
+		{
+		public:
+			CS_DECLARE_NAMEDTYPE(Screen);
+			//-------------------------------------------------------
+			/// @param The interface Id.
+			///
+			/// @return Whether system is of given type.
+			//-------------------------------------------------------
+			bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+			//-----------------------------------------------------------
+			/// @return The resolution of the virtual screen.
+			//-----------------------------------------------------------
+			const CSCore::Vector2& GetResolution() const override;
+			//-----------------------------------------------------------
+			/// @return The density scale. This is always 1.
+			//-----------------------------------------------------------
+			f32 GetDensityScale() const override;
+			//-----------------------------------------------------------
+			/// @return The inverse density scale. This is always 1.
+			//-----------------------------------------------------------
+			f32 GetInverseDensityScale() const override;
+			//-----------------------------------------------------------
+			/// @return Event triggered when the resolution changes.
+			//-----------------------------------------------------------
+			CSCore::IConnectableEvent<ResolutionChangedDelegate>& GetResolutionChangedEvent() override;
+			//-----------------------------------------------------------
+			/// @return Event triggered when the display mode changes.
+			/// This is never triggered.
+			//-----------------------------------------------------------
+			CSCore::IConnectableEvent<DisplayModeChangedDelegate>& GetDisplayModeChangedEvent() override;
+			//----------------------------------------------------------
+			/// @param The new resolution of the virtual screen.
+			//----------------------------------------------------------
+			void SetResolution(const CSCore::Integer2& in_size) override;
+			//----------------------------------------------------------
+			/// The virtual screen has no display mode so this does
+			/// nothing.
+			///
+			/// @param The display mode.
+			//----------------------------------------------------------
+			void SetDisplayMode(DisplayMode in_mode) override;
+			//----------------------------------------------------------
+			/// @return The current resolution, as it is the only one
+			/// supported.
+			//----------------------------------------------------------
+			std::vector<CSCore::Integer2> GetSupportedResolutions() const override;
+		private:
+			friend CSCore::ScreenUPtr CSCore::Screen::Create();
+			//-------------------------------------------------------
+			/// Private constructor to enforce use of the factory
+			/// method.
+			//-------------------------------------------------------
+			Screen();
+			//------------------------------------------------
+			//------------------------------------------------
+			void OnInit() override;
+			//-----------------------------------------------------------
+			/// Called when the main loop resolution changes.
+			///
+			/// @param The new resolution.
+			//------------------------------------------------------------
+			void OnResolutionChanged(const CSCore::Integer2& in_resolution);
+			//------------------------------------------------
+			//------------------------------------------------
+			void OnDestroy() override;
+
+			CSCore::Vector2 m_resolution;
+			CSCore::Event<ResolutionChangedDelegate> m_resolutionChangedEvent;
+			CSCore::Event<DisplayModeChangedDelegate> m_displayModeChangedEvent;
+			CSCore::EventConnectionUPtr m_resolutionChangedConnection;
+		};
+	}
+}
+
+#endif
+
+#endif
@@ -0,0 +1,604 @@
+//
+//  FileSystem.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#include <CSBackend/Platform/Linux/Core/File/FileSystem.h>
+
+#include <ChilliSource/Core/Base/Utils.h>
+#include <ChilliSource/Core/File/FileStream.h>
+#include <ChilliSource/Core/String/StringUtils.h>
+
+#include <algorithm>
+#include <climits>
+#include <fstream>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace CSBackend
+{
+	namespace Linux
+	{
+		namespace
+		{
+			const std::string k_saveDataPath = "SaveData/";
+			const std::string k_cachePath = "Cache/";
+			const std::string k_dlcPath = "DLC/";
+
+			//--------------------------------------------------------------
+			/// @return The directory containing the running executable, or
+			/// the current working directory if it cannot be determined.
+			//--------------------------------------------------------------
+			std::string GetExecutableDirectory()
+			{
+				char pathChars[PATH_MAX];
+				ssize_t length = readlink("/proc/self/exe", pathChars, PATH_MAX - 1);
+				if (length > 0)
+				{
+					std::string path(pathChars, (std::string::size_type)length);
+					return path.substr(0, path.find_last_of("/"));
+				}
+
+				if (getcwd(pathChars, PATH_MAX) != nullptr)
+				{
+					return std::string(pathChars);
+				}
+
+				return ".";
+			}
+			//--------------------------------------------------------------
+			/// @param The file path.
+			///
+			/// @return Whether or not the given file path exists.
+			//--------------------------------------------------------------
+			bool DoesFileExist(const std::string& in_filePath)
+			{
+				struct stat attributes;
+				return (stat(in_filePath.c_str(), &attributes) == 0 && S_ISDIR(attributes.st_mode) == false);
+			}
+			//--------------------------------------------------------------
+			/// @param The directory path.
+			///
+			/// @return Whether or not the given directory path exists.
+			//--------------------------------------------------------------
+			bool DoesDirectoryExist(const std::string& in_directoryPath)
+			{
+				struct stat attributes;
+				return (stat(in_directoryPath.c_str(), &attributes) == 0 && S_ISDIR(attributes.st_mode) == true);
+			}
+			//--------------------------------------------------------------
+			/// Creates the given directory and any missing parent
+			/// directories.
+			///
+			/// @param The directory path.
+			///
+			/// @return Whether or not the directory now exists.
+			//--------------------------------------------------------------
+			bool CreateDirectoryPath(const std::string& in_directoryPath)
+			{
+				std::string directoryPath = CSCore::StringUtils::StandardiseDirectoryPath(in_directoryPath);
+				for (std::string::size_type pos = directoryPath.find('/', 1); pos != std::string::npos; pos = directoryPath.find('/', pos + 1))
+				{
+					std::string subPath = directoryPath.substr(0, pos);
+					if (DoesDirectoryExist(subPath) == false && mkdir(subPath.c_str(), 0755) != 0)
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+			//--------------------------------------------------------------
+			/// @param The source file path.
+			/// @param The destination file path.
+			///
+			/// @return Whether or not the copy succeeded.
+			//--------------------------------------------------------------
+			bool CopyFile(const std::string& in_sourceFilePath, const std::string& in_destinationFilePath)
+			{
+				std::ifstream source(in_sourceFilePath, std::ios::binary);
+				std::ofstream destination(in_destinationFilePath, std::ios::binary | std::ios::trunc);
+				if (source.good() == false || destination.good() == false)
+				{
+					return false;
+				}
+
+				destination << source.rdbuf();
+				return destination.good();
+			}
+			//--------------------------------------------------------------
+			/// Lists all files and sub-directories inside the given directory.
+			/// All paths will be relative to the given directory.
+			///
+			/// @param The directory.
+			/// @param Whether or not to recurse into sub directories.
+			/// @param [Out] The sub directories.
+			/// @param [Out] The files.
+			/// @param [Optional] The relative directory path. This is used
+			/// in recursion and shouldn't be set outside of this function.
+			/// @return Whether or not this succeeded.
+			//--------------------------------------------------------------
+			bool ListDirectoryContents(const std::string& in_directoryPath, bool in_recursive, std::vector<std::string>& out_directoryPaths, std::vector<std::string>& out_filePaths,
+				const std::string& in_relativeDirectoryPath = "")
+			{
+				std::string directoryPath = CSCore::StringUtils::StandardiseDirectoryPath(in_directoryPath);
+				DIR* directory = opendir(directoryPath.c_str());
+				if (directory == nullptr)
+				{
+					return false;
+				}
+
+				bool success = true;
+				while (dirent* entry = readdir(directory))
+				{
+					std::string name(entry->d_name);
+					if (name == "." || name == "..")
+					{
+						continue;
+					}
+
+					std::string absolutePath = CSCore::StringUtils::StandardiseFilePath(directoryPath + name);
+					if (DoesDirectoryExist(absolutePath) == true)
+					{
+						std::string relativeDirectoryPath = CSCore::StringUtils::StandardiseDirectoryPath(in_relativeDirectoryPath + name);
+						out_directoryPaths.push_back(relativeDirectoryPath);
+
+						if (in_recursive == true && ListDirectoryContents(CSCore::StringUtils::StandardiseDirectoryPath(absolutePath), true, out_directoryPaths, out_filePaths, relativeDirectoryPath) == false)
+						{
+							success = false;
+							break;
+						}
+					}
+					else
+					{
+						out_filePaths.push_back(CSCore::StringUtils::StandardiseFilePath(in_relativeDirectoryPath + name));
+					}
+				}
+
+				closedir(directory);
+				return success;
+			}
+			//--------------------------------------------------------------
+			/// Deletes the given directory and all of its contents.
+			///
+			/// @param The directory path.
+			///
+			/// @return Whether or not the directory was deleted.
+			//--------------------------------------------------------------
+			bool DeleteDirectory(const std::string& in_directoryPath)
+			{
+				std::string directoryPath = CSCore::StringUtils::StandardiseDirectoryPath(in_directoryPath);
+
+				std::vector<std::string> directoryPaths;
+				std::vector<std::string> filePaths;
+				if (ListDirectoryContents(directoryPath, true, directoryPaths, filePaths) == false)
+				{
+					return false;
+				}
+
+				for (const std::string& filePath : filePaths)
+				{
+					if (unlink((directoryPath + filePath).c_str()) != 0)
+					{
+						return false;
+					}
+				}
+
+				//Sub directories are listed before their contents, so remove them deepest first.
+				for (auto it = directoryPaths.rbegin(); it != directoryPaths.rend(); ++it)
+				{
+					if (rmdir((directoryPath + *it).c_str()) != 0)
+					{
+						return false;
+					}
+				}
+
+				return (rmdir(directoryPath.c_str()) == 0);
+			}
+		}
+		CS_DEFINE_NAMEDTYPE(FileSystem);
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		FileSystem::FileSystem()
+		{
+			std::string workingDir = CSCore::StringUtils::StandardiseDirectoryPath(GetExecutableDirectory());
+
+			m_packagePath = workingDir + "assets/";
+			m_documentsPath = workingDir + "Documents/";
+
+			CreateDirectoryPath(CSCore::StorageLocation::k_saveData, "");
+			CreateDirectoryPath(CSCore::StorageLocation::k_cache, "");
+			CreateDirectoryPath(CSCore::StorageLocation::k_DLC, "");
+		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool FileSystem::IsA(CSCore::InterfaceIDType in_interfaceId) const
+		{
+			return (CSCore::FileSystem::InterfaceID == in_interfaceId || FileSystem::InterfaceID == in_interfaceId);
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		CSCore::FileStreamUPtr FileSystem::CreateFileStream(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath, CSCore::FileMode in_fileMode) const
+		{
+			CSCore::FileStreamUPtr fileStream = CSCore::FileStreamUPtr(new CSCore::FileStream());
+
+			if (IsWriteMode(in_fileMode) == true)
+			{
+				CS_ASSERT(IsStorageLocationWritable(in_storageLocation), "File System: Trying to write to read only storage location.");
+
+				std::string filePath = GetAbsolutePathToStorageLocation(in_storageLocation) + in_filePath;
+				fileStream->Open(filePath, in_fileMode);
+			}
+			else
+			{
+				std::string filePath = GetAbsolutePathToFile(in_storageLocation, in_filePath);
+				fileStream->Open(filePath, in_fileMode);
+			}
+
+			return fileStream;
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		bool FileSystem::CreateDirectoryPath(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath) const
+		{
+			CS_ASSERT(IsStorageLocationWritable(in_storageLocation), "File System: Trying to write to read only storage location.");
+
+			std::string directoryPath = GetAbsolutePathToStorageLocation(in_storageLocation) + in_directoryPath;
+			if (CSBackend::Linux::DoesDirectoryExist(directoryPath) == false)
+			{
+				if (CSBackend::Linux::CreateDirectoryPath(directoryPath) == false)
+				{
+					CS_LOG_ERROR("File System: Failed to create directory '" + in_directoryPath + "'");
+					return false;
+				}
+			}
+
+			return true;
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		bool FileSystem::CopyFile(CSCore::StorageLocation in_sourceStorageLocation, const std::string& in_sourceFilePath, 
+			CSCore::StorageLocation in_destinationStorageLocation, const std::string& in_destinationFilePath) const
+		{
+			CS_ASSERT(IsStorageLocationWritable(in_destinationStorageLocation), "File System: Trying to write to read only storage location.");
+            
+			std::string sourceFilePath = GetAbsolutePathToFile(in_sourceStorageLocation, in_sourceFilePath);
+			if (sourceFilePath.empty() == true)
+            {
+				CS_LOG_ERROR("File System: Trying to copy file '" + in_sourceFilePath + "' but it does not exist.");
+                return false;
+            }
+
+            //get the path to the file
+			std::string destinationFileName, destinationDirectoryPath;
+			CSCore::StringUtils::SplitFilename(in_destinationFilePath, destinationFileName, destinationDirectoryPath);
+            
+            //create the output directory
+			CreateDirectoryPath(in_destinationStorageLocation, destinationDirectoryPath);
+            
+            //try and copy the files
+			if (CSBackend::Linux::CopyFile(sourceFilePath, GetAbsolutePathToStorageLocation(in_destinationStorageLocation) + in_destinationFilePath) == false)
+			{
+				CS_LOG_ERROR("File System: Failed to copy file '" + in_sourceFilePath + "'");
+				return false;
+			}
+
+			return true;
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		bool FileSystem::CopyDirectory(CSCore::StorageLocation in_sourceStorageLocation, const std::string& in_sourceDirectoryPath, 
+			CSCore::StorageLocation in_destinationStorageLocation, const std::string& in_destinationDirectoryPath) const
+		{
+			CS_ASSERT(IsStorageLocationWritable(in_destinationStorageLocation), "File System: Trying to write to read only storage location.");
+
+			if (DoesDirectoryExist(in_sourceStorageLocation, in_sourceDirectoryPath) == false)
+			{
+				CS_LOG_ERROR("File System: Trying to copy directory '" + in_sourceDirectoryPath + "' but it doesn't exist.");
+				return false;
+			}
+
+			std::vector<std::string> filePaths = GetFilePaths(in_sourceStorageLocation, in_sourceDirectoryPath, true);
+
+			//if the source directory is empty, just create the equivelent directory in the destination
+			if (filePaths.size() == 0)
+			{
+				CreateDirectoryPath(in_destinationStorageLocation, in_destinationDirectoryPath);
+			}
+			else
+			{
+				std::string sourceDirectoryPath = CSCore::StringUtils::StandardiseDirectoryPath(in_sourceDirectoryPath);
+				std::string destinationDirectoryPath = CSCore::StringUtils::StandardiseDirectoryPath(in_destinationDirectoryPath);
+				for (const std::string& filePath : filePaths)
+				{
+					if (CopyFile(in_sourceStorageLocation, sourceDirectoryPath + filePath, in_destinationStorageLocation, destinationDirectoryPath + filePath) == false)
+					{
+						CS_LOG_ERROR("File System: Failed to copy directory '" + in_sourceDirectoryPath + "'");
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		bool FileSystem::DeleteFile(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath) const
+		{
+			CS_ASSERT(IsStorageLocationWritable(in_storageLocation), "File System: Trying to delete from a read only storage location.");
+
+			std::string filePath = GetAbsolutePathToStorageLocation(in_storageLocation) + in_filePath;
+			if (unlink(filePath.c_str()) != 0)
+			{
+				CS_LOG_ERROR("File System: Failed to delete file '" + in_filePath + "'");
+				return false;
+			}
+
+			return true;
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		bool FileSystem::DeleteDirectory(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath) const
+		{
+			CS_ASSERT(IsStorageLocationWritable(in_storageLocation), "File System: Trying to delete from a read only storage location.");
+
+			std::string directoryPath = GetAbsolutePathToDirectory(in_storageLocation, in_directoryPath);
+			if (directoryPath != "")
+			{
+				if (CSBackend::Linux::DeleteDirectory(directoryPath) == false)
+				{
+					CS_LOG_ERROR("File System: Failed to delete directory '" + in_directoryPath + "'");
+					return false;
+				}
+				return true;
+			}
+
+			return false;
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		std::vector<std::string> FileSystem::GetFilePaths(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath, bool in_recursive) const
+		{
+			std::vector<std::string> possibleDirectories = GetPossibleAbsoluteDirectoryPaths(in_storageLocation, in_directoryPath);
+            
+			std::vector<std::string> output;
+			std::vector<std::string> filePaths;
+			std::vector<std::string> directoryPaths;
+			for (const std::string& possibleDirectory : possibleDirectories)
+			{
+				filePaths.clear();
+				directoryPaths.clear();
+
+				ListDirectoryContents(possibleDirectory, in_recursive, directoryPaths, filePaths);
+				output.insert(output.end(), filePaths.begin(), filePaths.end());
+			}
+
+			std::sort(output.begin(), output.end());
+			std::vector<std::string>::iterator it = std::unique(output.begin(), output.end());
+			output.resize(it - output.begin());
+			return output;
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		std::vector<std::string> FileSystem::GetDirectoryPaths(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath, bool in_recursive) const
+		{
+			std::vector<std::string> possibleDirectories = GetPossibleAbsoluteDirectoryPaths(in_storageLocation, in_directoryPath);
+
+			std::vector<std::string> output;
+			std::vector<std::string> filePaths;
+			std::vector<std::string> directoryPaths;
+			for (const std::string& possibleDirectory : possibleDirectories)
+			{
+				filePaths.clear();
+				directoryPaths.clear();
+
+				ListDirectoryContents(possibleDirectory, in_recursive, directoryPaths, filePaths);
+				output.insert(output.end(), directoryPaths.begin(), directoryPaths.end());
+			}
+
+			std::sort(output.begin(), output.end());
+			std::vector<std::string>::iterator it = std::unique(output.begin(), output.end());
+			output.resize(it - output.begin());
+			return output;
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		bool FileSystem::DoesFileExist(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath) const
+		{
+			switch (in_storageLocation)
+			{
+				case CSCore::StorageLocation::k_DLC:
+				{
+					if (DoesItemExistInDLCCache(in_filePath, false) == true)
+					{
+						return true;
+					}
+
+					return DoesFileExist(CSCore::StorageLocation::k_package, GetPackageDLCPath() + in_filePath);
+				}
+				default:
+				{
+					std::string path = CSCore::StringUtils::StandardiseFilePath(GetAbsolutePathToStorageLocation(in_storageLocation) + in_filePath);
+					return CSBackend::Linux::DoesFileExist(path);
+				}
+			}
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		bool FileSystem::DoesDirectoryExist(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath) const
+		{
+			switch (in_storageLocation)
+			{
+				case CSCore::StorageLocation::k_DLC:
+				{
+					if (DoesItemExistInDLCCache(in_directoryPath, true) == true)
+					{
+						return true;
+					}
+
+					return DoesDirectoryExist(CSCore::StorageLocation::k_package, GetPackageDLCPath() + in_directoryPath);
+				}
+				default:
+				{
+					std::string path = CSCore::StringUtils::StandardiseDirectoryPath(GetAbsolutePathToStorageLocation(in_storageLocation) + in_directoryPath);
+					return CSBackend::Linux::DoesDirectoryExist(path);
+				}
+			}
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		bool FileSystem::DoesFileExistInCachedDLC(const std::string& in_filePath) const
+		{
+			return DoesItemExistInDLCCache(in_filePath, false);
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		bool FileSystem::DoesFileExistInPackageDLC(const std::string& in_filePath) const
+		{
+			return DoesFileExist(CSCore::StorageLocation::k_package, GetPackageDLCPath() + in_filePath);
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		std::string FileSystem::GetAbsolutePathToStorageLocation(CSCore::StorageLocation in_storageLocation) const
+		{
+			switch (in_storageLocation)
+			{
+			case CSCore::StorageLocation::k_package:
+				return m_packagePath + "AppResources/";
+			case CSCore::StorageLocation::k_chilliSource:
+				return m_packagePath + "CSResources/";
+			case CSCore::StorageLocation::k_saveData:
+				return m_documentsPath + k_saveDataPath;
+			case CSCore::StorageLocation::k_cache:
+				return m_documentsPath + k_cachePath;
+			case CSCore::StorageLocation::k_DLC:
+				return m_documentsPath + k_dlcPath;
+			case CSCore::StorageLocation::k_root:
+				return "";
+				break;
+			default:
+				CS_LOG_ERROR("Storage Location not available on this platform!");
+				return "";
+			}
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		std::string FileSystem::GetAbsolutePathToFile(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath) const
+		{
+			if (DoesFileExist(in_storageLocation, in_filePath) == true)
+			{
+				switch (in_storageLocation)
+				{
+					case CSCore::StorageLocation::k_DLC:
+					{
+						std::string filePath = CSCore::StringUtils::StandardiseFilePath(GetAbsolutePathToStorageLocation(CSCore::StorageLocation::k_DLC) + in_filePath);
+						if (CSBackend::Linux::DoesFileExist(filePath) == true)
+						{
+							return filePath;
+						}
+
+						return GetAbsolutePathToFile(CSCore::StorageLocation::k_package, GetPackageDLCPath() + in_filePath);
+					}
+					default:
+					{
+						return GetAbsolutePathToStorageLocation(in_storageLocation) + in_filePath;
+					}
+				}
+			}
+
+			return "";
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		std::string FileSystem::GetAbsolutePathToDirectory(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath) const
+		{
+			if (DoesDirectoryExist(in_storageLocation, in_directoryPath) == true)
+			{
+				switch (in_storageLocation)
+				{
+					case CSCore::StorageLocation::k_DLC:
+					{
+						std::string filePath = CSCore::StringUtils::StandardiseDirectoryPath(GetAbsolutePathToStorageLocation(CSCore::StorageLocation::k_DLC) + in_directoryPath);
+						if (CSBackend::Linux::DoesDirectoryExist(filePath) == true)
+						{
+							return filePath;
+						}
+
+						return GetAbsolutePathToDirectory(CSCore::StorageLocation::k_package, GetPackageDLCPath() + in_directoryPath);
+					}
+					default:
+					{
+						return GetAbsolutePathToStorageLocation(in_storageLocation) + in_directoryPath;
+					}
+				}
+			}
+
+			return "";
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		bool FileSystem::DoesItemExistInDLCCache(const std::string& in_path, bool in_isDirectory) const
+		{
+			std::string path = GetAbsolutePathToStorageLocation(CSCore::StorageLocation::k_DLC) + in_path;
+			if (in_isDirectory == true)
+			{
+				return CSBackend::Linux::DoesDirectoryExist(CSCore::StringUtils::StandardiseDirectoryPath(path));
+			}
+			else
+			{
+				return CSBackend::Linux::DoesFileExist(CSCore::StringUtils::StandardiseFilePath(path));
+			}
+		}
+		//------------------------------------------------------------
+		//------------------------------------------------------------
+		std::vector<std::string> FileSystem::GetPossibleAbsoluteDirectoryPaths(CSCore::StorageLocation in_storageLocation, const std::string& in_path) const
+		{
+			std::vector<std::string> output;
+
+			switch (in_storageLocation)
+			{
+				case CSCore::StorageLocation::k_DLC:
+				{
+					output.push_back(GetAbsolutePathToStorageLocation(CSCore::StorageLocation::k_package) + GetPackageDLCPath() + in_path);
+					output.push_back(GetAbsolutePathToStorageLocation(CSCore::StorageLocation::k_DLC) + in_path);
+					break;
+				}
+				default:
+				{
+					output.push_back(GetAbsolutePathToStorageLocation(in_storageLocation) + in_path);
+					break;
+				}
+			}
+
+			return output;
+		}
+	}
+}
+
+#endif
@@ -1,11 +1,10 @@
 //
-//  Particle.h
+//  PointerSystem.cpp
 //  Chilli Source
-//  Created by Ian Copland on 07/10/2014.
 //
 //  The MIT License (MIT)
 //
-//  Copyright (c) 2014 Tag Games Limited
+//  Copyright (c) 2026 Tag Games Limited
 //
 //  Permission is hereby granted, free of charge, to any person obtaining a copy
 //  of this software and associated documentation files (the "Software"), to deal
@@ -26,38 +25,32 @@
 //  THE SOFTWARE.
 //
 
-#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLE_H_
-#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLE_H_
+#ifdef CS_TARGETPLATFORM_LINUX
 
-#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Platform/Linux/Input/Pointer/PointerSystem.h>
 
-#include <ChilliSource/Core/Math/Vector3.h>
-#include <ChilliSource/Core/Math/Vector2.h>
-#include <ChilliSource/Core/Math/Quaternion.h>
-#include <ChilliSource/Core/Base/Colour.h>
-
-namespace ChilliSource
+namespace CSBackend
 {
-	namespace Rendering
+	namespace Linux
 	{
-		//-----------------------------------------------------------------------
-		/// A struct containing the properties for a single particle.
-		///
-		/// @author Ian Copland
-		//-----------------------------------------------------------------------
-		struct Particle final
+		CS_DEFINE_NAMEDTYPE(PointerSystem);
+		//----------------------------------------------------
+		//----------------------------------------------------
+		bool PointerSystem::IsA(CSCore::InterfaceIDType in_interfaceId) const
+		{
+			return (CSInput::PointerSystem::InterfaceID == in_interfaceId || PointerSystem::InterfaceID == in_interfaceId);
+		}
+		//----------------------------------------------------
+		//----------------------------------------------------
+		void PointerSystem::HideCursor()
+		{
+		}
+		//----------------------------------------------------
+		//----------------------------------------------------
+		void PointerSystem::ShowCursor()
 		{
-			bool m_isActive = false;
-			f32 m_lifetime = 0.0f;
-			f32 m_energy = 0.0f;
-			Core::Vector3 m_position;
-            Core::Vector2 m_scale = Core::Vector2::k_one;
-			f32 m_rotation = 0.0f;
-			Core::Colour m_colour = Core::Colour::k_white;
-			Core::Vector3 m_velocity;
-			f32 m_angularVelocity = 0.0f;
-		};
+		}
 	}
 }
 
-#endif
\ No newline at end of file
+#endif
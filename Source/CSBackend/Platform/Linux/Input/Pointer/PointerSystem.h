@@ -0,0 +1,78 @@
+//
+//  PointerSystem.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#ifndef _CSBACKEND_PLATFORM_LINUX_INPUT_POINTER_POINTERSYSTEM_H_
+#define _CSBACKEND_PLATFORM_LINUX_INPUT_POINTER_POINTERSYSTEM_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Platform/Linux/ForwardDeclarations.h>
+#include <ChilliSource/Input/Pointer/PointerSystem.h>
+
+namespace CSBackend
+{
+	namespace Linux
+	{
+		//------------------------------------------------------------
+		/// The Linux backend for the pointer system. There is no input
+		/// device when running headless so no pointers are ever
+		/// created, but the system is provided so that systems which
+		/// listen for pointer events, such as the canvas, still work.
+		//------------------------------------------------------------
+		class PointerSystem final : public CSInput::PointerSystem
+		{
+		public:
+			CS_DECLARE_NAMEDTYPE(PointerSystem);
+			//----------------------------------------------------
+			/// @param The interface Id.
+			///
+			/// @return Whether system is of given type.
+			//----------------------------------------------------
+			bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+			//----------------------------------------------------
+			/// There is no cursor so this does nothing.
+			//----------------------------------------------------
+			void HideCursor() override;
+			//----------------------------------------------------
+			/// There is no cursor so this does nothing.
+			//----------------------------------------------------
+			void ShowCursor() override;
+		private:
+			friend CSInput::PointerSystemUPtr CSInput::PointerSystem::Create();
+			//------------------------------------------------
+			/// Private constructor to force the use of the
+			/// factory method.
+			//------------------------------------------------
+			PointerSystem() = default;
+		};
+	}
+}
+
+#endif
+
+#endif
@@ -0,0 +1,112 @@
+//
+//  Main.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifdef CS_TARGETPLATFORM_LINUX
+
+#include <CSBackend/Platform/Linux/Core/Base/MainLoop.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+	//----------------------------------------------------------------------------------
+	/// Parses the command line options for the main loop. The following options are
+	/// supported:
+	///
+	///	--frames <count>		Quit after the given number of frames.
+	///	--timestep <seconds>	Advance each frame by a fixed time step.
+	///	--uncapped				Don't limit the frame rate to the preferred FPS.
+	///	--resolution <w>x<h>	The resolution of the virtual screen.
+	///	--cores <count>			The number of CPU cores reported to the application,
+	///							which the task scheduler sizes its thread pool from.
+	///
+	/// @param The number of arguments
+	/// @param The arguments
+	///
+	/// @return The main loop options.
+	//----------------------------------------------------------------------------------
+	CSBackend::Linux::MainLoop::Options ParseOptions(int in_argc, char* in_argv[])
+	{
+		CSBackend::Linux::MainLoop::Options options;
+
+		for (int i = 1; i < in_argc; ++i)
+		{
+			const bool hasValue = (i + 1 < in_argc);
+
+			if (strcmp(in_argv[i], "--frames") == 0 && hasValue == true)
+			{
+				options.m_maxFrames = (u32)strtoul(in_argv[++i], nullptr, 10);
+			}
+			else if (strcmp(in_argv[i], "--timestep") == 0 && hasValue == true)
+			{
+				options.m_fixedTimeStep = strtof(in_argv[++i], nullptr);
+			}
+			else if (strcmp(in_argv[i], "--uncapped") == 0)
+			{
+				options.m_isFrameRateCapped = false;
+			}
+			else if (strcmp(in_argv[i], "--resolution") == 0 && hasValue == true)
+			{
+				char* heightString = nullptr;
+				options.m_resolution.x = (s32)strtoul(in_argv[++i], &heightString, 10);
+				options.m_resolution.y = (heightString != nullptr && *heightString == 'x') ? (s32)strtoul(heightString + 1, nullptr, 10) : 0;
+			}
+			else if (strcmp(in_argv[i], "--cores") == 0 && hasValue == true)
+			{
+				options.m_numCPUCores = (u32)strtoul(in_argv[++i], nullptr, 10);
+			}
+			else
+			{
+				fprintf(stderr, "[Chilli Source] Unknown command line option: %s\n", in_argv[i]);
+			}
+		}
+
+		return options;
+	}
+}
+
+//----------------------------------------------------------------------------------
+/// Includes the "main" function for Linux and will create the inherited CS
+/// application using the exposed CreateApplication method that the application
+/// code base must implement. The application is run headless.
+///
+/// @param The number of arguments
+/// @param The arguments
+///
+/// @return Exit status
+//----------------------------------------------------------------------------------
+int main(int in_argc, char* in_argv[])
+{
+	CSBackend::Linux::MainLoop::Create(ParseOptions(in_argc, in_argv));
+	CSBackend::Linux::MainLoop::Get()->Run();
+	CSBackend::Linux::MainLoop::Destroy();
+	return 0;
+}
+
+#endif
@@ -0,0 +1,87 @@
+//
+//  MeshBuffer.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSBackend/Rendering/Null/Base/MeshBuffer.h>
+
+#include <CSBackend/Rendering/Null/Base/RenderSystem.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        MeshBuffer::MeshBuffer(CSRendering::BufferDescription& in_desc, RenderSystem* in_renderSystem)
+            : CSRendering::MeshBuffer(in_desc), m_renderSystem(in_renderSystem)
+        {
+            CS_ASSERT(m_renderSystem != nullptr, "Mesh buffer requires a render system.");
+            
+            if (mBufferDesc.VertexDataCapacity > 0)
+            {
+                m_vertexData.reset(new u8[mBufferDesc.VertexDataCapacity]);
+            }
+            
+            if (mBufferDesc.IndexDataCapacity > 0)
+            {
+                m_indexData.reset(new u8[mBufferDesc.IndexDataCapacity]);
+            }
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void MeshBuffer::Bind()
+        {
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        bool MeshBuffer::LockVertex(f32** out_buffer, u32 in_dataOffset, u32 in_dataStride)
+        {
+            (*out_buffer) = reinterpret_cast<f32*>(m_vertexData.get());
+            return ((*out_buffer) != nullptr);
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        bool MeshBuffer::LockIndex(u16** out_buffer, u32 in_dataOffset, u32 in_dataStride)
+        {
+            (*out_buffer) = reinterpret_cast<u16*>(m_indexData.get());
+            return ((*out_buffer) != nullptr);
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        bool MeshBuffer::UnlockVertex()
+        {
+            m_renderSystem->GetRenderStats().RecordBufferUpload(mBufferDesc.VertexDataCapacity, 0);
+            return true;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        bool MeshBuffer::UnlockIndex()
+        {
+            m_renderSystem->GetRenderStats().RecordBufferUpload(0, mBufferDesc.IndexDataCapacity);
+            return true;
+        }
+    }
+}
@@ -0,0 +1,93 @@
+//
+//  MeshBuffer.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_BASE_MESHBUFFER_H_
+#define _CSBACKEND_RENDERING_NULL_BASE_MESHBUFFER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Base/MeshBuffer.h>
+
+#include <memory>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //----------------------------------------------------------
+        /// A mesh buffer backed by system memory. Unlocking the
+        /// buffer records an upload of its full capacity with the
+        /// render system, mirroring the cost of the buffer being
+        /// re-specified by the OpenGL backend.
+        //----------------------------------------------------------
+        class MeshBuffer final : public CSRendering::MeshBuffer
+        {
+        public:
+            //-----------------------------------------------------
+            /// @param The buffer description.
+            /// @param The render system which uploads are recorded
+            /// with.
+            //-----------------------------------------------------
+            MeshBuffer(CSRendering::BufferDescription& in_desc, RenderSystem* in_renderSystem);
+            //-----------------------------------------------------
+            //-----------------------------------------------------
+            void Bind() override;
+            //-----------------------------------------------------
+            /// @param [Out] The pointer to the buffer
+            /// @param The offset to the subset of the buffer
+            /// @param The vertex layout stride
+            ///
+            /// @return If successful
+            //-----------------------------------------------------
+            bool LockVertex(f32** out_buffer, u32 in_dataOffset, u32 in_dataStride) override;
+            //-----------------------------------------------------
+            /// @param [Out] The pointer to the buffer
+            /// @param The offset to the subset of the buffer
+            /// @param The index stride
+            ///
+            /// @return If successful. This will fail if the buffer
+            /// was described without an index buffer.
+            //-----------------------------------------------------
+            bool LockIndex(u16** out_buffer, u32 in_dataOffset, u32 in_dataStride) override;
+            //-----------------------------------------------------
+            /// @return If successful
+            //-----------------------------------------------------
+            bool UnlockVertex() override;
+            //-----------------------------------------------------
+            /// @return If successful
+            //-----------------------------------------------------
+            bool UnlockIndex() override;
+            
+        private:
+            RenderSystem* m_renderSystem;
+            std::unique_ptr<u8[]> m_vertexData;
+            std::unique_ptr<u8[]> m_indexData;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,89 @@
+//
+//  RenderCapabilities.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_BASE_RENDERCAPABILITIES_H_
+#define _CSBACKEND_RENDERING_NULL_BASE_RENDERCAPABILITIES_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Base/RenderCapabilities.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //---------------------------------------------------------
+        /// The null backend for the render capabilities. There is
+        /// no device to query so this reports a fixed set of
+        /// capabilities equivalent to a typical GLES 2.0 device
+        /// with all extensions present, so that the same code
+        /// paths are exercised as on hardware.
+        //---------------------------------------------------------
+        class RenderCapabilities final : public CSRendering::RenderCapabilities
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(RenderCapabilities);
+            //-------------------------------------------------
+            /// @param The interface Id.
+            ///
+            /// @return Whether system is of given type.
+            //-------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //-------------------------------------------------
+            /// @return Whether or not shadows are supported.
+            //-------------------------------------------------
+            bool IsShadowMappingSupported() const override;
+            //-------------------------------------------------
+            /// @return Whether or not depth textures are
+            /// supported.
+            //-------------------------------------------------
+            bool IsDepthTextureSupported() const override;
+            //-------------------------------------------------
+            /// @return Whether or not map buffer is supported.
+            //-------------------------------------------------
+            bool IsMapBufferSupported() const override;
+            //-------------------------------------------------
+            /// @return The maximum texture size.
+            //-------------------------------------------------
+            u32 GetMaxTextureSize() const override;
+            //-------------------------------------------------
+            /// @return The number of texture units.
+            //-------------------------------------------------
+            u32 GetNumTextureUnits() const override;
+            
+        private:
+            friend CSRendering::RenderCapabilitiesUPtr CSRendering::RenderCapabilities::Create();
+            //-------------------------------------------------
+            /// Private constructor to enforce use of the
+            /// factory method.
+            //-------------------------------------------------
+            RenderCapabilities() = default;
+        };
+    }
+}
+
+#endif
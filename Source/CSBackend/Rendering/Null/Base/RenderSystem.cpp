@@ -0,0 +1,312 @@
+//
+//  RenderSystem.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSBackend/Rendering/Null/Base/RenderSystem.h>
+
+#include <CSBackend/Rendering/Null/Base/MeshBuffer.h>
+#include <CSBackend/Rendering/Null/Base/RenderTarget.h>
+#include <ChilliSource/Rendering/Material/Material.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        CS_DEFINE_NAMEDTYPE(RenderSystem);
+        
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        bool RenderSystem::IsA(CSCore::InterfaceIDType in_interfaceId) const
+        {
+            return (in_interfaceId == CSRendering::RenderSystem::InterfaceID || in_interfaceId == RenderSystem::InterfaceID);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::Init()
+        {
+            m_currentMaterial = nullptr;
+            m_currentShader = nullptr;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::Resume()
+        {
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::Suspend()
+        {
+            m_currentMaterial = nullptr;
+            m_currentShader = nullptr;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::Destroy()
+        {
+            m_currentMaterial = nullptr;
+            m_currentShader = nullptr;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::BeginFrame(CSRendering::RenderTarget* in_activeRenderTarget)
+        {
+            if (in_activeRenderTarget != nullptr)
+            {
+                in_activeRenderTarget->Bind();
+                m_renderStats.RecordRenderTargetPass();
+            }
+            
+            EnableColourWriting(true);
+            EnableDepthWriting(true);
+            
+            //Materials are re-applied at the start of every frame, as they are in the OpenGL backend.
+            m_currentMaterial = nullptr;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EndFrame(CSRendering::RenderTarget* in_activeRenderTarget)
+        {
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::ApplyMaterial(const CSRendering::MaterialCSPtr& in_material, CSRendering::ShaderPass in_shaderPass)
+        {
+            CS_ASSERT(in_material != nullptr, "Cannot apply null material");
+            
+            const CSRendering::Shader* shader = in_material->GetShader(in_shaderPass).get();
+            CS_ASSERT(shader != nullptr, "Cannot render with null shader");
+            
+            bool hasMaterialChanged = m_currentMaterial == nullptr || m_currentMaterial != in_material.get() || m_currentMaterial->IsCacheValid() == false || shader != m_currentShader;
+            if (hasMaterialChanged == true)
+            {
+                m_currentMaterial = in_material.get();
+                m_renderStats.RecordMaterialChange();
+                
+                EnableAlphaBlending(m_currentMaterial->IsTransparencyEnabled());
+                SetBlendFunction(m_currentMaterial->GetSourceBlendMode(), m_currentMaterial->GetDestBlendMode());
+                EnableFaceCulling(m_currentMaterial->IsFaceCullingEnabled());
+                SetCullFace(m_currentMaterial->GetCullFace());
+                EnableColourWriting(m_currentMaterial->IsColourWriteEnabled());
+                EnableDepthWriting(m_currentMaterial->IsDepthWriteEnabled());
+                EnableDepthTesting(m_currentMaterial->IsDepthTestEnabled());
+                
+                if (shader != m_currentShader)
+                {
+                    m_currentShader = shader;
+                    m_renderStats.RecordShaderBind();
+                }
+                
+                for (u32 i = 0; i < m_currentMaterial->GetNumTextures(); ++i)
+                {
+                    m_renderStats.RecordTextureBind();
+                }
+                if (m_currentMaterial->GetCubemap() != nullptr)
+                {
+                    m_renderStats.RecordTextureBind();
+                }
+                
+                const_cast<CSRendering::Material*>(m_currentMaterial)->SetCacheValid();
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::ApplyJoints(const std::vector<CSCore::Vector4>& in_jointPalette)
+        {
+            CS_ASSERT(m_currentShader != nullptr,  "Cannot set joints without binding shader");
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::ApplyCamera(const CSCore::Vector3& in_position, const CSCore::Matrix4& in_view, const CSCore::Matrix4& in_projection, const CSCore::Colour& in_clearColour)
+        {
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetLight(CSRendering::LightComponent* in_lightComponent)
+        {
+            //A change of light forces the material to be re-applied, as it does in the OpenGL backend.
+            m_currentMaterial = nullptr;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        template <typename TState> void RenderSystem::ChangeState(TState& out_state, const TState& in_value)
+        {
+            if (out_state != in_value)
+            {
+                out_state = in_value;
+                m_renderStats.RecordStateChange();
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableAlphaBlending(bool in_isEnabled)
+        {
+            if (m_isAlphaBlendingLocked == false)
+            {
+                ChangeState(m_isAlphaBlendingEnabled, in_isEnabled);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableDepthTesting(bool in_isEnabled)
+        {
+            ChangeState(m_isDepthTestingEnabled, in_isEnabled);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableFaceCulling(bool in_isEnabled)
+        {
+            ChangeState(m_isFaceCullingEnabled, in_isEnabled);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableColourWriting(bool in_isEnabled)
+        {
+            ChangeState(m_isColourWritingEnabled, in_isEnabled);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableDepthWriting(bool in_isEnabled)
+        {
+            if (m_isDepthWritingLocked == false)
+            {
+                ChangeState(m_isDepthWritingEnabled, in_isEnabled);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::EnableScissorTesting(bool in_isEnabled)
+        {
+            ChangeState(m_isScissorTestingEnabled, in_isEnabled);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::LockDepthWriting()
+        {
+            m_isDepthWritingLocked = true;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::UnlockDepthWriting()
+        {
+            m_isDepthWritingLocked = false;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::LockAlphaBlending()
+        {
+            m_isAlphaBlendingLocked = true;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::UnlockAlphaBlending()
+        {
+            m_isAlphaBlendingLocked = false;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::LockBlendFunction()
+        {
+            m_isBlendFunctionLocked = true;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::UnlockBlendFunction()
+        {
+            m_isBlendFunctionLocked = false;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetBlendFunction(CSRendering::BlendMode in_source, CSRendering::BlendMode in_destination)
+        {
+            if (m_isBlendFunctionLocked == false && (in_source != m_sourceBlendMode || in_destination != m_destinationBlendMode))
+            {
+                m_sourceBlendMode = in_source;
+                m_destinationBlendMode = in_destination;
+                m_renderStats.RecordStateChange();
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetDepthFunction(CSRendering::DepthTestComparison in_function)
+        {
+            ChangeState(m_depthFunction, in_function);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetCullFace(CSRendering::CullFace in_cullFace)
+        {
+            ChangeState(m_cullFace, in_cullFace);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::SetScissorRegion(const CSCore::Vector2& in_position, const CSCore::Vector2& in_size)
+        {
+            if (in_position != m_scissorPosition || in_size != m_scissorSize)
+            {
+                m_scissorPosition = in_position;
+                m_scissorSize = in_size;
+                m_renderStats.RecordStateChange();
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        CSRendering::MeshBuffer* RenderSystem::CreateBuffer(CSRendering::BufferDescription& in_desc)
+        {
+            return new MeshBuffer(in_desc, this);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::RenderVertexBuffer(CSRendering::MeshBuffer* in_buffer, u32 in_offset, u32 in_numVerts, const CSCore::Matrix4& in_worldMat)
+        {
+            CS_ASSERT(in_buffer != nullptr, "Cannot render a null buffer.");
+            CS_ASSERT(m_currentShader != nullptr, "Cannot render without a bound shader.");
+            CS_ASSERT(in_offset + in_numVerts <= in_buffer->GetVertexCapacity(), "Vertex range exceeds buffer capacity.");
+            
+            in_buffer->Bind();
+            
+            m_renderStats.RecordDrawCall(in_numVerts, 0);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderSystem::RenderBuffer(CSRendering::MeshBuffer* in_buffer, u32 in_offset, u32 in_numIndices, const CSCore::Matrix4& in_worldMat)
+        {
+            CS_ASSERT(in_buffer != nullptr, "Cannot render a null buffer.");
+            CS_ASSERT(m_currentShader != nullptr, "Cannot render without a bound shader.");
+            
+            in_buffer->Bind();
+            
+            m_renderStats.RecordDrawCall(0, in_numIndices);
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        CSRendering::RenderTarget* RenderSystem::CreateRenderTarget(u32 in_width, u32 in_height)
+        {
+            RenderTarget* renderTarget = new RenderTarget();
+            renderTarget->Init(in_width, in_height);
+            return renderTarget;
+        }
+    }
+}
@@ -0,0 +1,237 @@
+//
+//  RenderSystem.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_BASE_RENDERSYSTEM_H_
+#define _CSBACKEND_RENDERING_NULL_BASE_RENDERSYSTEM_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Rendering/Base/BlendMode.h>
+#include <ChilliSource/Rendering/Base/CullFace.h>
+#include <ChilliSource/Rendering/Base/DepthTestComparison.h>
+#include <ChilliSource/Rendering/Base/RenderSystem.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //----------------------------------------------------------
+        /// A render system that requires no GPU. Nothing is drawn
+        /// but every request is validated and recorded so that the
+        /// rest of the engine runs exactly as it would with a real
+        /// backend. The draw calls, state changes and uploaded bytes
+        /// are recorded into the render stats, which allows scene,
+        /// UI and particle benchmarks to be run headless.
+        ///
+        /// Render state is cached in the same way as the OpenGL
+        /// backend so that state change counts reflect what would
+        /// actually be submitted to the driver.
+        //----------------------------------------------------------
+        class RenderSystem final : public CSRendering::RenderSystem
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(RenderSystem);
+            //----------------------------------------------------------
+            /// @param Comparison Type
+            ///
+            /// @return Whether the class matches the comparison type
+            //----------------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //----------------------------------------------------------
+            /// Resets all cached state.
+            //----------------------------------------------------------
+            void Init() override;
+            //----------------------------------------------------------
+            //----------------------------------------------------------
+            void Resume() override;
+            //----------------------------------------------------------
+            //----------------------------------------------------------
+            void Suspend() override;
+            //----------------------------------------------------------
+            //----------------------------------------------------------
+            void Destroy() override;
+            //----------------------------------------------------------
+            /// @param The active render target or null for the screen
+            //----------------------------------------------------------
+            void BeginFrame(CSRendering::RenderTarget* in_activeRenderTarget) override;
+            //----------------------------------------------------------
+            /// @param The active render target or null for the screen
+            //----------------------------------------------------------
+            void EndFrame(CSRendering::RenderTarget* in_activeRenderTarget) override;
+            //----------------------------------------------------------
+            /// @param Material
+            /// @param Shader pass
+            //----------------------------------------------------------
+            void ApplyMaterial(const CSRendering::MaterialCSPtr& in_material, CSRendering::ShaderPass in_shaderPass) override;
+            //----------------------------------------------------------
+            /// @param The joint palette
+            //----------------------------------------------------------
+            void ApplyJoints(const std::vector<CSCore::Vector4>& in_jointPalette) override;
+            //----------------------------------------------------------
+            /// @param Camera position
+            /// @param Camera view matrix
+            /// @param Camera projection matrix
+            /// @param Clear colour
+            //----------------------------------------------------------
+            void ApplyCamera(const CSCore::Vector3& in_position, const CSCore::Matrix4& in_view, const CSCore::Matrix4& in_projection, const CSCore::Colour& in_clearColour) override;
+            //----------------------------------------------------------
+            /// @param The active light
+            //----------------------------------------------------------
+            void SetLight(CSRendering::LightComponent* in_lightComponent) override;
+            //----------------------------------------------------------
+            /// @param Whether alpha blending is enabled
+            //----------------------------------------------------------
+            void EnableAlphaBlending(bool in_isEnabled) override;
+            //----------------------------------------------------------
+            /// @param Whether depth testing is enabled
+            //----------------------------------------------------------
+            void EnableDepthTesting(bool in_isEnabled) override;
+            //----------------------------------------------------------
+            /// @param Whether face culling is enabled
+            //----------------------------------------------------------
+            void EnableFaceCulling(bool in_isEnabled) override;
+            //----------------------------------------------------------
+            /// @param Whether colour writing is enabled
+            //----------------------------------------------------------
+            void EnableColourWriting(bool in_isEnabled) override;
+            //----------------------------------------------------------
+            /// @param Whether depth writing is enabled
+            //----------------------------------------------------------
+            void EnableDepthWriting(bool in_isEnabled) override;
+            //----------------------------------------------------------
+            /// @param Whether scissor testing is enabled
+            //----------------------------------------------------------
+            void EnableScissorTesting(bool in_isEnabled) override;
+            //----------------------------------------------------------
+            //----------------------------------------------------------
+            void LockDepthWriting() override;
+            //----------------------------------------------------------
+            //----------------------------------------------------------
+            void UnlockDepthWriting() override;
+            //----------------------------------------------------------
+            //----------------------------------------------------------
+            void LockAlphaBlending() override;
+            //----------------------------------------------------------
+            //----------------------------------------------------------
+            void UnlockAlphaBlending() override;
+            //----------------------------------------------------------
+            //----------------------------------------------------------
+            void LockBlendFunction() override;
+            //----------------------------------------------------------
+            //----------------------------------------------------------
+            void UnlockBlendFunction() override;
+            //----------------------------------------------------------
+            /// @param Source blend function
+            /// @param Destination blend function
+            //----------------------------------------------------------
+            void SetBlendFunction(CSRendering::BlendMode in_source, CSRendering::BlendMode in_destination) override;
+            //----------------------------------------------------------
+            /// @param Depth test comparison function
+            //----------------------------------------------------------
+            void SetDepthFunction(CSRendering::DepthTestComparison in_function) override;
+            //----------------------------------------------------------
+            /// @param Face to cull
+            //----------------------------------------------------------
+            void SetCullFace(CSRendering::CullFace in_cullFace) override;
+            //----------------------------------------------------------
+            /// @param Scissor region bottom left position
+            /// @param Scissor region size
+            //----------------------------------------------------------
+            void SetScissorRegion(const CSCore::Vector2& in_position, const CSCore::Vector2& in_size) override;
+            //----------------------------------------------------------
+            /// @param Buffer description
+            ///
+            /// @return A new mesh buffer backed by system memory
+            //----------------------------------------------------------
+            CSRendering::MeshBuffer* CreateBuffer(CSRendering::BufferDescription& in_desc) override;
+            //----------------------------------------------------------
+            /// Records a non-indexed draw call
+            ///
+            /// @param The buffer to be rendered
+            /// @param Offset into vertex buffer
+            /// @param Number of vertices to render
+            /// @param The world matrix
+            //----------------------------------------------------------
+            void RenderVertexBuffer(CSRendering::MeshBuffer* in_buffer, u32 in_offset, u32 in_numVerts, const CSCore::Matrix4& in_worldMat) override;
+            //----------------------------------------------------------
+            /// Records an indexed draw call
+            ///
+            /// @param The buffer to be rendered
+            /// @param Offset into index buffer
+            /// @param Number of indices to render
+            /// @param The world matrix
+            //----------------------------------------------------------
+            void RenderBuffer(CSRendering::MeshBuffer* in_buffer, u32 in_offset, u32 in_numIndices, const CSCore::Matrix4& in_worldMat) override;
+            //----------------------------------------------------------
+            /// @param Width
+            /// @param Height
+            ///
+            /// @return A new render target
+            //----------------------------------------------------------
+            CSRendering::RenderTarget* CreateRenderTarget(u32 in_width, u32 in_height) override;
+            
+        private:
+            friend CSRendering::RenderSystemUPtr CSRendering::RenderSystem::Create(CSRendering::RenderCapabilities*);
+            //----------------------------------------------------------
+            /// Private constructor to enforce use of the factory
+            /// method.
+            //----------------------------------------------------------
+            RenderSystem() = default;
+            //----------------------------------------------------------
+            /// Sets the given cached state to the given value,
+            /// recording a state change if it differs.
+            ///
+            /// @param [Out] The cached state
+            /// @param The new value
+            //----------------------------------------------------------
+            template <typename TState> void ChangeState(TState& out_state, const TState& in_value);
+            
+            const CSRendering::Material* m_currentMaterial = nullptr;
+            const CSRendering::Shader* m_currentShader = nullptr;
+            
+            bool m_isAlphaBlendingEnabled = false;
+            bool m_isDepthTestingEnabled = false;
+            bool m_isFaceCullingEnabled = false;
+            bool m_isColourWritingEnabled = true;
+            bool m_isDepthWritingEnabled = false;
+            bool m_isScissorTestingEnabled = false;
+            bool m_isDepthWritingLocked = false;
+            bool m_isAlphaBlendingLocked = false;
+            bool m_isBlendFunctionLocked = false;
+            CSRendering::BlendMode m_sourceBlendMode = CSRendering::BlendMode::k_one;
+            CSRendering::BlendMode m_destinationBlendMode = CSRendering::BlendMode::k_zero;
+            CSRendering::DepthTestComparison m_depthFunction = CSRendering::DepthTestComparison::k_less;
+            CSRendering::CullFace m_cullFace = CSRendering::CullFace::k_back;
+            CSCore::Vector2 m_scissorPosition;
+            CSCore::Vector2 m_scissorSize;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,82 @@
+//
+//  RenderTarget.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_BASE_RENDERTARGET_H_
+#define _CSBACKEND_RENDERING_NULL_BASE_RENDERTARGET_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Base/RenderTarget.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //----------------------------------------------------------
+        /// A render target which holds references to its target
+        /// textures but never renders into them.
+        //----------------------------------------------------------
+        class RenderTarget final : public CSRendering::RenderTarget
+        {
+        public:
+            //------------------------------------------------------
+            /// @param Width of the render target
+            /// @param Height of the render target
+            //------------------------------------------------------
+            void Init(u32 in_width, u32 in_height);
+            //------------------------------------------------------
+            /// @param The colour texture.
+            /// @param The depth texture.
+            //------------------------------------------------------
+            void SetTargetTextures(const CSRendering::TextureSPtr& in_colourTexture, const CSRendering::TextureSPtr& in_depthTexture) override;
+            //------------------------------------------------------
+            /// @return The colour texture.
+            //------------------------------------------------------
+            const CSRendering::TextureSPtr& GetColourTexture() const override;
+            //------------------------------------------------------
+            /// @return The depth texture.
+            //------------------------------------------------------
+            const CSRendering::TextureSPtr& GetDepthTexture() const override;
+            //------------------------------------------------------
+            //------------------------------------------------------
+            void Bind() override;
+            //------------------------------------------------------
+            //------------------------------------------------------
+            void Discard() override;
+            //------------------------------------------------------
+            /// Releases the target textures.
+            //------------------------------------------------------
+            void Destroy() override;
+            
+        private:
+            CSRendering::TextureSPtr m_colourTexture;
+            CSRendering::TextureSPtr m_depthTexture;
+        };
+    }
+}
+
+#endif
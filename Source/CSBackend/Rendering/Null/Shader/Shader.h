@@ -0,0 +1,71 @@
+//
+//  Shader.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_SHADER_SHADER_H_
+#define _CSBACKEND_RENDERING_NULL_SHADER_SHADER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Shader/Shader.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //----------------------------------------------------------
+        /// A shader resource which holds no program. The shader
+        /// source is validated on build but is never compiled.
+        //----------------------------------------------------------
+        class Shader final : public CSRendering::Shader
+        {
+        public:
+            //----------------------------------------------------------
+            /// @param Comparison Type
+            ///
+            /// @return Whether the class matches the comparison type
+            //----------------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //----------------------------------------------------------
+            /// @param The vertex shader source
+            /// @param The fragment shader source
+            ///
+            /// @return Whether the shader was built successfully
+            //----------------------------------------------------------
+            bool Build(const std::string& in_vs, const std::string& in_fs);
+            
+        private:
+            friend CSRendering::ShaderUPtr CSRendering::Shader::Create();
+            //----------------------------------------------------------
+            /// Private constructor to enforce use of the factory
+            /// method.
+            //----------------------------------------------------------
+            Shader() = default;
+        };
+    }
+}
+
+#endif
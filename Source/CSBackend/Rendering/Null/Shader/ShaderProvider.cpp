@@ -0,0 +1,174 @@
+//
+//  ShaderProvider.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSBackend/Rendering/Null/Shader/ShaderProvider.h>
+
+#include <CSBackend/Rendering/Null/Shader/Shader.h>
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        namespace
+        {
+            const std::string k_shaderFileExtension("csshader");
+            const std::string k_languageTag("GLSL");
+            const std::string k_vsTag("VertexShader");
+            const std::string k_fsTag("FragmentShader");
+            
+            //----------------------------------------------
+            /// Grabs the contents of the chunk identified
+            /// by the given tag, or an empty string if the
+            /// chunk cannot be found.
+            ///
+            /// @param The chunk tag
+            /// @param The string data to search in.
+            ///
+            /// @return Contents of the chunk or empty
+            //----------------------------------------------
+            std::string GetChunk(const std::string& in_chunkTag, const std::string& in_text)
+            {
+                std::string::size_type tagStart = in_text.find(in_chunkTag);
+                if (tagStart == std::string::npos)
+                {
+                    return "";
+                }
+                
+                std::string::size_type openBrace = in_text.find('{', tagStart);
+                if (openBrace == std::string::npos)
+                {
+                    return "";
+                }
+                
+                u32 depth = 0;
+                for (std::string::size_type i = openBrace + 1; i < in_text.size(); ++i)
+                {
+                    if (in_text[i] == '{')
+                    {
+                        ++depth;
+                    }
+                    else if (in_text[i] == '}')
+                    {
+                        if (depth == 0)
+                        {
+                            return in_text.substr(openBrace + 1, i - (openBrace + 1));
+                        }
+                        
+                        --depth;
+                    }
+                }
+                
+                return "";
+            }
+            //----------------------------------------------
+            /// Performs the actual loading for the 2
+            /// create methods
+            ///
+            /// @param Location
+            /// @param File path
+            /// @param Completion delegate
+            /// @param [Out] Shader resource
+            //----------------------------------------------
+            void LoadShader(CSCore::StorageLocation in_location, const std::string& in_filePath, const CSCore::ResourceProvider::AsyncLoadDelegate& in_delegate, const ShaderSPtr& out_shader)
+            {
+                CSCore::Resource::LoadState loadState = CSCore::Resource::LoadState::k_failed;
+                
+                CSCore::FileStreamSPtr shaderStream = CSCore::Application::Get()->GetFileSystem()->CreateFileStream(in_location, in_filePath, CSCore::FileMode::k_read);
+                if (shaderStream != nullptr && shaderStream->IsBad() == false)
+                {
+                    std::string fileContents;
+                    shaderStream->GetAll(fileContents);
+                    shaderStream->Close();
+                    
+                    std::string languageChunk = GetChunk(k_languageTag, fileContents);
+                    if (out_shader->Build(GetChunk(k_vsTag, languageChunk), GetChunk(k_fsTag, languageChunk)) == true)
+                    {
+                        loadState = CSCore::Resource::LoadState::k_loaded;
+                    }
+                    else
+                    {
+                        CS_LOG_ERROR("Invalid shader file: " + in_filePath);
+                    }
+                }
+                else
+                {
+                    CS_LOG_ERROR("Failed to open shader file: " + in_filePath);
+                }
+                
+                out_shader->SetLoadState(loadState);
+                if (in_delegate != nullptr)
+                {
+                    CSCore::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_shader));
+                }
+            }
+        }
+        
+        CS_DEFINE_NAMEDTYPE(ShaderProvider);
+        
+        //-------------------------------------------------------------------------
+        //-------------------------------------------------------------------------
+        ShaderProviderUPtr ShaderProvider::Create()
+        {
+            return ShaderProviderUPtr(new ShaderProvider());
+        }
+        //-------------------------------------------------------------------------
+        //-------------------------------------------------------------------------
+        bool ShaderProvider::IsA(CSCore::InterfaceIDType in_interfaceId) const
+        {
+            return in_interfaceId == ResourceProvider::InterfaceID || in_interfaceId == ShaderProvider::InterfaceID;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        CSCore::InterfaceIDType ShaderProvider::GetResourceType() const
+        {
+            return CSRendering::Shader::InterfaceID;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        bool ShaderProvider::CanCreateResourceWithFileExtension(const std::string& in_extension) const
+        {
+            return in_extension == k_shaderFileExtension;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void ShaderProvider::CreateResourceFromFile(CSCore::StorageLocation in_location, const std::string& in_filePath, const CSCore::IResourceOptionsBaseCSPtr& in_options, const CSCore::ResourceSPtr& out_resource)
+        {
+            ShaderSPtr shaderResource = std::static_pointer_cast<Shader>(out_resource);
+            LoadShader(in_location, in_filePath, nullptr, shaderResource);
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void ShaderProvider::CreateResourceFromFileAsync(CSCore::StorageLocation in_location, const std::string& in_filePath, const CSCore::IResourceOptionsBaseCSPtr& in_options, const CSCore::ResourceProvider::AsyncLoadDelegate& in_delegate, const CSCore::ResourceSPtr& out_resource)
+        {
+            ShaderSPtr shaderResource = std::static_pointer_cast<Shader>(out_resource);
+            LoadShader(in_location, in_filePath, in_delegate, shaderResource);
+        }
+    }
+}
@@ -0,0 +1,87 @@
+//
+//  Cubemap.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSBackend/Rendering/Null/Texture/Cubemap.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Rendering/Base/RenderSystem.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //--------------------------------------------------
+        //--------------------------------------------------
+        bool Cubemap::IsA(CSCore::InterfaceIDType in_interfaceId) const
+        {
+            return in_interfaceId == CSRendering::Cubemap::InterfaceID;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Cubemap::Build(const std::array<CSRendering::Texture::Descriptor, 6>& in_descs, std::array<CSRendering::Texture::TextureDataUPtr, 6>&& in_datas, bool in_mipMap, bool in_restoreCubemapDataEnabled)
+        {
+            u64 memoryUsage = 0;
+            for (const auto& desc : in_descs)
+            {
+                memoryUsage += desc.m_dataSize;
+            }
+            
+            CSRendering::RenderSystem* renderSystem = CSCore::Application::Get()->GetRenderSystem();
+            if (renderSystem != nullptr)
+            {
+                renderSystem->GetRenderStats().RecordTextureUpload(memoryUsage);
+            }
+            
+            //A full mip chain adds a third on top of the base level.
+            if (in_mipMap == true)
+            {
+                memoryUsage += memoryUsage / 3;
+            }
+            SetMemoryUsage(memoryUsage);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Cubemap::Bind(u32 in_texUnit)
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Cubemap::Unbind()
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Cubemap::SetFilterMode(CSRendering::Texture::FilterMode in_mode)
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Cubemap::SetWrapMode(CSRendering::Texture::WrapMode in_sMode, CSRendering::Texture::WrapMode in_tMode)
+        {
+        }
+    }
+}
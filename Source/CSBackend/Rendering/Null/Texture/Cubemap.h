@@ -0,0 +1,88 @@
+//
+//  Cubemap.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_TEXTURE_CUBEMAP_H_
+#define _CSBACKEND_RENDERING_NULL_TEXTURE_CUBEMAP_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Texture/Cubemap.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //--------------------------------------------------------------
+        /// A cubemap resource which discards its image data. Building
+        /// the cubemap records the upload of all six faces with the
+        /// null render system.
+        //--------------------------------------------------------------
+        class Cubemap final : public CSRendering::Cubemap
+        {
+        public:
+            //--------------------------------------------------
+            /// @param Interface to compare
+            ///
+            /// @return Whether the object implements the given interface
+            //--------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //--------------------------------------------------------------
+            /// @param Face descriptors
+            /// @param Face data. The data is discarded.
+            /// @param Whether or not to generate mip maps
+            /// @param Ignored as there is no context to restore.
+            //--------------------------------------------------------------
+            void Build(const std::array<CSRendering::Texture::Descriptor, 6>& in_descs, std::array<CSRendering::Texture::TextureDataUPtr, 6>&& in_datas, bool in_mipMap, bool in_restoreCubemapDataEnabled) override;
+            //--------------------------------------------------------------
+            /// @param Texture unit
+            //--------------------------------------------------------------
+            void Bind(u32 in_texUnit = 0) override;
+            //--------------------------------------------------------------
+            //--------------------------------------------------------------
+            void Unbind() override;
+            //--------------------------------------------------------------
+            /// @param Filter mode
+            //--------------------------------------------------------------
+            void SetFilterMode(CSRendering::Texture::FilterMode in_mode) override;
+            //--------------------------------------------------------------
+            /// @param Horizontal wrapping
+            /// @param Vertical wrapping
+            //--------------------------------------------------------------
+            void SetWrapMode(CSRendering::Texture::WrapMode in_sMode, CSRendering::Texture::WrapMode in_tMode) override;
+            
+        private:
+            friend CSRendering::CubemapUPtr CSRendering::Cubemap::Create();
+            //----------------------------------------------------------
+            /// Private constructor to enforce use of the factory
+            /// method.
+            //----------------------------------------------------------
+            Cubemap() = default;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,97 @@
+//
+//  Texture.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSBackend/Rendering/Null/Texture/Texture.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Rendering/Base/RenderSystem.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //--------------------------------------------------
+        //--------------------------------------------------
+        bool Texture::IsA(CSCore::InterfaceIDType in_interfaceId) const
+        {
+            return in_interfaceId == CSRendering::Texture::InterfaceID;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::Build(const Descriptor& in_desc, TextureDataUPtr in_data, bool in_mipMap, bool in_restoreTextureDataEnabled)
+        {
+            m_width = in_desc.m_width;
+            m_height = in_desc.m_height;
+            
+            CSRendering::RenderSystem* renderSystem = CSCore::Application::Get()->GetRenderSystem();
+            if (renderSystem != nullptr && in_data != nullptr)
+            {
+                renderSystem->GetRenderStats().RecordTextureUpload(in_desc.m_dataSize);
+            }
+            
+            //A full mip chain adds a third on top of the base level.
+            u64 memoryUsage = in_desc.m_dataSize;
+            if (in_mipMap == true)
+            {
+                memoryUsage += memoryUsage / 3;
+            }
+            SetMemoryUsage(memoryUsage);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::Bind(u32 in_texUnit)
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::Unbind()
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::SetFilterMode(FilterMode in_mode)
+        {
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void Texture::SetWrapMode(WrapMode in_sMode, WrapMode in_tMode)
+        {
+        }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        u32 Texture::GetWidth() const
+        {
+            return m_width;
+        }
+        //--------------------------------------------------
+        //--------------------------------------------------
+        u32 Texture::GetHeight() const
+        {
+            return m_height;
+        }
+    }
+}
@@ -0,0 +1,100 @@
+//
+//  Texture.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBACKEND_RENDERING_NULL_TEXTURE_TEXTURE_H_
+#define _CSBACKEND_RENDERING_NULL_TEXTURE_TEXTURE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Rendering/Null/ForwardDeclarations.h>
+#include <ChilliSource/Rendering/Texture/Texture.h>
+
+namespace CSBackend
+{
+    namespace Null
+    {
+        //--------------------------------------------------------------
+        /// A texture resource which keeps its description but not its
+        /// image data. Building the texture records the upload with
+        /// the null render system and reports the memory usage the
+        /// OpenGL backend would.
+        //--------------------------------------------------------------
+        class Texture final : public CSRendering::Texture
+        {
+        public:
+            //--------------------------------------------------
+            /// @param Interface to compare
+            ///
+            /// @return Whether the object implements the given interface
+            //--------------------------------------------------
+            bool IsA(CSCore::InterfaceIDType in_interfaceId) const override;
+            //--------------------------------------------------------------
+            /// @param Texture descriptor
+            /// @param Texture data. The data is discarded.
+            /// @param Whether or not to generate mip maps
+            /// @param Ignored as there is no context to restore.
+            //--------------------------------------------------------------
+            void Build(const Descriptor& in_desc, TextureDataUPtr in_data, bool in_mipMap, bool in_restoreTextureDataEnabled) override;
+            //--------------------------------------------------------------
+            /// @param Texture unit
+            //--------------------------------------------------------------
+            void Bind(u32 in_texUnit = 0) override;
+            //--------------------------------------------------------------
+            //--------------------------------------------------------------
+            void Unbind() override;
+            //--------------------------------------------------------------
+            /// @param Filter mode
+            //--------------------------------------------------------------
+            void SetFilterMode(FilterMode in_mode) override;
+            //--------------------------------------------------------------
+            /// @param Horizontal wrapping
+            /// @param Vertical wrapping
+            //--------------------------------------------------------------
+            void SetWrapMode(WrapMode in_sMode, WrapMode in_tMode) override;
+            //--------------------------------------------------
+            /// @return Texture width
+            //--------------------------------------------------
+            u32 GetWidth() const override;
+            //--------------------------------------------------
+            /// @return Texture height
+            //--------------------------------------------------
+            u32 GetHeight() const override;
+            
+        private:
+            friend CSRendering::TextureUPtr CSRendering::Texture::Create();
+            //----------------------------------------------------------
+            /// Private constructor to enforce use of the factory
+            /// method.
+            //----------------------------------------------------------
+            Texture() = default;
+            
+            u32 m_width = 0;
+            u32 m_height = 0;
+        };
+    }
+}
+
+#endif
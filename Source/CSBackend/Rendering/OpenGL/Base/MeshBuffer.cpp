@@ -211,6 +211,12 @@ namespace CSBackend
 		//-----------------------------------------------------
 		bool MeshBuffer::UnlockVertex()
 		{
+            //Either way the whole buffer is uploaded
+            if(mpRenderSystem != nullptr)
+            {
+                mpRenderSystem->GetRenderStats().RecordBufferUpload(mBufferDesc.VertexDataCapacity, 0);
+            }
+            
 			if(mbMapBufferAvailable)
 			{
 				mpVertexData = nullptr;
@@ -241,6 +247,11 @@ namespace CSBackend
             if(!mIndexBuffer)
                 return false;
             
+            if(mpRenderSystem != nullptr)
+            {
+                mpRenderSystem->GetRenderStats().RecordBufferUpload(0, mBufferDesc.IndexDataCapacity);
+            }
+            
 			if(mbMapBufferAvailable)
 			{
 				mpIndexData = nullptr;
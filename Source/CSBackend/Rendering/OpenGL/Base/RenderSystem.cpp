@@ -150,12 +150,6 @@ namespace CSBackend
             CS_ASSERT(mpRenderCapabilities, "Cannot find required system: Render Capabilities.");
             mpRenderCapabilities->DetermineCapabilities();
             
-            m_textureUniformNames.clear();
-            for(u32 i=0; i<mpRenderCapabilities->GetNumTextureUnits(); ++i)
-            {
-                m_textureUniformNames.push_back("u_texture" + CSCore::ToString(i));
-            }
-            
             ForceRefreshRenderStates();
 			
             OnScreenResolutionChanged(m_screen->GetResolution());
@@ -262,6 +256,7 @@ namespace CSBackend
             {
                 mudwNumBoundTextures = 0;
                 mpCurrentMaterial = in_material.get();
+                m_renderStats.RecordMaterialChange();
                 
                 //Bind this materials shader
                 ApplyRenderStates(mpCurrentMaterial);
@@ -272,6 +267,7 @@ namespace CSBackend
                 {
                     shader->Bind();
                     m_currentShader = shader;
+                    m_renderStats.RecordShaderBind();
                     
                     mbEmissiveSet = false;
                     mbAmbientSet = false;
@@ -283,7 +279,7 @@ namespace CSBackend
                 //Set all the custom shader variables
                 if(mpCurrentMaterial->IsVariableCacheValid() == false || hasShaderChanged == true)
                 {
-                    ApplyShaderVariables(mpCurrentMaterial, m_currentShader);
+                    ApplyShaderVariables(mpCurrentMaterial, in_shaderPass, m_currentShader);
                 }
                 
                 ApplyTextures(mpCurrentMaterial, m_currentShader);
@@ -295,25 +291,16 @@ namespace CSBackend
                 const_cast<CSRendering::Material*>(mpCurrentMaterial)->SetCacheValid();
             }
             
-            shader->SetUniform("u_cameraPos", mvCameraPos, Shader::UniformNotFoundPolicy::k_failSilent);
+            shader->SetUniform(Shader::BuiltInUniform::k_cameraPos, mvCameraPos, Shader::UniformNotFoundPolicy::k_failSilent);
 		}
         //----------------------------------------------------------
         /// Apply Joints
         //----------------------------------------------------------
-        void RenderSystem::ApplyJoints(const std::vector<CSCore::Matrix4>& inaJoints)
+        void RenderSystem::ApplyJoints(const std::vector<CSCore::Vector4>& in_jointPalette)
         {
             CS_ASSERT(m_currentShader != nullptr,  "Cannot set joints without binding shader");
             
-            //Remove the final column from the joint matrix data as it is always going to be [0 0 0 1].
-            std::vector<CSCore::Vector4> jointVectors;
-            for (const auto& joint : inaJoints)
-            {
-                jointVectors.push_back(CSCore::Vector4(joint.m[0], joint.m[4], joint.m[8], joint.m[12]));
-                jointVectors.push_back(CSCore::Vector4(joint.m[1], joint.m[5], joint.m[9], joint.m[13]));
-                jointVectors.push_back(CSCore::Vector4(joint.m[2], joint.m[6], joint.m[10], joint.m[14]));
-            }
-            
-            m_currentShader->SetUniform("u_joints", jointVectors);
+            m_currentShader->SetUniform(Shader::BuiltInUniform::k_joints, in_jointPalette);
         }
         //----------------------------------------------------------
 		/// Apply Render States
@@ -333,33 +320,31 @@ namespace CSBackend
         //----------------------------------------------------------
 		/// Apply Shader Variables
 		//----------------------------------------------------------
-		void RenderSystem::ApplyShaderVariables(const CSRendering::Material* inMaterial, Shader* out_shader)
+		void RenderSystem::ApplyShaderVariables(const CSRendering::Material* inMaterial, CSRendering::ShaderPass in_shaderPass, Shader* out_shader)
 		{
-			//Get and set all the custom shader variables
-			for(auto it = inMaterial->m_floatVars.begin(); it!= inMaterial->m_floatVars.end(); ++it)
-			{
-                out_shader->SetUniform(it->first, it->second);
-			}
-			for(auto it = inMaterial->m_vec2Vars.begin(); it!= inMaterial->m_vec2Vars.end(); ++it)
-			{
-                out_shader->SetUniform(it->first, it->second);
-			}
-			for(auto it = inMaterial->m_vec3Vars.begin(); it!= inMaterial->m_vec3Vars.end(); ++it)
-			{
-				out_shader->SetUniform(it->first, it->second);
-			}
-			for(auto it = inMaterial->m_vec4Vars.begin(); it!= inMaterial->m_vec4Vars.end(); ++it)
-			{
-				out_shader->SetUniform(it->first, it->second);
-			}
-			for(auto it = inMaterial->m_mat4Vars.begin(); it!= inMaterial->m_mat4Vars.end(); ++it)
-			{
-				out_shader->SetUniform(it->first, it->second);
-			}
-			for(auto it = inMaterial->m_colourVars.begin(); it!= inMaterial->m_colourVars.end(); ++it)
-			{
-				out_shader->SetUniform(it->first, it->second);
-			}
+            //The handles are only looked up by name if the pass has a different shader or variables have been added
+            CSRendering::Material::ShaderVarHandles& handles = inMaterial->m_shaderVarHandles[(u32)in_shaderPass];
+            if(handles.m_uniformTableId != out_shader->GetUniformTableId() || handles.m_handles.size() != inMaterial->m_shaderVars.size())
+            {
+                handles.m_uniformTableId = out_shader->GetUniformTableId();
+                handles.m_handles.clear();
+                for(const auto& shaderVar : inMaterial->m_shaderVars)
+                {
+                    Shader::UniformHandle handle = out_shader->GetUniformHandle(shaderVar.m_name);
+                    if(handle == Shader::k_invalidUniformHandle)
+                    {
+                        CS_LOG_FATAL("Cannot find shader uniform: " + shaderVar.m_name);
+                    }
+                    handles.m_handles.push_back(handle);
+                }
+            }
+            
+			//Set all the custom shader variables
+            for(u32 i = 0; i < inMaterial->m_shaderVars.size(); ++i)
+            {
+                const auto& shaderVar = inMaterial->m_shaderVars[i];
+                out_shader->SetUniform(handles.m_handles[i], &inMaterial->m_shaderVarValues[shaderVar.m_offset], shaderVar.m_numValues);
+            }
 		}
         //----------------------------------------------------------
         /// Apply Textures
@@ -373,7 +358,8 @@ namespace CSBackend
                 //with a list of commands and texture handles
                 Cubemap* cubemap = (Cubemap*)inMaterial->GetCubemap().get();
                 cubemap->Bind(mudwNumBoundTextures);
-                out_shader->SetUniform("u_cubemap", (s32)mudwNumBoundTextures);
+                m_renderStats.RecordTextureBind();
+                out_shader->SetUniform(Shader::BuiltInUniform::k_cubemap, (s32)mudwNumBoundTextures);
                 ++mudwNumBoundTextures;
             }
             
@@ -387,7 +373,13 @@ namespace CSBackend
                 //with a list of commands and texture handles
                 Texture* texture = (Texture*)inMaterial->GetTexture(i).get();
                 texture->Bind(mudwNumBoundTextures);
-                out_shader->SetUniform(m_textureUniformNames[i], (s32)mudwNumBoundTextures);
+                m_renderStats.RecordTextureBind();
+                Shader::UniformHandle handle = out_shader->GetTextureUniformHandle(i);
+                if(handle == Shader::k_invalidUniformHandle)
+                {
+                    CS_LOG_FATAL("Cannot find shader uniform: u_texture" + CSCore::ToString(i));
+                }
+                out_shader->SetUniform(handle, (s32)mudwNumBoundTextures);
                 ++mudwNumBoundTextures;
             }
         }
@@ -399,25 +391,25 @@ namespace CSBackend
             {
                 mbEmissiveSet = true;
                 mCurrentEmissive = inMaterial->GetEmissive();
-                out_shader->SetUniform("u_emissive", mCurrentEmissive, Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_emissive, mCurrentEmissive, Shader::UniformNotFoundPolicy::k_failSilent);
             }
             if(mbInvalidateAllCaches || mbAmbientSet == false || mCurrentAmbient != inMaterial->GetAmbient())
             {
                 mbAmbientSet = true;
                 mCurrentAmbient = inMaterial->GetAmbient();
-                out_shader->SetUniform("u_ambient", mCurrentAmbient, Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_ambient, mCurrentAmbient, Shader::UniformNotFoundPolicy::k_failSilent);
             }
             if(mbInvalidateAllCaches || mbDiffuseSet == false || mCurrentDiffuse != inMaterial->GetDiffuse())
             {
                 mbDiffuseSet = true;
                 mCurrentDiffuse = inMaterial->GetDiffuse();
-                out_shader->SetUniform("u_diffuse", mCurrentDiffuse, Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_diffuse, mCurrentDiffuse, Shader::UniformNotFoundPolicy::k_failSilent);
             }
             if(mbInvalidateAllCaches || mbSpecularSet == false || mCurrentSpecular != inMaterial->GetSpecular())
             {
                 mbSpecularSet = true;
                 mCurrentSpecular = inMaterial->GetSpecular();
-                out_shader->SetUniform("u_specular", mCurrentSpecular, Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_specular, mCurrentSpecular, Shader::UniformNotFoundPolicy::k_failSilent);
             }
         }
         //----------------------------------------------------------
@@ -435,17 +427,18 @@ namespace CSBackend
             if(inpLightComponent->IsA(CSRendering::DirectionalLightComponent::InterfaceID))
             {
                 CSRendering::DirectionalLightComponent* pLightComponent = (CSRendering::DirectionalLightComponent*)inpLightComponent;
-                out_shader->SetUniform("u_lightDir", pLightComponent->GetDirection(), Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_lightDir, pLightComponent->GetDirection(), Shader::UniformNotFoundPolicy::k_failSilent);
                 
                 if(pLightComponent->GetShadowMapPtr() != nullptr)
                 {
-                    out_shader->SetUniform("u_shadowTolerance", pLightComponent->GetShadowTolerance(), Shader::UniformNotFoundPolicy::k_failSilent);
+                    out_shader->SetUniform(Shader::BuiltInUniform::k_shadowTolerance, pLightComponent->GetShadowTolerance(), Shader::UniformNotFoundPolicy::k_failSilent);
                     
                     //If we have used all the texture units then we cannot bind the shadow map
                     if(mudwNumBoundTextures <= mpRenderCapabilities->GetNumTextureUnits())
                     {
                         pLightComponent->GetShadowMapPtr()->Bind(mudwNumBoundTextures);
-                        out_shader->SetUniform("u_shadowMap", (s32)mudwNumBoundTextures, Shader::UniformNotFoundPolicy::k_failSilent);
+                        m_renderStats.RecordTextureBind();
+                        out_shader->SetUniform(Shader::BuiltInUniform::k_shadowMap, (s32)mudwNumBoundTextures, Shader::UniformNotFoundPolicy::k_failSilent);
                         ++mudwNumBoundTextures;
                     }
                     else
@@ -457,14 +450,14 @@ namespace CSBackend
             else if(inpLightComponent->IsA(CSRendering::PointLightComponent::InterfaceID))
             {
                 CSRendering::PointLightComponent* pLightComponent = (CSRendering::PointLightComponent*)inpLightComponent;
-                out_shader->SetUniform("u_attenuationConstant", pLightComponent->GetConstantAttenuation(), Shader::UniformNotFoundPolicy::k_failSilent);
-                out_shader->SetUniform("u_attenuationLinear", pLightComponent->GetLinearAttenuation(), Shader::UniformNotFoundPolicy::k_failSilent);
-                out_shader->SetUniform("u_attenuationQuadratic", pLightComponent->GetQuadraticAttenuation(), Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_attenuationConstant, pLightComponent->GetConstantAttenuation(), Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_attenuationLinear, pLightComponent->GetLinearAttenuation(), Shader::UniformNotFoundPolicy::k_failSilent);
+                out_shader->SetUniform(Shader::BuiltInUniform::k_attenuationQuadratic, pLightComponent->GetQuadraticAttenuation(), Shader::UniformNotFoundPolicy::k_failSilent);
             }
             
-            out_shader->SetUniform("u_lightPos", inpLightComponent->GetWorldPosition(), Shader::UniformNotFoundPolicy::k_failSilent);
-            out_shader->SetUniform("u_lightCol", inpLightComponent->GetColour(), Shader::UniformNotFoundPolicy::k_failSilent);
-            out_shader->SetUniform("u_lightMat", inpLightComponent->GetLightMatrix(), Shader::UniformNotFoundPolicy::k_failSilent);
+            out_shader->SetUniform(Shader::BuiltInUniform::k_lightPos, inpLightComponent->GetWorldPosition(), Shader::UniformNotFoundPolicy::k_failSilent);
+            out_shader->SetUniform(Shader::BuiltInUniform::k_lightCol, inpLightComponent->GetColour(), Shader::UniformNotFoundPolicy::k_failSilent);
+            out_shader->SetUniform(Shader::BuiltInUniform::k_lightMat, inpLightComponent->GetLightMatrix(), Shader::UniformNotFoundPolicy::k_failSilent);
         }
 		//----------------------------------------------------------
 		/// Apply Camera
@@ -488,6 +481,7 @@ namespace CSBackend
 			if (inpActiveRenderTarget != nullptr)
 			{
 				inpActiveRenderTarget->Bind();
+                m_renderStats.RecordRenderTargetPass();
 			}
             else
             {
@@ -540,15 +534,16 @@ namespace CSBackend
 			//Set the new model view matrix based on the camera view matrix and the object matrix
             static CSCore::Matrix4 matWorldViewProj;
 			matWorldViewProj = inmatWorld * mmatViewProj;
-            m_currentShader->SetUniform("u_wvpMat", matWorldViewProj, Shader::UniformNotFoundPolicy::k_failSilent);
-            m_currentShader->SetUniform("u_worldMat", inmatWorld, Shader::UniformNotFoundPolicy::k_failSilent);
-            if(m_currentShader->HasUniform("u_normalMat"))
+            m_currentShader->SetUniform(Shader::BuiltInUniform::k_wvpMat, matWorldViewProj, Shader::UniformNotFoundPolicy::k_failSilent);
+            m_currentShader->SetUniform(Shader::BuiltInUniform::k_worldMat, inmatWorld, Shader::UniformNotFoundPolicy::k_failSilent);
+            if(m_currentShader->HasUniform(Shader::BuiltInUniform::k_normalMat))
             {
-                m_currentShader->SetUniform("u_normalMat", CSCore::Matrix4::Transpose(CSCore::Matrix4::Inverse(inmatWorld)));
+                m_currentShader->SetUniform(Shader::BuiltInUniform::k_normalMat, CSCore::Matrix4::Transpose(CSCore::Matrix4::Inverse(inmatWorld)));
             }
             
 			EnableVertexAttributeForSemantic(inpBuffer);
 			glDrawArrays(GetPrimitiveType(inpBuffer->GetPrimitiveType()), inudwOffset, inudwNumVerts);
+            m_renderStats.RecordDrawCall(inudwNumVerts, 0);
             
             mbInvalidateAllCaches = false;
             
@@ -562,16 +557,17 @@ namespace CSBackend
 			//Set the new model view matrix based on the camera view matrix and the object matrix
             static CSCore::Matrix4 matWorldViewProj;
 			matWorldViewProj = inmatWorld * mmatViewProj;
-            m_currentShader->SetUniform("u_wvpMat", matWorldViewProj, Shader::UniformNotFoundPolicy::k_failSilent);
-            m_currentShader->SetUniform("u_worldMat", inmatWorld, Shader::UniformNotFoundPolicy::k_failSilent);
-            if(m_currentShader->HasUniform("u_normalMat"))
+            m_currentShader->SetUniform(Shader::BuiltInUniform::k_wvpMat, matWorldViewProj, Shader::UniformNotFoundPolicy::k_failSilent);
+            m_currentShader->SetUniform(Shader::BuiltInUniform::k_worldMat, inmatWorld, Shader::UniformNotFoundPolicy::k_failSilent);
+            if(m_currentShader->HasUniform(Shader::BuiltInUniform::k_normalMat))
             {
-                m_currentShader->SetUniform("u_normalMat", CSCore::Matrix4::Transpose(CSCore::Matrix4::Inverse(inmatWorld)));
+                m_currentShader->SetUniform(Shader::BuiltInUniform::k_normalMat, CSCore::Matrix4::Transpose(CSCore::Matrix4::Inverse(inmatWorld)));
             }
             
 			//Render the buffer contents
 			EnableVertexAttributeForSemantic(inpBuffer);
 			glDrawElements(GetPrimitiveType(inpBuffer->GetPrimitiveType()), inudwNumIndices, GL_UNSIGNED_SHORT, (GLvoid*)inudwOffset);
+            m_renderStats.RecordDrawCall(0, inudwNumIndices);
             
             mbInvalidateAllCaches = false;
             
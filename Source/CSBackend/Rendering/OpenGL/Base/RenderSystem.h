@@ -165,7 +165,7 @@ namespace CSBackend
 			///
 			/// @param Dynamic array of joint matrices.
 			//----------------------------------------------------------
-            void ApplyJoints(const std::vector<CSCore::Matrix4>& inaJoints) override;
+            void ApplyJoints(const std::vector<CSCore::Vector4>& in_jointPalette) override;
 			//----------------------------------------------------------
 			/// Create Render Target
 			///
@@ -388,9 +388,10 @@ namespace CSBackend
 			/// Send the custom variables to the given shader
 			///
 			/// @param Material
+			/// @param The shader pass the shader is used for
 			/// @param Shader
 			//----------------------------------------------------------
-			void ApplyShaderVariables(const CSRendering::Material* inMaterial, Shader* out_shader);
+			void ApplyShaderVariables(const CSRendering::Material* inMaterial, CSRendering::ShaderPass in_shaderPass, Shader* out_shader);
             //----------------------------------------------------------
             /// Apply Lighting
             ///
@@ -467,8 +468,6 @@ namespace CSBackend
             bool* mpbLastVertexAttribState;
             bool* mpbCurrentVertexAttribState;
             
-            std::vector<std::string> m_textureUniformNames;
-            
             CSCore::Vector2 mvCachedScissorPos;
             CSCore::Vector2 mvCachedScissorSize;
             
@@ -32,21 +32,99 @@
 #include <CSBackend/Rendering/OpenGL/Base/RenderSystem.h>
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/String/StringParser.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstring>
 
 namespace CSBackend
 {
 	namespace OpenGL
 	{
+        namespace
+        {
+            const char* k_builtInUniformNames[(u32)Shader::BuiltInUniform::k_total] =
+            {
+                "u_wvpMat",
+                "u_worldMat",
+                "u_normalMat",
+                "u_cameraPos",
+                "u_joints",
+                "u_emissive",
+                "u_ambient",
+                "u_diffuse",
+                "u_specular",
+                "u_lightDir",
+                "u_lightPos",
+                "u_lightCol",
+                "u_lightMat",
+                "u_shadowTolerance",
+                "u_shadowMap",
+                "u_attenuationConstant",
+                "u_attenuationLinear",
+                "u_attenuationQuadratic",
+                "u_cubemap"
+            };
+            
+            const std::string k_textureUniformPrefix = "u_texture";
+            
+            //Material shader variables hold at most a Matrix4, so int uniforms set from float values never exceed this
+            const u32 k_maxIntUniformValues = 16;
+            
+            //Shaders can be built on any thread
+            std::atomic<u32> g_nextUniformTableId(1);
+            
+            //----------------------------------------------------------
+            /// @param GL uniform type
+            ///
+            /// @return The size in bytes of a single element of the
+            /// given type or 0 if the type isn't cached.
+            //----------------------------------------------------------
+            u32 GetUniformTypeSize(GLenum in_type)
+            {
+                switch(in_type)
+                {
+                    case GL_FLOAT:
+                    case GL_INT:
+                    case GL_BOOL:
+                    case GL_SAMPLER_2D:
+                    case GL_SAMPLER_CUBE:
+                        return 4;
+                    case GL_FLOAT_VEC2:
+                    case GL_INT_VEC2:
+                    case GL_BOOL_VEC2:
+                        return 8;
+                    case GL_FLOAT_VEC3:
+                    case GL_INT_VEC3:
+                    case GL_BOOL_VEC3:
+                        return 12;
+                    case GL_FLOAT_VEC4:
+                    case GL_INT_VEC4:
+                    case GL_BOOL_VEC4:
+                    case GL_FLOAT_MAT2:
+                        return 16;
+                    case GL_FLOAT_MAT3:
+                        return 36;
+                    case GL_FLOAT_MAT4:
+                        return 64;
+                    default:
+                        return 0;
+                }
+            }
+        }
+        
         CS_DEFINE_NAMEDTYPE(Shader);
         
+        const Shader::UniformHandle Shader::k_invalidUniformHandle;
+        
         //----------------------------------------------------------
         //----------------------------------------------------------
 		Shader::Shader()
 		: m_programId(0), m_vertexShaderId(0), m_fragmentShaderId(0)
 		{
-			
+            m_builtInUniformHandles.fill(k_invalidUniformHandle);
 		}
 		//----------------------------------------------------------
 		//----------------------------------------------------------
@@ -64,6 +142,7 @@ namespace CSBackend
             CompileShader(in_fs, GL_FRAGMENT_SHADER);
             CreateProgram(m_vertexShaderId, m_fragmentShaderId);
             PopulateAttributeHandles();
+            PopulateUniformHandles();
         }
         //----------------------------------------------------------
         //----------------------------------------------------------
@@ -101,183 +180,363 @@ namespace CSBackend
         //----------------------------------------------------------
         void Shader::SetUniform(const std::string& in_varName, s32 in_value, UniformNotFoundPolicy in_notFoundPolicy)
         {
-            GLint handle = GetUniformHandle(in_varName);
-            
-            if(handle < 0)
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_varName, in_notFoundPolicy, handle) == true)
             {
-                switch (in_notFoundPolicy)
-                {
-                    case UniformNotFoundPolicy::k_failHard:
-                        CS_LOG_FATAL("Cannot find shader uniform: " + in_varName);
-                        return;
-                    case UniformNotFoundPolicy::k_failSilent:
-                        return;
-                }
+                SetUniform(handle, in_value);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(const std::string& in_varName, f32 in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_varName, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_value);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(const std::string& in_varName, const CSCore::Vector2& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_varName, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_value);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(const std::string& in_varName, const CSCore::Vector3& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_varName, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_value);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(const std::string& in_varName, const CSCore::Vector4& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_varName, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_value);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(const std::string& in_varName, const CSCore::Matrix4& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_varName, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_value);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(const std::string& in_varName, const CSCore::Colour& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_varName, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_value);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(const std::string& in_varName, const std::vector<CSCore::Vector4>& in_vec4Values, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_varName, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_vec4Values);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(BuiltInUniform in_uniform, s32 in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_uniform, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_value);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(BuiltInUniform in_uniform, f32 in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_uniform, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_value);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(BuiltInUniform in_uniform, const CSCore::Vector2& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_uniform, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_value);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(BuiltInUniform in_uniform, const CSCore::Vector3& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_uniform, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_value);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(BuiltInUniform in_uniform, const CSCore::Vector4& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_uniform, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_value);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(BuiltInUniform in_uniform, const CSCore::Matrix4& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_uniform, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_value);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(BuiltInUniform in_uniform, const CSCore::Colour& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_uniform, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_value);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(BuiltInUniform in_uniform, const std::vector<CSCore::Vector4>& in_vec4Values, UniformNotFoundPolicy in_notFoundPolicy)
+        {
+            UniformHandle handle = k_invalidUniformHandle;
+            if(TryGetUniformHandle(in_uniform, in_notFoundPolicy, handle) == true)
+            {
+                SetUniform(handle, in_vec4Values);
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(UniformHandle in_handle, s32 in_value)
+        {
+            if(in_handle == k_invalidUniformHandle || UpdateCachedValue(in_handle, &in_value, sizeof(s32)) == false)
+            {
+                return;
             }
             
-            glUniform1i(handle, in_value);
+            glUniform1i(m_uniforms[in_handle].m_location, in_value);
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
         }
         //----------------------------------------------------------
         //----------------------------------------------------------
-        void Shader::SetUniform(const std::string& in_varName, f32 in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        void Shader::SetUniform(UniformHandle in_handle, f32 in_value)
         {
-            GLint handle = GetUniformHandle(in_varName);
-            
-            if(handle < 0)
+            if(in_handle == k_invalidUniformHandle || UpdateCachedValue(in_handle, &in_value, sizeof(f32)) == false)
             {
-                switch (in_notFoundPolicy)
-                {
-                    case UniformNotFoundPolicy::k_failHard:
-                        CS_LOG_FATAL("Cannot find shader uniform: " + in_varName);
-                        return;
-                    case UniformNotFoundPolicy::k_failSilent:
-                        return;
-                }
+                return;
             }
             
-            glUniform1f(handle, in_value);
+            glUniform1f(m_uniforms[in_handle].m_location, in_value);
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
         }
         //----------------------------------------------------------
         //----------------------------------------------------------
-        void Shader::SetUniform(const std::string& in_varName, const CSCore::Vector2& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        void Shader::SetUniform(UniformHandle in_handle, const CSCore::Vector2& in_value)
         {
-            GLint handle = GetUniformHandle(in_varName);
-            
-            if(handle < 0)
+            if(in_handle == k_invalidUniformHandle || UpdateCachedValue(in_handle, &in_value, sizeof(CSCore::Vector2)) == false)
             {
-                switch (in_notFoundPolicy)
-                {
-                    case UniformNotFoundPolicy::k_failHard:
-                        CS_LOG_FATAL("Cannot find shader uniform: " + in_varName);
-                        return;
-                    case UniformNotFoundPolicy::k_failSilent:
-                        return;
-                }
+                return;
             }
             
-            glUniform2fv(handle, 1, (GLfloat*)(&in_value));
+            glUniform2fv(m_uniforms[in_handle].m_location, 1, (GLfloat*)(&in_value));
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
         }
         //----------------------------------------------------------
         //----------------------------------------------------------
-        void Shader::SetUniform(const std::string& in_varName, const CSCore::Vector3& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        void Shader::SetUniform(UniformHandle in_handle, const CSCore::Vector3& in_value)
         {
-            GLint handle = GetUniformHandle(in_varName);
-            
-            if(handle < 0)
+            if(in_handle == k_invalidUniformHandle || UpdateCachedValue(in_handle, &in_value, sizeof(CSCore::Vector3)) == false)
             {
-                switch (in_notFoundPolicy)
-                {
-                    case UniformNotFoundPolicy::k_failHard:
-                        CS_LOG_FATAL("Cannot find shader uniform: " + in_varName);
-                        return;
-                    case UniformNotFoundPolicy::k_failSilent:
-                        return;
-                }
+                return;
             }
             
-            glUniform3fv(handle, 1, (GLfloat*)(&in_value));
+            glUniform3fv(m_uniforms[in_handle].m_location, 1, (GLfloat*)(&in_value));
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
         }
         //----------------------------------------------------------
         //----------------------------------------------------------
-        void Shader::SetUniform(const std::string& in_varName, const CSCore::Vector4& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        void Shader::SetUniform(UniformHandle in_handle, const CSCore::Vector4& in_value)
         {
-            GLint handle = GetUniformHandle(in_varName);
-            
-            if(handle < 0)
+            if(in_handle == k_invalidUniformHandle || UpdateCachedValue(in_handle, &in_value, sizeof(CSCore::Vector4)) == false)
             {
-                switch (in_notFoundPolicy)
-                {
-                    case UniformNotFoundPolicy::k_failHard:
-                        CS_LOG_FATAL("Cannot find shader uniform: " + in_varName);
-                        return;
-                    case UniformNotFoundPolicy::k_failSilent:
-                        return;
-                }
+                return;
             }
             
-            glUniform4fv(handle, 1, (GLfloat*)(&in_value));
+            glUniform4fv(m_uniforms[in_handle].m_location, 1, (GLfloat*)(&in_value));
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
         }
         //----------------------------------------------------------
         //----------------------------------------------------------
-        void Shader::SetUniform(const std::string& in_varName, const CSCore::Matrix4& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        void Shader::SetUniform(UniformHandle in_handle, const CSCore::Matrix4& in_value)
         {
-            GLint handle = GetUniformHandle(in_varName);
-            
-            if(handle < 0)
+            if(in_handle == k_invalidUniformHandle || UpdateCachedValue(in_handle, &in_value.m, sizeof(in_value.m)) == false)
             {
-                switch (in_notFoundPolicy)
-                {
-                    case UniformNotFoundPolicy::k_failHard:
-                        CS_LOG_FATAL("Cannot find shader uniform: " + in_varName);
-                        return;
-                    case UniformNotFoundPolicy::k_failSilent:
-                        return;
-                }
+                return;
             }
             
-            glUniformMatrix4fv(handle, 1, GL_FALSE, (GLfloat*)(&in_value.m));
+            glUniformMatrix4fv(m_uniforms[in_handle].m_location, 1, GL_FALSE, (GLfloat*)(&in_value.m));
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
         }
         //----------------------------------------------------------
         //----------------------------------------------------------
-        void Shader::SetUniform(const std::string& in_varName, const CSCore::Colour& in_value, UniformNotFoundPolicy in_notFoundPolicy)
+        void Shader::SetUniform(UniformHandle in_handle, const CSCore::Colour& in_value)
         {
-            GLint handle = GetUniformHandle(in_varName);
+            if(in_handle == k_invalidUniformHandle || UpdateCachedValue(in_handle, &in_value, sizeof(CSCore::Colour)) == false)
+            {
+                return;
+            }
+            
+            glUniform4fv(m_uniforms[in_handle].m_location, 1, (GLfloat*)(&in_value));
             
-            if(handle < 0)
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::SetUniform(UniformHandle in_handle, const std::vector<CSCore::Vector4>& in_vec4Values)
+        {
+            if(in_handle == k_invalidUniformHandle || UpdateCachedValue(in_handle, &in_vec4Values[0], in_vec4Values.size() * sizeof(CSCore::Vector4)) == false)
             {
-                switch (in_notFoundPolicy)
-                {
-                    case UniformNotFoundPolicy::k_failHard:
-                        CS_LOG_FATAL("Cannot find shader uniform: " + in_varName);
-                        return;
-                    case UniformNotFoundPolicy::k_failSilent:
-                        return;
-                }
+                return;
             }
             
-            glUniform4fv(handle, 1, (GLfloat*)(&in_value));
+            glUniform4fv(m_uniforms[in_handle].m_location, in_vec4Values.size(), (GLfloat*)(&in_vec4Values[0]));
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
         }
         //----------------------------------------------------------
         //----------------------------------------------------------
-        void Shader::SetUniform(const std::string& in_varName, const std::vector<CSCore::Vector4>& in_vec4Values, UniformNotFoundPolicy in_notFoundPolicy)
+        void Shader::SetUniform(UniformHandle in_handle, const f32* in_values, u32 in_numValues)
         {
-            GLint handle = GetUniformHandle(in_varName);
+            if(in_handle == k_invalidUniformHandle || UpdateCachedValue(in_handle, in_values, in_numValues * sizeof(f32)) == false)
+            {
+                return;
+            }
             
-            if(handle < 0)
+            const Uniform& uniform = m_uniforms[in_handle];
+            switch(uniform.m_type)
             {
-                switch (in_notFoundPolicy)
+                case GL_FLOAT:
+                    glUniform1fv(uniform.m_location, in_numValues, in_values);
+                    break;
+                case GL_FLOAT_VEC2:
+                    glUniform2fv(uniform.m_location, in_numValues / 2, in_values);
+                    break;
+                case GL_FLOAT_VEC3:
+                    glUniform3fv(uniform.m_location, in_numValues / 3, in_values);
+                    break;
+                case GL_FLOAT_VEC4:
+                    glUniform4fv(uniform.m_location, in_numValues / 4, in_values);
+                    break;
+                case GL_FLOAT_MAT2:
+                    glUniformMatrix2fv(uniform.m_location, in_numValues / 4, GL_FALSE, in_values);
+                    break;
+                case GL_FLOAT_MAT3:
+                    glUniformMatrix3fv(uniform.m_location, in_numValues / 9, GL_FALSE, in_values);
+                    break;
+                case GL_FLOAT_MAT4:
+                    glUniformMatrix4fv(uniform.m_location, in_numValues / 16, GL_FALSE, in_values);
+                    break;
+                case GL_BOOL:
+                    glUniform1fv(uniform.m_location, in_numValues, in_values);
+                    break;
+                case GL_BOOL_VEC2:
+                    glUniform2fv(uniform.m_location, in_numValues / 2, in_values);
+                    break;
+                case GL_BOOL_VEC3:
+                    glUniform3fv(uniform.m_location, in_numValues / 3, in_values);
+                    break;
+                case GL_BOOL_VEC4:
+                    glUniform4fv(uniform.m_location, in_numValues / 4, in_values);
+                    break;
+                case GL_INT:
+                case GL_INT_VEC2:
+                case GL_INT_VEC3:
+                case GL_INT_VEC4:
                 {
-                    case UniformNotFoundPolicy::k_failHard:
-                        CS_LOG_FATAL("Cannot find shader uniform: " + in_varName);
-                        return;
-                    case UniformNotFoundPolicy::k_failSilent:
-                        return;
+                    if(in_numValues > k_maxIntUniformValues)
+                    {
+                        CS_LOG_ERROR("Cannot set more than " + CSCore::ToString(k_maxIntUniformValues) + " int shader uniform values from float values.");
+                        break;
+                    }
+                    
+                    GLint intValues[k_maxIntUniformValues];
+                    for(u32 i = 0; i < in_numValues; ++i)
+                    {
+                        intValues[i] = GLint(in_values[i]);
+                    }
+                    
+                    switch(uniform.m_type)
+                    {
+                        case GL_INT:
+                            glUniform1iv(uniform.m_location, in_numValues, intValues);
+                            break;
+                        case GL_INT_VEC2:
+                            glUniform2iv(uniform.m_location, in_numValues / 2, intValues);
+                            break;
+                        case GL_INT_VEC3:
+                            glUniform3iv(uniform.m_location, in_numValues / 3, intValues);
+                            break;
+                        default:
+                            glUniform4iv(uniform.m_location, in_numValues / 4, intValues);
+                            break;
+                    }
+                    break;
                 }
+                default:
+                    CS_LOG_ERROR("Cannot set a sampler or unsupported shader uniform from float values.");
+                    break;
             }
             
-            glUniform4fv(handle, in_vec4Values.size(), (GLfloat*)(&in_vec4Values[0]));
-            
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while setting uniform.");
         }
         //----------------------------------------------------------
         //----------------------------------------------------------
-        bool Shader::HasUniform(const std::string& in_varName)
+        bool Shader::HasUniform(const std::string& in_varName) const
         {
-            return GetUniformHandle(in_varName) >= 0;
+            return GetUniformHandle(in_varName) != k_invalidUniformHandle;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        bool Shader::HasUniform(BuiltInUniform in_uniform) const
+        {
+            return GetUniformHandle(in_uniform) != k_invalidUniformHandle;
         }
         //----------------------------------------------------------
         //----------------------------------------------------------
@@ -296,21 +555,167 @@ namespace CSBackend
         }
         //----------------------------------------------------------
         //----------------------------------------------------------
-        GLint Shader::GetUniformHandle(const std::string& in_name)
+        Shader::UniformHandle Shader::GetUniformHandle(const std::string& in_varName) const
         {
-            auto it = m_uniformHandles.find(in_name);
+            auto it = m_uniformHandles.find(in_varName);
             
             if(it != m_uniformHandles.end())
             {
                 return it->second;
             }
             
-            GLint handle = glGetUniformLocation(m_programId, in_name.c_str());
-            m_uniformHandles.insert(std::make_pair(in_name, handle));
+            return k_invalidUniformHandle;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        Shader::UniformHandle Shader::GetUniformHandle(BuiltInUniform in_uniform) const
+        {
+            CS_ASSERT(in_uniform != BuiltInUniform::k_total, "Invalid built-in uniform.");
+            return m_builtInUniformHandles[(u32)in_uniform];
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        bool Shader::TryGetUniformHandle(const std::string& in_varName, UniformNotFoundPolicy in_notFoundPolicy, UniformHandle& out_handle) const
+        {
+            out_handle = GetUniformHandle(in_varName);
+            
+            if(out_handle == k_invalidUniformHandle)
+            {
+                if(in_notFoundPolicy == UniformNotFoundPolicy::k_failHard)
+                {
+                    CS_LOG_FATAL("Cannot find shader uniform: " + in_varName);
+                }
+                return false;
+            }
+            
+            return true;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        bool Shader::TryGetUniformHandle(BuiltInUniform in_uniform, UniformNotFoundPolicy in_notFoundPolicy, UniformHandle& out_handle) const
+        {
+            out_handle = GetUniformHandle(in_uniform);
+            
+            if(out_handle == k_invalidUniformHandle)
+            {
+                if(in_notFoundPolicy == UniformNotFoundPolicy::k_failHard)
+                {
+                    CS_LOG_FATAL("Cannot find shader uniform: " + std::string(k_builtInUniformNames[(u32)in_uniform]));
+                }
+                return false;
+            }
+            
+            return true;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        Shader::UniformHandle Shader::GetTextureUniformHandle(u32 in_index) const
+        {
+            if(in_index < m_textureUniformHandles.size())
+            {
+                return m_textureUniformHandles[in_index];
+            }
+            
+            return k_invalidUniformHandle;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        u32 Shader::GetUniformTableId() const
+        {
+            return m_uniformTableId;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void Shader::PopulateUniformHandles()
+        {
+            m_uniformTableId = g_nextUniformTableId++;
+            
+            GLint numUniforms = 0;
+            glGetProgramiv(m_programId, GL_ACTIVE_UNIFORMS, &numUniforms);
             
-            CS_ASSERT_NOGLERROR("An OpenGL error occurred while getting uniform handle.");
+            GLint maxNameLength = 0;
+            glGetProgramiv(m_programId, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+            std::vector<GLchar> nameBuffer(std::max(maxNameLength, 1));
+            
+            u32 valuesSize = 0;
+            for(GLint i = 0; i < numUniforms; ++i)
+            {
+                GLint arraySize = 0;
+                GLenum type = 0;
+                glGetActiveUniform(m_programId, (GLuint)i, (GLsizei)nameBuffer.size(), nullptr, &arraySize, &type, nameBuffer.data());
+                
+                //Arrays are reported as "name[0]" but are set by their base name
+                std::string name(nameBuffer.data());
+                std::string::size_type arrayStart = name.find('[');
+                if(arrayStart != std::string::npos)
+                {
+                    name.erase(arrayStart);
+                }
+                
+                Uniform uniform;
+                uniform.m_location = glGetUniformLocation(m_programId, name.c_str());
+                uniform.m_type = type;
+                uniform.m_valueOffset = valuesSize;
+                uniform.m_valueSize = GetUniformTypeSize(type) * (u32)arraySize;
+                uniform.m_hasValue = false;
+                
+                if(uniform.m_location < 0)
+                {
+                    continue;
+                }
+                
+                valuesSize += uniform.m_valueSize;
+                m_uniformHandles.insert(std::make_pair(name, (UniformHandle)m_uniforms.size()));
+                m_uniforms.push_back(uniform);
+            }
+            
+            m_uniformValues.assign(valuesSize, 0);
+            
+            for(u32 i = 0; i < (u32)BuiltInUniform::k_total; ++i)
+            {
+                m_builtInUniformHandles[i] = GetUniformHandle(k_builtInUniformNames[i]);
+            }
+            
+            for(const auto& entry : m_uniformHandles)
+            {
+                const std::string& name = entry.first;
+                if(name.size() > k_textureUniformPrefix.size() && name.compare(0, k_textureUniformPrefix.size(), k_textureUniformPrefix) == 0 &&
+                   name.find_first_not_of("0123456789", k_textureUniformPrefix.size()) == std::string::npos)
+                {
+                    u32 index = CSCore::ParseU32(name.substr(k_textureUniformPrefix.size()));
+                    if(index >= m_textureUniformHandles.size())
+                    {
+                        m_textureUniformHandles.resize(index + 1, k_invalidUniformHandle);
+                    }
+                    m_textureUniformHandles[index] = entry.second;
+                }
+            }
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while populating uniform handles.");
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        bool Shader::UpdateCachedValue(UniformHandle in_handle, const void* in_data, u32 in_size)
+        {
+            CS_ASSERT(in_handle >= 0 && in_handle < (UniformHandle)m_uniforms.size(), "Invalid uniform handle.");
+            
+            Uniform& uniform = m_uniforms[in_handle];
+            
+            //If the value doesn't fit the declared type then leave it to GL to validate.
+            if(in_size == 0 || in_size > uniform.m_valueSize)
+            {
+                return true;
+            }
+            
+            u8* cachedValue = m_uniformValues.data() + uniform.m_valueOffset;
+            if(uniform.m_hasValue == true && memcmp(cachedValue, in_data, in_size) == 0)
+            {
+                return false;
+            }
             
-            return handle;
+            memcpy(cachedValue, in_data, in_size);
+            uniform.m_hasValue = true;
+            return true;
         }
 		//----------------------------------------------------------
 		//----------------------------------------------------------
@@ -419,7 +824,11 @@ namespace CSBackend
             m_fragmentShaderId = 0;
             m_programId = 0;
             m_attribHandles.clear();
+            m_uniforms.clear();
+            m_uniformValues.clear();
             m_uniformHandles.clear();
+            m_builtInUniformHandles.fill(k_invalidUniformHandle);
+            m_textureUniformHandles.clear();
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while destroying shader.");
         }
@@ -34,7 +34,9 @@
 #include <CSBackend/Rendering/OpenGL/Base/GLIncludes.h>
 #include <ChilliSource/Rendering/Shader/Shader.h>
 
+#include <array>
 #include <unordered_map>
+#include <vector>
 
 namespace CSBackend
 {
@@ -53,6 +55,43 @@ namespace CSBackend
 			
             CS_DECLARE_NAMEDTYPE(Shader);
             
+            //----------------------------------------------------------
+            /// An index into the shaders table of active uniforms. These
+            /// are resolved once when the program is linked and should
+            /// be used in place of uniform names when setting variables
+            /// every frame.
+            //----------------------------------------------------------
+            typedef s32 UniformHandle;
+            static const UniformHandle k_invalidUniformHandle = -1;
+            //----------------------------------------------------------
+            /// The uniforms which are set by the render system rather
+            /// than by the material. The handles for these are looked
+            /// up when the program is linked so that no name lookup is
+            /// required while drawing.
+            //----------------------------------------------------------
+            enum class BuiltInUniform
+            {
+                k_wvpMat,
+                k_worldMat,
+                k_normalMat,
+                k_cameraPos,
+                k_joints,
+                k_emissive,
+                k_ambient,
+                k_diffuse,
+                k_specular,
+                k_lightDir,
+                k_lightPos,
+                k_lightCol,
+                k_lightMat,
+                k_shadowTolerance,
+                k_shadowMap,
+                k_attenuationConstant,
+                k_attenuationLinear,
+                k_attenuationQuadratic,
+                k_cubemap,
+                k_total
+            };
             //----------------------------------------------------------
             /// Specifies the policy for how the progrm should handle
             /// an missing variable when setting a uniform
@@ -177,9 +216,208 @@ namespace CSBackend
             //----------------------------------------------------------
             /// @author S Downie
             ///
+            /// @param Uniform name
+            ///
+            /// @return The handle to the active uniform with the given
+            /// name or k_invalidUniformHandle if the shader doesn't
+            /// use it.
+            //----------------------------------------------------------
+            UniformHandle GetUniformHandle(const std::string& in_varName) const;
+            //----------------------------------------------------------
+            /// @param Built-in uniform
+            ///
+            /// @return The handle to the built-in uniform or
+            /// k_invalidUniformHandle if the shader doesn't use it.
+            //----------------------------------------------------------
+            UniformHandle GetUniformHandle(BuiltInUniform in_uniform) const;
+            //----------------------------------------------------------
+            /// @param Texture unit index
+            ///
+            /// @return The handle to the u_texture sampler with the
+            /// given index or k_invalidUniformHandle if the shader
+            /// doesn't use it.
+            //----------------------------------------------------------
+            UniformHandle GetTextureUniformHandle(u32 in_index) const;
+            //----------------------------------------------------------
+            /// @return An id which is unique to this shader's uniform
+            /// table, so handles resolved for it can be cached by
+            /// id rather than looked up by name each time. This is
+            /// never 0.
+            //----------------------------------------------------------
+            u32 GetUniformTableId() const;
+            //----------------------------------------------------------
+            /// Sets the uniform with the given handle to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set. Invalid handles are ignored.
+            ///
+            /// @param Uniform handle
+            /// @param Value
+            //----------------------------------------------------------
+            void SetUniform(UniformHandle in_handle, s32 in_value);
+            //----------------------------------------------------------
+            /// Sets the uniform with the given handle to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set. Invalid handles are ignored.
+            ///
+            /// @param Uniform handle
+            /// @param Value
+            //----------------------------------------------------------
+            void SetUniform(UniformHandle in_handle, f32 in_value);
+            //----------------------------------------------------------
+            /// Sets the uniform with the given handle to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set. Invalid handles are ignored.
+            ///
+            /// @param Uniform handle
+            /// @param Value
+            //----------------------------------------------------------
+            void SetUniform(UniformHandle in_handle, const CSCore::Vector2& in_value);
+            //----------------------------------------------------------
+            /// Sets the uniform with the given handle to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set. Invalid handles are ignored.
+            ///
+            /// @param Uniform handle
+            /// @param Value
+            //----------------------------------------------------------
+            void SetUniform(UniformHandle in_handle, const CSCore::Vector3& in_value);
+            //----------------------------------------------------------
+            /// Sets the uniform with the given handle to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set. Invalid handles are ignored.
+            ///
+            /// @param Uniform handle
+            /// @param Value
+            //----------------------------------------------------------
+            void SetUniform(UniformHandle in_handle, const CSCore::Vector4& in_value);
+            //----------------------------------------------------------
+            /// Sets the uniform with the given handle to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set. Invalid handles are ignored.
+            ///
+            /// @param Uniform handle
+            /// @param Value
+            //----------------------------------------------------------
+            void SetUniform(UniformHandle in_handle, const CSCore::Matrix4& in_value);
+            //----------------------------------------------------------
+            /// Sets the uniform with the given handle to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set. Invalid handles are ignored.
+            ///
+            /// @param Uniform handle
+            /// @param Value
+            //----------------------------------------------------------
+            void SetUniform(UniformHandle in_handle, const CSCore::Colour& in_value);
+            //----------------------------------------------------------
+            /// Sets the uniform with the given handle to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set. Invalid handles are ignored.
+            ///
+            /// @param Uniform handle
+            /// @param Values
+            //----------------------------------------------------------
+            void SetUniform(UniformHandle in_handle, const std::vector<CSCore::Vector4>& in_vec4Values);
+            //----------------------------------------------------------
+            /// Sets the uniform with the given handle from the given
+            /// raw float values, using the type the uniform was
+            /// declared with in the shader. Int and bool uniforms are
+            /// converted from the float values. The value is only
+            /// uploaded if it differs from the last value set. Invalid
+            /// handles are ignored.
+            ///
+            /// @param Uniform handle
+            /// @param Values
+            /// @param Number of values
+            //----------------------------------------------------------
+            void SetUniform(UniformHandle in_handle, const f32* in_values, u32 in_numValues);
+            //----------------------------------------------------------
+            /// Attempts to set the given built-in uniform to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set.
+            ///
+            /// @param Built-in uniform
+            /// @param Value
+            /// @param Failure policy
+            //----------------------------------------------------------
+            void SetUniform(BuiltInUniform in_uniform, s32 in_value, UniformNotFoundPolicy in_notFoundPolicy = UniformNotFoundPolicy::k_failHard);
+            //----------------------------------------------------------
+            /// Attempts to set the given built-in uniform to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set.
+            ///
+            /// @param Built-in uniform
+            /// @param Value
+            /// @param Failure policy
+            //----------------------------------------------------------
+            void SetUniform(BuiltInUniform in_uniform, f32 in_value, UniformNotFoundPolicy in_notFoundPolicy = UniformNotFoundPolicy::k_failHard);
+            //----------------------------------------------------------
+            /// Attempts to set the given built-in uniform to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set.
+            ///
+            /// @param Built-in uniform
+            /// @param Value
+            /// @param Failure policy
+            //----------------------------------------------------------
+            void SetUniform(BuiltInUniform in_uniform, const CSCore::Vector2& in_value, UniformNotFoundPolicy in_notFoundPolicy = UniformNotFoundPolicy::k_failHard);
+            //----------------------------------------------------------
+            /// Attempts to set the given built-in uniform to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set.
+            ///
+            /// @param Built-in uniform
+            /// @param Value
+            /// @param Failure policy
+            //----------------------------------------------------------
+            void SetUniform(BuiltInUniform in_uniform, const CSCore::Vector3& in_value, UniformNotFoundPolicy in_notFoundPolicy = UniformNotFoundPolicy::k_failHard);
+            //----------------------------------------------------------
+            /// Attempts to set the given built-in uniform to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set.
+            ///
+            /// @param Built-in uniform
+            /// @param Value
+            /// @param Failure policy
+            //----------------------------------------------------------
+            void SetUniform(BuiltInUniform in_uniform, const CSCore::Vector4& in_value, UniformNotFoundPolicy in_notFoundPolicy = UniformNotFoundPolicy::k_failHard);
+            //----------------------------------------------------------
+            /// Attempts to set the given built-in uniform to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set.
+            ///
+            /// @param Built-in uniform
+            /// @param Value
+            /// @param Failure policy
+            //----------------------------------------------------------
+            void SetUniform(BuiltInUniform in_uniform, const CSCore::Matrix4& in_value, UniformNotFoundPolicy in_notFoundPolicy = UniformNotFoundPolicy::k_failHard);
+            //----------------------------------------------------------
+            /// Attempts to set the given built-in uniform to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set.
+            ///
+            /// @param Built-in uniform
+            /// @param Value
+            /// @param Failure policy
+            //----------------------------------------------------------
+            void SetUniform(BuiltInUniform in_uniform, const CSCore::Colour& in_value, UniformNotFoundPolicy in_notFoundPolicy = UniformNotFoundPolicy::k_failHard);
+            //----------------------------------------------------------
+            /// Attempts to set the given built-in uniform to the given
+            /// value. The value is only uploaded if it differs from
+            /// the last value set.
+            ///
+            /// @param Built-in uniform
+            /// @param Values
+            /// @param Failure policy
+            //----------------------------------------------------------
+            void SetUniform(BuiltInUniform in_uniform, const std::vector<CSCore::Vector4>& in_vec4Values, UniformNotFoundPolicy in_notFoundPolicy = UniformNotFoundPolicy::k_failHard);
+            //----------------------------------------------------------
             /// @return Whether shader has the given uniform variable
             //----------------------------------------------------------
-            bool HasUniform(const std::string& in_varName);
+            bool HasUniform(const std::string& in_varName) const;
+            //----------------------------------------------------------
+            /// @return Whether shader has the given built-in uniform
+            //----------------------------------------------------------
+            bool HasUniform(BuiltInUniform in_uniform) const;
             //----------------------------------------------------------
             /// Attempts to set the attribute shader variable with
             /// the given name. Will fail silently if variable not found.
@@ -245,26 +483,71 @@ namespace CSBackend
             //----------------------------------------------------------
             void PopulateAttributeHandles();
             //----------------------------------------------------------
-			/// Get the location of the given uniform variable.
-            /// Subsequent calls to the same variable will return the
-            /// cached value
+            /// Queries the linked program for all of its active
+            /// uniforms and builds the uniform table, the value cache
+            /// and the built-in uniform handles.
+            //----------------------------------------------------------
+            void PopulateUniformHandles();
+            //----------------------------------------------------------
+            /// Looks up the handle of the uniform with the given name,
+            /// applying the not found policy if it doesn't exist.
             ///
-            /// @author S Downie
+            /// @param Variable name
+            /// @param What to do if the uniform is not found
+            /// @param [Out] The uniform handle
             ///
-            /// @param Uniform name
+            /// @return Whether the uniform was found
+            //----------------------------------------------------------
+            bool TryGetUniformHandle(const std::string& in_varName, UniformNotFoundPolicy in_notFoundPolicy, UniformHandle& out_handle) const;
+            //----------------------------------------------------------
+            /// Looks up the handle of the given built-in uniform,
+            /// applying the not found policy if it doesn't exist.
+            ///
+            /// @param Built-in uniform
+            /// @param What to do if the uniform is not found
+            /// @param [Out] The uniform handle
+            ///
+            /// @return Whether the uniform was found
+            //----------------------------------------------------------
+            bool TryGetUniformHandle(BuiltInUniform in_uniform, UniformNotFoundPolicy in_notFoundPolicy, UniformHandle& out_handle) const;
+            //----------------------------------------------------------
+            /// Compares the given value with the last value set for
+            /// the uniform and stores it if it differs.
+            ///
+            /// @param Uniform handle
+            /// @param Value data
+            /// @param Size of the value data in bytes
             ///
-            /// @return Location or -1 if not found
+            /// @return Whether the value needs to be uploaded
             //----------------------------------------------------------
-            GLint GetUniformHandle(const std::string& in_name);
+            bool UpdateCachedValue(UniformHandle in_handle, const void* in_data, u32 in_size);
             
 		private:
+            
+            //----------------------------------------------------------
+            /// Describes a single active uniform in the linked program
+            /// and where its last set value lives in the value cache.
+            //----------------------------------------------------------
+            struct Uniform
+            {
+                GLint m_location;
+                GLenum m_type;
+                u32 m_valueOffset;
+                u32 m_valueSize;
+                bool m_hasValue;
+            };
 
             GLuint m_vertexShaderId;
 			GLuint m_fragmentShaderId;
 			GLuint m_programId;
             
             //---Uniforms
-            std::unordered_map<std::string, GLint> m_uniformHandles;
+            std::vector<Uniform> m_uniforms;
+            std::vector<u8> m_uniformValues;
+            std::unordered_map<std::string, UniformHandle> m_uniformHandles;
+            std::array<UniformHandle, (u32)BuiltInUniform::k_total> m_builtInUniformHandles;
+            std::vector<UniformHandle> m_textureUniformHandles;
+            u32 m_uniformTableId = 0;
         
             //---Attributes
             std::unordered_map<std::string, GLint> m_attribHandles;
@@ -320,8 +320,11 @@ namespace CSBackend
             }
             m_hasMipMaps = in_mipMap;
             
+            u64 memoryUsage = 0;
             for(u32 i=0; i<in_descs.size(); ++i)
             {
+                memoryUsage += in_descs[i].m_dataSize;
+                
                 CS_ASSERT(in_descs[i].m_width <= m_renderCapabilities->GetMaxTextureSize() && in_descs[i].m_height <= m_renderCapabilities->GetMaxTextureSize(),
                           "OpenGL does not support textures of this size on this device (" + CSCore::ToString(in_descs[i].m_width) + ", " + CSCore::ToString(in_descs[i].m_height) + ")");
                 
@@ -347,6 +350,15 @@ namespace CSBackend
                 };
             }
             
+            CSCore::Application::Get()->GetRenderSystem()->GetRenderStats().RecordTextureUpload(memoryUsage);
+            
+            //A full mip chain adds a third on top of the base level.
+            if(in_mipMap == true)
+            {
+                memoryUsage += memoryUsage / 3;
+            }
+            SetMemoryUsage(memoryUsage);
+            
 #ifdef CS_TARGETPLATFORM_ANDROID
             if (GetStorageLocation() == CSCore::StorageLocation::k_none && in_restoreCubemapDataEnabled == true)
             {
@@ -433,6 +445,8 @@ namespace CSBackend
         //--------------------------------------------------
         void Cubemap::Destroy()
         {
+            SetMemoryUsage(0);
+            
             m_hasFilterModeChanged = true;
             m_hasWrapModeChanged = true;
             m_hasMipMaps = false;
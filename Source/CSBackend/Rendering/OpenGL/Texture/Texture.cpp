@@ -343,6 +343,17 @@ namespace CSBackend
             
             m_hasMipMaps = in_mipMap;
             
+            //Mip maps are generated on the GPU so only the base level is uploaded.
+            CSCore::Application::Get()->GetRenderSystem()->GetRenderStats().RecordTextureUpload(in_desc.m_dataSize);
+            
+            //A full mip chain adds a third on top of the base level.
+            u64 memoryUsage = in_desc.m_dataSize;
+            if(in_mipMap == true)
+            {
+                memoryUsage += memoryUsage / 3;
+            }
+            SetMemoryUsage(memoryUsage);
+            
 #ifdef CS_TARGETPLATFORM_ANDROID
             if (GetStorageLocation() == CSCore::StorageLocation::k_none && in_restoreTextureDataEnabled == true)
             {
@@ -500,6 +511,7 @@ namespace CSBackend
         {
             m_width = 0;
             m_height = 0;
+            SetMemoryUsage(0);
             
             m_hasFilterModeChanged = true;
             m_hasWrapModeChanged = true;
@@ -45,6 +45,8 @@
 #include <ChilliSource/Core/State/StateManager.h>
 #include <ChilliSource/Core/String/StringParser.h>
 #include <ChilliSource/Core/Time/CoreTimer.h>
+#include <ChilliSource/Core/Time/Profiler.h>
+#include <ChilliSource/Core/Time/ScopedProfileMarker.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
 #include <ChilliSource/Input/DeviceButtons/DeviceButtonSystem.h>
@@ -63,8 +65,10 @@
 #include <ChilliSource/Rendering/Material/Material.h>
 #include <ChilliSource/Rendering/Material/MaterialProvider.h>
 #include <ChilliSource/Rendering/Material/MaterialFactory.h>
+#include <ChilliSource/Rendering/Model/AnimationUpdateSystem.h>
 #include <ChilliSource/Rendering/Model/Mesh.h>
 #include <ChilliSource/Rendering/Particle/CSParticleProvider.h>
+#include <ChilliSource/Rendering/Particle/ParticleUpdateSystem.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDefFactory.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawableDefFactory.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDefFactory.h>
@@ -167,6 +171,9 @@ namespace ChilliSource
             s_application = this;
             
 			Logging::Create();
+#ifdef CS_ENABLE_PROFILING
+            Profiler::Create();
+#endif
 
             //Create all application systems.
             m_isSystemCreationAllowed = true;
@@ -201,6 +208,12 @@ namespace ChilliSource
         //----------------------------------------------------
 		void Application::Update(f32 in_deltaTime, TimeIntervalSecs in_timestamp)
 		{
+#ifdef CS_ENABLE_PROFILING
+            //the previous frame's update and render have both finished by this point.
+            Profiler::Get()->EndFrame();
+#endif
+            CS_PROFILE_SCOPE("Application::Update");
+            
             if(m_shouldNotifyConnectionsResumeEvent == true)
 			{
 				m_shouldNotifyConnectionsResumeEvent = false;
@@ -243,6 +256,8 @@ namespace ChilliSource
             
             while((m_updateIntervalRemainder >= GetUpdateInterval()) || m_isFirstFrame)
             {
+                CS_PROFILE_SCOPE("Application::FixedUpdate");
+                
                 m_updateIntervalRemainder -=  GetUpdateInterval();
                 
                 //update all of the application systems
@@ -263,6 +278,8 @@ namespace ChilliSource
         //----------------------------------------------------
         void Application::Render()
         {
+            CS_PROFILE_SCOPE("Application::Render");
+            
             if(m_isSuspending)
             {
                 // Updating after told to suspend so early out
@@ -350,6 +367,9 @@ namespace ChilliSource
 
             m_systems.clear();
 
+#ifdef CS_ENABLE_PROFILING
+            Profiler::Destroy();
+#endif
             Logging::Destroy();
             
             s_application = nullptr;
@@ -393,12 +413,14 @@ namespace ChilliSource
             CreateSystem<Rendering::CubemapProvider>();
             CreateSystem<Rendering::FontProvider>();
             CreateSystem<Rendering::RenderComponentFactory>();
+            m_animationUpdateSystem = CreateSystem<Rendering::AnimationUpdateSystem>();
             
             //Particles
             CreateSystem<Rendering::CSParticleProvider>();
             CreateSystem<Rendering::ParticleAffectorDefFactory>();
             CreateSystem<Rendering::ParticleDrawableDefFactory>();
             CreateSystem<Rendering::ParticleEmitterDefFactory>();
+            m_particleUpdateSystem = CreateSystem<Rendering::ParticleUpdateSystem>();
             
             //UI
             CreateSystem<UI::ComponentFactory>();
@@ -445,10 +467,17 @@ namespace ChilliSource
             //update all of the application systems
             for (const AppSystemUPtr& system : m_systems)
             {
+                CS_PROFILE_SCOPE(system->GetInterfaceTypeName().c_str());
                 system->OnUpdate(in_deltaTime);
             }
             
             m_stateManager->UpdateStates(in_deltaTime);
+            
+            //all particle effects have now queued their updates so they can be dispatched together.
+            m_particleUpdateSystem->ProcessQueuedUpdates();
+            
+            //evaluate all queued animations together. This blocks until they are finished so they are ready to render.
+            m_animationUpdateSystem->ProcessQueuedUpdates();
 		}
         //----------------------------------------------------
         //----------------------------------------------------
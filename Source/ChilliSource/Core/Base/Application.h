@@ -496,6 +496,8 @@ namespace ChilliSource
             Input::PointerSystem* m_pointerSystem = nullptr;
             AppConfig* m_appConfig = nullptr;
             UI::WidgetFactory* m_widgetFactory = nullptr;
+            Rendering::ParticleUpdateSystem* m_particleUpdateSystem = nullptr;
+            Rendering::AnimationUpdateSystem* m_animationUpdateSystem = nullptr;
             
 			TimeIntervalSecs m_currentAppTime = 0;
 			f32 m_updateInterval;
@@ -54,6 +54,10 @@ extern "C"
 #include <Foundation/NSThread.h>
 #endif
 
+#ifdef CS_TARGETPLATFORM_LINUX
+#include <iostream>
+#endif
+
 #ifdef CS_ENABLE_DEBUG
 #include <cassert>
 #endif
@@ -173,6 +177,8 @@ namespace ChilliSource
             [message release];
 #elif defined (CS_TARGETPLATFORM_WINDOWS)
 			OutputDebugString(CSBackend::Windows::WindowsStringUtils::UTF8ToUTF16("[Chilli Source] " + in_message + "\n").c_str());
+#elif defined (CS_TARGETPLATFORM_LINUX)
+            std::cout << "[Chilli Source] " << in_message << std::endl;
 #endif
             
 #ifdef CS_ENABLE_LOGTOFILE
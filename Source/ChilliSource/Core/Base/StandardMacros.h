@@ -50,6 +50,15 @@
 #define CS_ASSERT(in_query, in_message)
 #endif
 //------------------------------------------------------------
+/// Profiling. Profile markers are enabled by default in debug
+/// builds. They can be enabled in other builds by declaring
+/// CS_ENABLE_PROFILING, or removed from debug builds by
+/// declaring CS_DISABLE_PROFILING.
+//------------------------------------------------------------
+#if defined CS_ENABLE_DEBUG && !defined CS_ENABLE_PROFILING && !defined CS_DISABLE_PROFILING
+#define CS_ENABLE_PROFILING
+#endif
+//------------------------------------------------------------
 /// Casting macros
 //------------------------------------------------------------
 #ifdef CS_ENABLE_DEBUG
@@ -30,6 +30,8 @@
 
 #include <aes/aes.h>
 
+#include <cstring>
+
 namespace ChilliSource
 {
     namespace Core
@@ -59,6 +59,20 @@ namespace ChilliSource
             /// @return CRC 32 hash code
             //-------------------------------------------------------------
             u32 GenerateHashCode(const s8* inbyVal, u32 inudwSizeInBytes);
+            //-------------------------------------------------------------
+            /// Continues a hash code with more data, allowing large data
+            /// sets such as files to be hashed in blocks. Hashing data in
+            /// any number of blocks gives the same result as hashing it
+            /// all at once.
+            ///
+            /// @param The hash code of the preceding data, or 0 if this
+            /// is the first block.
+            /// @param Data to hash
+            /// @param Size of data in bytes
+            ///
+            /// @return CRC 32 hash code of all data hashed so far.
+            //-------------------------------------------------------------
+            u32 UpdateHashCode(u32 in_hashCode, const s8* in_data, u32 in_sizeInBytes);
         }
     }
 }
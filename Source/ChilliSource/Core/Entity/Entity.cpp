@@ -211,6 +211,7 @@ namespace ChilliSource
             if(GetScene() != nullptr)
             {
                 in_component->OnAddedToScene();
+                m_scene->OnComponentAddedToScene(in_component.get());
                 if (m_appActive == true)
                 {
                     in_component->OnResume();
@@ -242,6 +243,7 @@ namespace ChilliSource
                             }
                             in_component->OnSuspend();
                         }
+                        m_scene->OnComponentRemovedFromScene(in_component);
                         in_component->OnRemovedFromScene();
                     }
                     
@@ -272,6 +274,7 @@ namespace ChilliSource
                         }
                         component->OnSuspend();
                     }
+                    m_scene->OnComponentRemovedFromScene(component);
                     component->OnRemovedFromScene();
                 }
                 
@@ -386,9 +389,12 @@ namespace ChilliSource
 		//-------------------------------------------------------------
 		void Entity::OnAddedToScene()
 		{
+            m_transform.SetUpdateMode(m_scene->GetTransformUpdateMode());
+            
             for (u32 i = 0; i < m_components.size(); ++i)
             {
                 m_components[i]->OnAddedToScene();
+                m_scene->OnComponentAddedToScene(m_components[i].get());
             }
             
             for (u32 i = 0; i < m_children.size(); ++i)
@@ -431,8 +437,11 @@ namespace ChilliSource
             
             for (s32 i = m_components.size() - 1; i >= 0; --i)
             {
+                m_scene->OnComponentRemovedFromScene(m_components[i].get());
                 m_components[i]->OnRemovedFromScene();
             }
+            
+            m_transform.SetUpdateMode(Transform::UpdateMode::k_immediate);
 		}
         //----------------------------------------------------
         //----------------------------------------------------
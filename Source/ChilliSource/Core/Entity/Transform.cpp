@@ -143,7 +143,8 @@ namespace ChilliSource
 		{
             if(mpParentTransform)
             {
-                mvWorldPosition = GetWorldTransform().GetTranslation();
+                //The world components are cached whenever the world transform is recalculated
+                GetWorldTransform();
                 return mvWorldPosition;
             }
             
@@ -158,7 +159,7 @@ namespace ChilliSource
 		{
             if(mpParentTransform)
 			{
-				mvWorldScale = mpParentTransform->GetWorldScale() * mvScale;
+                GetWorldTransform();
                 return mvWorldScale;
 			}
 			
@@ -182,7 +183,7 @@ namespace ChilliSource
 		{
             if(mpParentTransform)
             {
-                mqWorldOrientation = Core::Quaternion(GetWorldTransform());
+                GetWorldTransform();
                 return mqWorldOrientation;
             }
             
@@ -441,6 +442,12 @@ namespace ChilliSource
         //----------------------------------------------------------------
         const Matrix4& Transform::GetWorldTransform() const
         {
+            if(m_updateMode == UpdateMode::k_deferred)
+            {
+                ResolveWorldTransform();
+                return mmatWorldTransform;
+            }
+            
             //If we have a parent transform we must apply it to
             //our local transform to get the relative transformation
             if(mpParentTransform)
@@ -452,18 +459,24 @@ namespace ChilliSource
 					
                     //Calculate the relative transform with our new parent transform
 					mmatWorldTransform = GetLocalTransform() * mpParentTransform->GetWorldTransform();
+                    CacheWorldComponents();
+                    ++m_worldVersion;
                 }
                 //Our local transform has changed therefore we must update
                 else if(!mbIsTransformCacheValid)
                 {
                     //Calculate the relative transformation from our cached parent
 					mmatWorldTransform = GetLocalTransform() * mpParentTransform->GetWorldTransform();
+                    CacheWorldComponents();
+                    ++m_worldVersion;
                 }
             }
             //We do not have a parent so our relative transform is actually just our local one
             else if(!mbIsTransformCacheValid)
             {
                 mmatWorldTransform = GetLocalTransform();
+                CacheWorldComponents();
+                ++m_worldVersion;
             }
             
 			return mmatWorldTransform;
@@ -485,6 +498,14 @@ namespace ChilliSource
             
             mbIsTransformCacheValid = true;
             mbIsParentTransformCacheValid = true;
+            
+            //Record the parent this was set against so the deferred mode doesn't immediately recalculate it
+            if(mpParentTransform)
+            {
+                mpParentTransform->GetWorldTransform();
+                m_parentWorldVersion = mpParentTransform->m_worldVersion;
+            }
+            ++m_worldVersion;
         }
         //----------------------------------------------------------------
         /// Set Local Transform
@@ -597,6 +618,13 @@ namespace ChilliSource
             return mTransformChangedEvent;
         }
         //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        u32 Transform::GetWorldVersion() const
+        {
+            GetWorldTransform();
+            return m_worldVersion;
+        }
+        //----------------------------------------------------------------
         /// On Transform Changed 
         ///
         /// Triggered when our transform changes so we can 
@@ -606,6 +634,13 @@ namespace ChilliSource
         {
             mbIsTransformCacheValid = false;
             
+            //Descendants and listeners are dealt with in UpdateWorldTransforms()
+            if(m_updateMode == UpdateMode::k_deferred)
+            {
+                MarkDirty();
+                return;
+            }
+            
             for(std::vector<Transform*>::iterator it = mChildTransforms.begin(); it != mChildTransforms.end(); ++it)
             {
                 (*it)->OnParentTransformChanged();
@@ -627,6 +662,112 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
+        void Transform::MarkDirty()
+        {
+            m_isDirty = true;
+            
+            //Ancestors that are already flagged have flagged their own ancestors too
+            Transform* pAncestor = mpParentTransform;
+            while(pAncestor != nullptr && pAncestor->m_hasDirtyDescendant == false)
+            {
+                pAncestor->m_hasDirtyDescendant = true;
+                pAncestor = pAncestor->mpParentTransform;
+            }
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Transform::ResolveWorldTransform() const
+        {
+            bool bChanged = (mbIsTransformCacheValid == false || mbIsParentTransformCacheValid == false);
+            
+            if(mpParentTransform)
+            {
+                //Resolving the parent first means only the ancestors are visited, never the siblings or descendants
+                const Matrix4& matParentWorld = mpParentTransform->GetWorldTransform();
+                if(bChanged == true || m_parentWorldVersion != mpParentTransform->m_worldVersion)
+                {
+                    mmatWorldTransform = GetLocalTransform() * matParentWorld;
+                    m_parentWorldVersion = mpParentTransform->m_worldVersion;
+                    bChanged = true;
+                }
+            }
+            else if(bChanged == true)
+            {
+                mmatWorldTransform = GetLocalTransform();
+            }
+            
+            if(bChanged == true)
+            {
+                CacheWorldComponents();
+                mbIsParentTransformCacheValid = true;
+                ++m_worldVersion;
+            }
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Transform::CacheWorldComponents() const
+        {
+            mvWorldPosition = mmatWorldTransform.GetTranslation();
+            mqWorldOrientation = Quaternion(mmatWorldTransform);
+            
+            //The parent world transform has always been resolved before this one
+            mvWorldScale = (mpParentTransform != nullptr) ? mpParentTransform->GetWorldScale() * mvScale : mvScale;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Transform::SetUpdateMode(UpdateMode in_updateMode)
+        {
+            if(m_updateMode == in_updateMode)
+                return;
+            
+            m_updateMode = in_updateMode;
+            
+            OnParentTransformChanged();
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        Transform::UpdateMode Transform::GetUpdateMode() const
+        {
+            return m_updateMode;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Transform::UpdateWorldTransforms()
+        {
+            if(m_updateMode == UpdateMode::k_deferred)
+            {
+                UpdateWorldTransforms(false);
+            }
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Transform::UpdateWorldTransforms(bool in_ancestorChanged)
+        {
+            if(in_ancestorChanged == false && m_isDirty == false && m_hasDirtyDescendant == false)
+                return;
+            
+            //The flags are cleared before notifying so that any changes made by listeners are
+            //flagged again for the next update.
+            m_isDirty = false;
+            m_hasDirtyDescendant = false;
+            
+            //The world transform may already have been resolved by a request earlier in the frame
+            //so the version is compared against the one that was last notified.
+            ResolveWorldTransform();
+            const bool bChanged = (m_worldVersion != m_notifiedWorldVersion);
+            if(bChanged == true)
+            {
+                m_notifiedWorldVersion = m_worldVersion;
+                mTransformChangedEvent.NotifyConnections();
+            }
+            
+            for(u32 i = 0; i < mChildTransforms.size(); ++i)
+            {
+                mChildTransforms[i]->UpdateWorldTransforms(bChanged);
+            }
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
         void Transform::Reset()
         {
             mbIsTransformCacheValid = false;
@@ -636,6 +777,9 @@ namespace ChilliSource
             mqWorldOrientation = Quaternion::k_identity;
             mpParentTransform = nullptr;
             mChildTransforms.clear();
+            m_updateMode = UpdateMode::k_immediate;
+            m_isDirty = false;
+            m_hasDirtyDescendant = false;
             mTransformChangedEvent.CloseAllConnections();
         }
     }
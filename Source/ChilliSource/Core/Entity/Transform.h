@@ -45,6 +45,24 @@ namespace ChilliSource
         {
         public:
             typedef std::function<void()> TransformChangedDelegate;
+            //----------------------------------------------------------------
+            /// How changes to the transform are propagated through the
+            /// hierarchy.
+            ///
+            /// Immediate: every change invalidates all descendants and
+            /// notifies their listeners straight away.
+            ///
+            /// Deferred: a change only marks the transform as dirty. World
+            /// transforms are still resolved lazily on request, but listeners
+            /// are not notified until UpdateWorldTransforms() is called on
+            /// the root of the hierarchy, which notifies each changed
+            /// transform once, top-down.
+            //----------------------------------------------------------------
+            enum class UpdateMode
+            {
+                k_immediate,
+                k_deferred
+            };
             
             Transform();
             //----------------------------------------------------------
@@ -333,7 +351,41 @@ namespace ChilliSource
             /// @return TransformChangedDelegate event
             //----------------------------------------------------------------
             IConnectableEvent<TransformChangedDelegate>& GetTransformChangedEvent();
+            //----------------------------------------------------------------
+            /// In the deferred update mode the transform changed event isn't
+            /// sent until the per-frame update, so state derived from the
+            /// world transform, such as cached bounds, should also compare
+            /// this to detect changes made earlier in the frame.
+            ///
+            /// @return A number which changes whenever the world transform
+            /// is recalculated. This resolves the world transform first.
+            //----------------------------------------------------------------
+            u32 GetWorldVersion() const;
             
+            //----------------------------------------------------------------
+            /// Sets how changes to this transform are propagated. Every
+            /// transform in a hierarchy should use the same mode. Switching
+            /// mode invalidates the transform and notifies its listeners.
+            ///
+            /// @param The update mode.
+            //----------------------------------------------------------------
+            void SetUpdateMode(UpdateMode in_updateMode);
+            //----------------------------------------------------------------
+            /// @return How changes to this transform are propagated.
+            //----------------------------------------------------------------
+            UpdateMode GetUpdateMode() const;
+            //----------------------------------------------------------------
+            /// Resolves the world transforms of this transform and all of its
+            /// descendants in hierarchy order and notifies the listeners of
+            /// any that have changed since the last update. Subtrees that
+            /// contain no changes are skipped. This should be called on root
+            /// transforms once per frame when using the deferred update mode;
+            /// in the immediate mode it does nothing.
+            ///
+            /// Changes made by listeners during the update will be picked up
+            /// by the next update.
+            //----------------------------------------------------------------
+            void UpdateWorldTransforms();
             //----------------------------------------------------------------
             /// Resets the transform back to identity and removes any
             /// connections
@@ -358,6 +410,29 @@ namespace ChilliSource
             /// recalculate our transform
             //----------------------------------------------------------------
             void OnParentTransformChanged();
+            //----------------------------------------------------------------
+            /// Marks this transform as changed for the deferred update mode
+            /// and flags each ancestor as having a changed descendant.
+            //----------------------------------------------------------------
+            void MarkDirty();
+            //----------------------------------------------------------------
+            /// Recalculates the cached world transform in the deferred update
+            /// mode if the local transform or any ancestor has changed since
+            /// it was last calculated.
+            //----------------------------------------------------------------
+            void ResolveWorldTransform() const;
+            //----------------------------------------------------------------
+            /// Caches the world position, orientation and scale from the
+            /// newly calculated world transform so the world getters don't
+            /// need to write when the transform is up to date.
+            //----------------------------------------------------------------
+            void CacheWorldComponents() const;
+            //----------------------------------------------------------------
+            /// Resolves and notifies this transform and its descendants.
+            ///
+            /// @param Whether an ancestor changed during this update.
+            //----------------------------------------------------------------
+            void UpdateWorldTransforms(bool in_ancestorChanged);
             
         private:
             
@@ -380,6 +455,13 @@ namespace ChilliSource
             
             mutable bool mbIsTransformCacheValid;
             mutable bool mbIsParentTransformCacheValid;
+            
+            UpdateMode m_updateMode = UpdateMode::k_immediate;
+            mutable u32 m_worldVersion = 0;
+            mutable u32 m_parentWorldVersion = 0;
+            u32 m_notifiedWorldVersion = 0;
+            bool m_isDirty = false;
+            bool m_hasDirtyDescendant = false;
         };
     }
 }
@@ -28,9 +28,12 @@
 
 #include <ChilliSource/Core/File/FileStream.h>
 
+#include <ChilliSource/Core/Cryptographic/HashCRC32.h>
+
 #include <md5/md5.h>
 #include <SHA1/SHA1.h>
 
+#include <algorithm>
 #include <sstream>
 
 #ifdef CS_TARGETPLATFORM_WINDOWS
@@ -41,6 +44,11 @@ namespace ChilliSource
 {
     namespace Core
     {
+        namespace
+        {
+            const u32 k_checksumBlockSize = 64 * 1024;
+        }
+        
         //--------------------------------------------------------------
         /// Get MD5 Checksum 
         ///
@@ -50,34 +58,12 @@ namespace ChilliSource
         //--------------------------------------------------------------
         std::string FileStream::GetMD5Checksum()
         {
-            s32 dwCurrentPos = TellG();
-            
-            // Get file size
-            mFileStream.seekg(0, mFileStream.end);
-            u32 udwLength = TellG();
-            
-            SeekG(0);
-            
-            const u32 kudwChunkSize = 256;
-            s8 byData[kudwChunkSize];
-            
             MD5 Hash;
             
-            while(udwLength >= kudwChunkSize)
+            ReadInBlocks([&](const s8* in_block, u32 in_size)
             {
-                Read(byData, kudwChunkSize);
-                Hash.update(byData, kudwChunkSize);
-                udwLength -= kudwChunkSize;
-            }
-            
-            // Last chunk
-            if(udwLength > 0)
-            {
-                Read(byData, udwLength);
-                Hash.update(byData, udwLength);
-            }
-            
-            SeekG(dwCurrentPos);
+                Hash.update(in_block, in_size);
+            });
             
             Hash.finalize();
             return Hash.binarydigest();
@@ -87,35 +73,13 @@ namespace ChilliSource
         //--------------------------------------------------------------
         std::string FileStream::GetSHA1Checksum(CSHA1::REPORT_TYPE ineReportType)
         {
-            s32 dwCurrentPos = TellG();
-            
-            // Get file size
-            mFileStream.seekg(0, mFileStream.end);
-            u32 udwLength = TellG();
-            
-            SeekG(0);
-            
-            const u32 kudwChunkSize = 256;
-            s8 byData[kudwChunkSize];
-            
             CSHA1 Hash;
             Hash.Reset();
             
-            while(udwLength >= kudwChunkSize)
+            ReadInBlocks([&](const s8* in_block, u32 in_size)
             {
-                Read(byData, kudwChunkSize);
-                Hash.Update(reinterpret_cast<u8*>(byData), kudwChunkSize);
-                udwLength -= kudwChunkSize;
-            }
-            
-            // Last chunk
-            if(udwLength > 0)
-            {
-                Read(byData, udwLength);
-                Hash.Update(reinterpret_cast<u8*>(byData), udwLength);
-            }
-            
-            SeekG(dwCurrentPos);
+                Hash.Update(reinterpret_cast<const u8*>(in_block), in_size);
+            });
             
             Hash.Final();
             
@@ -133,6 +97,19 @@ namespace ChilliSource
 			return std::string(cHash);
 #endif
         }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        u32 FileStream::GetCRC32Checksum()
+        {
+            u32 hash = 0;
+            
+            ReadInBlocks([&](const s8* in_block, u32 in_size)
+            {
+                hash = HashCRC32::UpdateHashCode(hash, in_block, in_size);
+            });
+            
+            return hash;
+        }
         //--------------------------------------------------------------------------------------------------
 		/// Open
 		//--------------------------------------------------------------------------------------------------			
@@ -410,5 +387,29 @@ namespace ChilliSource
 					return (std::ios_base::in);
 			}
 		}
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void FileStream::ReadInBlocks(const std::function<void(const s8*, u32)>& in_blockDelegate)
+        {
+            s32 currentPos = TellG();
+            
+            SeekG(0, SeekDir::k_end);
+            u32 remaining = u32(TellG());
+            SeekG(0, SeekDir::k_beginning);
+            
+            //read in large blocks to keep the number of stream reads low, while keeping memory use
+            //bounded regardless of the file size. This is allocated on the heap as checksums are often
+            //calculated on worker threads, which may have small stacks.
+            std::unique_ptr<s8[]> block(new s8[k_checksumBlockSize]);
+            while (remaining > 0)
+            {
+                u32 blockSize = std::min(remaining, k_checksumBlockSize);
+                Read(block.get(), s32(blockSize));
+                in_blockDelegate(block.get(), blockSize);
+                remaining -= blockSize;
+            }
+            
+            SeekG(currentPos);
+        }
 	}
 }
@@ -36,6 +36,7 @@
 #include <string>
 #include <cstdio>
 #include <fstream>
+#include <functional>
 
 namespace ChilliSource
 {
@@ -348,6 +349,12 @@ namespace ChilliSource
             /// @return SHA1 checksum
             //--------------------------------------------------------------
             std::string GetSHA1Checksum(CSHA1::REPORT_TYPE ineReportType);
+            //--------------------------------------------------------------
+            /// Calculates the CRC 32 checksum of the file.
+            ///
+            /// @return CRC 32 checksum
+            //--------------------------------------------------------------
+            u32 GetCRC32Checksum();
             //--------------------------------------------------------------------------------------------------
 			/// Open
 			///
@@ -382,6 +389,14 @@ namespace ChilliSource
             /// Get File Mode
             //--------------------------------------------------------------------------------------------------
             std::ios_base::openmode GetFileMode() const;
+            //--------------------------------------------------------------------------------------------------
+            /// Reads the entire file in fixed size blocks, passing each to the given delegate. This allows
+            /// checksums to be calculated for files of any size with bounded memory. The get pointer is
+            /// restored afterwards.
+            ///
+            /// @param The delegate that will receive each block and its size in bytes.
+            //--------------------------------------------------------------------------------------------------
+            void ReadInBlocks(const std::function<void(const s8*, u32)>& in_blockDelegate);
             
             Core::FileMode meFileMode;
         
@@ -28,9 +28,11 @@
 
 #include <ChilliSource/Core/File/FileSystem.h>
 
+#include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Cryptographic/HashMD5.h>
 #include <ChilliSource/Core/Cryptographic/HashCRC32.h>
 #include <ChilliSource/Core/String/StringUtils.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
 
 #ifdef CS_TARGETPLATFORM_IOS
 #include <CSBackend/Platform/iOS/Core/File/FileSystem.h>
@@ -44,6 +46,10 @@
 #include <CSBackend/Platform/Windows/Core/File/FileSystem.h>
 #endif
 
+#ifdef CS_TARGETPLATFORM_LINUX
+#include <CSBackend/Platform/Linux/Core/File/FileSystem.h>
+#endif
+
 #include <md5/md5.h>
 
 #include <algorithm>
@@ -55,6 +61,44 @@ namespace ChilliSource
         namespace
         {
             const std::string k_defaultPackageDLCDirectory = "DLC/";
+            
+            //-------------------------------------------------------
+            /// Calls the given function for each file in the list,
+            /// spreading the files across the thread pool when the
+            /// task scheduler is available. This is used to hash
+            /// directories, where each file is independent. The
+            /// function is called with the index of the file and
+            /// may be called on any thread. Reading files is slow
+            /// so the chunks are low priority, keeping them clear
+            /// of frame critical tasks.
+            ///
+            /// @param The list of file paths.
+            /// @param The function to call for each file.
+            //-------------------------------------------------------
+            void ForEachFileInParallel(const std::vector<std::string>& in_filePaths, const std::function<void(u32)>& in_function)
+            {
+                const u32 numFiles = u32(in_filePaths.size());
+                
+                Application* application = Application::Get();
+                TaskScheduler* taskScheduler = (application != nullptr) ? application->GetTaskScheduler() : nullptr;
+                if (taskScheduler != nullptr)
+                {
+                    taskScheduler->ParallelFor(numFiles, 1, [&](u32 in_startIndex, u32 in_endIndex)
+                    {
+                        for (u32 i = in_startIndex; i < in_endIndex; ++i)
+                        {
+                            in_function(i);
+                        }
+                    }, TaskPriority::k_low);
+                }
+                else
+                {
+                    for (u32 i = 0; i < numFiles; ++i)
+                    {
+                        in_function(i);
+                    }
+                }
+            }
         }
         CS_DEFINE_NAMEDTYPE(FileSystem);
         
@@ -70,6 +114,9 @@ namespace ChilliSource
 #endif
 #ifdef CS_TARGETPLATFORM_WINDOWS
             return FileSystemUPtr(new CSBackend::Windows::FileSystem());
+#endif
+#ifdef CS_TARGETPLATFORM_LINUX
+            return FileSystemUPtr(new CSBackend::Linux::FileSystem());
 #endif
             return nullptr;
         }
@@ -191,14 +238,13 @@ namespace ChilliSource
         	std::vector<std::string> filenames = GetFilePaths(in_storageLocation, in_directoryPath, true);
             
 			//get a hash for each of the files.
-            std::vector<std::string> hashes;
-			for (const std::string& filename : filenames)
-			{
-                std::string fileHash = GetFileChecksumMD5(in_storageLocation, in_directoryPath + filename);
-                std::string pathHash = HashMD5::GenerateBinaryHashCode(filename.c_str(), filename.length());
-                hashes.push_back(fileHash);
-                hashes.push_back(pathHash);
-			}
+            std::vector<std::string> hashes(filenames.size() * 2);
+            ForEachFileInParallel(filenames, [&](u32 in_index)
+            {
+                const std::string& filename = filenames[in_index];
+                hashes[in_index * 2] = GetFileChecksumMD5(in_storageLocation, in_directoryPath + filename);
+                hashes[in_index * 2 + 1] = HashMD5::GenerateBinaryHashCode(filename.c_str(), filename.length());
+            });
             
 			//sort the list so that ordering of
             std::sort(hashes.begin(), hashes.end());
@@ -211,7 +257,7 @@ namespace ChilliSource
 			}
             
 			//return the hash of this as the output
-            std::string strOutput = 0;
+            std::string strOutput;
 			if (hashableDirectoryContents.length() > 0)
             {
 				strOutput = HashMD5::GenerateBinaryHashCode(hashableDirectoryContents.c_str(), hashableDirectoryContents.length());
@@ -225,22 +271,10 @@ namespace ChilliSource
 		{
 			u32 output = 0;
 
-			//open the file
 			FileStreamUPtr file = CreateFileStream(in_storageLocation, in_filePath, FileMode::k_readBinary);
 			if (file != nullptr && file->IsOpen() == true && file->IsBad() == false)
 			{
-				//get the length of the file
-				file->SeekG(0, SeekDir::k_end);
-				s32 length = file->TellG();
-				file->SeekG(0, SeekDir::k_beginning);
-
-				//read contents of file
-				s8* contents = new s8[length];
-				file->Read(contents, length);
-
-				//get the hash
-				output = HashCRC32::GenerateHashCode(contents, length);
-				CS_SAFEDELETE_ARRAY(contents);
+				output = file->GetCRC32Checksum();
 			}
 			return output;
 		}
@@ -251,14 +285,13 @@ namespace ChilliSource
 			std::vector<std::string> filenames = GetFilePaths(in_storageLocation, in_directoryPath, true);
 
 			//get a hash for each of the files.
-            std::vector<u32> hashes;
-			for (const std::string& filename : filenames)
-			{
-				u32 fileHash = GetFileChecksumCRC32(in_storageLocation, in_directoryPath + filename);
-				u32 pathHash = HashCRC32::GenerateHashCode(filename.c_str(), filename.length());
-				hashes.push_back(fileHash);
-				hashes.push_back(pathHash);
-			}
+            std::vector<u32> hashes(filenames.size() * 2);
+            ForEachFileInParallel(filenames, [&](u32 in_index)
+            {
+                const std::string& filename = filenames[in_index];
+                hashes[in_index * 2] = GetFileChecksumCRC32(in_storageLocation, in_directoryPath + filename);
+                hashes[in_index * 2 + 1] = HashCRC32::GenerateHashCode(filename.c_str(), filename.length());
+            });
 
 			//sort the list so that ordering of
 			std::sort(hashes.begin(), hashes.end());
@@ -149,6 +149,65 @@ namespace ChilliSource
                 CS_LOG_FATAL("TaggedFilePathResolver: No such group: " + in_group);
                 return TaggedFilePathResolver::TagGroup::k_platform;
             }
+            //--------------------------------------------------------------
+            /// Files in the package and ChilliSource locations never change
+            /// and DLC only changes when it is installed, so these can be
+            /// indexed. All other locations can be written to by the app.
+            ///
+            /// @param Storage location
+            ///
+            /// @return Whether or not files in the location are indexed.
+            //--------------------------------------------------------------
+            bool IsIndexedLocation(StorageLocation in_location)
+            {
+                return (in_location == StorageLocation::k_package || in_location == StorageLocation::k_chilliSource || in_location == StorageLocation::k_DLC);
+            }
+            //--------------------------------------------------------------
+            /// @param Storage location
+            /// @param Path
+            ///
+            /// @return A key which is unique to the path in the location.
+            //--------------------------------------------------------------
+            std::string MakeIndexKey(StorageLocation in_location, const std::string& in_path)
+            {
+                std::string key(1, (s8)('0' + (u32)in_location));
+                key += in_path;
+                return key;
+            }
+            //--------------------------------------------------------------
+            /// @param File name, without extension
+            /// @param Extension
+            ///
+            /// @return The key of the group the file belongs to in its
+            /// directory index. This is the file name up to the first '.'
+            /// followed by the lower case extension, so all tagged
+            /// variants of a file share the same key.
+            //--------------------------------------------------------------
+            std::string MakeGroupKey(const std::string& in_fileName, const std::string& in_extension)
+            {
+                std::string extension = in_extension;
+                StringUtils::ToLowerCase(extension);
+                
+                return in_fileName.substr(0, in_fileName.find('.')) + "." + extension;
+            }
+            //--------------------------------------------------------------
+            /// Groups the given file paths by file name and extension so
+            /// that all of the tagged variants of a file can be found
+            /// with a single lookup.
+            ///
+            /// @param The paths of the files in the directory.
+            /// @param [Out] The directory index.
+            //--------------------------------------------------------------
+            void BuildDirectoryIndex(const std::vector<std::string>& in_filePaths, std::unordered_map<std::string, std::vector<std::string>>& out_index)
+            {
+                for(const auto& path : in_filePaths)
+                {
+                    std::string fileName, extension;
+                    StringUtils::SplitBaseFilename(path.substr(path.find_last_of('/') + 1), fileName, extension);
+                    
+                    out_index[MakeGroupKey(fileName, extension)].push_back(path);
+                }
+            }
         }
         
         CS_DEFINE_NAMEDTYPE(TaggedFilePathResolver);
@@ -257,6 +316,8 @@ namespace ChilliSource
             m_activeTags[(u32)TagGroup::k_platform] = ".android";
 #elif defined CS_TARGETPLATFORM_WINDOWS
             m_activeTags[(u32)TagGroup::k_platform] = ".windows";
+#elif defined CS_TARGETPLATFORM_LINUX
+            m_activeTags[(u32)TagGroup::k_platform] = ".linux";
 #endif
             
             //---Resolution
@@ -287,6 +348,8 @@ namespace ChilliSource
             {
                 DetermineScreenDependentTags(m_screen->GetResolution());
             }
+            
+            ClearResolvedPaths();
         }
         //--------------------------------------------------------------
         //--------------------------------------------------------------
@@ -297,6 +360,8 @@ namespace ChilliSource
             m_priorityIndices[2] = (u32)in_3;
             m_priorityIndices[3] = (u32)in_low;
             
+            ClearResolvedPaths();
+            
 #ifdef DEBUG
             u32 priorityIndicesSorted[(u32)TagGroup::k_total];
             std::copy(m_priorityIndices, m_priorityIndices + (u32)TagGroup::k_total, priorityIndicesSorted);
@@ -337,6 +402,8 @@ namespace ChilliSource
                     break;
                 }
             }
+            
+            ClearResolvedPaths();
         }
         //--------------------------------------------------------------
         //--------------------------------------------------------------
@@ -345,11 +412,61 @@ namespace ChilliSource
             std::string filePath, fileName, fileExtension;
             StringUtils::SplitFullFilename(in_basePath, fileName, fileExtension, filePath);
             
-            //Look for all files in the given folder with the given name and extension
-            std::vector<std::string> pathsContaining = m_fileSystem->GetFilePathsWithExtension(in_location, filePath, false, fileExtension);
+            if(IsIndexedLocation(in_location) == false)
+            {
+                //Look for all files in the given folder with the given name and extension
+                return SelectBestPath(filePath, fileName, m_fileSystem->GetFilePathsWithExtension(in_location, filePath, false, fileExtension));
+            }
+            
+            std::unique_lock<std::mutex> lock(m_indexMutex);
+            
+            const std::string resolvedKey = MakeIndexKey(in_location, in_basePath);
+            auto resolvedIt = m_resolvedPaths.find(resolvedKey);
+            if(resolvedIt != m_resolvedPaths.end())
+            {
+                return resolvedIt->second;
+            }
+            
+            //The directory is only listed the first time a file in it is resolved.
+            const std::string directoryKey = MakeIndexKey(in_location, filePath);
+            auto directoryIt = m_directoryIndices.find(directoryKey);
+            if(directoryIt == m_directoryIndices.end())
+            {
+                directoryIt = m_directoryIndices.insert(std::make_pair(directoryKey, DirectoryIndex())).first;
+                BuildDirectoryIndex(m_fileSystem->GetFilePaths(in_location, filePath, false), directoryIt->second);
+            }
+            
+            std::string resolvedPath;
+            auto groupIt = directoryIt->second.find(MakeGroupKey(fileName, fileExtension));
+            if(groupIt != directoryIt->second.end())
+            {
+                resolvedPath = SelectBestPath(filePath, fileName, groupIt->second);
+            }
             
+            m_resolvedPaths.insert(std::make_pair(resolvedKey, resolvedPath));
+            return resolvedPath;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void TaggedFilePathResolver::ClearFileIndex()
+        {
+            std::unique_lock<std::mutex> lock(m_indexMutex);
+            m_directoryIndices.clear();
+            m_resolvedPaths.clear();
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void TaggedFilePathResolver::ClearResolvedPaths()
+        {
+            std::unique_lock<std::mutex> lock(m_indexMutex);
+            m_resolvedPaths.clear();
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        std::string TaggedFilePathResolver::SelectBestPath(const std::string& in_directoryPath, const std::string& in_fileName, const std::vector<std::string>& in_filePaths) const
+        {
             //Filter on the filename
-            pathsContaining = FilterFileNameStartsWith(pathsContaining, fileName + ".");
+            std::vector<std::string> pathsContaining = FilterFileNameStartsWith(in_filePaths, in_fileName + ".");
             
             if(pathsContaining.empty() == true)
             {
@@ -384,7 +501,7 @@ namespace ChilliSource
                 }
             }
 
-            return finalPaths.empty() == false ? filePath + finalPaths[0] : "";
+            return finalPaths.empty() == false ? in_directoryPath + finalPaths[0] : "";
         }
         //--------------------------------------------------------------
         //--------------------------------------------------------------
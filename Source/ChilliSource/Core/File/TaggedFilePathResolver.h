@@ -34,6 +34,9 @@
 
 #include <json/json.h>
 
+#include <mutex>
+#include <unordered_map>
+
 namespace ChilliSource
 {
 	namespace Core
@@ -62,6 +65,13 @@ namespace ChilliSource
         /// NOTE: Only the rules and tags for resolution and ratio are
         /// configurable as the platform and language are fixed.
         ///
+        /// Files in the package, ChilliSource and DLC storage locations
+        /// are indexed the first time a directory is resolved from, and
+        /// resolved paths are cached, so subsequent resolves are a
+        /// lookup rather than a directory listing. Other storage
+        /// locations can be written to by the app at any time so are
+        /// always resolved from a fresh directory listing.
+        ///
         /// @author S Downie
 		//-----------------------------------------------------------------
 		class TaggedFilePathResolver : public AppSystem
@@ -169,6 +179,15 @@ namespace ChilliSource
             //--------------------------------------------------------------
             std::string ResolveFilePath(StorageLocation in_location, const std::string& in_basePath) const;
             //--------------------------------------------------------------
+            /// Clears the index of tagged files and all cached resolved
+            /// paths. This must be called whenever files are added to or
+            /// removed from an indexed storage location at runtime, for
+            /// example after DLC has been installed.
+            ///
+            /// This is thread-safe.
+            //--------------------------------------------------------------
+            void ClearFileIndex();
+            //--------------------------------------------------------------
             /// Returns the active tag for the given Tag Group.
             ///
             /// @author Ian Copland
@@ -209,8 +228,33 @@ namespace ChilliSource
             /// @param Screen size
             //--------------------------------------------------------------
             void DetermineScreenDependentTags(const Vector2& in_size);
+            //--------------------------------------------------------------
+            /// Picks the best-fit path for the device from the given list
+            /// of files in a directory.
+            ///
+            /// @param The directory path of the base file.
+            /// @param The file name of the base file, without extension.
+            /// @param The paths, relative to the directory, of the files
+            /// in the directory with the same extension as the base file.
+            ///
+            /// @return The best-fit path, or an empty string if there is
+            /// none.
+            //--------------------------------------------------------------
+            std::string SelectBestPath(const std::string& in_directoryPath, const std::string& in_fileName, const std::vector<std::string>& in_filePaths) const;
+            //--------------------------------------------------------------
+            /// Clears the cached resolved paths, keeping the directory
+            /// indices. This is called whenever the tags or priorities
+            /// change.
+            //--------------------------------------------------------------
+            void ClearResolvedPaths();
             
         private:
+            //--------------------------------------------------------------
+            /// The files in a single directory, grouped by the name up to
+            /// the first '.' and the lower case extension. All tagged
+            /// variants of a file will be in the same group.
+            //--------------------------------------------------------------
+            typedef std::unordered_map<std::string, std::vector<std::string>> DirectoryIndex;
             
             FileSystem* m_fileSystem = nullptr;
             Screen* m_screen = nullptr;
@@ -222,6 +266,10 @@ namespace ChilliSource
             std::string m_activeTags[(u32)TagGroup::k_total];
             
             u32 m_priorityIndices[(u32)TagGroup::k_total];
+            
+            mutable std::mutex m_indexMutex;
+            mutable std::unordered_map<std::string, DirectoryIndex> m_directoryIndices;
+            mutable std::unordered_map<std::string, std::string> m_resolvedPaths;
 		};
 	}
 		
@@ -202,6 +202,8 @@ namespace ChilliSource
         //---------------------------------------------------------
         CS_FORWARDDECLARE_CLASS(CoreTimer);
         CS_FORWARDDECLARE_CLASS(PerformanceTimer);
+        CS_FORWARDDECLARE_CLASS(Profiler);
+        CS_FORWARDDECLARE_CLASS(ScopedProfileMarker);
         CS_FORWARDDECLARE_CLASS(Timer);
         //---------------------------------------------------------
         /// Tween
@@ -56,6 +56,10 @@ namespace ChilliSource
 #endif
 #ifdef CS_TARGETPLATFORM_WINDOWS
             return PNGImageProviderUPtr(new CSBackend::Windows::PNGImageProvider());
+#endif
+#ifdef CS_TARGETPLATFORM_LINUX
+            //PNG decoding isn't available to the headless backend, so only csimage files can be loaded.
+            return nullptr;
 #endif
         }
     }
@@ -37,7 +37,7 @@ namespace ChilliSource
 		//-------------------------------------------------------
 		//-------------------------------------------------------
 		Resource::Resource()
-        : m_location(StorageLocation::k_none), m_loadState(LoadState::k_loading)
+        : m_location(StorageLocation::k_none), m_loadState(LoadState::k_loading), m_memoryUsage(0), m_memoryUsageCounter(nullptr), m_lastAccessed(0)
 		{
 		}
         //-------------------------------------------------------
@@ -54,6 +54,54 @@ namespace ChilliSource
         void Resource::SetLoadState(LoadState in_loadState)
         {
             m_loadState = in_loadState;
+        }
+        //-------------------------------------------------------
+        /// The counter is unsigned so a shrinking resource adds
+        /// the two's complement of the difference which wraps
+        /// to the correct total.
+        //-------------------------------------------------------
+        void Resource::SetMemoryUsage(u64 in_bytes)
+        {
+            u64 previous = m_memoryUsage.exchange(in_bytes);
+            if (m_memoryUsageCounter != nullptr)
+            {
+                m_memoryUsageCounter->fetch_add(in_bytes - previous);
+            }
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        u64 Resource::GetMemoryUsage() const
+        {
+            return m_memoryUsage;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void Resource::SetMemoryUsageCounter(std::atomic<u64>* in_counter)
+        {
+            u64 usage = m_memoryUsage;
+            if (m_memoryUsageCounter != nullptr)
+            {
+                m_memoryUsageCounter->fetch_sub(usage);
+            }
+            
+            m_memoryUsageCounter = in_counter;
+            
+            if (m_memoryUsageCounter != nullptr)
+            {
+                m_memoryUsageCounter->fetch_add(usage);
+            }
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void Resource::SetLastAccessed(u64 in_accessStamp)
+        {
+            m_lastAccessed = in_accessStamp;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        u64 Resource::GetLastAccessed() const
+        {
+            return m_lastAccessed;
         }
 		//-------------------------------------------------------
 		//-------------------------------------------------------
@@ -134,6 +134,21 @@ namespace ChilliSource
             //-------------------------------------------------------
             LoadState GetLoadState() const;
             //-------------------------------------------------------
+            /// NOTE: This is used by the resource providers and
+            /// resources themselves to report how much memory the
+            /// resource occupies once built. The resource pool uses
+            /// this to enforce its memory budget. Resources that do
+            /// not report a usage are treated as free.
+            ///
+            /// @param The memory usage of the resource in bytes.
+            //-------------------------------------------------------
+            void SetMemoryUsage(u64 in_bytes);
+            //-------------------------------------------------------
+            /// @return The memory usage of the resource in bytes as
+            /// reported by the resource.
+            //-------------------------------------------------------
+            u64 GetMemoryUsage() const;
+            //-------------------------------------------------------
             /// Virtual desctructor
             ///
             /// @author S Downie
@@ -192,6 +207,26 @@ namespace ChilliSource
             /// loading.
 			//-------------------------------------------------------
 			const IResourceOptionsBaseCSPtr& GetOptions() const;
+            //-------------------------------------------------------
+            /// Sets the counter that the memory usage of this
+            /// resource is accumulated into while it is cached by
+            /// the resource pool. The current usage is moved from
+            /// any previous counter to the new one. Null detaches
+            /// the resource from the pool's accounting.
+            ///
+            /// @param The counter or null.
+            //-------------------------------------------------------
+            void SetMemoryUsageCounter(std::atomic<u64>* in_counter);
+            //-------------------------------------------------------
+            /// @param The pool access stamp at which the resource was
+            /// last requested. Used for least recently used eviction.
+            //-------------------------------------------------------
+            void SetLastAccessed(u64 in_accessStamp);
+            //-------------------------------------------------------
+            /// @return The pool access stamp at which the resource
+            /// was last requested.
+            //-------------------------------------------------------
+            u64 GetLastAccessed() const;
 			
 		private:
 			
@@ -203,6 +238,9 @@ namespace ChilliSource
             ResourceId m_id;
         
             std::atomic<LoadState> m_loadState;
+            std::atomic<u64> m_memoryUsage;
+            std::atomic<u64>* m_memoryUsageCounter;
+            u64 m_lastAccessed;
 		};
 	}
 }
@@ -30,10 +30,18 @@
 
 #include <ChilliSource/Core/Resource/ResourceProvider.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     namespace Core
     {
+        namespace
+        {
+            const u32 k_defaultMaxConcurrentStreams = 4;
+            const u32 k_numStreamPriorities = static_cast<u32>(ResourcePool::StreamPriority::k_high) + 1;
+        }
+        
         CS_DEFINE_NAMEDTYPE(ResourcePool);
         
         //------------------------------------------------------------------------------------
@@ -44,6 +52,13 @@ namespace ChilliSource
         }
         //------------------------------------------------------------------------------------
         //------------------------------------------------------------------------------------
+        ResourcePool::ResourcePool()
+            : m_accessStamp(0), m_memoryBudget(0), m_numEvictions(0), m_numPendingLoads(0), m_maxConcurrentStreams(k_defaultMaxConcurrentStreams),
+              m_numStreamsInFlight(0), m_isDispatchingStreams(false), m_nextStreamRequestId(0)
+        {
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
         bool ResourcePool::IsA(InterfaceIDType in_interfaceId) const
         {
             return in_interfaceId == ResourcePool::InterfaceID;
@@ -53,18 +68,7 @@ namespace ChilliSource
         void ResourcePool::AddProvider(ResourceProvider* in_provider)
         {
             CS_ASSERT(in_provider != nullptr, "Cannot add null resource provider to pool");
-            auto itDescriptor = m_descriptors.find(in_provider->GetResourceType());
-            
-            if(itDescriptor == m_descriptors.end())
-            {
-                PoolDesc desc;
-                desc.m_providers.push_back(in_provider);
-                m_descriptors.insert(std::make_pair(in_provider->GetResourceType(), desc));
-            }
-            else
-            {
-                itDescriptor->second.m_providers.push_back(in_provider);
-            }
+            m_descriptors[in_provider->GetResourceType()].m_providers.push_back(in_provider);
         }
         //------------------------------------------------------------------------------------
         //------------------------------------------------------------------------------------
@@ -133,7 +137,7 @@ namespace ChilliSource
                         {
                             //The pool is the sole owner so we can safely release the object
                             CS_LOG_VERBOSE("Releasing resource from pool " + itResource->second->GetName());
-                            itResource = descEntry.second.m_cachedResources.erase(itResource);
+                            itResource = RemoveFromCache(descEntry.second, itResource);
                             numReleased++;
                         }
                         else
@@ -166,7 +170,7 @@ namespace ChilliSource
 					ResourceSPtr& resource = itResource->second;
 					CS_ASSERT((resource.use_count() <= 1), "Cannot release a resource if it is owned by another object (i.e. use_count > 0) : (" + resource->GetName() + ")");
 					CS_LOG_VERBOSE("Releasing resource from pool " + resource->GetName());
-					cachedResources.erase(itResource);
+					RemoveFromCache(itDescriptor->second, itResource);
                     return;
                 }
                 else
@@ -175,6 +179,222 @@ namespace ChilliSource
                 }
             }
         }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        bool ResourcePool::CancelStream(StreamRequestId in_requestId)
+        {
+            CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Streams can only be cancelled on the main thread");
+            
+            for (auto& queue : m_queuedStreams)
+            {
+                for (auto itRequest = queue.begin(); itRequest != queue.end(); ++itRequest)
+                {
+                    if (itRequest->m_id == in_requestId)
+                    {
+                        queue.erase(itRequest);
+                        return true;
+                    }
+                }
+            }
+            
+            return m_activeStreams.erase(in_requestId) > 0;
+        }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        void ResourcePool::SetMaxConcurrentStreams(u32 in_maxStreams)
+        {
+            CS_ASSERT(in_maxStreams > 0, "Must allow at least one concurrent stream");
+            m_maxConcurrentStreams = in_maxStreams;
+        }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        void ResourcePool::SetMemoryBudget(u64 in_bytes)
+        {
+            m_memoryBudget = in_bytes;
+        }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        u64 ResourcePool::GetMemoryBudget() const
+        {
+            return m_memoryBudget;
+        }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        u64 ResourcePool::GetResidentMemory() const
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            u64 residentMemory = 0;
+            for(const auto& descEntry : m_descriptors)
+            {
+                residentMemory += descEntry.second.m_residentMemory;
+            }
+            
+            return residentMemory;
+        }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        u32 ResourcePool::GetNumPendingLoads() const
+        {
+            return m_numPendingLoads;
+        }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        u32 ResourcePool::GetNumQueuedStreams() const
+        {
+            u32 numQueued = 0;
+            for (const auto& queue : m_queuedStreams)
+            {
+                numQueued += u32(queue.size());
+            }
+            
+            return numQueued;
+        }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        u32 ResourcePool::GetNumEvictions() const
+        {
+            return m_numEvictions;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::AddToCache(PoolDesc& in_desc, const ResourceSPtr& in_resource)
+        {
+            in_desc.m_cachedResources.insert(std::make_pair(in_resource->GetId(), in_resource));
+            in_resource->SetMemoryUsageCounter(&in_desc.m_residentMemory);
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        ResourcePool::ResourceMap::iterator ResourcePool::RemoveFromCache(PoolDesc& in_desc, ResourceMap::iterator in_itResource)
+        {
+            in_itResource->second->SetMemoryUsageCounter(nullptr);
+            return in_desc.m_cachedResources.erase(in_itResource);
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::MarkAccessed(Resource* in_resource) const
+        {
+            in_resource->SetLastAccessed(++m_accessStamp);
+        }
+        //------------------------------------------------------------------------------------
+        /// Starting a stream can complete synchronously if the resource is already cached, in
+        /// which case the delegate may stream further resources. These are picked up by the
+        /// outer loop rather than dispatching recursively.
+        //------------------------------------------------------------------------------------
+        void ResourcePool::DispatchStreams()
+        {
+            if (m_isDispatchingStreams == true)
+            {
+                return;
+            }
+            
+            m_isDispatchingStreams = true;
+            
+            s32 priority = s32(k_numStreamPriorities) - 1;
+            while (priority >= 0 && m_numStreamsInFlight < m_maxConcurrentStreams)
+            {
+                auto& queue = m_queuedStreams[priority];
+                if (queue.empty() == true)
+                {
+                    --priority;
+                    continue;
+                }
+                
+                StreamRequest request = std::move(queue.front());
+                queue.pop_front();
+                
+                m_activeStreams.insert(request.m_id);
+                ++m_numStreamsInFlight;
+                request.m_start(request.m_id);
+                
+                //The delegate may have queued a higher priority request.
+                priority = s32(k_numStreamPriorities) - 1;
+            }
+            
+            m_isDispatchingStreams = false;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        bool ResourcePool::OnStreamComplete(StreamRequestId in_requestId)
+        {
+            CS_ASSERT(m_numStreamsInFlight > 0, "Stream completed with none in flight.");
+            --m_numStreamsInFlight;
+            
+            return m_activeStreams.erase(in_requestId) > 0;
+        }
+        //------------------------------------------------------------------------------------
+        /// Evicting a resource can release the last external reference to another, so
+        /// candidates are gathered again after each pass until the pool is within budget
+        /// or a pass evicts nothing.
+        //------------------------------------------------------------------------------------
+        void ResourcePool::EvictLeastRecentlyUsed()
+        {
+            struct Candidate
+            {
+                u64 m_lastAccessed;
+                PoolDesc* m_desc;
+                Resource::ResourceId m_id;
+            };
+            
+            std::vector<Candidate> candidates;
+            u32 numEvicted = 0;
+            
+            do
+            {
+                numEvicted = 0;
+                candidates.clear();
+                
+                for(auto& descEntry : m_descriptors)
+                {
+                    for(const auto& resourceEntry : descEntry.second.m_cachedResources)
+                    {
+                        if(resourceEntry.second.use_count() == 1 && resourceEntry.second->GetLoadState() != Resource::LoadState::k_loading)
+                        {
+                            Candidate candidate = { resourceEntry.second->GetLastAccessed(), &descEntry.second, resourceEntry.first };
+                            candidates.push_back(candidate);
+                        }
+                    }
+                }
+                
+                std::sort(candidates.begin(), candidates.end(), [](const Candidate& in_a, const Candidate& in_b)
+                {
+                    return in_a.m_lastAccessed < in_b.m_lastAccessed;
+                });
+                
+                for(const auto& candidate : candidates)
+                {
+                    u64 residentMemory = 0;
+                    for(const auto& descEntry : m_descriptors)
+                    {
+                        residentMemory += descEntry.second.m_residentMemory;
+                    }
+                    
+                    if(residentMemory <= m_memoryBudget)
+                    {
+                        return;
+                    }
+                    
+                    auto itResource = candidate.m_desc->m_cachedResources.find(candidate.m_id);
+                    CS_LOG_VERBOSE("Evicting resource from pool " + itResource->second->GetName());
+                    RemoveFromCache(*candidate.m_desc, itResource);
+                    ++numEvicted;
+                    ++m_numEvictions;
+                }
+            }
+            while(numEvicted > 0);
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::OnUpdate(f32 in_deltaTime)
+        {
+            DispatchStreams();
+            
+            if(m_memoryBudget > 0 && GetResidentMemory() > m_memoryBudget)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                EvictLeastRecentlyUsed();
+            }
+        }
         //------------------------------------------------------------------------------------
         /// At this stage in the app lifecycle all app and system references to resource
         /// should have been released. If the resource pool still has resources then this
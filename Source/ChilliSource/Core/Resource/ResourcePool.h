@@ -38,9 +38,12 @@
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
+#include <atomic>
+#include <deque>
 #include <functional>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace ChilliSource
 {
@@ -52,6 +55,12 @@ namespace ChilliSource
         /// same resource will return the cached copy. The resource pool always holds the last
         /// reference to any resource.
         ///
+        /// The pool can also stream resources: streamed requests are queued by priority and
+        /// dispatched through LoadResourceAsync a few at a time, and can be cancelled until
+        /// their delegate is called. If a memory budget is set, the least recently used
+        /// unreferenced resources are evicted each update until the resident memory is back
+        /// within budget.
+        ///
         /// @author S Downie
         //------------------------------------------------------------------------------------
         class ResourcePool final : public AppSystem
@@ -60,6 +69,22 @@ namespace ChilliSource
             
             CS_DECLARE_NAMEDTYPE(ResourcePool);
             
+            //------------------------------------------------------------------------------------
+            /// The priority of a streamed resource request. Higher priority requests are always
+            /// dispatched before lower priority ones; requests of equal priority are dispatched
+            /// in the order they were made.
+            //------------------------------------------------------------------------------------
+            enum class StreamPriority
+            {
+                k_low,
+                k_medium,
+                k_high
+            };
+            //------------------------------------------------------------------------------------
+            /// Identifies a streamed resource request so that it can be cancelled.
+            //------------------------------------------------------------------------------------
+            using StreamRequestId = u32;
+            
             //------------------------------------------------------------------------------------
             /// Factory method for creating the system
             ///
@@ -211,6 +236,97 @@ namespace ChilliSource
             /// called on the main thread
             //-------------------------------------------------------------------------------------
             template <typename TResourceType> void LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate);
+            //------------------------------------------------------------------------------------
+            /// Queues the resource of given type to be loaded asynchronously. Queued requests
+            /// are dispatched to LoadResourceAsync in priority order, with no more than the
+            /// maximum number of concurrent streams in flight at once. If the resource is
+            /// already cached the delegate is called as soon as the request is dispatched.
+            ///
+            /// The resource is immutable
+            ///
+            /// This can only be called on the main thread.
+            ///
+            /// @param Storage location
+            /// @param File path
+            /// @param Load options that are used by the underlying providers to customise
+            /// initialisation
+            /// @param The priority of the request.
+            /// @param Delegate to trigger when the resource is loaded or failed. This will not
+            /// be called if the request is cancelled. Note: Always called on the main thread
+            ///
+            /// @return The id of the request which can be used to cancel it.
+            //-------------------------------------------------------------------------------------
+            template <typename TResourceType> StreamRequestId StreamResource(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsCSPtr<TResourceType>& in_options, StreamPriority in_priority, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate);
+            //------------------------------------------------------------------------------------
+            /// Queues the resource of given type to be loaded asynchronously with the default
+            /// load options. See the overload above for details.
+            ///
+            /// @param Storage location
+            /// @param File path
+            /// @param The priority of the request.
+            /// @param Delegate to trigger when the resource is loaded or failed. This will not
+            /// be called if the request is cancelled. Note: Always called on the main thread
+            ///
+            /// @return The id of the request which can be used to cancel it.
+            //-------------------------------------------------------------------------------------
+            template <typename TResourceType> StreamRequestId StreamResource(StorageLocation in_location, const std::string& in_filePath, StreamPriority in_priority, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate);
+            //------------------------------------------------------------------------------------
+            /// Cancels a streamed resource request. If the request is still queued it will never
+            /// be dispatched. If it is already loading, the load will complete and the resource
+            /// will be cached as normal but the delegate will not be called. This can only be
+            /// called on the main thread.
+            ///
+            /// @param The id of the request.
+            ///
+            /// @return Whether or not the request was pending and has been cancelled.
+            //-------------------------------------------------------------------------------------
+            bool CancelStream(StreamRequestId in_requestId);
+            //------------------------------------------------------------------------------------
+            /// @param The maximum number of streamed requests that can be loading at once.
+            /// Must be greater than zero. Defaults to 4.
+            //-------------------------------------------------------------------------------------
+            void SetMaxConcurrentStreams(u32 in_maxStreams);
+            //------------------------------------------------------------------------------------
+            /// Sets the memory budget of the pool. While the resident memory exceeds the budget
+            /// the least recently used resources that are only referenced by the pool will be
+            /// evicted each update. Resources that are still in use are never evicted, so the
+            /// budget can be exceeded if everything that is resident is in use.
+            ///
+            /// Only resources which report their memory usage count towards the budget. These
+            /// are currently textures, cubemaps, meshes, fonts and skinned animations; all other
+            /// resources are treated as free, though they can still be evicted.
+            ///
+            /// @param The budget in bytes. Zero, the default, disables eviction.
+            //-------------------------------------------------------------------------------------
+            void SetMemoryBudget(u64 in_bytes);
+            //------------------------------------------------------------------------------------
+            /// @return The memory budget in bytes. Zero if there is no budget.
+            //-------------------------------------------------------------------------------------
+            u64 GetMemoryBudget() const;
+            //------------------------------------------------------------------------------------
+            /// @return The total memory usage, in bytes, of all cached resources as reported by
+            /// the resources themselves.
+            //-------------------------------------------------------------------------------------
+            u64 GetResidentMemory() const;
+            //------------------------------------------------------------------------------------
+            /// @return The total memory usage, in bytes, of all cached resources of the given
+            /// type as reported by the resources themselves.
+            //-------------------------------------------------------------------------------------
+            template <typename TResourceType> u64 GetResidentMemory() const;
+            //------------------------------------------------------------------------------------
+            /// @return The number of asynchronous loads that have been started but have not yet
+            /// completed.
+            //-------------------------------------------------------------------------------------
+            u32 GetNumPendingLoads() const;
+            //------------------------------------------------------------------------------------
+            /// @return The number of streamed requests waiting to be dispatched.
+            //-------------------------------------------------------------------------------------
+            u32 GetNumQueuedStreams() const;
+            //------------------------------------------------------------------------------------
+            /// @return The number of resources that have been evicted to stay within the memory
+            /// budget since the pool was created.
+            //-------------------------------------------------------------------------------------
+            u32 GetNumEvictions() const;
             //-------------------------------------------------------------------------------------
             /// Forces the pool to release its handle to any unused resources of the given type.
             /// If a resource is still in use the pool will keep it in the cache. The pool is
@@ -255,17 +371,42 @@ namespace ChilliSource
             
         private:
             
+            using ResourceMap = std::unordered_map<Resource::ResourceId, ResourceSPtr>;
             //-------------------------------------------------------------------------------------
-            /// Descriptor that holds the providers and cached resources for a given type
+            /// Descriptor that holds the providers and cached resources for a given type. The
+            /// resident memory is accumulated directly by the cached resources.
             ///
             /// @author S Downie
             //-------------------------------------------------------------------------------------
             struct PoolDesc
             {
+                PoolDesc() : m_residentMemory(0) {}
+                
                 std::vector<ResourceProvider*> m_providers;
-                std::unordered_map<Resource::ResourceId, ResourceSPtr> m_cachedResources;
+                ResourceMap m_cachedResources;
+                std::atomic<u64> m_residentMemory;
+            };
+            //-------------------------------------------------------------------------------------
+            /// A streamed request that has not yet been dispatched. Start is bound to the typed
+            /// load and is passed the id of the request.
+            //-------------------------------------------------------------------------------------
+            struct StreamRequest
+            {
+                StreamRequestId m_id;
+                std::function<void(StreamRequestId)> m_start;
             };
             //------------------------------------------------------------------------------------
+            /// Private constructor to enforce use of factory method
+            //------------------------------------------------------------------------------------
+            ResourcePool();
+            //------------------------------------------------------------------------------------
+            /// Dispatches any queued streams that there is room for and evicts resources if
+            /// the pool is over budget.
+            ///
+            /// @param Time since last update in seconds
+            //------------------------------------------------------------------------------------
+            void OnUpdate(f32 in_deltaTime) override;
+            //------------------------------------------------------------------------------------
             /// Called when the system receieves a memory warning. This will force the pool
             /// to release any unused resources
             ///
@@ -299,11 +440,65 @@ namespace ChilliSource
             /// @return Unique ID based on the location and path
             //------------------------------------------------------------------------------------
             Resource::ResourceId GenerateResourceId(const std::string& in_uniqueId) const;
+            //------------------------------------------------------------------------------------
+            /// Adds the resource to the cache of the descriptor, attaching it to the resident
+            /// memory accounting. The pool mutex must be held.
+            ///
+            /// @param Descriptor
+            /// @param Resource
+            //------------------------------------------------------------------------------------
+            void AddToCache(PoolDesc& in_desc, const ResourceSPtr& in_resource);
+            //------------------------------------------------------------------------------------
+            /// Removes the resource from the cache of the descriptor, detaching it from the
+            /// resident memory accounting. The pool mutex must be held.
+            ///
+            /// @param Descriptor
+            /// @param Iterator to the cached resource
+            ///
+            /// @return Iterator to the next cached resource
+            //------------------------------------------------------------------------------------
+            ResourceMap::iterator RemoveFromCache(PoolDesc& in_desc, ResourceMap::iterator in_itResource);
+            //------------------------------------------------------------------------------------
+            /// Marks the resource as the most recently used. The pool mutex must be held.
+            ///
+            /// @param Resource
+            //------------------------------------------------------------------------------------
+            void MarkAccessed(Resource* in_resource) const;
+            //------------------------------------------------------------------------------------
+            /// Dispatches queued streams, highest priority first, until the maximum number of
+            /// concurrent streams are in flight.
+            //------------------------------------------------------------------------------------
+            void DispatchStreams();
+            //------------------------------------------------------------------------------------
+            /// Called by a dispatched stream once its load has completed.
+            ///
+            /// @param The id of the request.
+            ///
+            /// @return Whether the request is still wanted, i.e. hasn't been cancelled.
+            //------------------------------------------------------------------------------------
+            bool OnStreamComplete(StreamRequestId in_requestId);
+            //------------------------------------------------------------------------------------
+            /// Evicts the least recently used resources that are only referenced by the pool
+            /// until the resident memory is within budget or nothing else can be evicted.
+            //------------------------------------------------------------------------------------
+            void EvictLeastRecentlyUsed();
             
         private:
             
             std::unordered_map<InterfaceIDType, PoolDesc> m_descriptors;
             mutable std::mutex m_mutex;
+            mutable u64 m_accessStamp;
+            
+            u64 m_memoryBudget;
+            u32 m_numEvictions;
+            std::atomic<u32> m_numPendingLoads;
+            
+            u32 m_maxConcurrentStreams;
+            u32 m_numStreamsInFlight;
+            bool m_isDispatchingStreams;
+            StreamRequestId m_nextStreamRequestId;
+            std::deque<StreamRequest> m_queuedStreams[static_cast<u32>(StreamPriority::k_high) + 1];
+            std::unordered_set<StreamRequestId> m_activeStreams;
         };
         //------------------------------------------------------------------------------------
         //-------------------------------------------------------------------------------------
@@ -328,6 +523,7 @@ namespace ChilliSource
             auto itResource = desc.m_cachedResources.find(resourceId);
             if(itResource != desc.m_cachedResources.end())
             {
+                MarkAccessed(itResource->second.get());
                 return std::static_pointer_cast<const TResourceType>(itResource->second);
             }
             
@@ -366,19 +562,10 @@ namespace ChilliSource
             
             std::unique_lock<std::mutex> lock(m_mutex);
             
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
-            if(itDescriptor == m_descriptors.end())
-            {
-                PoolDesc desc;
-                desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
-                m_descriptors.insert(std::make_pair(TResourceType::InterfaceID, desc));
-                return resource;
-            }
-            
             //Check to make sure this doesn't already exist
-            PoolDesc& desc(itDescriptor->second);
+            PoolDesc& desc(m_descriptors[TResourceType::InterfaceID]);
             CS_ASSERT(desc.m_cachedResources.find(resourceId) == desc.m_cachedResources.end(), "Resource with Id: " + in_uniqueId + " already exists");
-            desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
+            AddToCache(desc, resource);
             
             return resource;
         }
@@ -421,6 +608,7 @@ namespace ChilliSource
             auto itResource = desc.m_cachedResources.find(resourceId);
             if(itResource != desc.m_cachedResources.end())
             {
+                MarkAccessed(itResource->second.get());
                 return std::static_pointer_cast<TResourceType>(itResource->second);
             }
             lock.unlock();
@@ -446,12 +634,13 @@ namespace ChilliSource
             itResource = desc.m_cachedResources.find(resourceId);
             if(itResource == desc.m_cachedResources.end())
             {
-                desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
+                AddToCache(desc, resource);
             }
             else
             {
                 resource = itResource->second;
             }
+            MarkAccessed(resource.get());
             lock.unlock();
             
             return std::static_pointer_cast<TResourceType>(resource);
@@ -576,6 +765,7 @@ namespace ChilliSource
             
             if(itDescriptor == m_descriptors.end())
             {
+                lock.unlock();
                 CS_LOG_ERROR("Failed to find resource provider for " + TResourceType::TypeName);
                 in_delegate(nullptr);
                 return;
@@ -587,6 +777,7 @@ namespace ChilliSource
 			ResourceProvider* provider = FindProvider(in_filePath, desc);
             if(provider == nullptr)
             {
+                lock.unlock();
                 in_delegate(nullptr);
                 return;
             }
@@ -605,7 +796,11 @@ namespace ChilliSource
             auto itResource = desc.m_cachedResources.find(resourceId);
             if(itResource != desc.m_cachedResources.end())
             {
-                in_delegate(std::static_pointer_cast<const TResourceType>(itResource->second));
+                MarkAccessed(itResource->second.get());
+                ResourceSPtr cachedResource(itResource->second);
+                lock.unlock();
+                
+                in_delegate(std::static_pointer_cast<const TResourceType>(cachedResource));
                 return;
             }
             
@@ -618,11 +813,14 @@ namespace ChilliSource
             resource->SetId(resourceId);
 
             //Add it to the cache
-            desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
+            AddToCache(desc, resource);
+            MarkAccessed(resource.get());
             lock.unlock();
             
+            ++m_numPendingLoads;
             ResourceProvider::AsyncLoadDelegate convertDelegate([=](const ResourceSPtr& in_resource)
             {
+                --m_numPendingLoads;
                 in_delegate(std::static_pointer_cast<const TResourceType>(in_resource));
             });
 
@@ -630,6 +828,55 @@ namespace ChilliSource
             provider->CreateResourceFromFileAsync(in_location, deviceFilePath, options, convertDelegate, resource);
         }
         //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> ResourcePool::StreamRequestId ResourcePool::StreamResource(StorageLocation in_location, const std::string& in_filePath, StreamPriority in_priority, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate)
+        {
+            return StreamResource(in_location, in_filePath, IResourceOptionsCSPtr<TResourceType>(), in_priority, in_delegate);
+        }
+        //-------------------------------------------------------------------------------------
+        /// The typed load is wrapped in a type-erased start function so that requests of all
+        /// resource types can share the same priority queues.
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> ResourcePool::StreamRequestId ResourcePool::StreamResource(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsCSPtr<TResourceType>& in_options, StreamPriority in_priority, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate)
+        {
+            CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be streamed on the main thread");
+            CS_ASSERT(in_filePath.empty() == false, "Cannot stream resource with no file path");
+            CS_ASSERT(in_delegate != nullptr, "Cannot stream resource with null delegate");
+            
+            StreamRequest request;
+            request.m_id = m_nextStreamRequestId++;
+            request.m_start = [=](StreamRequestId in_requestId)
+            {
+                LoadResourceAsync<TResourceType>(in_location, in_filePath, in_options, [=](const std::shared_ptr<const TResourceType>& in_resource)
+                {
+                    if (OnStreamComplete(in_requestId) == true)
+                    {
+                        in_delegate(in_resource);
+                    }
+                });
+            };
+            
+            StreamRequestId requestId = request.m_id;
+            m_queuedStreams[static_cast<u32>(in_priority)].push_back(std::move(request));
+            DispatchStreams();
+            
+            return requestId;
+        }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> u64 ResourcePool::GetResidentMemory() const
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
+            if(itDescriptor == m_descriptors.end())
+            {
+                return 0;
+            }
+            
+            return itDescriptor->second.m_residentMemory;
+        }
+        //-------------------------------------------------------------------------------------
         /// Resources often have references to other resources and therefore multiple release passes
         /// are required until no more resources are released
         //-------------------------------------------------------------------------------------
@@ -656,7 +903,7 @@ namespace ChilliSource
                     {
                         //The pool is the sole owner so we can safely release the object
                         CS_LOG_VERBOSE("Releasing resource from pool " + itResource->second->GetName());
-                        itResource = cachedResources.erase(itResource);
+                        itResource = RemoveFromCache(itDescriptor->second, itResource);
                         numReleased++;
                     }
                     else
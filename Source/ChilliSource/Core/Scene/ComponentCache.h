@@ -0,0 +1,170 @@
+//
+//  ComponentCache.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_SCENE_COMPONENTCACHE_H_
+#define _CHILLISOURCE_CORE_SCENE_COMPONENTCACHE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Entity/Component.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace ChilliSource
+{
+	namespace Core
+	{
+        //--------------------------------------------------------------------------------------------------
+        /// The type independent interface to a component cache. This allows the scene to notify all
+        /// caches of components entering or leaving the scene without knowing the type each cache holds.
+        //--------------------------------------------------------------------------------------------------
+        class IComponentCache
+        {
+        public:
+            //-------------------------------------------------------
+            /// Destructor
+            //-------------------------------------------------------
+            virtual ~IComponentCache(){}
+            //-------------------------------------------------------
+            /// Adds the component to the cache if it is of the
+            /// cached type.
+            ///
+            /// @param The component which has entered the scene.
+            //-------------------------------------------------------
+            virtual void Add(Component* in_component) = 0;
+            //-------------------------------------------------------
+            /// Removes the component from the cache if it is of the
+            /// cached type.
+            ///
+            /// @param The component which has left the scene.
+            //-------------------------------------------------------
+            virtual void Remove(Component* in_component) = 0;
+            //-------------------------------------------------------
+            /// Removes all components from the cache.
+            //-------------------------------------------------------
+            virtual void Clear() = 0;
+        };
+        //--------------------------------------------------------------------------------------------------
+        /// A persistent list of all components of the given type that are currently in a scene. The
+        /// list is kept up to date incrementally as components and entities are added to and removed
+        /// from the scene, so querying it doesn't require traversing the scene. Both adding and
+        /// removing are constant time; removal moves the last component into the removed slot, so
+        /// the order of the list is not preserved.
+        //--------------------------------------------------------------------------------------------------
+        template <typename TComponentType> class ComponentCache final : public IComponentCache
+        {
+        public:
+            //-------------------------------------------------------
+            /// @param The component which has entered the scene.
+            //-------------------------------------------------------
+            void Add(Component* in_component) override
+            {
+                if (in_component->IsA(TComponentType::InterfaceID) == true)
+                {
+                    TComponentType* component = static_cast<TComponentType*>(in_component);
+                    if (m_indices.emplace(component, u32(m_components.size())).second == true)
+                    {
+                        m_components.push_back(component);
+                        m_addOrders.push_back(m_nextAddOrder++);
+                    }
+                }
+            }
+            //-------------------------------------------------------
+            /// @param The component which has left the scene.
+            //-------------------------------------------------------
+            void Remove(Component* in_component) override
+            {
+                if (in_component->IsA(TComponentType::InterfaceID) == true)
+                {
+                    auto it = m_indices.find(static_cast<TComponentType*>(in_component));
+                    if (it != m_indices.end())
+                    {
+                        const u32 index = it->second;
+                        const u32 lastIndex = u32(m_components.size()) - 1;
+                        if (index != lastIndex)
+                        {
+                            m_components[index] = m_components[lastIndex];
+                            m_addOrders[index] = m_addOrders[lastIndex];
+                            m_indices[m_components[index]] = index;
+                        }
+                        
+                        m_components.pop_back();
+                        m_addOrders.pop_back();
+                        m_indices.erase(it);
+                    }
+                }
+            }
+            //-------------------------------------------------------
+            //-------------------------------------------------------
+            void Clear() override
+            {
+                m_components.clear();
+                m_addOrders.clear();
+                m_indices.clear();
+            }
+            //-------------------------------------------------------
+            /// @return The list of cached components, in no
+            /// particular order. This should not be held on to as
+            /// it will be changed when the scene changes.
+            //-------------------------------------------------------
+            const std::vector<TComponentType*>& GetComponents() const
+            {
+                return m_components;
+            }
+            //-------------------------------------------------------
+            /// This is linear in the number of cached components so
+            /// is intended for types of which there are few, such
+            /// as cameras.
+            ///
+            /// @return The component which was most recently added
+            /// to the scene, or null if the cache is empty.
+            //-------------------------------------------------------
+            TComponentType* GetMostRecentlyAdded() const
+            {
+                TComponentType* output = nullptr;
+                u64 mostRecentAddOrder = 0;
+                for (u32 i = 0; i < m_components.size(); ++i)
+                {
+                    if (output == nullptr || m_addOrders[i] > mostRecentAddOrder)
+                    {
+                        output = m_components[i];
+                        mostRecentAddOrder = m_addOrders[i];
+                    }
+                }
+                
+                return output;
+            }
+        private:
+            std::vector<TComponentType*> m_components;
+            std::vector<u64> m_addOrders;
+            std::unordered_map<TComponentType*, u32> m_indices;
+            u64 m_nextAddOrder = 0;
+        };
+	}
+}
+
+#endif
@@ -145,6 +145,13 @@ namespace ChilliSource
 		//-------------------------------------------------------
 		void Scene::RemoveAllEntities()
 		{
+            //Everything is leaving the scene so the caches can be emptied up front rather than
+            //removing each component individually.
+            for (auto& cache : m_componentCaches)
+            {
+                cache.second->Clear();
+            }
+            
 			for(u32 i=0; i<m_entities.size(); ++i)
 			{
                 Entity* ent = m_entities[i].get();
@@ -185,6 +192,41 @@ namespace ChilliSource
 		{
 			return m_clearColour;
 		}
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::SetTransformUpdateMode(Transform::UpdateMode in_updateMode)
+        {
+            m_transformUpdateMode = in_updateMode;
+            
+            for(u32 i = 0; i < m_entities.size(); ++i)
+            {
+                m_entities[i]->GetTransform().SetUpdateMode(m_transformUpdateMode);
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        Transform::UpdateMode Scene::GetTransformUpdateMode() const
+        {
+            return m_transformUpdateMode;
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::UpdateWorldTransforms()
+        {
+            if(m_transformUpdateMode == Transform::UpdateMode::k_immediate)
+            {
+                return;
+            }
+            
+            //Child entities are updated through their root
+            for(u32 i = 0; i < m_entities.size(); ++i)
+            {
+                if(m_entities[i]->GetParent() == nullptr)
+                {
+                    m_entities[i]->GetTransform().UpdateWorldTransforms();
+                }
+            }
+        }
 		//--------------------------------------------------------------------------------------------------
 		//--------------------------------------------------------------------------------------------------
 		void Scene::QuerySceneForIntersection(const Ray &in_ray, std::vector<VolumeComponent*>& out_volumeComponents)
@@ -238,6 +280,24 @@ namespace ChilliSource
                 it->swap(m_entities.back());
                 m_entities.pop_back();
             }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::OnComponentAddedToScene(Component* in_component)
+        {
+            for (auto& cache : m_componentCaches)
+            {
+                cache.second->Add(in_component);
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::OnComponentRemovedFromScene(Component* in_component)
+        {
+            for (auto& cache : m_componentCaches)
+            {
+                cache.second->Remove(in_component);
+            }
         }
 		//--------------------------------------------------------------------------------------------------
 		//--------------------------------------------------------------------------------------------------
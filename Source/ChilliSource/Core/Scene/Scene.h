@@ -33,9 +33,12 @@
 #include <ChilliSource/Core/Base/Colour.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
+#include <ChilliSource/Core/Scene/ComponentCache.h>
 #include <ChilliSource/Core/System/StateSystem.h>
 #include <ChilliSource/Core/Volume/VolumeComponent.h>
 
+#include <unordered_map>
+
 namespace ChilliSource
 {
 	namespace Core
@@ -111,6 +114,28 @@ namespace ChilliSource
 			/// @return Screen clear colour
 			//------------------------------------------------------
 			const Core::Colour& GetClearColour() const;
+            //------------------------------------------------------
+            /// Sets how changes to the transforms of entities in
+            /// the scene are propagated. This applies to all
+            /// entities currently in the scene and any that are
+            /// added later. The default is immediate.
+            ///
+            /// @param The transform update mode.
+            //------------------------------------------------------
+            void SetTransformUpdateMode(Transform::UpdateMode in_updateMode);
+            //------------------------------------------------------
+            /// @return How changes to the transforms of entities in
+            /// the scene are propagated.
+            //------------------------------------------------------
+            Transform::UpdateMode GetTransformUpdateMode() const;
+            //------------------------------------------------------
+            /// Resolves the world transforms of all entities in the
+            /// scene and notifies the listeners of any that have
+            /// changed. This is called by the renderer each frame
+            /// and only does work when using the deferred transform
+            /// update mode.
+            //------------------------------------------------------
+            void UpdateWorldTransforms();
             //-------------------------------------------------------
             /// Sends the resume event on to the entities.
             ///
@@ -210,10 +235,40 @@ namespace ChilliSource
 					(*it)->GetComponents<TComponentType1, TComponentType2, TComponentType3>(out_components1, out_components2, out_components3);
 				}
 			}
+            //--------------------------------------------------------------------------------------------------
+            /// Returns the persistent list of all components of the given type that are currently in the
+            /// scene. The first call for a type will traverse the scene to build the list; after that it
+            /// is kept up to date as components and entities are added and removed, making this cheap
+            /// enough to call every frame. The returned list should not be held on to or modified.
+            ///
+            /// @return The cache of components of the given type.
+            //--------------------------------------------------------------------------------------------------
+            template <typename TComponentType>
+            const ComponentCache<TComponentType>& GetComponentCache()
+            {
+                auto it = m_componentCaches.find(TComponentType::InterfaceID);
+                if (it == m_componentCaches.end())
+                {
+                    ComponentCache<TComponentType>* cache = new ComponentCache<TComponentType>();
+                    
+                    std::vector<TComponentType*> components;
+                    QuerySceneForComponents(components);
+                    for (TComponentType* component : components)
+                    {
+                        cache->Add(component);
+                    }
+                    
+                    it = m_componentCaches.emplace(TComponentType::InterfaceID, IComponentCacheUPtr(cache)).first;
+                }
+                
+                return *static_cast<ComponentCache<TComponentType>*>(it->second.get());
+            }
             
         private:
             friend class Entity;
             
+            typedef std::unique_ptr<IComponentCache> IComponentCacheUPtr;
+            
             //-------------------------------------------------------
             /// Private to enforce use of factory method
             ///
@@ -228,13 +283,31 @@ namespace ChilliSource
             /// @param Entity
             //-------------------------------------------------------
             void Remove(Entity* inpEntity);
+            //-------------------------------------------------------
+            /// Called by entities in the scene when a component
+            /// enters the scene so that the component caches can
+            /// be updated.
+            ///
+            /// @param Component
+            //-------------------------------------------------------
+            void OnComponentAddedToScene(Component* in_component);
+            //-------------------------------------------------------
+            /// Called by entities in the scene when a component
+            /// leaves the scene so that the component caches can
+            /// be updated.
+            ///
+            /// @param Component
+            //-------------------------------------------------------
+            void OnComponentRemovedFromScene(Component* in_component);
             
 		private:
 			
 			SharedEntityList m_entities;
+            std::unordered_map<InterfaceIDType, IComponentCacheUPtr> m_componentCaches;
             Colour m_clearColour;
             bool m_entitiesActive = false;
             bool m_entitiesForegrounded = false;
+            Transform::UpdateMode m_transformUpdateMode = Transform::UpdateMode::k_immediate;
 		};		
 	}
 }
@@ -29,6 +29,7 @@
 #include <ChilliSource/Core/State/StateManager.h>
 
 #include <ChilliSource/Core/State/State.h>
+#include <ChilliSource/Core/Time/ScopedProfileMarker.h>
 
 namespace ChilliSource
 {
@@ -101,6 +102,8 @@ namespace ChilliSource
         //---------------------------------------------------------
         void StateManager::UpdateStates(f32 in_timeSinceLastUpdate)
         {
+            CS_PROFILE_SCOPE("StateManager::UpdateStates");
+            
             while(!m_operations.empty())
 			{
 				switch(m_operations.front().m_action)
@@ -30,6 +30,8 @@
 #define _CHILLISOURCE_CORE_THREADING_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Threading/TaskFunction.h>
+#include <ChilliSource/Core/Threading/TaskHandle.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Core/Threading/ThreadPool.h>
 
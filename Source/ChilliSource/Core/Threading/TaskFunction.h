@@ -0,0 +1,268 @@
+//
+//  TaskFunction.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_THREADING_TASKFUNCTION_H_
+#define _CHILLISOURCE_CORE_THREADING_TASKFUNCTION_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------
+        /// A move only container for a callable object which takes no
+        /// arguments and returns nothing. Unlike std::function, callables
+        /// up to k_inlineStorageSize bytes (a lambda capturing a handful
+        /// of pointers and values, for example) are stored inside the
+        /// object itself, so creating and scheduling a small task
+        /// doesn't touch the heap. Larger callables fall back to a heap
+        /// allocation.
+        //------------------------------------------------------------------
+        class TaskFunction final
+        {
+        public:
+            static const u32 k_inlineStorageSize = 64;
+            //---------------------------------------------------------
+            /// Constructs an empty task function.
+            //---------------------------------------------------------
+            TaskFunction()
+            {
+            }
+            //---------------------------------------------------------
+            /// Constructs an empty task function.
+            //---------------------------------------------------------
+            TaskFunction(std::nullptr_t)
+            {
+            }
+            //---------------------------------------------------------
+            /// Constructs the task function from the given callable.
+            ///
+            /// @param The callable. This is either moved or copied
+            /// into the task function depending on whether an rvalue
+            /// or lvalue is supplied.
+            //---------------------------------------------------------
+            template <typename TCallable, typename = typename std::enable_if<std::is_same<typename std::decay<TCallable>::type, TaskFunction>::value == false>::type>
+            TaskFunction(TCallable&& in_callable)
+            {
+                typedef typename std::decay<TCallable>::type CallableType;
+                Construct<CallableType>(std::forward<TCallable>(in_callable), std::integral_constant<bool, IsStoredInline<CallableType>::value>());
+            }
+            //---------------------------------------------------------
+            /// Move constructor.
+            ///
+            /// @param The task function to move. This will be empty
+            /// afterwards.
+            //---------------------------------------------------------
+            TaskFunction(TaskFunction&& in_toMove)
+            {
+                MoveFrom(in_toMove);
+            }
+            //---------------------------------------------------------
+            /// Move assignment.
+            ///
+            /// @param The task function to move. This will be empty
+            /// afterwards.
+            ///
+            /// @return This task function.
+            //---------------------------------------------------------
+            TaskFunction& operator=(TaskFunction&& in_toMove)
+            {
+                if (this != &in_toMove)
+                {
+                    Reset();
+                    MoveFrom(in_toMove);
+                }
+                return *this;
+            }
+            //---------------------------------------------------------
+            /// Destroys the stored callable, leaving this empty.
+            ///
+            /// @return This task function.
+            //---------------------------------------------------------
+            TaskFunction& operator=(std::nullptr_t)
+            {
+                Reset();
+                return *this;
+            }
+            //---------------------------------------------------------
+            /// Calls the stored callable. This must not be empty.
+            //---------------------------------------------------------
+            void operator()()
+            {
+                CS_ASSERT(m_operations != nullptr, "Cannot call an empty task function.");
+                m_operations->m_invoke(&m_storage);
+            }
+            //---------------------------------------------------------
+            /// @return Whether or not this holds a callable.
+            //---------------------------------------------------------
+            explicit operator bool() const
+            {
+                return (m_operations != nullptr);
+            }
+            //---------------------------------------------------------
+            /// Destructor
+            //---------------------------------------------------------
+            ~TaskFunction()
+            {
+                Reset();
+            }
+        private:
+            TaskFunction(const TaskFunction&) = delete;
+            TaskFunction& operator=(const TaskFunction&) = delete;
+
+            typedef std::aligned_storage<k_inlineStorageSize>::type Storage;
+            //---------------------------------------------------------
+            /// The type erased operations for a single callable type
+            /// and storage method.
+            //---------------------------------------------------------
+            struct Operations final
+            {
+                void (*m_invoke)(Storage* in_storage);
+                void (*m_move)(Storage* in_from, Storage* out_to);
+                void (*m_destroy)(Storage* in_storage);
+            };
+            //---------------------------------------------------------
+            /// Whether or not a callable type fits in the inline
+            /// storage. Types which could throw while being moved
+            /// are always stored on the heap so moving a task
+            /// function can never throw.
+            //---------------------------------------------------------
+            template <typename TCallable> struct IsStoredInline final
+            {
+                static const bool value = (sizeof(TCallable) <= sizeof(Storage) && std::alignment_of<Storage>::value % std::alignment_of<TCallable>::value == 0 &&
+                    std::is_nothrow_move_constructible<TCallable>::value == true);
+            };
+            //---------------------------------------------------------
+            /// The operations for a callable stored in place.
+            //---------------------------------------------------------
+            template <typename TCallable> struct InlineOperations final
+            {
+                static void Invoke(Storage* in_storage)
+                {
+                    (*reinterpret_cast<TCallable*>(in_storage))();
+                }
+                static void Move(Storage* in_from, Storage* out_to)
+                {
+                    TCallable* from = reinterpret_cast<TCallable*>(in_from);
+                    new (out_to) TCallable(std::move(*from));
+                    from->~TCallable();
+                }
+                static void Destroy(Storage* in_storage)
+                {
+                    reinterpret_cast<TCallable*>(in_storage)->~TCallable();
+                }
+                static const Operations k_operations;
+            };
+            //---------------------------------------------------------
+            /// The operations for a callable stored on the heap. The
+            /// inline storage holds a pointer to the callable.
+            //---------------------------------------------------------
+            template <typename TCallable> struct HeapOperations final
+            {
+                static void Invoke(Storage* in_storage)
+                {
+                    (**reinterpret_cast<TCallable**>(in_storage))();
+                }
+                static void Move(Storage* in_from, Storage* out_to)
+                {
+                    *reinterpret_cast<TCallable**>(out_to) = *reinterpret_cast<TCallable**>(in_from);
+                }
+                static void Destroy(Storage* in_storage)
+                {
+                    delete *reinterpret_cast<TCallable**>(in_storage);
+                }
+                static const Operations k_operations;
+            };
+            //---------------------------------------------------------
+            /// Constructs the callable in the inline storage.
+            ///
+            /// @param The callable.
+            //---------------------------------------------------------
+            template <typename TCallableType, typename TCallable> void Construct(TCallable&& in_callable, std::true_type)
+            {
+                new (&m_storage) TCallableType(std::forward<TCallable>(in_callable));
+                m_operations = &InlineOperations<TCallableType>::k_operations;
+            }
+            //---------------------------------------------------------
+            /// Constructs the callable on the heap.
+            ///
+            /// @param The callable.
+            //---------------------------------------------------------
+            template <typename TCallableType, typename TCallable> void Construct(TCallable&& in_callable, std::false_type)
+            {
+                *reinterpret_cast<TCallableType**>(&m_storage) = new TCallableType(std::forward<TCallable>(in_callable));
+                m_operations = &HeapOperations<TCallableType>::k_operations;
+            }
+            //---------------------------------------------------------
+            /// Takes the callable from the given task function. This
+            /// must be empty when called.
+            ///
+            /// @param The task function to move from.
+            //---------------------------------------------------------
+            void MoveFrom(TaskFunction& in_toMove)
+            {
+                if (in_toMove.m_operations != nullptr)
+                {
+                    in_toMove.m_operations->m_move(&in_toMove.m_storage, &m_storage);
+                    m_operations = in_toMove.m_operations;
+                    in_toMove.m_operations = nullptr;
+                }
+            }
+            //---------------------------------------------------------
+            /// Destroys the stored callable, if there is one.
+            //---------------------------------------------------------
+            void Reset()
+            {
+                if (m_operations != nullptr)
+                {
+                    m_operations->m_destroy(&m_storage);
+                    m_operations = nullptr;
+                }
+            }
+
+            Storage m_storage;
+            const Operations* m_operations = nullptr;
+        };
+
+        template <typename TCallable> const TaskFunction::Operations TaskFunction::InlineOperations<TCallable>::k_operations =
+        {
+            &TaskFunction::InlineOperations<TCallable>::Invoke, &TaskFunction::InlineOperations<TCallable>::Move, &TaskFunction::InlineOperations<TCallable>::Destroy
+        };
+        template <typename TCallable> const TaskFunction::Operations TaskFunction::HeapOperations<TCallable>::k_operations =
+        {
+            &TaskFunction::HeapOperations<TCallable>::Invoke, &TaskFunction::HeapOperations<TCallable>::Move, &TaskFunction::HeapOperations<TCallable>::Destroy
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,133 @@
+//
+//  TaskHandle.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Threading/TaskHandle.h>
+
+#include <ChilliSource/Core/Threading/ThreadPool.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        TaskHandle::TaskHandle(ThreadPool* in_threadPool, ScheduledTask* in_task)
+            : m_threadPool(in_threadPool), m_task(in_task)
+        {
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        TaskHandle::TaskHandle(const TaskHandle& in_toCopy)
+            : m_threadPool(in_toCopy.m_threadPool), m_task(in_toCopy.m_task)
+        {
+            if (m_task != nullptr)
+            {
+                m_task->m_refCount++;
+            }
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        TaskHandle::TaskHandle(TaskHandle&& in_toMove)
+            : m_threadPool(in_toMove.m_threadPool), m_task(in_toMove.m_task)
+        {
+            in_toMove.m_threadPool = nullptr;
+            in_toMove.m_task = nullptr;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        TaskHandle& TaskHandle::operator=(const TaskHandle& in_toCopy)
+        {
+            if (m_task != in_toCopy.m_task)
+            {
+                Reset();
+
+                m_threadPool = in_toCopy.m_threadPool;
+                m_task = in_toCopy.m_task;
+                if (m_task != nullptr)
+                {
+                    m_task->m_refCount++;
+                }
+            }
+            return *this;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        TaskHandle& TaskHandle::operator=(TaskHandle&& in_toMove)
+        {
+            if (this != &in_toMove)
+            {
+                Reset();
+
+                m_threadPool = in_toMove.m_threadPool;
+                m_task = in_toMove.m_task;
+                in_toMove.m_threadPool = nullptr;
+                in_toMove.m_task = nullptr;
+            }
+            return *this;
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        bool TaskHandle::IsValid() const
+        {
+            return (m_task != nullptr);
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        bool TaskHandle::IsFinished() const
+        {
+            CS_ASSERT(IsValid() == true, "Cannot query an invalid task handle.");
+
+            return m_task->m_isFinished.load(std::memory_order_acquire);
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        void TaskHandle::Wait() const
+        {
+            CS_ASSERT(IsValid() == true, "Cannot wait on an invalid task handle.");
+
+            const TaskHandle* handle = this;
+            m_threadPool->WaitUntil([handle]() { return handle->IsFinished(); }, m_task->m_priority);
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        void TaskHandle::Reset()
+        {
+            if (m_task != nullptr)
+            {
+                m_threadPool->ReleaseTask(m_task);
+                m_threadPool = nullptr;
+                m_task = nullptr;
+            }
+        }
+        //---------------------------------------------------------
+        //---------------------------------------------------------
+        TaskHandle::~TaskHandle()
+        {
+            Reset();
+        }
+    }
+}
@@ -0,0 +1,129 @@
+//
+//  TaskHandle.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_THREADING_TASKHANDLE_H_
+#define _CHILLISOURCE_CORE_THREADING_TASKHANDLE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        struct ScheduledTask;
+        //------------------------------------------------------------------
+        /// A reference to a task which has been scheduled with the task
+        /// scheduler. This can be used to query whether the task has
+        /// finished, to wait on it, or as a dependency of other tasks
+        /// so that they are not started until it has finished.
+        ///
+        /// Handles are reference counted and cheap to copy. A handle
+        /// must not outlive the task scheduler it came from.
+        //------------------------------------------------------------------
+        class TaskHandle final
+        {
+        public:
+            //---------------------------------------------------------
+            /// Constructs an invalid handle which doesn't refer to a
+            /// task.
+            //---------------------------------------------------------
+            TaskHandle() = default;
+            //---------------------------------------------------------
+            /// Copy constructor.
+            ///
+            /// @param The handle to copy.
+            //---------------------------------------------------------
+            TaskHandle(const TaskHandle& in_toCopy);
+            //---------------------------------------------------------
+            /// Move constructor.
+            ///
+            /// @param The handle to move. This will be invalid
+            /// afterwards.
+            //---------------------------------------------------------
+            TaskHandle(TaskHandle&& in_toMove);
+            //---------------------------------------------------------
+            /// Copy assignment.
+            ///
+            /// @param The handle to copy.
+            ///
+            /// @return This handle.
+            //---------------------------------------------------------
+            TaskHandle& operator=(const TaskHandle& in_toCopy);
+            //---------------------------------------------------------
+            /// Move assignment.
+            ///
+            /// @param The handle to move. This will be invalid
+            /// afterwards.
+            ///
+            /// @return This handle.
+            //---------------------------------------------------------
+            TaskHandle& operator=(TaskHandle&& in_toMove);
+            //---------------------------------------------------------
+            /// @return Whether or not this refers to a task.
+            //---------------------------------------------------------
+            bool IsValid() const;
+            //---------------------------------------------------------
+            /// This is thread-safe. The handle must be valid.
+            ///
+            /// @return Whether or not the task has finished running.
+            //---------------------------------------------------------
+            bool IsFinished() const;
+            //---------------------------------------------------------
+            /// Blocks until the task has finished. The calling thread
+            /// helps to execute queued tasks of the same or higher
+            /// priority while it waits, so this can safely be called
+            /// from within a task, and only sleeps when there are
+            /// none left to help with. The handle must be valid.
+            //---------------------------------------------------------
+            void Wait() const;
+            //---------------------------------------------------------
+            /// Destructor.
+            //---------------------------------------------------------
+            ~TaskHandle();
+        private:
+            friend class ThreadPool;
+            //---------------------------------------------------------
+            /// Constructs a handle to the given task. The task's
+            /// reference count must already include this handle.
+            ///
+            /// @param The thread pool which owns the task.
+            /// @param The task.
+            //---------------------------------------------------------
+            TaskHandle(ThreadPool* in_threadPool, ScheduledTask* in_task);
+            //---------------------------------------------------------
+            /// Releases this handle's reference to the task, leaving
+            /// the handle invalid.
+            //---------------------------------------------------------
+            void Reset();
+
+            ThreadPool* m_threadPool = nullptr;
+            ScheduledTask* m_task = nullptr;
+        };
+    }
+}
+
+#endif
@@ -31,10 +31,27 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/Device.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     namespace Core
     {
+        namespace
+        {
+            //-------------------------------------------------
+            /// The state shared between all the threads taking
+            /// part in a single parallel for. This lives on the
+            /// calling thread's stack, which waits until every
+            /// helper task has finished with it.
+            //-------------------------------------------------
+            struct ParallelForState
+            {
+                std::atomic<u32> m_nextChunk;
+                std::atomic<u32> m_numActiveHelpers;
+            };
+        }
+        
 		CS_DEFINE_NAMEDTYPE(TaskScheduler);
 
 		//-------------------------------------------------
@@ -46,6 +63,7 @@ namespace ChilliSource
 		//-------------------------------------------------
 		//-------------------------------------------------
 		TaskScheduler::TaskScheduler()
+            : m_isShuttingDown(false)
 		{
         
 		}
@@ -69,13 +87,105 @@ namespace ChilliSource
         bool TaskScheduler::IsMainThread() const
         {
             return m_mainThreadId == std::this_thread::get_id();
+        }
+        //------------------------------------------------
+        //------------------------------------------------
+        bool TaskScheduler::IsShuttingDown() const
+        {
+            return m_isShuttingDown;
         }
 		//------------------------------------------------
 		//------------------------------------------------
-		void TaskScheduler::ScheduleTask(const GenericTaskType& in_task)
+		TaskHandle TaskScheduler::ScheduleTask(TaskFunction in_task, TaskPriority in_priority)
+		{
+			return m_threadPool->Schedule(std::move(in_task), in_priority, nullptr, 0);
+		}
+        //------------------------------------------------
+        //------------------------------------------------
+		TaskHandle TaskScheduler::ScheduleTask(TaskFunction in_task, const std::vector<TaskHandle>& in_dependencies, TaskPriority in_priority)
 		{
-			m_threadPool->Schedule(in_task);
+			return m_threadPool->Schedule(std::move(in_task), in_priority, in_dependencies.data(), u32(in_dependencies.size()));
 		}
+        //------------------------------------------------
+        //------------------------------------------------
+        void TaskScheduler::ParallelFor(u32 in_numItems, u32 in_minItemsPerChunk, const ParallelForTaskType& in_task, TaskPriority in_priority)
+        {
+            CS_ASSERT(in_minItemsPerChunk > 0, "Parallel for must have at least one item per chunk.");
+            
+            if (in_numItems == 0)
+            {
+                return;
+            }
+            
+            //The thread pool may already have been stopped
+            if (m_isShuttingDown == true)
+            {
+                in_task(0, in_numItems);
+                return;
+            }
+            
+            const u32 numChunks = std::min((in_numItems + in_minItemsPerChunk - 1) / in_minItemsPerChunk, GetMaxNumParallelChunks());
+            if (numChunks <= 1)
+            {
+                in_task(0, in_numItems);
+                return;
+            }
+            
+            const u32 itemsPerChunk = (in_numItems + numChunks - 1) / numChunks;
+            
+            ParallelForState state;
+            state.m_nextChunk = 0;
+            state.m_numActiveHelpers = numChunks - 1;
+            
+            //The state and task outlive every helper task, as this doesn't return until all helpers have
+            //finished, so they can be referred to by pointer. This also keeps the helpers small enough
+            //to be scheduled without allocating.
+            ParallelForState* statePtr = &state;
+            const ParallelForTaskType* task = &in_task;
+            auto processChunks = [statePtr, task, numChunks, itemsPerChunk, in_numItems]()
+            {
+                u32 chunk = statePtr->m_nextChunk++;
+                while (chunk < numChunks)
+                {
+                    const u32 start = chunk * itemsPerChunk;
+                    const u32 end = std::min(start + itemsPerChunk, in_numItems);
+                    if (start < end)
+                    {
+                        (*task)(start, end);
+                    }
+                    
+                    chunk = statePtr->m_nextChunk++;
+                }
+            };
+            
+            for (u32 i = 1; i < numChunks; ++i)
+            {
+                TaskHandle helper = m_threadPool->Schedule([processChunks, statePtr]()
+                {
+                    processChunks();
+                    statePtr->m_numActiveHelpers--;
+                }, in_priority, nullptr, 0);
+                
+                //The pool rejects tasks once it has been stopped, in which case the remaining chunks are processed here.
+                if (helper.IsValid() == false)
+                {
+                    statePtr->m_numActiveHelpers--;
+                }
+            }
+            
+            processChunks();
+            
+            //Helpers which haven't started yet will find no chunks left and finish straight away, so help to
+            //execute them rather than sleeping. Only tasks of at least the same priority are picked up, so a
+            //thread waiting on frame critical work never takes on a low priority helper.
+            m_threadPool->WaitUntil([statePtr]() { return statePtr->m_numActiveHelpers == 0; }, in_priority);
+        }
+        //------------------------------------------------
+        //------------------------------------------------
+        u32 TaskScheduler::GetMaxNumParallelChunks() const
+        {
+            return m_threadPool->GetNumThreads() + 1;
+        }
 		//----------------------------------------------------
 		//----------------------------------------------------
 		void TaskScheduler::ScheduleMainThreadTask(const GenericTaskType& in_task)
@@ -100,6 +210,10 @@ namespace ChilliSource
 		//-------------------------------------------------
 		void TaskScheduler::Destroy()
 		{
+            m_isShuttingDown = true;
+            
+            //The pool is stopped before it is destroyed so that tasks which are still running can use it until they finish.
+            m_threadPool->Stop();
 			m_threadPool.reset();
 			m_mainThreadTasks.clear();
 		}
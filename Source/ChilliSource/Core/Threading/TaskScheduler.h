@@ -31,6 +31,8 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/System/AppSystem.h>
+#include <ChilliSource/Core/Threading/TaskFunction.h>
+#include <ChilliSource/Core/Threading/TaskHandle.h>
 #include <ChilliSource/Core/Threading/ThreadPool.h>
 
 namespace ChilliSource
@@ -51,6 +53,7 @@ namespace ChilliSource
 			CS_DECLARE_NAMEDTYPE(TaskScheduler);
 
             typedef std::function<void()> GenericTaskType;
+            typedef std::function<void(u32 in_startIndex, u32 in_endIndex)> ParallelForTaskType;
 
 			//------------------------------------------------
 			/// @author S Downie
@@ -68,8 +71,33 @@ namespace ChilliSource
 			/// @author S Downie
             ///
             /// @param Task
+            /// @param The priority of the task. Work which
+            /// is needed this frame should be high priority
+            /// while background work such as loading should
+            /// be low priority.
+            ///
+            /// @return A handle which can be used to wait on
+            /// the task or as a dependency of other tasks. This
+            /// is invalid if the scheduler is shutting down.
+            //------------------------------------------------
+			TaskHandle ScheduleTask(TaskFunction in_task, TaskPriority in_priority = TaskPriority::k_low);
             //------------------------------------------------
-			void ScheduleTask(const GenericTaskType& in_task);
+            /// The task will be placed into the task queue
+            /// once all of the given tasks have finished and
+            /// then be performed when a thread becomes
+            /// available. This can be used to run a
+            /// continuation after a task, or to join the
+            /// results of several tasks.
+			///
+            /// @param Task
+            /// @param The tasks which must finish first.
+            /// @param The priority of the task.
+            ///
+            /// @return A handle which can be used to wait on
+            /// the task or as a dependency of other tasks. This
+            /// is invalid if the scheduler is shutting down.
+            //------------------------------------------------
+			TaskHandle ScheduleTask(TaskFunction in_task, const std::vector<TaskHandle>& in_dependencies, TaskPriority in_priority = TaskPriority::k_low);
             //----------------------------------------------------
             /// Schedule a task to be executed by the main
             /// thread
@@ -80,6 +108,41 @@ namespace ChilliSource
             //----------------------------------------------------
 			void ScheduleMainThreadTask(const GenericTaskType& insTask);
             //----------------------------------------------------
+            /// Splits the given range of items into chunks and
+            /// processes them concurrently on the thread pool,
+            /// blocking until all of them have been processed.
+            /// The chunks are scheduled with the given priority
+            /// and the calling thread also processes chunks,
+            /// helping with other tasks of at least that
+            /// priority while it waits, so this can safely be
+            /// called from a pool thread.
+            ///
+            /// Frame critical work should use the default high
+            /// priority. Long running background work, such as
+            /// reading files, should use low priority so that
+            /// its chunks can't be picked up by threads waiting
+            /// on frame critical work, including the main thread.
+            ///
+            /// The task is called once per chunk with the range
+            /// [start, end) and may be called on any thread, so
+            /// it must only touch data that is specific to the
+            /// chunk or is read only.
+			///
+			/// @param The number of items.
+            /// @param The minimum number of items per chunk.
+            /// Small ranges are processed on the calling thread.
+            /// @param The task to perform on each chunk.
+            /// @param The priority of the chunks. Defaults to
+            /// high.
+            //----------------------------------------------------
+			void ParallelFor(u32 in_numItems, u32 in_minItemsPerChunk, const ParallelForTaskType& in_task, TaskPriority in_priority = TaskPriority::k_high);
+            //----------------------------------------------------
+            /// @return The maximum number of chunks a parallel
+            /// for will split work into. This can be used to
+            /// size per chunk storage.
+            //----------------------------------------------------
+            u32 GetMaxNumParallelChunks() const;
+            //----------------------------------------------------
             /// Execute any tasks that have been scehduled
             /// for the main thread
 			///
@@ -93,6 +156,18 @@ namespace ChilliSource
             /// thread
             //----------------------------------------------------
             bool IsMainThread() const;
+            //----------------------------------------------------
+            /// The scheduler is destroyed before any other
+            /// system, so long running tasks should check this
+            /// regularly and finish early once it is set.
+            /// Parallel fors started while shutting down are
+            /// processed on the calling thread, and new tasks
+            /// are discarded.
+            ///
+            /// @return Whether the scheduler is shutting down
+            /// and waiting for running tasks to finish.
+            //----------------------------------------------------
+            bool IsShuttingDown() const;
 
 		private:
 			friend class Application;
@@ -135,6 +210,8 @@ namespace ChilliSource
             std::vector<GenericTaskType> m_mainThreadTasks;
             
             std::thread::id m_mainThreadId;
+            
+            std::atomic<bool> m_isShuttingDown;
         };
     }
 }
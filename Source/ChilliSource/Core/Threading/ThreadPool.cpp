@@ -28,7 +28,8 @@
 
 #include <ChilliSource/Core/Threading/ThreadPool.h>
 
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
+#include <ChilliSource/Core/Time/Profiler.h>
+#include <ChilliSource/Core/Time/ScopedProfileMarker.h>
 
 namespace ChilliSource
 {
@@ -37,57 +38,341 @@ namespace ChilliSource
         //----------------------------------------------
         //----------------------------------------------
 		ThreadPool::ThreadPool(u32 in_numThreads)
-			: m_isFinished(false)
+			: m_numQueuedTasks(0), m_numSleepingThreads(0), m_isFinished(false), m_numWaitingThreads(0)
         {
-            //create the threads
-            for (u32 i=0; i<in_numThreads; ++i)
-            {  
-                m_threadGroup.push_back(std::thread(Core::MakeDelegate(this, &ThreadPool::DoTaskOrWait)));
+            //one queue per worker, plus the last which is shared by all threads outside the pool.
+            for (u32 i = 0; i < in_numThreads + 1; ++i)
+            {
+                m_workQueues.push_back(std::unique_ptr<WorkQueue>(new WorkQueue()));
+            }
+            
+            //create the threads. Tasks can't be scheduled until this has returned, so the thread ids
+            //are always complete before a worker looks them up.
+            for (u32 i = 0; i < in_numThreads; ++i)
+            {
+                m_threads.push_back(std::thread(&ThreadPool::DoTaskOrWait, this, i));
+                m_threadIds.push_back(m_threads.back().get_id());
+            }
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        TaskHandle ThreadPool::Schedule(TaskFunction in_task, TaskPriority in_priority, const TaskHandle* in_dependencies, u32 in_numDependencies)
+        {
+            CS_ASSERT(static_cast<bool>(in_task) == true, "Cannot schedule an empty task.");
+            
+            if (m_isFinished == true)
+            {
+                return TaskHandle();
+            }
+            
+            ScheduledTask* task = AcquireTask();
+            task->m_function = std::move(in_task);
+            task->m_priority = in_priority;
+            task->m_isFinished = false;
+            
+            //one reference is held until the task has executed and the other by the returned handle. An
+            //extra dependency is held while the dependencies are registered so the task can't be queued early.
+            task->m_refCount = 2;
+            task->m_numPendingDependencies = 1;
+            
+            for (u32 i = 0; i < in_numDependencies; ++i)
+            {
+                ScheduledTask* dependency = in_dependencies[i].m_task;
+                if (dependency != nullptr)
+                {
+                    std::unique_lock<std::mutex> lock(dependency->m_continuationMutex);
+                    if (dependency->m_isFinished == false)
+                    {
+                        task->m_numPendingDependencies++;
+                        dependency->m_continuations.push_back(task);
+                    }
+                }
+            }
+            
+            if (--task->m_numPendingDependencies == 0)
+            {
+                Enqueue(task);
+            }
+            
+            return TaskHandle(this, task);
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        bool ThreadPool::TryExecuteTask(TaskPriority in_lowestPriority)
+        {
+            ScheduledTask* task = PopTask(GetCurrentWorkerIndex(), in_lowestPriority);
+            if (task != nullptr)
+            {
+                Execute(task);
+                return true;
             }
+            
+            return false;
         }
         //----------------------------------------------
         //----------------------------------------------
-        void ThreadPool::Schedule(const GenericTaskType& in_task)
+        void ThreadPool::WaitUntil(const std::function<bool()>& in_condition, TaskPriority in_lowestPriority)
         {
-            m_tasks.push(std::move(in_task));
+            const u32 k_maxYields = 64;
+            
+            u32 numYields = 0;
+            while (in_condition() == false)
+            {
+                if (TryExecuteTask(in_lowestPriority) == true)
+                {
+                    numYields = 0;
+                    continue;
+                }
+                
+                if (numYields < k_maxYields)
+                {
+                    ++numYields;
+                    std::this_thread::yield();
+                    continue;
+                }
+                
+                //The waiting count is incremented and the generation read before the condition and queues are
+                //checked again. Anything that could end the wait after that point will see the waiting count and
+                //change the generation, so a wake up can never be missed.
+                m_numWaitingThreads++;
+                u32 generation = 0;
+                {
+                    std::unique_lock<std::mutex> lock(m_waitMutex);
+                    generation = m_waitGeneration;
+                }
+                
+                if (in_condition() == false && TryExecuteTask(in_lowestPriority) == false)
+                {
+                    std::unique_lock<std::mutex> lock(m_waitMutex);
+                    while (m_waitGeneration == generation)
+                    {
+                        m_waitCondition.wait(lock);
+                    }
+                }
+                
+                m_numWaitingThreads--;
+                numYields = 0;
+            }
         }
         //----------------------------------------------
         //----------------------------------------------
         u32 ThreadPool::GetNumQueuedTasks() const
         {
-            return m_tasks.size();
+            return m_numQueuedTasks;
         }
         //----------------------------------------------
         //----------------------------------------------
-        void ThreadPool::ClearQueuedTasks()
+        u32 ThreadPool::GetNumThreads() const
         {
-			m_tasks.clear();
+            return m_threads.size();
         }
         //----------------------------------------------
         //----------------------------------------------
-        void ThreadPool::DoTaskOrWait()
+        void ThreadPool::DoTaskOrWait(u32 in_workerIndex)
         {
+#ifdef CS_ENABLE_PROFILING
+            if (Profiler::Get() != nullptr)
+            {
+                Profiler::Get()->RegisterCurrentThread("Worker " + ToString(in_workerIndex));
+            }
+#endif
+            
 			while (m_isFinished == false)
 			{
-				GenericTaskType task;
-				if (m_tasks.pop_or_wait(task) == true)
-				{
-					task();
-				}
+                ScheduledTask* task = PopTask(in_workerIndex, TaskPriority::k_low);
+                if (task != nullptr)
+                {
+                    CS_PROFILE_SCOPE("ThreadPool::Task");
+                    Execute(task);
+                    continue;
+                }
+                
+                //The sleeping count is incremented before the queued count is checked, and the scheduling thread
+                //increments the queued count before checking the sleeping count, so a wake up can never be missed.
+                std::unique_lock<std::mutex> lock(m_sleepMutex);
+                m_numSleepingThreads++;
+                while (m_numQueuedTasks == 0 && m_isFinished == false)
+                {
+                    m_sleepCondition.wait(lock);
+                }
+                m_numSleepingThreads--;
             }
         }
         //----------------------------------------------
         //----------------------------------------------
-        ThreadPool::~ThreadPool()
+        u32 ThreadPool::GetCurrentWorkerIndex() const
+        {
+            const std::thread::id threadId = std::this_thread::get_id();
+            for (u32 i = 0; i < m_threadIds.size(); ++i)
+            {
+                if (m_threadIds[i] == threadId)
+                {
+                    return i;
+                }
+            }
+            
+            return m_threadIds.size();
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        ScheduledTask* ThreadPool::PopTask(u32 in_workerIndex, TaskPriority in_lowestPriority)
+        {
+            if (m_numQueuedTasks == 0)
+            {
+                return nullptr;
+            }
+            
+            const u32 numQueues = m_workQueues.size();
+            const u32 sharedQueueIndex = numQueues - 1;
+            for (u32 priority = 0; priority <= u32(in_lowestPriority); ++priority)
+            {
+                //newest task from our own queue, as it is most likely to still be in cache.
+                if (in_workerIndex != sharedQueueIndex)
+                {
+                    WorkQueue* queue = m_workQueues[in_workerIndex].get();
+                    std::unique_lock<std::mutex> lock(queue->m_mutex);
+                    if (queue->m_tasks[priority].empty() == false)
+                    {
+                        ScheduledTask* task = queue->m_tasks[priority].back();
+                        queue->m_tasks[priority].pop_back();
+                        m_numQueuedTasks--;
+                        return task;
+                    }
+                }
+                
+                //oldest task from the shared queue, then from each of the other workers in turn.
+                for (u32 i = 0; i < numQueues; ++i)
+                {
+                    const u32 queueIndex = (sharedQueueIndex + i) % numQueues;
+                    if (queueIndex == in_workerIndex && in_workerIndex != sharedQueueIndex)
+                    {
+                        continue;
+                    }
+                    
+                    WorkQueue* queue = m_workQueues[queueIndex].get();
+                    std::unique_lock<std::mutex> lock(queue->m_mutex);
+                    if (queue->m_tasks[priority].empty() == false)
+                    {
+                        ScheduledTask* task = queue->m_tasks[priority].front();
+                        queue->m_tasks[priority].pop_front();
+                        m_numQueuedTasks--;
+                        return task;
+                    }
+                }
+            }
+            
+            return nullptr;
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        void ThreadPool::Enqueue(ScheduledTask* in_task)
+        {
+            //The count is incremented first so that it never underflows if the task is popped straight away.
+            m_numQueuedTasks++;
+            
+            WorkQueue* queue = m_workQueues[GetCurrentWorkerIndex()].get();
+            {
+                std::unique_lock<std::mutex> lock(queue->m_mutex);
+                queue->m_tasks[u32(in_task->m_priority)].push_back(in_task);
+            }
+            
+            if (m_numSleepingThreads > 0)
+            {
+                std::unique_lock<std::mutex> lock(m_sleepMutex);
+                m_sleepCondition.notify_one();
+            }
+            
+            NotifyWaitingThreads();
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        void ThreadPool::Execute(ScheduledTask* in_task)
+        {
+            in_task->m_function();
+            in_task->m_function = nullptr;
+            
+            //No more continuations can be added once the task is marked as finished, so the list can
+            //then safely be walked outside of the lock.
+            {
+                std::unique_lock<std::mutex> lock(in_task->m_continuationMutex);
+                in_task->m_isFinished.store(true, std::memory_order_release);
+            }
+            
+            for (ScheduledTask* continuation : in_task->m_continuations)
+            {
+                if (--continuation->m_numPendingDependencies == 0)
+                {
+                    Enqueue(continuation);
+                }
+            }
+            in_task->m_continuations.clear();
+            
+            NotifyWaitingThreads();
+            ReleaseTask(in_task);
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        ScheduledTask* ThreadPool::AcquireTask()
+        {
+            std::unique_lock<std::mutex> lock(m_taskPoolMutex);
+            if (m_freeTasks.empty() == true)
+            {
+                m_allTasks.push_back(std::unique_ptr<ScheduledTask>(new ScheduledTask()));
+                return m_allTasks.back().get();
+            }
+            
+            ScheduledTask* task = m_freeTasks.back();
+            m_freeTasks.pop_back();
+            return task;
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        void ThreadPool::ReleaseTask(ScheduledTask* in_task)
         {
-			m_isFinished = true;
-			m_tasks.abort();
+            if (--in_task->m_refCount == 0)
+            {
+                std::unique_lock<std::mutex> lock(m_taskPoolMutex);
+                m_freeTasks.push_back(in_task);
+            }
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        void ThreadPool::NotifyWaitingThreads()
+        {
+            //Ensures the change being notified is visible before the waiting count is read.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
             
-            //join all threads.
-            for (u32 i=0; i<m_threadGroup.size(); ++i)
+            if (m_numWaitingThreads > 0)
             {
-                m_threadGroup[i].join();
+                std::unique_lock<std::mutex> lock(m_waitMutex);
+                m_waitGeneration++;
+                m_waitCondition.notify_all();
             }
         }
+        //----------------------------------------------
+        //----------------------------------------------
+        void ThreadPool::Stop()
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_sleepMutex);
+                m_isFinished = true;
+                m_sleepCondition.notify_all();
+            }
+            
+            //join all threads. Any tasks still queued are discarded.
+            for (u32 i=0; i<m_threads.size(); ++i)
+            {
+                if (m_threads[i].joinable() == true)
+                {
+                    m_threads[i].join();
+                }
+            }
+        }
+        //----------------------------------------------
+        //----------------------------------------------
+        ThreadPool::~ThreadPool()
+        {
+            Stop();
+        }
     }
-}
\ No newline at end of file
+}
@@ -30,9 +30,15 @@
 #define _CHILLISOURCE_CORE_THREADING_THREADPOOL_H_
 
 #include <ChilliSource/ChilliSource.h>
-#include <ChilliSource/Core/Container/concurrent_blocking_queue.h>
+#include <ChilliSource/Core/Threading/TaskFunction.h>
+#include <ChilliSource/Core/Threading/TaskHandle.h>
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -40,12 +46,50 @@ namespace ChilliSource
 {
     namespace Core
     {
+        //------------------------------------------------------------------
+        /// The priority of a task. High priority tasks are always picked
+        /// up before low priority tasks, so frame critical work such as
+        /// culling or particle simulation doesn't queue up behind
+        /// background work such as file loading.
+        //------------------------------------------------------------------
+        enum class TaskPriority
+        {
+            k_high,
+            k_low
+        };
+        //------------------------------------------------------------------
+        /// The internal state of a single scheduled task. Tasks are
+        /// recycled by the thread pool that owns them so scheduling a
+        /// task doesn't allocate once the pool has warmed up.
+        //------------------------------------------------------------------
+        struct ScheduledTask final
+        {
+            TaskFunction m_function;
+            TaskPriority m_priority = TaskPriority::k_low;
+            std::atomic<u32> m_refCount;
+            std::atomic<u32> m_numPendingDependencies;
+            std::atomic<bool> m_isFinished;
+            std::mutex m_continuationMutex;
+            std::vector<ScheduledTask*> m_continuations;
+        };
+        //------------------------------------------------------------------
+        /// A work stealing thread pool. Each worker thread owns a queue
+        /// of tasks for each priority; tasks scheduled from within a task
+        /// are pushed to the current worker's queue and popped last in,
+        /// first out, which keeps related work on the same core. When a
+        /// worker runs out of work it takes the oldest task from the
+        /// queue shared with non-worker threads, then steals the oldest
+        /// task from other workers' queues, before finally sleeping.
+        ///
+        /// Tasks can depend on other tasks, in which case they are not
+        /// queued until all of their dependencies have finished.
+        ///
+        /// @author Scott Downie
+        //------------------------------------------------------------------
         class ThreadPool
         {
         public:
-
-            typedef std::function<void()> GenericTaskType;
-            
+            CS_DECLARE_NOCOPY(ThreadPool);
             //------------------------------------------------
             /// Constructor
             ///
@@ -55,14 +99,48 @@ namespace ChilliSource
             //------------------------------------------------
             ThreadPool(u32 in_numThreads);
             //----------------------------------------------
-            /// Add a task to the queue to be serviced
-            /// when a thread becomes available
-            ///
-            /// @author Scott Downie
+            /// Schedules a task. The task will be queued once
+            /// all of the given dependencies have finished,
+            /// and will be executed when a thread becomes
+            /// available.
             ///
             /// @param Task to execute.
+            /// @param The priority of the task.
+            /// @param The tasks which must finish before this
+            /// task can start. Invalid handles are ignored.
+            /// @param The number of dependencies.
+            ///
+            /// @return A handle to the scheduled task, or an
+            /// invalid handle if the pool has been stopped.
+            //----------------------------------------------
+            TaskHandle Schedule(TaskFunction in_task, TaskPriority in_priority, const TaskHandle* in_dependencies, u32 in_numDependencies);
+            //----------------------------------------------
+            /// Executes a single queued task on the calling
+            /// thread, if there is one available. This allows
+            /// threads which are waiting on tasks to help
+            /// rather than sleep.
+            ///
+            /// @param The lowest priority of task that can
+            /// be executed.
+            ///
+            /// @return Whether or not a task was executed.
+            //----------------------------------------------
+            bool TryExecuteTask(TaskPriority in_lowestPriority);
             //----------------------------------------------
-            void Schedule(const GenericTaskType& in_task);
+            /// Blocks the calling thread until the given
+            /// condition is met. While waiting the thread
+            /// helps to execute queued tasks of at least the
+            /// given priority. If there are none it yields
+            /// for a short time, and then sleeps until a task
+            /// finishes or a new task is queued, so a thread
+            /// waiting on a long running task doesn't spin.
+            ///
+            /// @param The condition to wait for. This must
+            /// only change as the result of a task finishing.
+            /// @param The lowest priority of task that can
+            /// be executed.
+            //----------------------------------------------
+            void WaitUntil(const std::function<bool()>& in_condition, TaskPriority in_lowestPriority);
             //----------------------------------------------
             /// @author Scott Downie
             ///
@@ -70,33 +148,114 @@ namespace ChilliSource
             //----------------------------------------------
             u32 GetNumQueuedTasks() const;
             //----------------------------------------------
-            /// Discard all pending tasks from the queue
-            ///
-            /// @author Scott Downie
+            /// @return Num threads in the pool
+            //----------------------------------------------
+            u32 GetNumThreads() const;
+            //----------------------------------------------
+            /// Stops the pool, blocking until each worker
+            /// has finished its current task and exited.
+            /// Any tasks still queued are discarded and any
+            /// scheduled afterwards are rejected. The pool
+            /// remains valid throughout, so tasks which are
+            /// still running can safely continue to use it.
             //----------------------------------------------
-            void ClearQueuedTasks();
+            void Stop();
             //----------------------------------------------
             /// Destructor
             //----------------------------------------------
             ~ThreadPool();
         private:
+            friend class TaskHandle;
 
+            static const u32 k_numPriorities = 2;
+            //----------------------------------------------
+            /// A queue of tasks for each priority.
+            //----------------------------------------------
+            struct WorkQueue final
+            {
+                std::mutex m_mutex;
+                std::deque<ScheduledTask*> m_tasks[k_numPriorities];
+            };
             //----------------------------------------------
             /// Continues to perform tasks until there are
             /// none left to perform at which point this
             /// will sleep until there are new tasks.
-            /// @return The task.
+            ///
+            /// @param The index of the worker thread.
+            //----------------------------------------------
+            void DoTaskOrWait(u32 in_workerIndex);
+            //----------------------------------------------
+            /// @return The index of the calling thread in
+            /// the pool, or the number of threads if the
+            /// caller isn't a pool thread.
+            //----------------------------------------------
+            u32 GetCurrentWorkerIndex() const;
+            //----------------------------------------------
+            /// Pops the next task to execute. The worker's
+            /// own queue is checked first, then the shared
+            /// queue, then other workers' queues are stolen
+            /// from. This is repeated for each priority.
+            ///
+            /// @param The index of the calling worker, or
+            /// the number of threads if the caller isn't a
+            /// pool thread.
+            /// @param The lowest priority of task to pop.
+            ///
+            /// @return The task, or null if there are none.
+            //----------------------------------------------
+            ScheduledTask* PopTask(u32 in_workerIndex, TaskPriority in_lowestPriority);
+            //----------------------------------------------
+            /// Pushes a task, which has no remaining
+            /// dependencies, to the calling thread's queue
+            /// and wakes a sleeping worker.
+            ///
+            /// @param The task.
+            //----------------------------------------------
+            void Enqueue(ScheduledTask* in_task);
             //----------------------------------------------
-            void DoTaskOrWait();
+            /// Executes the given task and then queues any
+            /// continuations which no longer have any
+            /// dependencies.
+            ///
+            /// @param The task.
+            //----------------------------------------------
+            void Execute(ScheduledTask* in_task);
+            //----------------------------------------------
+            /// @return A recycled or newly created task.
+            //----------------------------------------------
+            ScheduledTask* AcquireTask();
+            //----------------------------------------------
+            /// Releases a reference to the task, recycling
+            /// the task when the last is released.
+            ///
+            /// @param The task.
+            //----------------------------------------------
+            void ReleaseTask(ScheduledTask* in_task);
+            //----------------------------------------------
+            /// Wakes any threads sleeping in WaitUntil() so
+            /// they can check their condition and look for
+            /// tasks to execute.
+            //----------------------------------------------
+            void NotifyWaitingThreads();
 
-			using ThreadGroup = std::vector<std::thread>;
-			using TaskQueue = concurrent_blocking_queue<GenericTaskType>;
+            std::vector<std::thread> m_threads;
+            std::vector<std::thread::id> m_threadIds;
+            std::vector<std::unique_ptr<WorkQueue>> m_workQueues;
 
+            std::mutex m_taskPoolMutex;
+            std::vector<std::unique_ptr<ScheduledTask>> m_allTasks;
+            std::vector<ScheduledTask*> m_freeTasks;
 
-            ThreadGroup m_threadGroup;
-			TaskQueue m_tasks;
-            
+            std::atomic<u32> m_numQueuedTasks;
+            std::atomic<u32> m_numSleepingThreads;
+            std::mutex m_sleepMutex;
+            std::condition_variable m_sleepCondition;
             std::atomic<bool> m_isFinished;
+
+            std::atomic<u32> m_numWaitingThreads;
+            std::mutex m_waitMutex;
+            std::condition_variable m_waitCondition;
+            u32 m_waitGeneration = 0;
         };
     }
 }
@@ -49,7 +49,7 @@ namespace ChilliSource
 
         void PerformanceTimer::Start()
         {
-#if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID     
+#if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_LINUX
 			gettimeofday(&m_startTime, 0);
 #elif defined CS_TARGETPLATFORM_WINDOWS
 			LARGE_INTEGER startTime;
@@ -60,7 +60,7 @@ namespace ChilliSource
         
         void PerformanceTimer::Stop()
         {
-#if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID    
+#if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_LINUX
             timeval stopTime;
 			gettimeofday(&stopTime, 0);
 			f64 startTimeMicro = (m_startTime.tv_sec * 1000000.0) + m_startTime.tv_usec;
@@ -0,0 +1,419 @@
+//
+//  Profiler.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Time/Profiler.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileStream.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            //Zero is never used, so a thread which hasn't cached a buffer never matches a profiler.
+            u32 g_nextProfilerInstanceId = 1;
+            
+            //------------------------------------------------------
+            /// Appends the given string to the output, escaped for
+            /// use in a JSON string.
+            ///
+            /// @param The string to escape.
+            /// @param [Out] The output string.
+            //------------------------------------------------------
+            void AppendEscaped(const std::string& in_string, std::string& out_output)
+            {
+                for (char character : in_string)
+                {
+                    if (character == '"' || character == '\\')
+                    {
+                        out_output += '\\';
+                    }
+                    out_output += character;
+                }
+            }
+        }
+        
+        //------------------------------------------------------------
+        /// A single producer, single consumer ring buffer of markers
+        /// owned by one thread. Only the owning thread writes to the
+        /// buffer and only the main thread reads from it, so neither
+        /// needs to lock.
+        ///
+        /// The buffers form a list, linked from the most recently
+        /// registered thread back to the first. A buffer is fully
+        /// constructed before it is published, and is never removed,
+        /// so the list can be walked without locking while other
+        /// threads register.
+        //------------------------------------------------------------
+        struct Profiler::ThreadBuffer final
+        {
+            static const u32 k_capacity = 8192;
+            
+            //------------------------------------------------------
+            /// A single recorded marker.
+            //------------------------------------------------------
+            struct Marker final
+            {
+                const char* m_name;
+                u64 m_startTime;
+                u64 m_endTime;
+            };
+            
+            std::string m_name;
+            u32 m_index;
+            ThreadBuffer* m_previous;
+            Marker m_markers[k_capacity];
+            std::atomic<u32> m_writeIndex;
+            std::atomic<u32> m_readIndex;
+            std::atomic<u32> m_numDropped;
+        };
+        
+        Profiler* Profiler::s_profiler = nullptr;
+        thread_local Profiler::ThreadBuffer* Profiler::s_threadBuffer = nullptr;
+        thread_local u32 Profiler::s_threadBufferInstanceId = 0;
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void Profiler::Create()
+        {
+            CS_ASSERT(s_profiler == nullptr, "The profiler has already been created.");
+            s_profiler = new Profiler();
+            s_profiler->RegisterCurrentThread("Main Thread");
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        Profiler* Profiler::Get()
+        {
+            return s_profiler;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        u64 Profiler::GetTimestampMicroS()
+        {
+            return u64(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        Profiler::Profiler()
+            : m_lastThreadBuffer(nullptr), m_numThreadBuffers(0), m_currentFrame(0), m_numFramesRecorded(0), m_frameStartTime(GetTimestampMicroS()), m_isCapturingTrace(false), m_instanceId(g_nextProfilerInstanceId++)
+        {
+            std::fill(m_frameTimesMS, m_frameTimesMS + k_numRollingFrames, 0.0);
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void Profiler::RegisterCurrentThread(const std::string& in_name)
+        {
+            if (FindThreadBuffer() == nullptr)
+            {
+                CreateThreadBuffer(in_name);
+            }
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void Profiler::RecordMarker(const char* in_name, u64 in_startTime, u64 in_endTime)
+        {
+            ThreadBuffer* buffer = FindThreadBuffer();
+            if (buffer == nullptr)
+            {
+                buffer = CreateThreadBuffer("Thread " + ToString(m_numThreadBuffers.load()));
+            }
+            
+            //only this thread writes, so the write index can be read relaxed. The read index is acquired so the
+            //slot isn't overwritten before the main thread has finished reading it.
+            const u32 writeIndex = buffer->m_writeIndex.load(std::memory_order_relaxed);
+            const u32 readIndex = buffer->m_readIndex.load(std::memory_order_acquire);
+            if (writeIndex - readIndex >= ThreadBuffer::k_capacity)
+            {
+                buffer->m_numDropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            
+            ThreadBuffer::Marker& marker = buffer->m_markers[writeIndex % ThreadBuffer::k_capacity];
+            marker.m_name = in_name;
+            marker.m_startTime = in_startTime;
+            marker.m_endTime = in_endTime;
+            buffer->m_writeIndex.store(writeIndex + 1, std::memory_order_release);
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void Profiler::EndFrame()
+        {
+            const u64 frameEndTime = GetTimestampMicroS();
+            
+            for (ThreadBuffer* buffer = m_lastThreadBuffer.load(std::memory_order_acquire); buffer != nullptr; buffer = buffer->m_previous)
+            {
+                const u32 writeIndex = buffer->m_writeIndex.load(std::memory_order_acquire);
+                const u32 readIndex = buffer->m_readIndex.load(std::memory_order_relaxed);
+                for (u32 index = readIndex; index != writeIndex; ++index)
+                {
+                    const ThreadBuffer::Marker& marker = buffer->m_markers[index % ThreadBuffer::k_capacity];
+                    const u64 duration = marker.m_endTime - marker.m_startTime;
+                    
+                    MarkerRecord& record = GetMarkerRecord(marker.m_name);
+                    record.m_numCallsThisFrame++;
+                    record.m_timeThisFrameMS += f64(duration) * 0.001;
+                    
+                    if (m_isCapturingTrace == true && m_capturedMarkers.size() < k_maxCapturedMarkers)
+                    {
+                        CapturedMarker capturedMarker;
+                        capturedMarker.m_name = marker.m_name;
+                        capturedMarker.m_startTime = marker.m_startTime;
+                        capturedMarker.m_duration = duration;
+                        capturedMarker.m_threadIndex = buffer->m_index;
+                        m_capturedMarkers.push_back(capturedMarker);
+                    }
+                }
+                buffer->m_readIndex.store(writeIndex, std::memory_order_release);
+            }
+            
+            for (MarkerRecord& record : m_markerRecords)
+            {
+                record.m_frameTimesMS[m_currentFrame] = record.m_timeThisFrameMS;
+                record.m_numCallsLastFrame = record.m_numCallsThisFrame;
+                record.m_numCallsThisFrame = 0;
+                record.m_timeThisFrameMS = 0.0;
+            }
+            
+            m_frameTimesMS[m_currentFrame] = f64(frameEndTime - m_frameStartTime) * 0.001;
+            m_frameStartTime = frameEndTime;
+            m_currentFrame = (m_currentFrame + 1) % k_numRollingFrames;
+            m_numFramesRecorded = std::min(m_numFramesRecorded + 1, u32(k_numRollingFrames));
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        std::vector<Profiler::MarkerStats> Profiler::GetMarkerStats() const
+        {
+            std::vector<MarkerStats> output;
+            if (m_numFramesRecorded == 0)
+            {
+                return output;
+            }
+            
+            const u32 lastFrame = (m_currentFrame + k_numRollingFrames - 1) % k_numRollingFrames;
+            
+            output.reserve(m_markerRecords.size());
+            for (const MarkerRecord& record : m_markerRecords)
+            {
+                MarkerStats stats;
+                stats.m_name = record.m_name;
+                stats.m_numCalls = record.m_numCallsLastFrame;
+                stats.m_lastFrameMS = record.m_frameTimesMS[lastFrame];
+                stats.m_minMS = record.m_frameTimesMS[lastFrame];
+                stats.m_maxMS = record.m_frameTimesMS[lastFrame];
+                
+                f64 total = 0.0;
+                for (u32 i = 0; i < m_numFramesRecorded; ++i)
+                {
+                    const f64 frameTime = record.m_frameTimesMS[(lastFrame + k_numRollingFrames - i) % k_numRollingFrames];
+                    stats.m_minMS = std::min(stats.m_minMS, frameTime);
+                    stats.m_maxMS = std::max(stats.m_maxMS, frameTime);
+                    total += frameTime;
+                }
+                stats.m_averageMS = total / f64(m_numFramesRecorded);
+                
+                output.push_back(stats);
+            }
+            
+            return output;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        f64 Profiler::GetLastFrameTimeMS() const
+        {
+            return m_frameTimesMS[(m_currentFrame + k_numRollingFrames - 1) % k_numRollingFrames];
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        f64 Profiler::GetAverageFrameTimeMS() const
+        {
+            if (m_numFramesRecorded == 0)
+            {
+                return 0.0;
+            }
+            
+            f64 total = 0.0;
+            for (u32 i = 0; i < m_numFramesRecorded; ++i)
+            {
+                total += m_frameTimesMS[(m_currentFrame + k_numRollingFrames - 1 - i) % k_numRollingFrames];
+            }
+            return total / f64(m_numFramesRecorded);
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        u32 Profiler::GetNumDroppedMarkers() const
+        {
+            u32 numDropped = 0;
+            
+            for (const ThreadBuffer* buffer = m_lastThreadBuffer.load(std::memory_order_acquire); buffer != nullptr; buffer = buffer->m_previous)
+            {
+                numDropped += buffer->m_numDropped.load(std::memory_order_relaxed);
+            }
+            
+            return numDropped;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void Profiler::StartTraceCapture()
+        {
+            m_capturedMarkers.clear();
+            m_isCapturingTrace = true;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void Profiler::StopTraceCapture()
+        {
+            m_isCapturingTrace = false;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        bool Profiler::IsCapturingTrace() const
+        {
+            return m_isCapturingTrace;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        bool Profiler::WriteTraceCapture(StorageLocation in_storageLocation, const std::string& in_filePath) const
+        {
+            std::string output = "{\"traceEvents\":[";
+            
+            //name each thread so they are labelled in the trace viewer.
+            bool isFirst = true;
+            for (const ThreadBuffer* buffer = m_lastThreadBuffer.load(std::memory_order_acquire); buffer != nullptr; buffer = buffer->m_previous)
+            {
+                output += (isFirst == true) ? "\n" : ",\n";
+                output += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" + ToString(buffer->m_index) + ",\"args\":{\"name\":\"";
+                AppendEscaped(buffer->m_name, output);
+                output += "\"}}";
+                isFirst = false;
+            }
+            
+            for (const CapturedMarker& marker : m_capturedMarkers)
+            {
+                output += (isFirst == true) ? "\n" : ",\n";
+                output += "{\"name\":\"";
+                AppendEscaped(marker.m_name, output);
+                output += "\",\"ph\":\"X\",\"pid\":0,\"tid\":" + ToString(marker.m_threadIndex) + ",\"ts\":" + ToString(marker.m_startTime) + ",\"dur\":" + ToString(marker.m_duration) + "}";
+                isFirst = false;
+            }
+            
+            output += "\n]}\n";
+            
+            FileStreamUPtr stream = Application::Get()->GetFileSystem()->CreateFileStream(in_storageLocation, in_filePath, FileMode::k_write);
+            if (stream == nullptr || stream->IsBad() == true)
+            {
+                CS_LOG_ERROR("Profiler: Could not write trace to '" + in_filePath + "'.");
+                return false;
+            }
+            
+            stream->Write(output);
+            return true;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        Profiler::ThreadBuffer* Profiler::FindThreadBuffer() const
+        {
+            //the cached buffer may belong to a profiler which has since been destroyed.
+            if (s_threadBufferInstanceId == m_instanceId)
+            {
+                return s_threadBuffer;
+            }
+            
+            return nullptr;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        Profiler::ThreadBuffer* Profiler::CreateThreadBuffer(const std::string& in_name)
+        {
+            std::unique_lock<std::mutex> lock(m_registrationMutex);
+            
+            const u32 index = m_numThreadBuffers.load(std::memory_order_relaxed);
+            
+            ThreadBuffer* buffer = new ThreadBuffer();
+            buffer->m_name = in_name;
+            buffer->m_index = index;
+            buffer->m_previous = m_lastThreadBuffer.load(std::memory_order_relaxed);
+            buffer->m_writeIndex = 0;
+            buffer->m_readIndex = 0;
+            buffer->m_numDropped = 0;
+            m_threadBuffers.push_back(std::unique_ptr<ThreadBuffer>(buffer));
+            
+            m_numThreadBuffers.store(index + 1, std::memory_order_relaxed);
+            m_lastThreadBuffer.store(buffer, std::memory_order_release);
+            
+            s_threadBuffer = buffer;
+            s_threadBufferInstanceId = m_instanceId;
+            return buffer;
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        Profiler::MarkerRecord& Profiler::GetMarkerRecord(const char* in_name)
+        {
+            auto pointerIt = m_markerIndicesByPointer.find(in_name);
+            if (pointerIt != m_markerIndicesByPointer.end())
+            {
+                return m_markerRecords[pointerIt->second];
+            }
+            
+            //the same name may be used from different translation units, in which case the pointers can differ.
+            u32 index = 0;
+            auto nameIt = m_markerIndicesByName.find(in_name);
+            if (nameIt != m_markerIndicesByName.end())
+            {
+                index = nameIt->second;
+            }
+            else
+            {
+                index = m_markerRecords.size();
+                
+                MarkerRecord record;
+                record.m_name = in_name;
+                std::fill(record.m_frameTimesMS, record.m_frameTimesMS + k_numRollingFrames, 0.0);
+                m_markerRecords.push_back(record);
+                m_markerIndicesByName.emplace(in_name, index);
+            }
+            
+            m_markerIndicesByPointer.emplace(in_name, index);
+            return m_markerRecords[index];
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        void Profiler::Destroy()
+        {
+            CS_SAFEDELETE(s_profiler);
+        }
+        //-----------------------------------------------------
+        //-----------------------------------------------------
+        Profiler::~Profiler()
+        {
+        }
+    }
+}
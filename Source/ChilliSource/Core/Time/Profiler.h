@@ -0,0 +1,267 @@
+//
+//  Profiler.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_TIME_PROFILER_H_
+#define _CHILLISOURCE_CORE_TIME_PROFILER_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------
+        /// A lightweight frame profiler. Timings are recorded by
+        /// placing profile markers, using the CS_PROFILE_SCOPE macro,
+        /// around the code to be measured. Each thread records into
+        /// its own fixed size ring buffer without locking, and the
+        /// buffers are drained on the main thread once per frame.
+        ///
+        /// The drained timings are used to build rolling per-frame
+        /// statistics for each marker, and can optionally be captured
+        /// and written out in the Chrome trace event format, which
+        /// can be viewed at chrome://tracing.
+        ///
+        /// The profiler only exists when CS_ENABLE_PROFILING is
+        /// declared, which it is by default in debug builds. This
+        /// implements the singleton pattern but does not inherit
+        /// from singleton, as it is needed before and after all
+        /// systems exist.
+        //------------------------------------------------------------
+        class Profiler final
+        {
+        public:
+            CS_DECLARE_NOCOPY(Profiler);
+            
+            static const u32 k_numRollingFrames = 60;
+            //-----------------------------------------------------
+            /// The rolling statistics for a single marker.
+            //-----------------------------------------------------
+            struct MarkerStats final
+            {
+                std::string m_name;
+                u32 m_numCalls = 0;
+                f64 m_lastFrameMS = 0.0;
+                f64 m_averageMS = 0.0;
+                f64 m_minMS = 0.0;
+                f64 m_maxMS = 0.0;
+            };
+            //-----------------------------------------------------
+            /// @return The singleton instance of the profiler, or
+            /// null if profiling is not enabled.
+            //-----------------------------------------------------
+            static Profiler* Get();
+            //-----------------------------------------------------
+            /// @return The current time in microseconds, relative
+            /// to an arbitrary fixed point. This is the time base
+            /// used for all profile markers.
+            //-----------------------------------------------------
+            static u64 GetTimestampMicroS();
+            //-----------------------------------------------------
+            /// Registers the calling thread with the given name,
+            /// which is used when writing traces. Threads which
+            /// record a marker without being registered are given
+            /// a default name. This has no effect if the thread
+            /// has already recorded a marker.
+            ///
+            /// @param The name of the calling thread.
+            //-----------------------------------------------------
+            void RegisterCurrentThread(const std::string& in_name);
+            //-----------------------------------------------------
+            /// Records a marker on the calling thread. This can be
+            /// called from any thread and doesn't lock. If the
+            /// thread's buffer is full the marker is dropped.
+            /// This is typically called by ScopedProfileMarker
+            /// rather than directly.
+            ///
+            /// @param The name of the marker. This must remain
+            /// valid for the lifetime of the profiler, typically
+            /// it will be a string literal.
+            /// @param The start time in microseconds.
+            /// @param The end time in microseconds.
+            //-----------------------------------------------------
+            void RecordMarker(const char* in_name, u64 in_startTime, u64 in_endTime);
+            //-----------------------------------------------------
+            /// Ends the current frame. All recorded markers are
+            /// drained from the thread buffers and added to the
+            /// rolling statistics, and to the trace capture if one
+            /// is in progress. This must be called on the main
+            /// thread.
+            //-----------------------------------------------------
+            void EndFrame();
+            //-----------------------------------------------------
+            /// @return The statistics for each marker which has
+            /// been recorded, over the last k_numRollingFrames
+            /// frames. Times are the total for the marker within
+            /// a frame. This must be called on the main thread.
+            //-----------------------------------------------------
+            std::vector<MarkerStats> GetMarkerStats() const;
+            //-----------------------------------------------------
+            /// @return The duration of the last frame in
+            /// milliseconds.
+            //-----------------------------------------------------
+            f64 GetLastFrameTimeMS() const;
+            //-----------------------------------------------------
+            /// @return The average duration of a frame over the
+            /// last k_numRollingFrames frames, in milliseconds.
+            //-----------------------------------------------------
+            f64 GetAverageFrameTimeMS() const;
+            //-----------------------------------------------------
+            /// @return The number of markers which have been
+            /// dropped because a thread's buffer was full.
+            //-----------------------------------------------------
+            u32 GetNumDroppedMarkers() const;
+            //-----------------------------------------------------
+            /// Starts capturing markers for a trace. Any previous
+            /// capture is discarded.
+            //-----------------------------------------------------
+            void StartTraceCapture();
+            //-----------------------------------------------------
+            /// Stops capturing markers. The captured trace is kept
+            /// until the next capture is started.
+            //-----------------------------------------------------
+            void StopTraceCapture();
+            //-----------------------------------------------------
+            /// @return Whether or not a trace is being captured.
+            //-----------------------------------------------------
+            bool IsCapturingTrace() const;
+            //-----------------------------------------------------
+            /// Writes the captured trace to file as Chrome trace
+            /// event JSON.
+            ///
+            /// @param The storage location to write to.
+            /// @param The file path.
+            ///
+            /// @return Whether or not the file was written.
+            //-----------------------------------------------------
+            bool WriteTraceCapture(StorageLocation in_storageLocation, const std::string& in_filePath) const;
+        private:
+            friend class Application;
+            
+            static const u32 k_maxCapturedMarkers = 1000000;
+            
+            struct ThreadBuffer;
+            //-----------------------------------------------------
+            /// A marker which has been drained from a thread
+            /// buffer into a trace capture.
+            //-----------------------------------------------------
+            struct CapturedMarker final
+            {
+                const char* m_name;
+                u64 m_startTime;
+                u64 m_duration;
+                u32 m_threadIndex;
+            };
+            //-----------------------------------------------------
+            /// The accumulated timings of a single marker.
+            //-----------------------------------------------------
+            struct MarkerRecord final
+            {
+                std::string m_name;
+                f64 m_frameTimesMS[k_numRollingFrames];
+                u32 m_numCallsThisFrame = 0;
+                u32 m_numCallsLastFrame = 0;
+                f64 m_timeThisFrameMS = 0.0;
+            };
+            //-----------------------------------------------------
+            /// Creates the singleton instance of the profiler and
+            /// registers the calling thread as the main thread.
+            //-----------------------------------------------------
+            static void Create();
+            //-----------------------------------------------------
+            /// Destroys the profiler. All threads which record
+            /// markers must have finished before this is called.
+            //-----------------------------------------------------
+            static void Destroy();
+            //-----------------------------------------------------
+            /// Constructor.
+            //-----------------------------------------------------
+            Profiler();
+            //-----------------------------------------------------
+            /// Finds the buffer for the calling thread. The buffer
+            /// is cached per thread, so this doesn't lock or
+            /// search.
+            ///
+            /// @return The buffer, or null if the calling thread
+            /// doesn't have one yet.
+            //-----------------------------------------------------
+            ThreadBuffer* FindThreadBuffer() const;
+            //-----------------------------------------------------
+            /// Creates a buffer for the calling thread. This must
+            /// only be called if the thread doesn't have one.
+            ///
+            /// @param The name of the thread.
+            ///
+            /// @return The buffer.
+            //-----------------------------------------------------
+            ThreadBuffer* CreateThreadBuffer(const std::string& in_name);
+            //-----------------------------------------------------
+            /// @param The name of a marker.
+            ///
+            /// @return The record for the marker, created if it
+            /// doesn't exist yet.
+            //-----------------------------------------------------
+            MarkerRecord& GetMarkerRecord(const char* in_name);
+            //-----------------------------------------------------
+            /// Destructor
+            //-----------------------------------------------------
+            ~Profiler();
+            
+            std::vector<std::unique_ptr<ThreadBuffer>> m_threadBuffers;
+            std::atomic<ThreadBuffer*> m_lastThreadBuffer;
+            std::atomic<u32> m_numThreadBuffers;
+            std::mutex m_registrationMutex;
+            
+            std::vector<MarkerRecord> m_markerRecords;
+            std::unordered_map<const char*, u32> m_markerIndicesByPointer;
+            std::unordered_map<std::string, u32> m_markerIndicesByName;
+            
+            f64 m_frameTimesMS[k_numRollingFrames];
+            u32 m_currentFrame;
+            u32 m_numFramesRecorded;
+            u64 m_frameStartTime;
+            
+            bool m_isCapturingTrace;
+            std::vector<CapturedMarker> m_capturedMarkers;
+            
+            u32 m_instanceId;
+            
+            static Profiler* s_profiler;
+            static thread_local ThreadBuffer* s_threadBuffer;
+            static thread_local u32 s_threadBufferInstanceId;
+        };
+    }
+}
+
+#endif
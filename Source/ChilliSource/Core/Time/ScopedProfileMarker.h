@@ -0,0 +1,94 @@
+//
+//  ScopedProfileMarker.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_TIME_SCOPEDPROFILEMARKER_H_
+#define _CHILLISOURCE_CORE_TIME_SCOPEDPROFILEMARKER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Time/Profiler.h>
+
+//------------------------------------------------------------
+/// Profiles the remainder of the current scope under the given
+/// name, which must remain valid for the lifetime of the
+/// application; typically this will be a string literal. This
+/// compiles to nothing unless CS_ENABLE_PROFILING is declared.
+//------------------------------------------------------------
+#ifdef CS_ENABLE_PROFILING
+#define CS_PROFILE_SCOPE_CONCAT_IMPL(in_a, in_b) in_a##in_b
+#define CS_PROFILE_SCOPE_CONCAT(in_a, in_b) CS_PROFILE_SCOPE_CONCAT_IMPL(in_a, in_b)
+#define CS_PROFILE_SCOPE(in_name) ::CSCore::ScopedProfileMarker CS_PROFILE_SCOPE_CONCAT(csScopedProfileMarker, __LINE__)(in_name)
+#else
+#define CS_PROFILE_SCOPE(in_name)
+#endif
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------
+        /// Records the time between its construction and destruction
+        /// with the profiler. This should typically be used through
+        /// the CS_PROFILE_SCOPE macro so that it is compiled out when
+        /// profiling is disabled.
+        //------------------------------------------------------------
+        class ScopedProfileMarker final
+        {
+        public:
+            CS_DECLARE_NOCOPY(ScopedProfileMarker);
+            //-----------------------------------------------------
+            /// Constructor. Starts timing.
+            ///
+            /// @param The name of the marker. This must remain
+            /// valid for the lifetime of the profiler.
+            //-----------------------------------------------------
+            ScopedProfileMarker(const char* in_name)
+                : m_name(in_name), m_startTime(0)
+            {
+                if (Profiler::Get() != nullptr)
+                {
+                    m_startTime = Profiler::GetTimestampMicroS();
+                }
+            }
+            //-----------------------------------------------------
+            /// Destructor. Records the marker.
+            //-----------------------------------------------------
+            ~ScopedProfileMarker()
+            {
+                Profiler* profiler = Profiler::Get();
+                if (profiler != nullptr)
+                {
+                    profiler->RecordMarker(m_name, m_startTime, Profiler::GetTimestampMicroS());
+                }
+            }
+        private:
+            const char* m_name;
+            u64 m_startTime;
+        };
+    }
+}
+
+#endif
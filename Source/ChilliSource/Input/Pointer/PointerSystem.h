@@ -35,6 +35,7 @@
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Input/Pointer/Pointer.h>
 
+#include <functional>
 #include <mutex>
 #include <queue>
 #include <set>
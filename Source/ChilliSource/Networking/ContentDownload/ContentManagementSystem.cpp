@@ -35,11 +35,22 @@
 #include <ChilliSource/Core/File/FileSystem.h>
 #include <ChilliSource/Core/File/FileStream.h>
 #include <ChilliSource/Core/File/AppDataStore.h>
+#include <ChilliSource/Core/File/TaggedFilePathResolver.h>
+#include <ChilliSource/Core/String/StringParser.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/ScopedProfileMarker.h>
+
+#ifdef CS_TARGETPLATFORM_WINDOWS
+#include <CSBackend/Platform/Windows/Core/String/WindowsStringUtils.h>
+#endif
 
 #include <minizip/unzip.h>
 
+#include <atomic>
+#include <sys/types.h>
+#include <sys/stat.h>
+
 namespace ChilliSource
 {
     namespace Networking
@@ -47,6 +58,24 @@ namespace ChilliSource
         namespace
         {
             const std::string k_adsKeyHasCached = "_CMSCachedDLC";
+            const std::string k_checksumCacheFilePath = "ContentChecksumCache.mocache";
+            const std::string k_checksumCacheVersion = "1";
+            
+            const u32 k_minFilesPerVerificationTask = 4;
+            
+            //--------------------------------------------------------
+            /// A cached checksum for a file in the DLC cache. The
+            /// checksum is only valid while the file size and
+            /// modification time match.
+            //--------------------------------------------------------
+            struct ChecksumCacheEntry final
+            {
+                u64 m_size = 0;
+                u64 m_modifiedTime = 0;
+                std::string m_checksum;
+            };
+            
+            using ChecksumCache = std::unordered_map<std::string, ChecksumCacheEntry>;
             
             //--------------------------------------------------------
             /// @author S Downie
@@ -89,8 +118,237 @@ namespace ChilliSource
                 
                 return "";
             }
+            //--------------------------------------------------------
+            /// @param The absolute path to a file.
+            /// @param [Out] The size of the file in bytes.
+            /// @param [Out] The last modification time of the file.
+            ///
+            /// @return Whether or not the file information could be
+            /// read.
+            //--------------------------------------------------------
+            bool GetFileSizeAndModifiedTime(const std::string& in_absolutePath, u64& out_size, u64& out_modifiedTime)
+            {
+#ifdef CS_TARGETPLATFORM_WINDOWS
+                struct _stat64 info;
+                std::wstring path = CSBackend::Windows::WindowsStringUtils::UTF8ToUTF16(in_absolutePath);
+                if (_wstat64(path.c_str(), &info) != 0)
+                {
+                    return false;
+                }
+#else
+                struct stat info;
+                if (stat(in_absolutePath.c_str(), &info) != 0)
+                {
+                    return false;
+                }
+#endif
+                out_size = u64(info.st_size);
+                out_modifiedTime = u64(info.st_mtime);
+                return true;
+            }
+            //--------------------------------------------------------
+            /// Loads the checksum cache from the DLC storage location.
+            /// Each line of the cache holds the size, modification
+            /// time, checksum and path of a file, separated by tabs.
+            ///
+            /// @param The file system.
+            ///
+            /// @return The cache. This is empty if there is no cache
+            /// or it is from an older version.
+            //--------------------------------------------------------
+            ChecksumCache LoadChecksumCache(const Core::FileSystem* in_fileSystem)
+            {
+                ChecksumCache cache;
+                
+                std::string contents;
+                if (in_fileSystem->DoesFileExistInCachedDLC(k_checksumCacheFilePath) == false || in_fileSystem->ReadFile(Core::StorageLocation::k_DLC, k_checksumCacheFilePath, contents) == false)
+                {
+                    return cache;
+                }
+                
+                std::vector<std::string> lines = Core::StringUtils::Split(contents, "\n");
+                if (lines.empty() == true || lines[0] != k_checksumCacheVersion)
+                {
+                    return cache;
+                }
+                
+                for (u32 i = 1; i < lines.size(); ++i)
+                {
+                    std::vector<std::string> fields = Core::StringUtils::Split(lines[i], "\t", 3);
+                    if (fields.size() == 4)
+                    {
+                        ChecksumCacheEntry entry;
+                        entry.m_size = Core::ParseU64(fields[0]);
+                        entry.m_modifiedTime = Core::ParseU64(fields[1]);
+                        entry.m_checksum = fields[2];
+                        cache.insert(std::make_pair(fields[3], entry));
+                    }
+                }
+                
+                return cache;
+            }
+            //--------------------------------------------------------
+            /// Saves the checksum cache to the DLC storage location.
+            ///
+            /// @param The file system.
+            /// @param The cache.
+            //--------------------------------------------------------
+            void SaveChecksumCache(const Core::FileSystem* in_fileSystem, const ChecksumCache& in_cache)
+            {
+                std::string contents = k_checksumCacheVersion + "\n";
+                for (const auto& entry : in_cache)
+                {
+                    contents += Core::ToString(entry.second.m_size) + "\t" + Core::ToString(entry.second.m_modifiedTime) + "\t" + entry.second.m_checksum + "\t" + entry.first + "\n";
+                }
+                
+                if (in_fileSystem->WriteFile(Core::StorageLocation::k_DLC, k_checksumCacheFilePath, contents) == false)
+                {
+                    CS_LOG_WARNING("CMS: Failed to save the checksum cache.");
+                }
+            }
+            //--------------------------------------------------------
+            /// Calculate a checksum for the file. This is thread safe
+            /// providing the custom checksum delegate, if there is
+            /// one, is.
+            ///
+            /// @param The file system.
+            /// @param The custom checksum delegate. May be null.
+            /// @param File location
+            /// @param File path
+            ///
+            /// @return Checksum string
+            //--------------------------------------------------------
+            std::string CalculateFileChecksum(const Core::FileSystem* in_fileSystem, const ContentManagementSystem::ChecksumDelegate& in_checksumDelegate, Core::StorageLocation in_location, const std::string& in_filePath)
+            {
+                if(in_checksumDelegate)
+                {
+                    // Custom checksum calculation
+                    return in_checksumDelegate(in_location, in_filePath);
+                }
+                
+                std::string checksum = in_fileSystem->GetFileChecksumSHA1(in_location, in_filePath);
+                CSCore::StringUtils::ToLowerCase(checksum);
+                std::string base64Encoded = Core::BaseEncoding::Base64Encode(checksum);
+                Core::StringUtils::ChopTrailingChars(base64Encoded, '=');
+                return base64Encoded;
+            }
         }
         CS_DEFINE_NAMEDTYPE(ContentManagementSystem);
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        struct ContentManagementSystem::UpdateCheck final
+        {
+            //-------------------------------------------------------
+            /// A package whose files need to be verified. The package
+            /// is downloaded if any of them fail.
+            //-------------------------------------------------------
+            struct Package final
+            {
+                PackageDetails m_details;
+                bool m_checkOnlyBundle = false;
+                u32 m_firstFileIndex = 0;
+                u32 m_numFiles = 0;
+            };
+            //-------------------------------------------------------
+            /// A file that needs to be verified, along with the
+            /// result of doing so.
+            //-------------------------------------------------------
+            struct File final
+            {
+                u32 m_packageIndex = 0;
+                u32 m_indexInPackage = 0;
+                Core::StorageLocation m_location = Core::StorageLocation::k_DLC;
+                std::string m_path;
+                std::string m_dlcPath;
+                std::string m_checksum;
+                
+                bool m_isCacheable = false;
+                ChecksumCacheEntry m_cacheEntry;
+            };
+            
+            UpdateCheck()
+                : m_numFilesVerified(0), m_cancelled(false)
+            {
+            }
+            //-------------------------------------------------------
+            /// Checks whether the file exists and its checksum
+            /// matches the manifest, recording the first failure in
+            /// each package. Files after a known failure in the same
+            /// package are skipped as the package will be downloaded
+            /// regardless. This is called on the thread pool.
+            ///
+            /// @param The index of the file.
+            //-------------------------------------------------------
+            void VerifyFile(u32 in_fileIndex)
+            {
+                File& file = m_files[in_fileIndex];
+                std::atomic<u32>& firstFailedFileIndex = m_firstFailedFileIndices[file.m_packageIndex];
+                if (file.m_indexInPackage >= firstFailedFileIndex)
+                {
+                    return;
+                }
+                
+                if (IsFileValid(file) == false)
+                {
+                    u32 currentFirstFailed = firstFailedFileIndex;
+                    while (file.m_indexInPackage < currentFirstFailed && firstFailedFileIndex.compare_exchange_weak(currentFirstFailed, file.m_indexInPackage) == false)
+                    {
+                    }
+                }
+            }
+            //-------------------------------------------------------
+            /// @param The file.
+            ///
+            /// @return Whether or not the file exists and its
+            /// checksum matches the manifest. Checksums of files in
+            /// the DLC cache are reused from the checksum cache if
+            /// the file hasn't changed.
+            //-------------------------------------------------------
+            bool IsFileValid(File& in_file)
+            {
+                if (m_fileSystem->DoesFileExist(in_file.m_location, in_file.m_path) == false)
+                {
+                    return false;
+                }
+                
+                if (m_useChecksumCache == true && in_file.m_location == Core::StorageLocation::k_DLC)
+                {
+                    //Files in the DLC storage location may also be found in the bundle, which is not cached
+                    std::string absolutePath = Core::StringUtils::StandardiseFilePath(m_contentDirectory + "/" + in_file.m_path);
+                    in_file.m_isCacheable = GetFileSizeAndModifiedTime(absolutePath, in_file.m_cacheEntry.m_size, in_file.m_cacheEntry.m_modifiedTime);
+                }
+                
+                if (in_file.m_isCacheable == true)
+                {
+                    auto it = m_checksumCache.find(in_file.m_dlcPath);
+                    if (it != m_checksumCache.end() && it->second.m_size == in_file.m_cacheEntry.m_size && it->second.m_modifiedTime == in_file.m_cacheEntry.m_modifiedTime)
+                    {
+                        in_file.m_cacheEntry.m_checksum = it->second.m_checksum;
+                    }
+                    else
+                    {
+                        in_file.m_cacheEntry.m_checksum = CalculateFileChecksum(m_fileSystem, m_checksumDelegate, in_file.m_location, in_file.m_path);
+                    }
+                    
+                    return (in_file.m_cacheEntry.m_checksum == in_file.m_checksum);
+                }
+                
+                return (CalculateFileChecksum(m_fileSystem, m_checksumDelegate, in_file.m_location, in_file.m_path) == in_file.m_checksum);
+            }
+            
+            std::vector<Package> m_packages;
+            std::vector<File> m_files;
+            std::unique_ptr<std::atomic<u32>[]> m_firstFailedFileIndices;
+            
+            const Core::FileSystem* m_fileSystem = nullptr;
+            ChecksumDelegate m_checksumDelegate;
+            std::string m_contentDirectory;
+            bool m_useChecksumCache = false;
+            ChecksumCache m_checksumCache;
+            
+            std::atomic<u32> m_numFilesVerified;
+            std::atomic<bool> m_cancelled;
+        };
         //--------------------------------------------------------
         //--------------------------------------------------------
         ContentManagementSystemUPtr ContentManagementSystem::Create(IContentDownloader* in_contentDownloader)
@@ -110,6 +368,12 @@ namespace ChilliSource
         {
             m_contentDirectory = Core::Application::Get()->GetFileSystem()->GetAbsolutePathToStorageLocation(Core::StorageLocation::k_DLC);
         }
+        //------------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::OnDestroy()
+        {
+            CancelUpdateCheck();
+        }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
         bool ContentManagementSystem::IsA(Core::InterfaceIDType in_interfaceId) const
@@ -145,17 +409,7 @@ namespace ChilliSource
 		//-----------------------------------------------------------
 		std::string ContentManagementSystem::CalculateChecksum(Core::StorageLocation in_location, const std::string& in_filePath) const
 		{
-            if(m_checksumDelegate)
-            {
-                // Custom checksum calculation
-                return m_checksumDelegate(in_location, in_filePath);
-            }
-            
-            std::string checksum = Core::Application::Get()->GetFileSystem()->GetFileChecksumSHA1(in_location, in_filePath);
-            CSCore::StringUtils::ToLowerCase(checksum);
-			std::string base64Encoded = Core::BaseEncoding::Base64Encode(checksum);
-			Core::StringUtils::ChopTrailingChars(base64Encoded, '=');
-			return base64Encoded;
+            return CalculateFileChecksum(Core::Application::Get()->GetFileSystem(), m_checksumDelegate, in_location, in_filePath);
 		}
         //-----------------------------------------------------------
         //-----------------------------------------------------------
@@ -170,14 +424,19 @@ namespace ChilliSource
         //-----------------------------------------------------------
         void ContentManagementSystem::CheckForUpdates(const ContentManagementSystem::CheckForUpdateDelegate& in_delegate)
         {
+            //Only one update check can be in progress at a time
+            CancelUpdateCheck();
+            
             //Clear any stale data from last update check
             ClearDownloadData();
+            m_serverManifestData.clear();
             
             //Have the downloader request the manifest in it's own way
             if(m_contentDownloader->DownloadContentManifest(Core::MakeDelegate(this, &ContentManagementSystem::OnContentManifestDownloadComplete)))
             {
                 //The request has started successfully
                 m_onUpdateCheckCompleteDelegate = in_delegate;
+                m_isCheckingForUpdates = true;
             }
             else
             {
@@ -195,6 +454,41 @@ namespace ChilliSource
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
+        void ContentManagementSystem::CancelUpdateCheck()
+        {
+            if (m_updateCheck != nullptr)
+            {
+                m_updateCheck->m_cancelled = true;
+                m_updateCheck.reset();
+            }
+            
+            m_isCheckingForUpdates = false;
+            m_onUpdateCheckCompleteDelegate = nullptr;
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        bool ContentManagementSystem::IsCheckingForUpdates() const
+        {
+            return m_isCheckingForUpdates;
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        f32 ContentManagementSystem::GetUpdateCheckProgress() const
+        {
+            if (m_updateCheck == nullptr)
+            {
+                return 0.0f;
+            }
+            
+            if (m_updateCheck->m_files.empty() == true)
+            {
+                return 1.0f;
+            }
+            
+            return f32(m_updateCheck->m_numFilesVerified.load()) / f32(m_updateCheck->m_files.size());
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
         void ContentManagementSystem::DownloadUpdates(const ContentManagementSystem::CompleteDelegate& in_delegate)
         {
         	m_onDownloadCompleteDelegate = in_delegate;
@@ -251,6 +545,9 @@ namespace ChilliSource
                 //Save the new content manifest
                 CSCore::XMLUtils::WriteDocument(m_serverManifest->GetDocument(), Core::StorageLocation::k_DLC, "ContentManifest.moman");
                 
+                //The DLC files have changed so any tagged file paths resolved from them are out of date
+                Core::Application::Get()->GetTaggedFilePathResolver()->ClearFileIndex();
+                
                 m_dlcCachePurged = false;
                 
                 //Store that we have DLC cached. If there is no DLC on next check then 
@@ -273,6 +570,13 @@ namespace ChilliSource
         //-----------------------------------------------------------
         void ContentManagementSystem::OnContentManifestDownloadComplete(IContentDownloader::Result in_result, const std::string& in_manifest)
         {
+            //The update check may have been cancelled while the manifest was downloading
+            if(m_isCheckingForUpdates == false)
+            {
+                m_serverManifestData.clear();
+                return;
+            }
+            
             switch(in_result)
             {
                 case IContentDownloader::Result::k_succeeded:
@@ -282,15 +586,12 @@ namespace ChilliSource
                     break;
                 case IContentDownloader::Result::k_failed:
                     m_serverManifestData.clear();
-                    m_dlcCachePurged ? m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_checkFailedBlocking) : m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_checkFailed);
+                    NotifyUpdateCheckComplete(m_dlcCachePurged ? CheckForUpdatesResult::k_checkFailedBlocking : CheckForUpdatesResult::k_checkFailed);
                     break;
                 case IContentDownloader::Result::k_flushed:
                     m_serverManifestData += in_manifest;
                     break;
             };
-            
-            //Reset the listener
-            m_onUpdateCheckCompleteDelegate = nullptr;
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
@@ -348,11 +649,11 @@ namespace ChilliSource
                 CS_LOG_ERROR("CMS: Server content manifest is invalid");
                 if(m_dlcCachePurged)
                 {
-                    m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_checkFailedBlocking);
+                    NotifyUpdateCheckComplete(CheckForUpdatesResult::k_checkFailedBlocking);
                 }
                 else
                 {
-                    m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_checkFailed);
+                    NotifyUpdateCheckComplete(CheckForUpdatesResult::k_checkFailed);
                 }
 
                 return;
@@ -361,10 +662,25 @@ namespace ChilliSource
             //Check if DLC is enabled
             if(!Core::XMLUtils::GetAttributeValue<bool>(serverManifestRootNode, "DLCEnabled", false))
             {
-				m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_notAvailable);
+				NotifyUpdateCheckComplete(CheckForUpdatesResult::k_notAvailable);
                 return;
             }
             
+            Core::FileSystem* fileSystem = Core::Application::Get()->GetFileSystem();
+            
+            //The files are verified on background threads so gather everything they need up front
+            std::shared_ptr<UpdateCheck> updateCheck = std::make_shared<UpdateCheck>();
+            updateCheck->m_fileSystem = fileSystem;
+            updateCheck->m_checksumDelegate = m_checksumDelegate;
+            updateCheck->m_contentDirectory = m_contentDirectory;
+            
+            //Custom checksums could change between sessions so are not cached
+            if (m_checksumDelegate == nullptr)
+            {
+                updateCheck->m_useChecksumCache = true;
+                updateCheck->m_checksumCache = LoadChecksumCache(fileSystem);
+            }
+            
             Core::XMLUPtr currentManifest = LoadLocalManifest();
             
 			//If we have not successfully loaded a manifest from file we need to check if any of the assets 
@@ -378,7 +694,7 @@ namespace ChilliSource
                 while(serverPackageEl)
                 {
                     //If the package is not in the bundle it will download
-                    AddToDownloadListIfNotInBundle(serverPackageEl);
+                    AddPackageToUpdateCheck(updateCheck.get(), serverPackageEl, true);
                     
                     //On to the next package
                     serverPackageEl = Core::XMLUtils::GetNextSiblingElement(serverPackageEl, "Package");
@@ -415,7 +731,6 @@ namespace ChilliSource
                     //Store the local ID's and checksums for comparison later
                     std::string strServerPackageID = Core::XMLUtils::GetAttributeValue<std::string>(pServerPackageEl, "ID", "");
                     std::string strServerPackageChecksum = Core::XMLUtils::GetAttributeValue<std::string>(pServerPackageEl, "Checksum", "");
-					std::string strMinVersionForPackage = Core::XMLUtils::GetAttributeValue<std::string>(pServerPackageEl, "MinVersion", "");
                     
                     std::unordered_map<std::string, std::string>::iterator it = mapPackageIDToChecksum.find(strServerPackageID);
 				
@@ -427,43 +742,14 @@ namespace ChilliSource
                         {
                             //The package in documents is outdated lets check if the files all exist in the bundle
                             //that way we don't need to download
-                            AddToDownloadListIfNotInBundle(pServerPackageEl);                            
+                            AddPackageToUpdateCheck(updateCheck.get(), pServerPackageEl, true);
                         }
                         else
                         {
                             //The checksum in the local manifest matches that on the
                             //server but the file may have been altered locally
                             //Check if the files within are corrupt
-                            //Check all the file names
-                            Core::XML::Node* pFileEl = Core::XMLUtils::GetFirstChildElement(pServerPackageEl, "File");
-                            while(pFileEl)
-                            {
-                                std::string strFullPath = Core::XMLUtils::GetAttributeValue<std::string>(pFileEl, "Location", "");
-                                std::string strChecksum = Core::XMLUtils::GetAttributeValue<std::string>(pFileEl, "Checksum", "");
-                                
-                                if(strFullPath.empty()) //Maintain backwards compatability with old versions
-                                {
-                                    std::string strFileName = Core::XMLUtils::GetAttributeValue<std::string>(pFileEl, "Name", "");
-                                    strFullPath = strServerPackageID + "/" + strFileName;
-                                }
-                                
-                                if(!DoesFileExist(strFullPath, strChecksum, false))
-                                {
-                                    std::string strPackageUrl = Core::XMLUtils::GetAttributeValue<std::string>(pServerPackageEl, "URL", "");
-                                    u32 udwPackageSize = Core::XMLUtils::GetAttributeValue<u32>(pServerPackageEl, "Size", 0);
-                                    m_runningToDownloadTotal += udwPackageSize;
-
-                                    PackageDetails packageDetails;
-                                    packageDetails.m_id = strServerPackageID;
-                                    packageDetails.m_url = strPackageUrl;
-                                    packageDetails.m_checksum = strServerPackageChecksum;
-                                    packageDetails.m_size = udwPackageSize;
-                                    m_packageDetails.push_back(packageDetails);
-                                    break;
-                                }
-                                
-                                pFileEl = Core::XMLUtils::GetNextSiblingElement(pFileEl, "File");
-                            }
+                            AddPackageToUpdateCheck(updateCheck.get(), pServerPackageEl, false);
                         }
                         
                         mapPackageIDToChecksum.erase(it);
@@ -472,7 +758,7 @@ namespace ChilliSource
                     {
                         //Couldn't find the package in the local manifest if it isn't
                         //in the bundle then we need to download it
-                        AddToDownloadListIfNotInBundle(pServerPackageEl);
+                        AddPackageToUpdateCheck(updateCheck.get(), pServerPackageEl, true);
                     }
                     
                     //On to the next package
@@ -486,61 +772,191 @@ namespace ChilliSource
                 }
             }
             
+            m_updateCheck = updateCheck;
+            StartUpdateCheckVerification(updateCheck);
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::AddPackageToUpdateCheck(UpdateCheck* in_updateCheck, Core::XML::Node* in_packageEl, bool in_checkOnlyBundle) const
+        {
+            UpdateCheck::Package package;
+            package.m_details.m_id = Core::XMLUtils::GetAttributeValue<std::string>(in_packageEl, "ID", "");
+            package.m_details.m_url = Core::XMLUtils::GetAttributeValue<std::string>(in_packageEl, "URL", "");
+            package.m_details.m_checksum = Core::XMLUtils::GetAttributeValue<std::string>(in_packageEl, "Checksum", "");
+            package.m_details.m_size = Core::XMLUtils::GetAttributeValue<u32>(in_packageEl, "Size", 0);
+            package.m_checkOnlyBundle = in_checkOnlyBundle;
+            package.m_firstFileIndex = u32(in_updateCheck->m_files.size());
+            
+            const u32 packageIndex = u32(in_updateCheck->m_packages.size());
+            const std::string& packageDLCPath = in_updateCheck->m_fileSystem->GetPackageDLCPath();
+            
+            //Check all the file names
+            Core::XML::Node* pFileEl = Core::XMLUtils::GetFirstChildElement(in_packageEl, "File");
+            while(pFileEl)
+            {
+                UpdateCheck::File file;
+                file.m_packageIndex = packageIndex;
+                file.m_indexInPackage = package.m_numFiles++;
+                file.m_checksum = Core::XMLUtils::GetAttributeValue<std::string>(pFileEl, "Checksum", "");
+                
+                if (in_checkOnlyBundle == true)
+                {
+                    std::string strFileName = Core::XMLUtils::GetAttributeValue<std::string>(pFileEl, "Name", "");
+                    file.m_dlcPath = package.m_details.m_id + "/" + strFileName;
+                    file.m_location = Core::StorageLocation::k_package;
+                    file.m_path = packageDLCPath + file.m_dlcPath;
+                }
+                else
+                {
+                    file.m_dlcPath = Core::XMLUtils::GetAttributeValue<std::string>(pFileEl, "Location", "");
+                    if(file.m_dlcPath.empty()) //Maintain backwards compatability with old versions
+                    {
+                        std::string strFileName = Core::XMLUtils::GetAttributeValue<std::string>(pFileEl, "Name", "");
+                        file.m_dlcPath = package.m_details.m_id + "/" + strFileName;
+                    }
+                    file.m_location = Core::StorageLocation::k_DLC;
+                    file.m_path = file.m_dlcPath;
+                }
+                
+                in_updateCheck->m_files.push_back(file);
+                
+                pFileEl = Core::XMLUtils::GetNextSiblingElement(pFileEl, "File");
+            }
+            
+            in_updateCheck->m_packages.push_back(package);
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::StartUpdateCheckVerification(const std::shared_ptr<UpdateCheck>& in_updateCheck)
+        {
+            const u32 numPackages = u32(in_updateCheck->m_packages.size());
+            in_updateCheck->m_firstFailedFileIndices.reset(new std::atomic<u32>[numPackages]);
+            for (u32 i = 0; i < numPackages; ++i)
+            {
+                in_updateCheck->m_firstFailedFileIndices[i] = in_updateCheck->m_packages[i].m_numFiles;
+            }
+            
+            Core::TaskScheduler* taskScheduler = Core::Application::Get()->GetTaskScheduler();
+            std::shared_ptr<UpdateCheck> updateCheck = in_updateCheck;
+            
+            taskScheduler->ScheduleTask([=]()
+            {
+                CS_PROFILE_SCOPE("ContentManagementSystem::VerifyFiles");
+                
+                //The scheduler stops its thread pool before the system is destroyed, waiting for this task to return, so
+                //shutting down is treated as cancelling the check
+                auto isCancelled = [&]()
+                {
+                    return (updateCheck->m_cancelled == true || taskScheduler->IsShuttingDown() == true);
+                };
+                
+                taskScheduler->ParallelFor(u32(updateCheck->m_files.size()), k_minFilesPerVerificationTask, [&](u32 in_startIndex, u32 in_endIndex)
+                {
+                    for (u32 i = in_startIndex; i < in_endIndex && isCancelled() == false; ++i)
+                    {
+                        updateCheck->VerifyFile(i);
+                        ++updateCheck->m_numFilesVerified;
+                    }
+                }, Core::TaskPriority::k_low);
+                
+                if (isCancelled() == true)
+                {
+                    return;
+                }
+                
+                taskScheduler->ScheduleMainThreadTask([=]()
+                {
+                    //The system may have been destroyed if the check was cancelled
+                    if (updateCheck->m_cancelled == false)
+                    {
+                        OnUpdateCheckVerified(updateCheck);
+                    }
+                });
+            });
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::OnUpdateCheckVerified(const std::shared_ptr<UpdateCheck>& in_updateCheck)
+        {
+            CS_ASSERT(in_updateCheck == m_updateCheck, "CMS: Verified update check is not the current update check.");
+            
+            Core::FileSystem* fileSystem = Core::Application::Get()->GetFileSystem();
+            
+            //The cache is saved on the main thread, as it is loaded, so a new check can't read it while it's written
+            if (in_updateCheck->m_useChecksumCache == true)
+            {
+                //Rebuild the cache from this check so entries for files no longer in the manifest are dropped
+                ChecksumCache checksumCache;
+                for (const auto& file : in_updateCheck->m_files)
+                {
+                    if (file.m_isCacheable == true && file.m_cacheEntry.m_checksum.empty() == false)
+                    {
+                        checksumCache.insert(std::make_pair(file.m_dlcPath, file.m_cacheEntry));
+                    }
+                    else if (file.m_indexInPackage > in_updateCheck->m_firstFailedFileIndices[file.m_packageIndex])
+                    {
+                        //Files after a failure in their package may have been skipped, so keep their existing entries
+                        auto it = in_updateCheck->m_checksumCache.find(file.m_dlcPath);
+                        if (it != in_updateCheck->m_checksumCache.end())
+                        {
+                            checksumCache.insert(*it);
+                        }
+                    }
+                }
+                SaveChecksumCache(fileSystem, checksumCache);
+            }
+            
+            for (u32 i = 0; i < in_updateCheck->m_packages.size(); ++i)
+            {
+                const UpdateCheck::Package& package = in_updateCheck->m_packages[i];
+                const u32 firstFailedFileIndex = in_updateCheck->m_firstFailedFileIndices[i];
+                
+                if (package.m_checkOnlyBundle == true)
+                {
+                    //The files that exist in the bundle can be removed from the DLC cache
+                    for (u32 j = 0; j < firstFailedFileIndex; ++j)
+                    {
+                        fileSystem->DeleteFile(Core::StorageLocation::k_DLC, in_updateCheck->m_files[package.m_firstFileIndex + j].m_dlcPath);
+                    }
+                }
+                
+                if (firstFailedFileIndex < package.m_numFiles)
+                {
+                    //It doesn't matter if all the other files exist we need to pull down this package anyway
+                    m_runningToDownloadTotal += package.m_details.m_size;
+                    m_packageDetails.push_back(package.m_details);
+                }
+            }
+            
             //Notify the delegate of our completion and whether the need to update anything
             bool bRequiresUpdating = (!m_removePackageIds.empty() || !m_packageDetails.empty());
             
             if(bRequiresUpdating && m_dlcCachePurged)
             {
-                m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_availableBlocking);
+                NotifyUpdateCheckComplete(CheckForUpdatesResult::k_availableBlocking);
             }
             else if(bRequiresUpdating && !m_dlcCachePurged)
             {
-                m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_available);
+                NotifyUpdateCheckComplete(CheckForUpdatesResult::k_available);
             }
             else
             {
-                m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_notAvailable);
+                NotifyUpdateCheckComplete(CheckForUpdatesResult::k_notAvailable);
             }
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
-        void ContentManagementSystem::AddToDownloadListIfNotInBundle(Core::XML::Node* in_packageEl)
+        void ContentManagementSystem::NotifyUpdateCheckComplete(CheckForUpdatesResult in_result)
         {
-            //Check all the file names
-            Core::XML::Node* pFileEl = Core::XMLUtils::GetFirstChildElement(in_packageEl, "File");
-            while(pFileEl)
+            CheckForUpdateDelegate delegate = m_onUpdateCheckCompleteDelegate;
+            
+            m_updateCheck.reset();
+            m_isCheckingForUpdates = false;
+            m_onUpdateCheckCompleteDelegate = nullptr;
+            
+            if (delegate != nullptr)
             {
-                std::string strFileName = Core::XMLUtils::GetAttributeValue<std::string>(pFileEl, "Name", "");
-                std::string strChecksum = Core::XMLUtils::GetAttributeValue<std::string>(pFileEl, "Checksum", "");
-                std::string strPackageID = Core::XMLUtils::GetAttributeValue<std::string>(in_packageEl, "ID", "");
-                
-                if(!DoesFileExist(strPackageID + "/" + strFileName, strChecksum, true))
-                {
-                    //It doesn't exist in the bundle either!
-                    std::string strPackageUrl = Core::XMLUtils::GetAttributeValue<std::string>(in_packageEl, "URL", "");
-                    std::string strPackageChecksum = Core::XMLUtils::GetAttributeValue<std::string>(in_packageEl, "Checksum", "");
-                    
-                    u32 udwPackageSize = Core::XMLUtils::GetAttributeValue<u32>(in_packageEl, "Size", 0);
-					m_runningToDownloadTotal += udwPackageSize;
-                    
-                    PackageDetails packageDetails;
-                    packageDetails.m_id = strPackageID;
-                    packageDetails.m_url = strPackageUrl;
-                    packageDetails.m_checksum = strPackageChecksum;
-                    packageDetails.m_size = udwPackageSize;
-                    m_packageDetails.push_back(packageDetails);
-                    //It doesn't matter if all the other files exist we need to pull down this package anyway
-                    break;
-                }
-                else
-                {
-                    //It exists in the bundle let's remove the old version from DLC cache
-                    //Remove old content
-                    Core::Application::Get()->GetFileSystem()->DeleteFile(Core::StorageLocation::k_DLC, strPackageID + "/" + strFileName);
-                    
-                    //On to the next file
-                    pFileEl = Core::XMLUtils::GetNextSiblingElement(pFileEl, "File");
-                }
+                delegate(in_result);
             }
         }
         //-----------------------------------------------------------
@@ -654,31 +1070,6 @@ namespace ChilliSource
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
-        bool ContentManagementSystem::DoesFileExist(const std::string& in_filename, const std::string in_checksum, bool in_checkOnlyBundle) const
-        {
-            if(in_checkOnlyBundle)
-            {
-                if(Core::Application::Get()->GetFileSystem()->DoesFileExist(Core::StorageLocation::k_package, Core::Application::Get()->GetFileSystem()->GetPackageDLCPath() + in_filename))
-                {
-                    //Check if the file has become corrupted
-                    return (CalculateChecksum(Core::StorageLocation::k_package, Core::Application::Get()->GetFileSystem()->GetPackageDLCPath() + in_filename) == in_checksum);
-                }
-                
-                return false;
-            }
-            else
-            {
-                if(Core::Application::Get()->GetFileSystem()->DoesFileExist(Core::StorageLocation::k_DLC, in_filename))
-                {
-                    //Check if the file has become corrupted
-                    return (CalculateChecksum(Core::StorageLocation::k_DLC, in_filename) == in_checksum);
-                }
-                
-                return false;
-            }
-        }
-        //-----------------------------------------------------------
-        //-----------------------------------------------------------
         void ContentManagementSystem::DeleteDirectory(const std::string& in_directory) const
         {
             CSCore::Application::Get()->GetFileSystem()->DeleteDirectory(Core::StorageLocation::k_DLC, in_directory);
@@ -132,6 +132,13 @@ namespace ChilliSource
             /// the SKU (i.e. Google's Asset Store). The URL is taken
             /// from the tweakable constants.
             ///
+            /// The files listed in the manifest are verified against
+            /// their checksums on background threads, so the delegate
+            /// will be called on the main thread some time after the
+            /// manifest has downloaded. Checking for updates while a
+            /// check is already in progress will cancel the previous
+            /// check.
+            ///
             /// @author S Downie
             ///
             /// @param Delegate to callback notifying whether an update
@@ -139,6 +146,22 @@ namespace ChilliSource
             //-----------------------------------------------------------
             void CheckForUpdates(const CheckForUpdateDelegate& in_delegate);
             //-----------------------------------------------------------
+            /// Cancels the update check that is currently in progress,
+            /// if there is one. The update check delegate will not be
+            /// called.
+            //-----------------------------------------------------------
+            void CancelUpdateCheck();
+            //-----------------------------------------------------------
+            /// @return Whether or not an update check is in progress.
+            //-----------------------------------------------------------
+            bool IsCheckingForUpdates() const;
+            //-----------------------------------------------------------
+            /// @return The progress of verifying the local files during
+            /// an update check in the range 0.0 to 1.0. This is 0.0 if no
+            /// check is in progress or the manifest is still downloading.
+            //-----------------------------------------------------------
+            f32 GetUpdateCheckProgress() const;
+            //-----------------------------------------------------------
             /// Having checked for updates and been notified whether
             /// there are updates pending this function should be
             /// called to begin downloading any out of date content
@@ -201,6 +224,11 @@ namespace ChilliSource
             //-----------------------------------------------------------
             IContentDownloader* GetContentDownloader() const;
             //-----------------------------------------------------------
+            /// Sets a custom checksum calculation. As files are verified
+            /// in parallel during update checks, the delegate may be
+            /// called from any thread, concurrently. Checksums from a
+            /// custom delegate are not cached between sessions.
+            ///
             /// @author N Tanda
             ///
             /// @param The checksum calculation delegate
@@ -221,6 +249,12 @@ namespace ChilliSource
                 std::string m_checksum;
                 u32 m_size;
             };
+            //-----------------------------------------------------------
+            /// The state of an update check that is verifying local
+            /// files on background threads. This is shared with the
+            /// background tasks so it can outlive a cancelled check.
+			//-----------------------------------------------------------
+            struct UpdateCheck;
             //------------------------------------------------------------
             /// Initialisation method called at a time when all App Systems
             /// have been created. System initialisation occurs in the order
@@ -230,6 +264,10 @@ namespace ChilliSource
             //-----------------------------------------------------------
             void OnInit() override;
             //-----------------------------------------------------------
+            /// Cancels any update check in progress.
+            //-----------------------------------------------------------
+            void OnDestroy() override;
+            //-----------------------------------------------------------
             /// Constructor. Declared private to force the use of the
             /// factory method.
             ///
@@ -277,14 +315,40 @@ namespace ChilliSource
             //-----------------------------------------------------------
             void BuildDownloadList(const std::string& in_serverManifest);
             //-----------------------------------------------------------
-            /// The package may be outdated in documents but are
-            /// all the files in bundle up to date
-            ///
-            /// @author S Downie
+            /// Adds the files in the given package to the list of files
+            /// the update check needs to verify. If any file fails
+            /// verification the package will be downloaded.
             ///
+            /// @param The update check.
             /// @param Package element
+            /// @param Whether to check the bundle rather than the DLC
+            /// cache. Files that are found in the bundle are removed from
+            /// the DLC cache.
+            //-----------------------------------------------------------
+            void AddPackageToUpdateCheck(UpdateCheck* in_updateCheck, Core::XML::Node* in_packageEl, bool in_checkOnlyBundle) const;
             //-----------------------------------------------------------
-            void AddToDownloadListIfNotInBundle(Core::XML::Node* in_packageEl);
+            /// Verifies the files in the update check on the thread pool,
+            /// then calls OnUpdateCheckVerified() on the main thread.
+            ///
+            /// @param The update check.
+            //-----------------------------------------------------------
+            void StartUpdateCheckVerification(const std::shared_ptr<UpdateCheck>& in_updateCheck);
+            //-----------------------------------------------------------
+            /// Called on the main thread once the files in the update
+            /// check have been verified. Saves the checksum cache,
+            /// builds the download list from the results and notifies
+            /// the update check delegate.
+            ///
+            /// @param The update check.
+            //-----------------------------------------------------------
+            void OnUpdateCheckVerified(const std::shared_ptr<UpdateCheck>& in_updateCheck);
+            //-----------------------------------------------------------
+            /// Ends the current update check and calls the update check
+            /// delegate with the given result.
+            ///
+            /// @param The result.
+            //-----------------------------------------------------------
+            void NotifyUpdateCheckComplete(CheckForUpdatesResult in_result);
             //-----------------------------------------------------------
             /// Save the zip file to documents directory
             ///
@@ -314,19 +378,6 @@ namespace ChilliSource
 			//-----------------------------------------------------------
 			void DeleteDirectory(const std::string& in_directory) const;
             //-----------------------------------------------------------
-            /// Checks whether the file is within the application and if the
-            /// the checksums match
-            ///
-            /// @author S Downie
-            ///
-            /// @param Filename
-            /// @param Checksum
-            /// @param Whether to check only the bundle
-            ///
-            /// @return Whether the file exists
-            //-----------------------------------------------------------
-            bool DoesFileExist(const std::string& in_filename, const std::string in_checksum, bool in_checkOnlyBundle) const;
-            //-----------------------------------------------------------
             /// Calculate a checksum for the file. Will call the custom
             /// checksum delegate if provided. Otherwise, will perform an
             /// SHA1 hash of the file and convert that to base 64 encoded
@@ -354,6 +405,7 @@ namespace ChilliSource
 			u32 m_runningDownloadedTotal = 0;
             
             Core::XMLUPtr m_serverManifest;
+            std::shared_ptr<UpdateCheck> m_updateCheck;
             
             IContentDownloader* m_contentDownloader = nullptr;
             
@@ -367,6 +419,7 @@ namespace ChilliSource
             u32 m_currentPackageDownload = 0;
             
             bool m_dlcCachePurged = false;
+            bool m_isCheckingForUpdates = false;
         };
     }
 }
@@ -46,6 +46,8 @@
 #include <ChilliSource/Rendering/Base/RenderComponentFactory.h>
 #include <ChilliSource/Rendering/Base/Renderer.h>
 #include <ChilliSource/Rendering/Base/RendererSortPredicates.h>
+#include <ChilliSource/Rendering/Base/RenderSortUtils.h>
+#include <ChilliSource/Rendering/Base/RenderStats.h>
 #include <ChilliSource/Rendering/Base/RenderSystem.h>
 #include <ChilliSource/Rendering/Base/RenderTarget.h>
 #include <ChilliSource/Rendering/Base/ShaderPass.h>
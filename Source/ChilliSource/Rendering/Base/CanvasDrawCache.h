@@ -0,0 +1,67 @@
+//
+//  CanvasDrawCache.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_BASE_CANVASDRAWCACHE_H_
+#define _CHILLISOURCE_RENDERING_BASE_CANVASDRAWCACHE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Rendering/Sprite/SpriteBatch.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+        //----------------------------------------------------------------------------
+        /// The retained geometry for a single widget's components. The canvas
+        /// renderer fills this while the widget draws and can then merge it into the
+        /// canvas vertex buffer on later frames without the components having to
+        /// generate their quads again.
+        ///
+        /// The vertices are laid out in sprites of k_numSpriteVerts, in the order
+        /// given by SpriteBatch::Verts. Each run describes a consecutive set of
+        /// sprites that share a material.
+        //----------------------------------------------------------------------------
+        struct CanvasDrawCache
+        {
+            //----------------------------------------------------------------------------
+            /// A consecutive set of sprites that are rendered with the same material.
+            //----------------------------------------------------------------------------
+            struct Run
+            {
+                MaterialCSPtr m_material;
+                u32 m_numSprites = 0;
+            };
+
+            std::vector<SpriteBatch::SpriteVertex> m_vertices;
+            std::vector<Run> m_runs;
+        };
+	}
+}
+
+#endif
@@ -33,6 +33,8 @@
 #include <ChilliSource/Core/Math/MathUtils.h>
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 #include <ChilliSource/Core/String/UTF8StringUtils.h>
+#include <ChilliSource/Core/Time/ScopedProfileMarker.h>
+#include <ChilliSource/Rendering/Base/RenderSystem.h>
 #include <ChilliSource/Rendering/Font/Font.h>
 #include <ChilliSource/Rendering/Material/Material.h>
 #include <ChilliSource/Rendering/Material/MaterialFactory.h>
@@ -47,6 +49,10 @@ namespace ChilliSource
 	{
         namespace
         {
+            //The number of sprites in each of the retained canvas buffers. This is kept well
+            //below the limit of 16-bit indices.
+            const u32 k_maxSpritesPerCanvasBatch = 2048;
+
             //------------------------------------------------------
             /// Converts a 2D transformation matrix to a 3D
             /// Transformation matrix. This will only work for
@@ -67,25 +73,27 @@ namespace ChilliSource
                     in_transform.m[6], in_transform.m[7], in_transform.m[8], 1);
             }
             //----------------------------------------------------------------------------
-            /// Get the width of the character
-            ///
-            /// @author S Downie
-            ///
-            /// @param Character
-            /// @param Font
-            /// @param The absolute character spacing offset.
-            /// @param The text scale factor.
+            /// A single character of text which has been decoded and looked up in the
+            /// font in preparation for laying out the text.
             //----------------------------------------------------------------------------
-            f32 GetCharacterWidth(Core::UTF8Char in_character, const FontCSPtr& in_font, f32 in_absCharSpacingOffset, f32 in_textScale)
+            struct LayoutCharacter
             {
-                Font::CharacterInfo charInfo;
-                if(in_font->TryGetCharacterInfo(in_character, charInfo) == true)
-                {
-                    return (charInfo.m_advance + in_absCharSpacingOffset) * in_textScale;
-                }
-
-                return 0.0f;
-            }
+                u32 m_characterIndex = 0;
+                f32 m_width = 0.0f;
+                f32 m_nextWordWidth = 0.0f;
+                bool m_isInFont = false;
+                bool m_isBreakable = false;
+                bool m_isNewLine = false;
+            };
+            //----------------------------------------------------------------------------
+            /// A single line of laid out text, described by the range of layout
+            /// characters it contains.
+            //----------------------------------------------------------------------------
+            struct LayoutLine
+            {
+                u32 m_start = 0;
+                u32 m_end = 0;
+            };
             //----------------------------------------------------------------------------
             /// @author S Downie
             ///
@@ -98,146 +106,223 @@ namespace ChilliSource
                 return in_character == ' ' || in_character == '\t' || in_character == '\n' || in_character == '-';
             }
             //----------------------------------------------------------------------------
-            /// Calculate the distance in text space to the next 'breakable' character
+            /// Decodes the given text into layout characters, looking each up in the
+            /// font only once. The width of the word following each breakable character
+            /// is also calculated, allowing the lines to be broken in a single pass
+            /// without scanning ahead.
             ///
-            /// @author S Downie
-            ///
-            /// @param Iterator pointing to start
-            /// @param Iterator pointing to end
+            /// @param Text (UTF-8)
             /// @param Font
             /// @param The absolute character spacing offset.
             /// @param The text scale factor.
+            /// @param [Out] The layout characters.
             //----------------------------------------------------------------------------
-            f32 CalculateDistanceToNextBreak(std::string::const_iterator in_itStart, std::string::const_iterator in_itEnd, const FontCSPtr& in_font, f32 in_absCharSpacingOffset, f32 in_textScale)
+            void DecodeText(const std::string& in_text, const FontCSPtr& in_font, f32 in_absCharSpacingOffset, f32 in_textScale, std::vector<LayoutCharacter>& out_characters)
             {
-                f32 totalWidth = 0.0f;
+                out_characters.reserve(in_text.size());
+                
+                bool hasPreviousBreak = false;
+                u32 previousBreakIndex = 0;
+                f32 wordWidth = 0.0f;
                 
-                while(in_itStart < in_itEnd)
-                {
-                    auto nextCharacter = Core::UTF8StringUtils::Next(in_itStart);
-                    if (IsBreakableCharacter(nextCharacter) == true)
-                    {
-                        break;
-                    }
-                    
-                    totalWidth += GetCharacterWidth(nextCharacter, in_font, in_absCharSpacingOffset, in_textScale);
-                }
-
-                return totalWidth;
-            }
-            //----------------------------------------------------------------------------
-            /// Split the given text into lines based on any '\n' characters. The newline
-            /// characters do not appear in the returned lines
-            ///
-            /// @author S Downie
-            ///
-            /// @param Text (UTF-8)
-            /// @param [Out] Array of lines split by '\n'
-            //----------------------------------------------------------------------------
-            void SplitByNewLine(const std::string& in_text, std::vector<std::string>& out_lines)
-            {
                 auto it = in_text.begin();
-                std::string line;
                 while(it < in_text.end())
                 {
                     auto character = Core::UTF8StringUtils::Next(it);
-
-                    if(character != '\n')
+                    
+                    LayoutCharacter layoutCharacter;
+                    layoutCharacter.m_isInFont = in_font->TryGetCharacterIndex(character, layoutCharacter.m_characterIndex);
+                    layoutCharacter.m_isBreakable = IsBreakableCharacter(character);
+                    layoutCharacter.m_isNewLine = (character == '\n');
+                    
+                    if(layoutCharacter.m_isInFont == true)
+                    {
+                        layoutCharacter.m_width = (in_font->GetCharacterInfo(layoutCharacter.m_characterIndex).m_advance + in_absCharSpacingOffset) * in_textScale;
+                    }
+                    
+                    if(layoutCharacter.m_isBreakable == true)
                     {
-                        Core::UTF8StringUtils::Append(character, line);
+                        if(hasPreviousBreak == true)
+                        {
+                            out_characters[previousBreakIndex].m_nextWordWidth = wordWidth;
+                        }
+                        
+                        //Words never continue on from a new line so there is no need to track the width following it.
+                        hasPreviousBreak = (layoutCharacter.m_isNewLine == false);
+                        previousBreakIndex = (u32)out_characters.size();
+                        wordWidth = 0.0f;
                     }
                     else
                     {
-                        out_lines.push_back(line);
-                        line.clear();
+                        wordWidth += layoutCharacter.m_width;
                     }
+                    
+                    out_characters.push_back(layoutCharacter);
                 }
-
-                if(line.size() > 0)
+                
+                if(hasPreviousBreak == true)
                 {
-                    out_lines.push_back(line);
+                    out_characters[previousBreakIndex].m_nextWordWidth = wordWidth;
                 }
             }
             //----------------------------------------------------------------------------
-            /// Split the given text into lines based on the constrained bounds.
-            /// Splits will prefer to happen on breakable whitespace characters but
-            /// will split mid-word if neccessary.
-            ///
-            /// @author S Downie
+            /// Splits the layout characters into lines based on any '\n' characters and
+            /// the constrained bounds, in a single pass. Splits on the bounds will prefer
+            /// to happen on breakable whitespace characters but will split mid-word if
+            /// neccessary. The newline characters, and any breakable characters at the
+            /// point a line is wrapped, do not appear in the returned lines.
             ///
-            /// @param Text (UTF-8)
-            /// @param Font
-            /// @param Text scale
-            /// @param The absolute character spacing offset.
-            /// @param Bounds
-            /// @param [Out] Array of lines split to fit in bounds
+            /// @param Layout characters
+            /// @param Max line width
+            /// @param [Out] Array of lines
             //----------------------------------------------------------------------------
-            void SplitByBounds(const std::string& in_text, const FontCSPtr& in_font, f32 in_absCharSpacingOffset, f32 in_textScale, const Core::Vector2& in_bounds, std::vector<std::string>& out_lines)
+            void BreakLines(const std::vector<LayoutCharacter>& in_characters, f32 in_maxLineWidth, std::vector<LayoutLine>& out_lines)
             {
-                f32 maxLineWidth = in_bounds.x;
-
-                auto it = in_text.begin();
-                std::string line;
+                const u32 numCharacters = (u32)in_characters.size();
+                
+                LayoutLine line;
                 f32 currentLineWidth = 0.0f;
-
-                while(it < in_text.end())
+                
+                u32 index = 0;
+                while(index < numCharacters)
                 {
-                    auto character = Core::UTF8StringUtils::Next(it);
-                    u32 characterWidth = GetCharacterWidth(character, in_font, in_absCharSpacingOffset, in_textScale);
+                    const LayoutCharacter& character = in_characters[index];
+                    
+                    if(character.m_isNewLine == true)
+                    {
+                        line.m_end = index;
+                        if(line.m_end > line.m_start)
+                        {
+                            out_lines.push_back(line);
+                        }
+                        
+                        ++index;
+                        line.m_start = index;
+                        currentLineWidth = 0.0f;
+                        continue;
+                    }
                     
                     //If we come across a character on which we can wrap we need
-                    //to check ahead to see if the next space is within the bounds or
-                    //whether we need to wrap now
-                    if(IsBreakableCharacter(character) == true)
+                    //to check whether the next breakable character is within the bounds
+                    //or whether we need to wrap now
+                    if(character.m_isBreakable == true)
                     {
-                        f32 nextBreakWidth = currentLineWidth + characterWidth + CalculateDistanceToNextBreak(it, in_text.end(), in_font, in_absCharSpacingOffset, in_textScale);
-
-                        if(nextBreakWidth >= maxLineWidth && line.size() > 0)
+                        if(currentLineWidth + character.m_width + character.m_nextWordWidth >= in_maxLineWidth && index > line.m_start)
                         {
+                            line.m_end = index;
                             out_lines.push_back(line);
-                            line.clear();
                             currentLineWidth = 0.0f;
                             
                             //since we've broken mid line we don't want to start the next line with
-                            //whitespace. To ensure this we want to jump the cursor forward to find
-                            //the next non-breakable character.
-                            auto nextIt = it;
-                            Core::UTF8Char nextCharacter = Core::UTF8StringUtils::Next(nextIt);
-                            while (IsBreakableCharacter(nextCharacter) == true)
+                            //whitespace. To ensure this we want to jump forward to find the next
+                            //non-breakable character.
+                            ++index;
+                            while(index < numCharacters && in_characters[index].m_isBreakable == true && in_characters[index].m_isNewLine == false)
                             {
-                                it = nextIt;
-                                nextCharacter = Core::UTF8StringUtils::Next(nextIt);
+                                ++index;
                             }
                             
+                            line.m_start = index;
                             continue;
                         }
                     }
                     
                     //If this is not a breakable character, but it is still beyond the bounds
                     //then wrap anyway, even though we are mid word.
-                    else if((currentLineWidth + characterWidth) >= maxLineWidth)
+                    else if((currentLineWidth + character.m_width) >= in_maxLineWidth)
                     {
+                        line.m_end = index;
                         out_lines.push_back(line);
-                        line.clear();
+                        line.m_start = index;
                         currentLineWidth = 0.0f;
                     }
                     
-                    currentLineWidth += characterWidth;
-                    Core::UTF8StringUtils::Append(character, line);
+                    currentLineWidth += character.m_width;
+                    ++index;
                 }
-
-                if(line.size() > 0)
+                
+                line.m_end = index;
+                if(line.m_end > line.m_start)
                 {
                     out_lines.push_back(line);
                 }
             }
             //----------------------------------------------------------------------------
+            /// Makes room for an ellipsis at the end of the given line of text without
+            /// increasing the width of the line beyond the given length. If required,
+            /// characters will be removed from the end of the line.
+            ///
+            /// If the font doesn't contain '.' the line will be left unchanged.
+            ///
+            /// @param The layout characters.
+            /// @param The font the text will be renderered with.
+            /// @param The absolute pixel offset to regular character spacing.
+            /// @param The text scale factor.
+            /// @param The maximum pixel width of the text.
+            /// @param [In/Out] The line to add the ellipsis to.
+            ///
+            /// @return The number of '.' characters which should be appended to the line.
+            //----------------------------------------------------------------------------
+            u32 AddEllipsis(const std::vector<LayoutCharacter>& in_characters, const FontCSPtr& in_font, f32 in_absCharSpacingOffset, f32 in_textScale, f32 in_maxTextWidth, LayoutLine& inout_line)
+            {
+                const u32 k_numDots = 3;
+                
+                //Check the font contains '.' for building the ellipsis.
+                u32 dotIndex = 0;
+                if (in_font->TryGetCharacterIndex((Core::UTF8Char)'.', dotIndex) == false)
+                {
+                    return 0;
+                }
+                
+                //get the width of an ellipsis
+                f32 dotWidth = (in_font->GetCharacterInfo(dotIndex).m_advance + in_absCharSpacingOffset) * in_textScale;
+                f32 ellipsisWidth = dotWidth * k_numDots;
+                
+                //if there is space for some of the text and the ellipsis, then shorten the line to fit.
+                if (in_maxTextWidth > ellipsisWidth)
+                {
+                    f32 currentLineWidth = 0.0f;
+                    u32 lineEnd = inout_line.m_start;
+                    while(lineEnd < inout_line.m_end)
+                    {
+                        currentLineWidth += in_characters[lineEnd].m_width;
+                        if (currentLineWidth > in_maxTextWidth - ellipsisWidth)
+                        {
+                            break;
+                        }
+                        
+                        ++lineEnd;
+                    }
+                    
+                    inout_line.m_end = lineEnd;
+                    return k_numDots;
+                }
+                
+                //otherwise don't bother trying to use the line and just build the ellipsis.
+                inout_line.m_end = inout_line.m_start;
+                
+                u32 numDots = 0;
+                f32 currentLineWidth = 0.0f;
+                for (u32 i = 0; i < k_numDots; ++i)
+                {
+                    currentLineWidth += dotWidth;
+                    if (currentLineWidth > in_maxTextWidth)
+                    {
+                        break;
+                    }
+                    
+                    ++numDots;
+                }
+                
+                return numDots;
+            }
+            //----------------------------------------------------------------------------
             /// Create the data required to display a character. This includes
             /// the size, UV and position.
             ///
             /// @author S Downie
             ///
-            /// @param Character
+            /// @param Character info
             /// @param Font
             /// @param Current cursor X pos
             /// @param Current cursor Y pos
@@ -246,23 +331,15 @@ namespace ChilliSource
             ///
             /// @return Display characer info
             //----------------------------------------------------------------------------
-            CanvasRenderer::DisplayCharacterInfo BuildCharacter(Core::UTF8Char in_character, const FontCSPtr& in_font, f32 in_cursorX, f32 in_cursorY, f32 in_textScale, f32 in_absCharSpacingOffset)
+            CanvasRenderer::DisplayCharacterInfo BuildCharacter(const Font::CharacterInfo& in_info, const FontCSPtr& in_font, f32 in_cursorX, f32 in_cursorY, f32 in_textScale, f32 in_absCharSpacingOffset)
             {
                 CanvasRenderer::DisplayCharacterInfo result;
 
-                Font::CharacterInfo info;
-                if(in_font->TryGetCharacterInfo(in_character, info) == true)
-                {
-                    result.m_UVs = info.m_UVs;
-                    result.m_advance = ((info.m_advance + in_absCharSpacingOffset) * in_textScale);
-                    result.m_packedImageSize = info.m_size * in_textScale;
-                    result.m_position.x = in_cursorX + (info.m_offset.x - info.m_origin) * in_textScale;
-                    result.m_position.y = in_cursorY - (info.m_offset.y - in_font->GetVerticalPadding()) * in_textScale;
-                }
-                else
-                {
-                    CS_LOG_ERROR("Unknown character not provided by font: " + in_font->GetName());
-                }
+                result.m_UVs = in_info.m_UVs;
+                result.m_advance = ((in_info.m_advance + in_absCharSpacingOffset) * in_textScale);
+                result.m_packedImageSize = in_info.m_size * in_textScale;
+                result.m_position.x = in_cursorX + (in_info.m_offset.x - in_info.m_origin) * in_textScale;
+                result.m_position.y = in_cursorY - (in_info.m_offset.y - in_font->GetVerticalPadding()) * in_textScale;
 
                 return result;
             }
@@ -275,7 +352,7 @@ namespace ChilliSource
             /// @param Horizontal justification
             /// @param Bounds width
             /// @param Index of the first character in a line
-            /// @param Index of the last character in a line
+            /// @param Index one past the last character in a line
             /// @param Line width in text space.
             /// @param [In/Out] List of display character infos that will be manipulated.
             ///         These are the charcters for all lines.
@@ -298,7 +375,7 @@ namespace ChilliSource
                         break;
                 }
 
-                for(u32 i = in_lineStartIdx; i <= in_lineEndIdx; ++i)
+                for(u32 i = in_lineStartIdx; i < in_lineEndIdx; ++i)
                 {
                     inout_characters[i].m_position.x += horizontalOffset;
                 }
@@ -412,82 +489,6 @@ namespace ChilliSource
                 out_sprite.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vPos.z = -k_nearClipDistance;
                 out_sprite.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vPos.w = 1.0f;
             }
-            //----------------------------------------------------------------------------
-            /// Adds an ellipsis to the end of the line of text without increasing the
-            /// width of the line of text beyond the given length. If required, characters
-            /// will be removed from the string.
-            ///
-            /// If the font doesn't contain '.' the original string will simply be returned.
-            ///
-            /// @author Ian Copland
-            ///
-            /// @param The string to add the ellipsis to.
-            /// @param The font the string will be renderered with.
-            /// @param The absolute pixel offset to regular character spacing.
-            /// @param The text scale factor.
-            /// @param The maximum pixel width of the text.
-            ///
-            /// @return The output string with ellipsis
-            //----------------------------------------------------------------------------
-            std::string AppendEllipsis(const std::string& in_text, const FontCSPtr& in_font, f32 in_absCharSpacingOffset, f32 in_textScale, f32 in_maxTextWidth)
-            {
-                const u32 k_numDots = 3;
-                
-                //Check the font contains '.' for building the ellipsis.
-                Font::CharacterInfo charInfo;
-                if (in_font->TryGetCharacterInfo((Core::UTF8Char)'.', charInfo) == false)
-                {
-                    return in_text;
-                }
-                
-                //get the width of an ellipsis
-                f32 dotWidth = GetCharacterWidth((Core::UTF8Char)'.', in_font, in_absCharSpacingOffset, in_textScale);
-                f32 ellipsisWidth = dotWidth * k_numDots;
-                
-                //if there is space for some of the text and the ellipsis, then calculate the output string.
-                std::string outputText;
-                if (in_maxTextWidth > ellipsisWidth)
-                {
-                    f32 currentLineWidth = 0.0f;
-                    auto it = in_text.begin();
-                    while(it < in_text.end())
-                    {
-                        auto character = Core::UTF8StringUtils::Next(it);
-                        
-                        currentLineWidth += GetCharacterWidth(character, in_font, in_absCharSpacingOffset, in_textScale);
-                        if (currentLineWidth > in_maxTextWidth - ellipsisWidth)
-                        {
-                            break;
-                        }
-                        
-                        Core::UTF8StringUtils::Append(character, outputText);
-                    }
-                    
-                    //append the ellipsis
-                    for (u32 i = 0; i < k_numDots; ++i)
-                    {
-                        Core::UTF8StringUtils::Append((Core::UTF8Char)'.', outputText);
-                    }
-                }
-                
-                //otherwise don't bother trying to use the input text and just build the ellipsis text.
-                else
-                {
-                    f32 currentLineWidth = 0.0f;
-                    for (u32 i = 0; i < k_numDots; ++i)
-                    {
-                        currentLineWidth += dotWidth;
-                        if (currentLineWidth > in_maxTextWidth)
-                        {
-                            break;
-                        }
-                        
-                        Core::UTF8StringUtils::Append((Core::UTF8Char)'.', outputText);
-                    }
-                }
-                
-                return outputText;
-            }
         }
 
         CS_DEFINE_NAMEDTYPE(CanvasRenderer);
@@ -514,13 +515,13 @@ namespace ChilliSource
             m_resourcePool = Core::Application::Get()->GetResourcePool();
             CS_ASSERT(m_resourcePool != nullptr, "Must have a resource pool");
 
-            RenderSystem* renderSystem = Core::Application::Get()->GetRenderSystem();
-            CS_ASSERT(renderSystem != nullptr, "Canvas renderer cannot find render system");
+            m_renderSystem = Core::Application::Get()->GetRenderSystem();
+            CS_ASSERT(m_renderSystem != nullptr, "Canvas renderer cannot find render system");
 
             m_screen = Core::Application::Get()->GetSystem<Core::Screen>();
             CS_ASSERT(m_screen != nullptr, "Canvas renderer cannot find screen system");
 
-            m_overlayBatcher = DynamicSpriteBatchUPtr(new DynamicSpriteBatch(renderSystem));
+            m_overlayBatcher = DynamicSpriteBatchUPtr(new DynamicSpriteBatch(m_renderSystem));
         }
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
@@ -556,9 +557,21 @@ namespace ChilliSource
 		//----------------------------------------------------------
 		void CanvasRenderer::Render(UI::Canvas* in_canvas)
 		{
+            CS_PROFILE_SCOPE("CanvasRenderer::Render");
+            
 			CS_ASSERT(in_canvas != nullptr, "Canvas cannot render null UI canvas");
 
-            in_canvas->Draw(this);
+            if (m_builtCanvas != in_canvas || in_canvas->IsDrawCacheValid() == false)
+            {
+                BuildCanvas(in_canvas);
+            }
+
+            RenderCanvas();
+
+            if (m_isRenderStatsOverlayEnabled == true)
+            {
+                DrawRenderStatsOverlay(in_canvas);
+            }
 
 			m_overlayBatcher->DisableScissoring();
 			m_overlayBatcher->ForceRender();
@@ -568,6 +581,217 @@ namespace ChilliSource
 		}
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
+        void CanvasRenderer::BuildCanvas(UI::Canvas* in_canvas)
+        {
+            CS_PROFILE_SCOPE("CanvasRenderer::BuildCanvas");
+
+            m_canvasVertices.clear();
+            m_canvasCommands.clear();
+
+            m_isBuildingCanvas = true;
+            in_canvas->Draw(this);
+            m_isBuildingCanvas = false;
+
+            //Upload the merged geometry, splitting it over as many batches as are required.
+            const u32 numSprites = m_canvasVertices.size() / k_numSpriteVerts;
+            const u32 numBatches = (numSprites + k_maxSpritesPerCanvasBatch - 1) / k_maxSpritesPerCanvasBatch;
+            while (m_canvasBatches.size() < numBatches)
+            {
+                m_canvasBatches.push_back(SpriteBatchUPtr(new SpriteBatch(k_maxSpritesPerCanvasBatch, m_renderSystem, BufferUsage::k_dynamic)));
+            }
+
+            for (u32 i = 0; i < numBatches; ++i)
+            {
+                const u32 firstSprite = i * k_maxSpritesPerCanvasBatch;
+                const u32 numBatchSprites = std::min(k_maxSpritesPerCanvasBatch, numSprites - firstSprite);
+                m_canvasBatches[i]->Build(&m_canvasVertices[firstSprite * k_numSpriteVerts], numBatchSprites);
+            }
+
+            m_builtCanvas = in_canvas;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void CanvasRenderer::RenderCanvas()
+        {
+            RenderStats& renderStats = m_renderSystem->GetRenderStats();
+            bool wasLastCommandDraw = false;
+
+            for (const auto& command : m_canvasCommands)
+            {
+                switch (command.m_type)
+                {
+                    case CommandType::k_draw:
+                    {
+                        //Adjacent draw commands are only ever split by a change of material
+                        if (wasLastCommandDraw == true)
+                        {
+                            renderStats.RecordSpriteBatchBreak(RenderStats::SpriteBatchBreak::k_materialChange);
+                        }
+
+                        u32 firstSprite = command.m_firstSprite;
+                        u32 numSpritesRemaining = command.m_numSprites;
+                        while (numSpritesRemaining > 0)
+                        {
+                            const u32 batchIndex = firstSprite / k_maxSpritesPerCanvasBatch;
+                            const u32 firstSpriteInBatch = firstSprite % k_maxSpritesPerCanvasBatch;
+                            const u32 numSpritesInBatch = std::min(numSpritesRemaining, k_maxSpritesPerCanvasBatch - firstSpriteInBatch);
+
+                            m_canvasBatches[batchIndex]->Render(command.m_material, firstSpriteInBatch * k_numSpriteIndices * sizeof(u16), numSpritesInBatch * k_numSpriteIndices);
+
+                            firstSprite += numSpritesInBatch;
+                            numSpritesRemaining -= numSpritesInBatch;
+                            if (numSpritesRemaining > 0)
+                            {
+                                renderStats.RecordSpriteBatchBreak(RenderStats::SpriteBatchBreak::k_bufferFull);
+                            }
+                        }
+
+                        wasLastCommandDraw = true;
+                        break;
+                    }
+                    case CommandType::k_scissorOn:
+                        if (wasLastCommandDraw == true)
+                        {
+                            renderStats.RecordSpriteBatchBreak(RenderStats::SpriteBatchBreak::k_scissorChange);
+                        }
+                        m_renderSystem->EnableScissorTesting(true);
+                        m_renderSystem->SetScissorRegion(command.m_scissorPosition, command.m_scissorSize);
+                        wasLastCommandDraw = false;
+                        break;
+                    case CommandType::k_scissorOff:
+                        if (wasLastCommandDraw == true)
+                        {
+                            renderStats.RecordSpriteBatchBreak(RenderStats::SpriteBatchBreak::k_scissorChange);
+                        }
+                        m_renderSystem->EnableScissorTesting(false);
+                        wasLastCommandDraw = false;
+                        break;
+                }
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void CanvasRenderer::BeginDrawCache(CanvasDrawCache* in_drawCache)
+        {
+            CS_ASSERT(in_drawCache != nullptr, "Cannot capture into a null draw cache.");
+            CS_ASSERT(m_activeDrawCache == nullptr, "Cannot begin a draw cache while another is being captured.");
+
+            m_activeDrawCache = in_drawCache;
+            m_activeDrawCache->m_vertices.clear();
+            m_activeDrawCache->m_runs.clear();
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void CanvasRenderer::EndDrawCache()
+        {
+            CS_ASSERT(m_activeDrawCache != nullptr, "Cannot end a draw cache that was never begun.");
+
+            m_activeDrawCache = nullptr;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void CanvasRenderer::DrawCached(const CanvasDrawCache& in_drawCache)
+        {
+            CS_ASSERT(m_activeDrawCache == nullptr, "Cannot draw a draw cache while one is being captured.");
+
+            if (m_isBuildingCanvas == true)
+            {
+                u32 firstSprite = m_canvasVertices.size() / k_numSpriteVerts;
+                for (const auto& run : in_drawCache.m_runs)
+                {
+                    if (m_canvasCommands.empty() == false && m_canvasCommands.back().m_type == CommandType::k_draw && m_canvasCommands.back().m_material == run.m_material)
+                    {
+                        m_canvasCommands.back().m_numSprites += run.m_numSprites;
+                    }
+                    else
+                    {
+                        CanvasCommand command;
+                        command.m_type = CommandType::k_draw;
+                        command.m_material = run.m_material;
+                        command.m_firstSprite = firstSprite;
+                        command.m_numSprites = run.m_numSprites;
+                        m_canvasCommands.push_back(command);
+                    }
+
+                    firstSprite += run.m_numSprites;
+                }
+
+                m_canvasVertices.insert(m_canvasVertices.end(), in_drawCache.m_vertices.begin(), in_drawCache.m_vertices.end());
+            }
+            else
+            {
+                const SpriteBatch::SpriteVertex* vertices = in_drawCache.m_vertices.data();
+                for (const auto& run : in_drawCache.m_runs)
+                {
+                    u32 numSpritesRemaining = run.m_numSprites;
+                    while (numSpritesRemaining > 0)
+                    {
+                        SpriteBatch::SpriteVertex* batchVertices = nullptr;
+                        u32 numReserved = m_overlayBatcher->ReserveSprites(run.m_material, numSpritesRemaining, batchVertices);
+                        std::copy(vertices, vertices + numReserved * k_numSpriteVerts, batchVertices);
+
+                        vertices += numReserved * k_numSpriteVerts;
+                        numSpritesRemaining -= numReserved;
+                    }
+                }
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void CanvasRenderer::AddSprite(const SpriteBatch::SpriteData& in_sprite)
+        {
+            if (m_activeDrawCache != nullptr)
+            {
+                auto& runs = m_activeDrawCache->m_runs;
+                if (runs.empty() == true || runs.back().m_material != in_sprite.pMaterial)
+                {
+                    CanvasDrawCache::Run run;
+                    run.m_material = in_sprite.pMaterial;
+                    runs.push_back(run);
+                }
+
+                ++runs.back().m_numSprites;
+                m_activeDrawCache->m_vertices.insert(m_activeDrawCache->m_vertices.end(), std::begin(in_sprite.sVerts), std::end(in_sprite.sVerts));
+            }
+            else
+            {
+                m_overlayBatcher->Render(in_sprite);
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void CanvasRenderer::EnableScissoring(const Core::Vector2& in_position, const Core::Vector2& in_size)
+        {
+            if (m_isBuildingCanvas == true)
+            {
+                CanvasCommand command;
+                command.m_type = CommandType::k_scissorOn;
+                command.m_scissorPosition = in_position;
+                command.m_scissorSize = in_size;
+                m_canvasCommands.push_back(command);
+            }
+            else
+            {
+                m_overlayBatcher->EnableScissoring(in_position, in_size);
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void CanvasRenderer::DisableScissoring()
+        {
+            if (m_isBuildingCanvas == true)
+            {
+                CanvasCommand command;
+                command.m_type = CommandType::k_scissorOff;
+                m_canvasCommands.push_back(command);
+            }
+            else
+            {
+                m_overlayBatcher->DisableScissoring();
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
         void CanvasRenderer::PushClipBounds(const Core::Vector2& in_blPosition, const Core::Vector2& in_size)
         {
             if(m_scissorPositions.empty())
@@ -597,7 +821,7 @@ namespace ChilliSource
                 m_scissorSizes.push_back(vNewSize);
             }
 
-            m_overlayBatcher->EnableScissoring(m_scissorPositions.back(), m_scissorSizes.back());
+            EnableScissoring(m_scissorPositions.back(), m_scissorSizes.back());
         }
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
@@ -610,13 +834,13 @@ namespace ChilliSource
 
                 if(!m_scissorPositions.empty())
                 {
-                    m_overlayBatcher->EnableScissoring(m_scissorPositions.back(), m_scissorSizes.back());
+                    EnableScissoring(m_scissorPositions.back(), m_scissorSizes.back());
                 }
             }
 
             if(m_scissorPositions.empty())
             {
-                m_overlayBatcher->DisableScissoring();
+                DisableScissoring();
             }
         }
         //----------------------------------------------------------------------------
@@ -628,7 +852,7 @@ namespace ChilliSource
 
 			UpdateSpriteData(Convert2DTransformTo3D(in_transform), in_size, in_offset, in_UVs, in_colour, in_anchor, m_canvasSprite);
 
-			m_overlayBatcher->Render(m_canvasSprite);
+			AddSprite(m_canvasSprite);
         }
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
@@ -646,38 +870,36 @@ namespace ChilliSource
             
             result.m_characters.reserve(in_text.size());
 
+            //Decode the text into characters from the font once, up front, so that nothing below needs to
+            //decode the string or look characters up again.
+            std::vector<LayoutCharacter> characters;
+            DecodeText(in_text, in_font, in_properties.m_absCharSpacingOffset, in_properties.m_textScale, characters);
+
             //NOTE: | denotes the bounds of the box
             //- |The quick brown fox| jumped over\nthe ferocious honey badger
 
-            //Split the string into lines by the forced line breaks (i.e. the \n)
-            //- |The quick brown fox| jumped over
-            //- |the ferocious honey| badger
-            std::vector<std::string> linesOnNewLine;
-            SplitByNewLine(in_text, linesOnNewLine);
-
-            //Split the lines further based on the line width, breakable characters and the bounds
+            //Split the text into lines by the forced line breaks (i.e. the \n), the line width, breakable
+            //characters and the bounds
             //- |The quick brown fox|
             //- |jumped over        |
             //- |the ferocious honey|
             //- |badger             |
-            std::vector<std::string> linesOnBounds;
-            for(const auto& line : linesOnNewLine)
-            {
-                SplitByBounds(line, in_font, in_properties.m_absCharSpacingOffset, in_properties.m_textScale, in_bounds, linesOnBounds);
-            }
+            std::vector<LayoutLine> lines;
+            BreakLines(characters, in_bounds.x, lines);
 
             //Only build as many lines as we have been told to. If ZERO is specified
             //this means build all lines. We are also constrained by the size of the bounds
-            u32 numLines = (in_properties.m_maxNumLines == 0) ? linesOnBounds.size() : std::min((u32)linesOnBounds.size(), in_properties.m_maxNumLines);
+            u32 numLines = (in_properties.m_maxNumLines == 0) ? lines.size() : std::min((u32)lines.size(), in_properties.m_maxNumLines);
 
             f32 lineHeight = in_properties.m_lineSpacingScale * ((in_font->GetLineHeight() + in_properties.m_absLineSpacingOffset) * in_properties.m_textScale);
             f32 maxHeight = in_bounds.y;
             numLines = std::min(numLines, (u32)(maxHeight/lineHeight));
 
             //add an ellipsis if the text doesn't fit.
-            if (linesOnBounds.size() > numLines && numLines > 0)
+            u32 numEllipsisDots = 0;
+            if (lines.size() > numLines && numLines > 0)
             {
-                linesOnBounds[numLines-1] = AppendEllipsis(linesOnBounds[numLines-1], in_font, in_properties.m_absCharSpacingOffset, in_properties.m_textScale, in_bounds.x);
+                numEllipsisDots = AddEllipsis(characters, in_font, in_properties.m_absCharSpacingOffset, in_properties.m_textScale, in_bounds.x, lines[numLines-1]);
             }
             
             //The middle of the text label is 0,0. We want to be starting at the top left.
@@ -689,11 +911,16 @@ namespace ChilliSource
             {
                 u32 lineStartIdx = result.m_characters.size();
 
-                auto characterIt = linesOnBounds[lineIdx].begin();
-                while(characterIt != linesOnBounds[lineIdx].end())
+                for(u32 characterIdx = lines[lineIdx].m_start; characterIdx < lines[lineIdx].m_end; ++characterIdx)
                 {
-                    auto character = Core::UTF8StringUtils::Next(characterIt);
-                    auto builtCharacter(BuildCharacter(character, in_font, cursorX, cursorY, in_properties.m_textScale, in_properties.m_absCharSpacingOffset));
+                    const LayoutCharacter& character = characters[characterIdx];
+                    if(character.m_isInFont == false)
+                    {
+                        CS_LOG_ERROR("Unknown character not provided by font: " + in_font->GetName());
+                        continue;
+                    }
+                    
+                    auto builtCharacter(BuildCharacter(in_font->GetCharacterInfo(character.m_characterIndex), in_font, cursorX, cursorY, in_properties.m_textScale, in_properties.m_absCharSpacingOffset));
                     
                     cursorX += builtCharacter.m_advance;
                     
@@ -703,9 +930,23 @@ namespace ChilliSource
                         result.m_characters.push_back(builtCharacter);
                     }
                 }
+                
+                if(lineIdx == numLines - 1 && numEllipsisDots > 0)
+                {
+                    u32 dotIndex = 0;
+                    in_font->TryGetCharacterIndex((Core::UTF8Char)'.', dotIndex);
+                    const Font::CharacterInfo& dotInfo = in_font->GetCharacterInfo(dotIndex);
+                    
+                    for(u32 i = 0; i < numEllipsisDots; ++i)
+                    {
+                        auto builtCharacter(BuildCharacter(dotInfo, in_font, cursorX, cursorY, in_properties.m_textScale, in_properties.m_absCharSpacingOffset));
+                        cursorX += builtCharacter.m_advance;
+                        result.m_characters.push_back(builtCharacter);
+                    }
+                }
 
                 f32 lineWidth = cursorX - cursorXReturnPos;
-                ApplyHorizontalTextJustifications(in_properties.m_horizontalJustification, in_bounds.x, lineStartIdx, result.m_characters.size() - 1, lineWidth, result.m_characters);
+                ApplyHorizontalTextJustifications(in_properties.m_horizontalJustification, in_bounds.x, lineStartIdx, result.m_characters.size(), lineWidth, result.m_characters);
 
                 result.m_width = std::max(lineWidth, result.m_width);
 
@@ -731,14 +972,55 @@ namespace ChilliSource
             {
                 matTransformedLocal = Core::Matrix4::CreateTranslation(Core::Vector3(character.m_position, 0.0f)) * matTransform;
                 UpdateSpriteData(matTransformedLocal, character.m_packedImageSize, Core::Vector2::k_zero, character.m_UVs, in_colour, AlignmentAnchor::k_topLeft, m_canvasSprite);
-                m_overlayBatcher->Render(m_canvasSprite);
+                AddSprite(m_canvasSprite);
 			}
 		}
         //----------------------------------------------------------------------------
         //----------------------------------------------------------------------------
+        void CanvasRenderer::SetRenderStatsOverlayEnabled(bool in_enabled)
+        {
+            m_isRenderStatsOverlayEnabled = in_enabled;
+
+            if (m_isRenderStatsOverlayEnabled == true && m_renderStatsOverlayFont == nullptr)
+            {
+                m_renderStatsOverlayFont = m_resourcePool->LoadResource<Font>(Core::StorageLocation::k_chilliSource, "Fonts/CarlitoMed.csfont");
+                CS_ASSERT(m_renderStatsOverlayFont != nullptr, "Could not load the render stats overlay font.");
+            }
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        bool CanvasRenderer::IsRenderStatsOverlayEnabled() const
+        {
+            return m_isRenderStatsOverlayEnabled;
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
+        void CanvasRenderer::DrawRenderStatsOverlay(UI::Canvas* in_canvas)
+        {
+            const f32 k_textScale = 0.5f;
+
+            TextProperties textProperties;
+            textProperties.m_textScale = k_textScale;
+            textProperties.m_horizontalJustification = HorizontalTextJustification::k_left;
+            textProperties.m_verticalJustification = VerticalTextJustification::k_top;
+
+            //Text is built around the centre of its bounds, so the bounds are positioned in the top left of the canvas.
+            const Core::Vector2 bounds(in_canvas->GetSize().x, in_canvas->GetSize().y * 0.5f);
+            const Core::Matrix3 transform = Core::Matrix3::CreateTranslation(Core::Vector2(bounds.x * 0.5f, in_canvas->GetSize().y - bounds.y * 0.5f));
+
+            BuiltText builtText = BuildText(m_renderSystem->GetRenderStats().GetLastFrameSummary(), m_renderStatsOverlayFont, bounds, textProperties);
+            DrawText(builtText.m_characters, transform, Core::Colour::k_white, m_renderStatsOverlayFont->GetTexture());
+        }
+        //----------------------------------------------------------------------------
+        //----------------------------------------------------------------------------
         void CanvasRenderer::OnDestroy()
         {
+            m_renderStatsOverlayFont = nullptr;
             m_overlayBatcher = nullptr;
+            m_canvasBatches.clear();
+            m_canvasCommands.clear();
+            m_canvasVertices.clear();
+            m_builtCanvas = nullptr;
             m_materialGUICache.clear();
             m_canvasSprite.pMaterial = nullptr;
         }
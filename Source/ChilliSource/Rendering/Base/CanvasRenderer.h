@@ -32,12 +32,14 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
 #include <ChilliSource/Core/System/AppSystem.h>
+#include <ChilliSource/Rendering/Base/CanvasDrawCache.h>
 #include <ChilliSource/Rendering/Base/HorizontalTextJustification.h>
 #include <ChilliSource/Rendering/Base/VerticalTextJustification.h>
 #include <ChilliSource/Rendering/Sprite/DynamicSpriteBatcher.h>
 #include <ChilliSource/Rendering/Sprite/SpriteComponent.h>
 
 #include <unordered_map>
+#include <vector>
 
 namespace ChilliSource
 {
@@ -104,10 +106,34 @@ namespace ChilliSource
             //----------------------------------------------------------
 			/// Render
 			///
-			/// Draw UI
+			/// Draw UI. The canvas geometry is retained between frames
+			/// and the widget hierarchy is only traversed when the
+			/// canvas reports that part of it has changed; otherwise
+			/// the previous frame's vertex buffers are re-submitted.
 			//----------------------------------------------------------
 			void Render(UI::Canvas* in_canvas);
             //----------------------------------------------------------------------------
+            /// Starts capturing into the given draw cache. Until EndDrawCache() is
+            /// called all boxes and text drawn will be stored in the cache rather than
+            /// rendered; the cache can then be drawn with DrawCached(). Any previous
+            /// contents of the cache are discarded. Clip bounds are not captured.
+            ///
+            /// @param The draw cache to fill.
+            //----------------------------------------------------------------------------
+            void BeginDrawCache(CanvasDrawCache* in_drawCache);
+            //----------------------------------------------------------------------------
+            /// Stops capturing into the current draw cache.
+            //----------------------------------------------------------------------------
+            void EndDrawCache();
+            //----------------------------------------------------------------------------
+            /// Draws the contents of a previously captured draw cache. While the canvas
+            /// is being built this is merged into the canvas vertex buffer with a single
+            /// copy.
+            ///
+            /// @param The draw cache.
+            //----------------------------------------------------------------------------
+            void DrawCached(const CanvasDrawCache& in_drawCache);
+            //----------------------------------------------------------------------------
             /// Set the bounds beyond which any subviews will clip
             /// Pushes to a stack which tracks when to enable and
             /// disable scissoring
@@ -162,6 +188,17 @@ namespace ChilliSource
             /// @param Texture
             //----------------------------------------------------------------------------
 			void DrawText(const std::vector<DisplayCharacterInfo>& in_characters, const Core::Matrix3& in_transform, const Core::Colour& in_colour, const TextureCSPtr& in_texture);
+            //----------------------------------------------------------------------------
+            /// Sets whether or not the previous frame's render stats are drawn over the
+            /// top of the canvas. This is intended for debugging.
+            ///
+            /// @param Whether or not the overlay is enabled.
+            //----------------------------------------------------------------------------
+            void SetRenderStatsOverlayEnabled(bool in_enabled);
+            //----------------------------------------------------------------------------
+            /// @return Whether or not the render stats overlay is enabled.
+            //----------------------------------------------------------------------------
+            bool IsRenderStatsOverlayEnabled() const;
 
 		private:
 
@@ -201,8 +238,61 @@ namespace ChilliSource
             /// texture
             //----------------------------------------------------------------------------
             MaterialCSPtr GetGUIMaterialForTexture(const TextureCSPtr& in_texture);
+            //----------------------------------------------------------------------------
+            /// Draws the summary of the previous frame's render stats in the top left
+            /// of the canvas.
+            ///
+            /// @param The canvas being drawn.
+            //----------------------------------------------------------------------------
+            void DrawRenderStatsOverlay(UI::Canvas* in_canvas);
+            //----------------------------------------------------------------------------
+            /// Adds the given sprite to the draw cache that is currently being
+            /// captured, or to the overlay batch if there isn't one.
+            ///
+            /// @param The sprite.
+            //----------------------------------------------------------------------------
+            void AddSprite(const SpriteBatch::SpriteData& in_sprite);
+            //----------------------------------------------------------------------------
+            /// Enables scissoring in either the canvas commands or the overlay batch
+            /// depending on whether the canvas is currently being built.
+            ///
+            /// @param Bottom left position of the scissor rect.
+            /// @param Size of the scissor rect.
+            //----------------------------------------------------------------------------
+            void EnableScissoring(const Core::Vector2& in_position, const Core::Vector2& in_size);
+            //----------------------------------------------------------------------------
+            /// Disables scissoring in either the canvas commands or the overlay batch
+            /// depending on whether the canvas is currently being built.
+            //----------------------------------------------------------------------------
+            void DisableScissoring();
+            //----------------------------------------------------------------------------
+            /// Traverses the canvas, gathering the geometry of each widget into the
+            /// canvas vertex array, and uploads it to the canvas sprite batches.
+            ///
+            /// @param The canvas.
+            //----------------------------------------------------------------------------
+            void BuildCanvas(UI::Canvas* in_canvas);
+            //----------------------------------------------------------------------------
+            /// Renders the canvas sprite batches using the commands recorded the last
+            /// time the canvas was built.
+            //----------------------------------------------------------------------------
+            void RenderCanvas();
 
 		private:
+            //----------------------------------------------------------------------------
+            /// A retained draw or scissor command. Draw commands refer to a range of
+            /// sprites in the canvas vertex array, which may span more than one of the
+            /// canvas sprite batches.
+            //----------------------------------------------------------------------------
+            struct CanvasCommand
+            {
+                MaterialCSPtr m_material;
+                Core::Vector2 m_scissorPosition;
+                Core::Vector2 m_scissorSize;
+                u32 m_firstSprite = 0;
+                u32 m_numSprites = 0;
+                CommandType m_type = CommandType::k_draw;
+            };
             
 			SpriteBatch::SpriteData m_canvasSprite;
 
@@ -213,9 +303,20 @@ namespace ChilliSource
 
             std::unordered_map<TextureCSPtr, MaterialCSPtr> m_materialGUICache;
 
+            CanvasDrawCache* m_activeDrawCache = nullptr;
+            bool m_isBuildingCanvas = false;
+            const UI::Canvas* m_builtCanvas = nullptr;
+            std::vector<SpriteBatch::SpriteVertex> m_canvasVertices;
+            std::vector<CanvasCommand> m_canvasCommands;
+            std::vector<SpriteBatchUPtr> m_canvasBatches;
+
             Core::ResourcePool* m_resourcePool;
             Core::Screen* m_screen;
             MaterialFactory* m_materialFactory;
+            RenderSystem* m_renderSystem = nullptr;
+
+            bool m_isRenderStatsOverlayEnabled = false;
+            FontCSPtr m_renderStatsOverlayFont;
 		};
 	}
 }
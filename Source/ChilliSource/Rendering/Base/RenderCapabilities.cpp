@@ -30,6 +30,8 @@
 
 #if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_WINDOWS
 #include <CSBackend/Rendering/OpenGL/Base/RenderCapabilities.h>
+#elif defined CS_TARGETPLATFORM_LINUX
+#include <CSBackend/Rendering/Null/Base/RenderCapabilities.h>
 #endif
 
 namespace ChilliSource
@@ -44,6 +46,8 @@ namespace ChilliSource
         {
 #if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_WINDOWS
             return RenderCapabilitiesUPtr(new CSBackend::OpenGL::RenderCapabilities());
+#elif defined CS_TARGETPLATFORM_LINUX
+            return RenderCapabilitiesUPtr(new CSBackend::Null::RenderCapabilities());
 #else
             return nullptr;
 #endif
@@ -0,0 +1,150 @@
+//
+//  RenderSortUtils.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Base/RenderSortUtils.h>
+
+#include <ChilliSource/Core/Resource/Resource.h>
+#include <ChilliSource/Rendering/Base/RenderComponent.h>
+#include <ChilliSource/Rendering/Base/Renderer.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace ChilliSource
+{
+    namespace Rendering
+    {
+        namespace RenderSortUtils
+        {
+            namespace
+            {
+                const u32 k_numRadixPasses = sizeof(u64);
+                const u32 k_radixSize = 256;
+            }
+            //----------------------------------------------------------------------------------------
+            //----------------------------------------------------------------------------------------
+            u32 ToSortableBits(f32 in_value)
+            {
+                u32 bits = 0;
+                std::memcpy(&bits, &in_value, sizeof(bits));
+
+                //Positive floats order correctly as integers once the sign bit is set; negative
+                //floats order in reverse so all of their bits are flipped.
+                return (bits & 0x80000000) != 0 ? ~bits : (bits | 0x80000000);
+            }
+            //----------------------------------------------------------------------------------------
+            //----------------------------------------------------------------------------------------
+            u32 GetSortId(const Core::Resource* in_resource)
+            {
+                if (in_resource == nullptr)
+                {
+                    return 0;
+                }
+
+                u32 id = in_resource->GetId();
+                if (id == 0)
+                {
+                    //Resources created outside of the resource pool have no id. Fold the pointer,
+                    //ignoring the alignment bits, which is enough to keep them grouped.
+                    u64 address = (u64)reinterpret_cast<uintptr_t>(in_resource) >> 4;
+                    id = (u32)(address ^ (address >> 32));
+                }
+                return id;
+            }
+            //----------------------------------------------------------------------------------------
+            //----------------------------------------------------------------------------------------
+            f32 CalculateProjectedDepth(RenderComponent* in_renderable)
+            {
+                //The bounds are already in world space so only the z column of the view projection
+                //is needed.
+                const Core::Matrix4& viewProj = Renderer::matViewProjCache;
+                const Core::Vector3& centre = in_renderable->GetAABB().GetOrigin();
+                return centre.x * viewProj.m[2] + centre.y * viewProj.m[6] + centre.z * viewProj.m[10] + viewProj.m[14];
+            }
+            //----------------------------------------------------------------------------------------
+            //----------------------------------------------------------------------------------------
+            void RadixSort(std::vector<SortableRenderable>& inout_renderables, std::vector<SortableRenderable>& in_scratch)
+            {
+                const u32 numItems = inout_renderables.size();
+                if (numItems < 2)
+                {
+                    return;
+                }
+
+                //Build the histograms for every byte in a single pass over the keys
+                u32 counts[k_numRadixPasses][k_radixSize];
+                std::memset(counts, 0, sizeof(counts));
+                for (u32 i = 0; i < numItems; ++i)
+                {
+                    u64 key = inout_renderables[i].m_sortKey;
+                    for (u32 pass = 0; pass < k_numRadixPasses; ++pass)
+                    {
+                        ++counts[pass][(key >> (pass * 8)) & 0xff];
+                    }
+                }
+
+                in_scratch.resize(numItems);
+                SortableRenderable* source = inout_renderables.data();
+                SortableRenderable* destination = in_scratch.data();
+
+                for (u32 pass = 0; pass < k_numRadixPasses; ++pass)
+                {
+                    u32* passCounts = counts[pass];
+
+                    //If every key has the same value for this byte the pass wouldn't change the order
+                    const u32 firstDigit = (source[0].m_sortKey >> (pass * 8)) & 0xff;
+                    if (passCounts[firstDigit] == numItems)
+                    {
+                        continue;
+                    }
+
+                    u32 offset = 0;
+                    for (u32 digit = 0; digit < k_radixSize; ++digit)
+                    {
+                        u32 count = passCounts[digit];
+                        passCounts[digit] = offset;
+                        offset += count;
+                    }
+
+                    for (u32 i = 0; i < numItems; ++i)
+                    {
+                        const u32 digit = (source[i].m_sortKey >> (pass * 8)) & 0xff;
+                        destination[passCounts[digit]++] = source[i];
+                    }
+
+                    std::swap(source, destination);
+                }
+
+                //An odd number of passes leaves the result in the scratch buffer
+                if (source != inout_renderables.data())
+                {
+                    std::memcpy(inout_renderables.data(), source, numItems * sizeof(SortableRenderable));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,92 @@
+//
+//  RenderSortUtils.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_BASE_RENDERSORTUTILS_H_
+#define _CHILLISOURCE_RENDERING_BASE_RENDERSORTUTILS_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Rendering
+    {
+        //--------------------------------------------------------------------
+        /// A renderable paired with the packed sort key generated for it
+        /// by a sort predicate. Keys are sorted in ascending order.
+        //--------------------------------------------------------------------
+        struct SortableRenderable
+        {
+            u64 m_sortKey;
+            RenderComponent* m_renderable;
+        };
+        //--------------------------------------------------------------------
+        /// Utility methods for building packed sort keys and sorting
+        /// renderables by them.
+        //--------------------------------------------------------------------
+        namespace RenderSortUtils
+        {
+            //----------------------------------------------------------------------------------------
+            /// Converts the float to an unsigned integer which orders the same way as the float,
+            /// i.e if a < b then ToSortableBits(a) < ToSortableBits(b).
+            ///
+            /// @param Value
+            ///
+            /// @return Order preserving integer representation
+            //----------------------------------------------------------------------------------------
+            u32 ToSortableBits(f32 in_value);
+            //----------------------------------------------------------------------------------------
+            /// @param Resource. May be null.
+            ///
+            /// @return An id for the resource that is used to group renderables using the same
+            /// resource together. This is the resource id if it has one, otherwise it is derived
+            /// from the pointer. Null resources have an id of 0.
+            //----------------------------------------------------------------------------------------
+            u32 GetSortId(const Core::Resource* in_resource);
+            //----------------------------------------------------------------------------------------
+            /// @param Renderable
+            ///
+            /// @return The projected z of the centre of the renderable's world space bounds, using
+            /// the renderer's cached view projection matrix.
+            //----------------------------------------------------------------------------------------
+            f32 CalculateProjectedDepth(RenderComponent* in_renderable);
+            //----------------------------------------------------------------------------------------
+            /// Sorts the renderables in ascending order of sort key. This is a stable LSD radix sort
+            /// over the bytes of the key; passes over bytes that are the same for every key are
+            /// skipped, so keys which only use some of their bits are cheaper to sort.
+            ///
+            /// @param [In/Out] The renderables to sort.
+            /// @param Scratch buffer. This is resized as needed so can be reused between calls to
+            /// avoid allocating.
+            //----------------------------------------------------------------------------------------
+            void RadixSort(std::vector<SortableRenderable>& inout_renderables, std::vector<SortableRenderable>& in_scratch);
+        }
+    }
+}
+
+#endif
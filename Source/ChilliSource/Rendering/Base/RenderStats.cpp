@@ -0,0 +1,162 @@
+//
+//  RenderStats.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Base/RenderStats.h>
+
+namespace ChilliSource
+{
+    namespace Rendering
+    {
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderStats::RecordCameraCulling(u32 in_numGathered, u32 in_numHidden, u32 in_numCulled)
+        {
+            m_currentFrame.m_numRenderablesGathered += in_numGathered;
+            m_currentFrame.m_numRenderablesHidden += in_numHidden;
+            m_currentFrame.m_numRenderablesCameraCulled += in_numCulled;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderStats::RecordLightCulling(u32 in_numCulled)
+        {
+            m_currentFrame.m_numRenderablesLightCulled += in_numCulled;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderStats::RecordShadowCasters(u32 in_numShadowCasters)
+        {
+            m_currentFrame.m_numShadowCasters += in_numShadowCasters;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderStats::RecordDrawCall(u32 in_numVertices, u32 in_numIndices)
+        {
+            m_currentFrame.m_numDrawCalls++;
+            m_currentFrame.m_numVerticesDrawn += in_numVertices;
+            m_currentFrame.m_numIndicesDrawn += in_numIndices;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderStats::RecordMaterialChange()
+        {
+            m_currentFrame.m_numMaterialChanges++;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderStats::RecordShaderBind()
+        {
+            m_currentFrame.m_numShaderBinds++;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderStats::RecordTextureBind()
+        {
+            m_currentFrame.m_numTextureBinds++;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderStats::RecordStateChange()
+        {
+            m_currentFrame.m_numStateChanges++;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderStats::RecordRenderTargetPass()
+        {
+            m_currentFrame.m_numRenderTargetPasses++;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderStats::RecordSpriteBatchBreak(SpriteBatchBreak in_reason)
+        {
+            switch (in_reason)
+            {
+                case SpriteBatchBreak::k_materialChange:
+                    m_currentFrame.m_numMaterialChangeSpriteBatchBreaks++;
+                    break;
+                case SpriteBatchBreak::k_scissorChange:
+                    m_currentFrame.m_numScissorChangeSpriteBatchBreaks++;
+                    break;
+                case SpriteBatchBreak::k_bufferFull:
+                    m_currentFrame.m_numBufferFullSpriteBatchBreaks++;
+                    break;
+                case SpriteBatchBreak::k_forced:
+                    m_currentFrame.m_numForcedSpriteBatchBreaks++;
+                    break;
+            }
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderStats::RecordBufferUpload(u64 in_numVertexBytes, u64 in_numIndexBytes)
+        {
+            m_currentFrame.m_numVertexBytesUploaded += in_numVertexBytes;
+            m_currentFrame.m_numIndexBytesUploaded += in_numIndexBytes;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderStats::RecordTextureUpload(u64 in_numBytes)
+        {
+            m_currentFrame.m_numTextureBytesUploaded += in_numBytes;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        void RenderStats::EndFrame()
+        {
+            m_lastFrame = m_currentFrame;
+            m_currentFrame = FrameStats();
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        const RenderStats::FrameStats& RenderStats::GetLastFrame() const
+        {
+            return m_lastFrame;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        const RenderStats::FrameStats& RenderStats::GetCurrentFrame() const
+        {
+            return m_currentFrame;
+        }
+        //----------------------------------------------------------
+        //----------------------------------------------------------
+        std::string RenderStats::GetLastFrameSummary() const
+        {
+            const u32 numVisible = m_lastFrame.m_numRenderablesGathered - m_lastFrame.m_numRenderablesHidden - m_lastFrame.m_numRenderablesCameraCulled;
+            
+            std::string summary;
+            summary += "Renderables: " + Core::ToString(numVisible) + " / " + Core::ToString(m_lastFrame.m_numRenderablesGathered) + " drawn (" + Core::ToString(m_lastFrame.m_numRenderablesHidden) + " hidden, " + Core::ToString(m_lastFrame.m_numRenderablesCameraCulled) + " camera culled, " + Core::ToString(m_lastFrame.m_numRenderablesLightCulled) + " light culled)\n";
+            summary += "Shadow casters: " + Core::ToString(m_lastFrame.m_numShadowCasters) + "\n";
+            summary += "Draw calls: " + Core::ToString(m_lastFrame.m_numDrawCalls) + " (" + Core::ToString(m_lastFrame.m_numVerticesDrawn) + " vertices, " + Core::ToString(m_lastFrame.m_numIndicesDrawn) + " indices)\n";
+            summary += "Materials: " + Core::ToString(m_lastFrame.m_numMaterialChanges) + ", shaders: " + Core::ToString(m_lastFrame.m_numShaderBinds) + ", textures: " + Core::ToString(m_lastFrame.m_numTextureBinds) + "\n";
+            summary += "State changes: " + Core::ToString(m_lastFrame.m_numStateChanges) + ", render target passes: " + Core::ToString(m_lastFrame.m_numRenderTargetPasses) + "\n";
+            summary += "Sprite batch breaks: " + Core::ToString(m_lastFrame.m_numMaterialChangeSpriteBatchBreaks) + " material, " + Core::ToString(m_lastFrame.m_numScissorChangeSpriteBatchBreaks) + " scissor, " + Core::ToString(m_lastFrame.m_numBufferFullSpriteBatchBreaks) + " full, " + Core::ToString(m_lastFrame.m_numForcedSpriteBatchBreaks) + " forced\n";
+            summary += "Uploaded: " + Core::ToString(m_lastFrame.m_numVertexBytesUploaded) + " vertex bytes, " + Core::ToString(m_lastFrame.m_numIndexBytesUploaded) + " index bytes, " + Core::ToString(m_lastFrame.m_numTextureBytesUploaded) + " texture bytes";
+            
+            return summary;
+        }
+    }
+}
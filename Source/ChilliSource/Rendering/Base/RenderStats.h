@@ -0,0 +1,195 @@
+//
+//  RenderStats.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_BASE_RENDERSTATS_H_
+#define _CHILLISOURCE_RENDERING_BASE_RENDERSTATS_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <string>
+
+namespace ChilliSource
+{
+    namespace Rendering
+    {
+        //--------------------------------------------------------------
+        /// Per-frame rendering statistics. The renderer, sprite batches
+        /// and render system backend record into the current frame as
+        /// they work, and the renderer ends the frame once it has been
+        /// rendered to screen, at which point the counts become
+        /// available through GetLastFrame(). This is intended to help
+        /// tune scenes for culling and batching.
+        ///
+        /// Statistics must only be recorded on the render thread.
+        //--------------------------------------------------------------
+        class RenderStats final
+        {
+        public:
+            CS_DECLARE_NOCOPY(RenderStats);
+            //----------------------------------------------------------
+            /// The reasons the dynamic sprite batch can be broken into
+            /// more than one draw call.
+            //----------------------------------------------------------
+            enum class SpriteBatchBreak
+            {
+                k_materialChange,
+                k_scissorChange,
+                k_bufferFull,
+                k_forced
+            };
+            //----------------------------------------------------------
+            /// The counts recorded for a single frame.
+            //----------------------------------------------------------
+            struct FrameStats final
+            {
+                u32 m_numRenderablesGathered = 0;
+                u32 m_numRenderablesHidden = 0;
+                u32 m_numRenderablesCameraCulled = 0;
+                u32 m_numRenderablesLightCulled = 0;
+                u32 m_numShadowCasters = 0;
+                u32 m_numDrawCalls = 0;
+                u32 m_numVerticesDrawn = 0;
+                u32 m_numIndicesDrawn = 0;
+                u32 m_numMaterialChanges = 0;
+                u32 m_numShaderBinds = 0;
+                u32 m_numTextureBinds = 0;
+                u32 m_numStateChanges = 0;
+                u32 m_numRenderTargetPasses = 0;
+                u32 m_numMaterialChangeSpriteBatchBreaks = 0;
+                u32 m_numScissorChangeSpriteBatchBreaks = 0;
+                u32 m_numBufferFullSpriteBatchBreaks = 0;
+                u32 m_numForcedSpriteBatchBreaks = 0;
+                u64 m_numVertexBytesUploaded = 0;
+                u64 m_numIndexBytesUploaded = 0;
+                u64 m_numTextureBytesUploaded = 0;
+            };
+            //----------------------------------------------------------
+            /// Constructor
+            //----------------------------------------------------------
+            RenderStats() = default;
+            //----------------------------------------------------------
+            /// Records the result of culling a set of renderables
+            /// against a camera.
+            ///
+            /// @param The number of renderables gathered from the
+            /// scene.
+            /// @param The number which were skipped as they are not
+            /// visible.
+            /// @param The number which were culled by the camera's
+            /// culling predicate.
+            //----------------------------------------------------------
+            void RecordCameraCulling(u32 in_numGathered, u32 in_numHidden, u32 in_numCulled);
+            //----------------------------------------------------------
+            /// Records the number of renderables culled against the
+            /// range of a light.
+            ///
+            /// @param The number of renderables culled.
+            //----------------------------------------------------------
+            void RecordLightCulling(u32 in_numCulled);
+            //----------------------------------------------------------
+            /// @param The number of renderables rendered into a
+            /// shadow map.
+            //----------------------------------------------------------
+            void RecordShadowCasters(u32 in_numShadowCasters);
+            //----------------------------------------------------------
+            /// Records a draw call.
+            ///
+            /// @param The number of vertices drawn, if not indexed.
+            /// @param The number of indices drawn, if indexed.
+            //----------------------------------------------------------
+            void RecordDrawCall(u32 in_numVertices, u32 in_numIndices);
+            //----------------------------------------------------------
+            /// Records that a different material has been applied.
+            //----------------------------------------------------------
+            void RecordMaterialChange();
+            //----------------------------------------------------------
+            /// Records that a different shader has been bound.
+            //----------------------------------------------------------
+            void RecordShaderBind();
+            //----------------------------------------------------------
+            /// Records that a texture or cubemap has been bound.
+            //----------------------------------------------------------
+            void RecordTextureBind();
+            //----------------------------------------------------------
+            /// Records that a piece of fixed function render state,
+            /// such as blending or depth testing, has changed. Only
+            /// recorded by backends which track their render state.
+            //----------------------------------------------------------
+            void RecordStateChange();
+            //----------------------------------------------------------
+            /// Records that rendering to an offscreen render target
+            /// has begun.
+            //----------------------------------------------------------
+            void RecordRenderTargetPass();
+            //----------------------------------------------------------
+            /// Records that a sprite batch has been broken into a
+            /// new draw call.
+            ///
+            /// @param The reason for the break.
+            //----------------------------------------------------------
+            void RecordSpriteBatchBreak(SpriteBatchBreak in_reason);
+            //----------------------------------------------------------
+            /// Records data uploaded to a mesh buffer.
+            ///
+            /// @param The number of vertex bytes uploaded.
+            /// @param The number of index bytes uploaded.
+            //----------------------------------------------------------
+            void RecordBufferUpload(u64 in_numVertexBytes, u64 in_numIndexBytes);
+            //----------------------------------------------------------
+            /// Records data uploaded to a texture or cubemap.
+            ///
+            /// @param The number of bytes uploaded.
+            //----------------------------------------------------------
+            void RecordTextureUpload(u64 in_numBytes);
+            //----------------------------------------------------------
+            /// Ends the current frame, making its counts available
+            /// through GetLastFrame() and starting a new frame.
+            //----------------------------------------------------------
+            void EndFrame();
+            //----------------------------------------------------------
+            /// @return The counts for the last complete frame.
+            //----------------------------------------------------------
+            const FrameStats& GetLastFrame() const;
+            //----------------------------------------------------------
+            /// @return The counts recorded so far in the current
+            /// frame.
+            //----------------------------------------------------------
+            const FrameStats& GetCurrentFrame() const;
+            //----------------------------------------------------------
+            /// @return A human readable, multi-line summary of the
+            /// last complete frame.
+            //----------------------------------------------------------
+            std::string GetLastFrameSummary() const;
+            
+        private:
+            FrameStats m_currentFrame;
+            FrameStats m_lastFrame;
+        };
+    }
+}
+
+#endif
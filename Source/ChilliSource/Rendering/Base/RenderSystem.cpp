@@ -33,6 +33,8 @@
 
 #if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_WINDOWS
 #include <CSBackend/Rendering/OpenGL/Base/RenderSystem.h>
+#elif defined CS_TARGETPLATFORM_LINUX
+#include <CSBackend/Rendering/Null/Base/RenderSystem.h>
 #endif
 
 namespace ChilliSource
@@ -47,6 +49,8 @@ namespace ChilliSource
         {
 #if defined CS_TARGETPLATFORM_IOS || defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_WINDOWS
             return RenderSystemUPtr(new CSBackend::OpenGL::RenderSystem(in_renderCapabilities));
+#elif defined CS_TARGETPLATFORM_LINUX
+            return RenderSystemUPtr(new CSBackend::Null::RenderSystem());
 #else
             return nullptr;
 #endif
@@ -74,6 +78,18 @@ namespace ChilliSource
             }
             
             return mpSpriteBatcher;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        RenderStats& RenderSystem::GetRenderStats()
+        {
+            return m_renderStats;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        const RenderStats& RenderSystem::GetRenderStats() const
+        {
+            return m_renderStats;
         }
 		//-------------------------------------------------------
 		/// Destructor
@@ -32,6 +32,7 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Rendering/Base/MeshBuffer.h>
+#include <ChilliSource/Rendering/Base/RenderStats.h>
 
 namespace ChilliSource
 {
@@ -85,7 +86,7 @@ namespace ChilliSource
 			virtual void EndFrame(RenderTarget* inpActiveRenderTarget) = 0;
 
 			virtual void ApplyMaterial(const MaterialCSPtr& inMaterial, ShaderPass in_shaderPass) = 0;
-            virtual void ApplyJoints(const std::vector<Core::Matrix4>& inaJoints) = 0;
+            virtual void ApplyJoints(const std::vector<Core::Vector4>& in_jointPalette) = 0;
 			virtual void ApplyCamera(const Core::Vector3& invPosition, const Core::Matrix4& inmatInvView, const Core::Matrix4& inmatProj, const Core::Colour& inClearCol) = 0;
             virtual void SetLight(LightComponent* inpLightComponent) = 0;
 			
@@ -121,6 +122,16 @@ namespace ChilliSource
             /// @return Pointer to dynamic sprite batcher
             //----------------------------------------------------
             DynamicSpriteBatch* GetDynamicSpriteBatchPtr();
+            //----------------------------------------------------
+            /// @return The per-frame rendering statistics. These
+            /// are recorded by the renderer, sprite batches and
+            /// the render system itself.
+            //----------------------------------------------------
+            RenderStats& GetRenderStats();
+            //----------------------------------------------------
+            /// @return The per-frame rendering statistics.
+            //----------------------------------------------------
+            const RenderStats& GetRenderStats() const;
             
         protected:
             //-------------------------------------------------------
@@ -133,6 +144,7 @@ namespace ChilliSource
 		protected:
             
             DynamicSpriteBatch* mpSpriteBatcher;
+            RenderStats m_renderStats;
 		};
 	}
 }
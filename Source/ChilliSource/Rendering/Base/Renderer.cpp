@@ -29,15 +29,17 @@
 #include <ChilliSource/Rendering/Base/Renderer.h>
 
 #include <ChilliSource/Core/Base/Application.h>
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/Math/Geometry/ShapeIntersection.h>
 #include <ChilliSource/Core/Scene/Scene.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/ScopedProfileMarker.h>
 #include <ChilliSource/Rendering/Base/BlendMode.h>
 #include <ChilliSource/Rendering/Base/CullingPredicates.h>
 #include <ChilliSource/Rendering/Base/RenderComponent.h>
 #include <ChilliSource/Rendering/Base/RenderTarget.h>
 #include <ChilliSource/Rendering/Base/RendererSortPredicates.h>
+#include <ChilliSource/Rendering/Base/RenderSortUtils.h>
 #include <ChilliSource/Rendering/Base/RenderSystem.h>
 #include <ChilliSource/Rendering/Camera/CameraComponent.h>
 #include <ChilliSource/Rendering/Camera/OrthographicCameraComponent.h>
@@ -58,7 +60,11 @@ namespace ChilliSource
         //---Matrix caches
         Core::Matrix4 Renderer::matViewProjCache;
 
-		typedef std::function<bool(RenderComponent*, RenderComponent*)> RenderSortDelegate;
+        namespace
+        {
+            //Culling below this many renderables isn't worth spreading across threads
+            const u32 k_minRenderablesPerCullChunk = 256;
+        }
 
         CS_DEFINE_NAMEDTYPE(Renderer);
         //-------------------------------------------------------
@@ -87,6 +93,9 @@ namespace ChilliSource
             m_canvas = Core::Application::Get()->GetSystem<CanvasRenderer>();
             CS_ASSERT(m_canvas != nullptr, "Renderer cannot have null canvas renderer");
 
+            m_taskScheduler = Core::Application::Get()->GetTaskScheduler();
+            m_cullChunks.resize(m_taskScheduler->GetMaxNumParallelChunks());
+
             mpTransparentSortPredicate = RendererSortPredicateSPtr(new BackToFrontSortPredicate());
             mpOpaqueSortPredicate = RendererSortPredicateSPtr(new MaterialSortPredicate());
 
@@ -138,6 +147,9 @@ namespace ChilliSource
 		void Renderer::RenderToScreen(Core::Scene* inpScene, UI::Canvas* in_canvas)
 		{
             RenderSceneToTarget(inpScene, in_canvas, nullptr);
+            
+            //Only rendering to screen completes a frame, so any offscreen renders are included in the next frame's stats
+            mpRenderSystem->GetRenderStats().EndFrame();
 		}
         //----------------------------------------------------------
         /// Render To Texture
@@ -168,16 +180,22 @@ namespace ChilliSource
 		//----------------------------------------------------------
 		void Renderer::RenderSceneToTarget(Core::Scene* inpScene, UI::Canvas* in_canvas, RenderTarget* inpRenderTarget)
         {
-            //TODO: Remove old UI render code
-			//Traverse the scene graph and get all renderable objects
-            std::vector<RenderComponent*> aPreFilteredRenderCache;
-            std::vector<CameraComponent*> aCameraCache;
-            std::vector<DirectionalLightComponent*> aDirLightCache;
-            std::vector<PointLightComponent*> aPointLightCache;
-            AmbientLightComponent* pAmbientLight = nullptr;
+            CS_PROFILE_SCOPE("Renderer::RenderSceneToTarget");
+            
+            //Resolve any deferred transform changes so listeners are up to date before the scene is gathered
+            {
+                CS_PROFILE_SCOPE("Renderer::UpdateWorldTransforms");
+                inpScene->UpdateWorldTransforms();
+            }
 
-			FindRenderableObjectsInScene(inpScene, aPreFilteredRenderCache, aCameraCache, aDirLightCache, aPointLightCache, pAmbientLight);
-            mpActiveCamera = (aCameraCache.empty() ? nullptr : aCameraCache.back());
+            //The scene keeps persistent caches of each of these component types so there is no need to traverse it
+            const std::vector<RenderComponent*>& aPreFilteredRenderCache = inpScene->GetComponentCache<RenderComponent>().GetComponents();
+            const std::vector<DirectionalLightComponent*>& aDirLightCache = inpScene->GetComponentCache<DirectionalLightComponent>().GetComponents();
+            const std::vector<PointLightComponent*>& aPointLightCache = inpScene->GetComponentCache<PointLightComponent>().GetComponents();
+            
+            //If there is more than one camera or ambient light the one most recently added to the scene is used
+            AmbientLightComponent* pAmbientLight = inpScene->GetComponentCache<AmbientLightComponent>().GetMostRecentlyAdded();
+            mpActiveCamera = inpScene->GetComponentCache<CameraComponent>().GetMostRecentlyAdded();
 
             if(mpActiveCamera)
             {
@@ -187,26 +205,33 @@ namespace ChilliSource
 				matViewProjCache = mpActiveCamera->GetView() * mpActiveCamera->GetProjection();
 
                 //Render shadow maps
-                RenderShadowMap(mpActiveCamera, aDirLightCache, aPreFilteredRenderCache);
+                {
+                    CS_PROFILE_SCOPE("Renderer::RenderShadowMaps");
+                    RenderShadowMap(mpActiveCamera, aDirLightCache, aPreFilteredRenderCache);
+                }
 
-                //Cull items based on camera
-                std::vector<RenderComponent*> aCameraRenderCache;
-                std::vector<RenderComponent*> aCameraOpaqueCache;
-                std::vector<RenderComponent*> aCameraTransparentCache;
-                CullRenderables(mpActiveCamera, aPreFilteredRenderCache, aCameraRenderCache);
-                FilterSceneRenderables(aCameraRenderCache, aCameraOpaqueCache, aCameraTransparentCache);
+                //Cull items based on camera and generate their sort keys
+                {
+                    CS_PROFILE_SCOPE("Renderer::Cull");
+                    CullRenderables(mpActiveCamera, aPreFilteredRenderCache, m_cameraOpaqueSortCache, m_cameraTransparentSortCache);
+                }
 
                 //Render scene
                 mpRenderSystem->BeginFrame(inpRenderTarget);
 
                 //Perform the ambient pass
-                mpRenderSystem->SetLight(pAmbientLight);
-                SortOpaque(mpActiveCamera, aCameraOpaqueCache);
-                Render(mpActiveCamera, ShaderPass::k_ambient, aCameraOpaqueCache);
+                {
+                    CS_PROFILE_SCOPE("Renderer::OpaquePass");
+                    mpRenderSystem->SetLight(pAmbientLight);
+                    SortOpaque(mpActiveCamera, m_cameraOpaqueSortCache, m_cameraOpaqueCache);
+                    Render(mpActiveCamera, ShaderPass::k_ambient, m_cameraOpaqueCache);
+                }
 
                 //Perform the diffuse pass
                 if(aDirLightCache.empty() == false || aPointLightCache.empty() == false)
                 {
+                    CS_PROFILE_SCOPE("Renderer::LightPass");
+                    
                     mpRenderSystem->SetBlendFunction(BlendMode::k_one, BlendMode::k_one);
                     mpRenderSystem->LockBlendFunction();
 
@@ -219,15 +244,14 @@ namespace ChilliSource
                     for(u32 i=0; i<aDirLightCache.size(); ++i)
                     {
                         mpRenderSystem->SetLight(aDirLightCache[i]);
-                        Render(mpActiveCamera, ShaderPass::k_directional, aCameraOpaqueCache);
+                        Render(mpActiveCamera, ShaderPass::k_directional, m_cameraOpaqueCache);
                     }
 
                     for(u32 i=0; i<aPointLightCache.size(); ++i)
                     {
                         mpRenderSystem->SetLight(aPointLightCache[i]);
-                        std::vector<RenderComponent*> aPointLightOpaqueCache;
-                        CullRenderables(aPointLightCache[i], aCameraOpaqueCache, aPointLightOpaqueCache);
-                        Render(mpActiveCamera, ShaderPass::k_point, aPointLightOpaqueCache);
+                        CullRenderables(aPointLightCache[i], m_cameraOpaqueCache, m_pointLightOpaqueCache);
+                        Render(mpActiveCamera, ShaderPass::k_point, m_pointLightOpaqueCache);
                     }
 
                     mpRenderSystem->UnlockAlphaBlending();
@@ -235,8 +259,11 @@ namespace ChilliSource
                     mpRenderSystem->UnlockBlendFunction();
                 }
 
-                SortTransparent(mpActiveCamera, aCameraTransparentCache);
-                Render(mpActiveCamera, ShaderPass::k_ambient, aCameraTransparentCache);
+                {
+                    CS_PROFILE_SCOPE("Renderer::TransparentPass");
+                    SortTransparent(mpActiveCamera, m_cameraTransparentSortCache, m_cameraTransparentCache);
+                    Render(mpActiveCamera, ShaderPass::k_ambient, m_cameraTransparentCache);
+                }
 
                 mpRenderSystem->SetLight(nullptr);
 
@@ -266,34 +293,6 @@ namespace ChilliSource
                 mpRenderSystem->EndFrame(inpRenderTarget);
             }
         }
-        //----------------------------------------------------------
-		/// Find Renderable Objects In Scene
-		//----------------------------------------------------------
-        void Renderer::FindRenderableObjectsInScene(Core::Scene* pScene, std::vector<RenderComponent*>& outaRenderCache, std::vector<CameraComponent*>& outaCameraCache,
-                                          std::vector<DirectionalLightComponent*>& outaDirectionalLightComponentCache, std::vector<PointLightComponent*>& outaPointLightComponentCache, AmbientLightComponent*& outpAmbientLight) const
-		{
-            static std::vector<LightComponent*> aLightComponentCache;
-            aLightComponentCache.clear();
-
-            pScene->QuerySceneForComponents<RenderComponent, CameraComponent, LightComponent>(outaRenderCache, outaCameraCache, aLightComponentCache);
-
-            //Split the lights
-            for(u32 i=0; i<aLightComponentCache.size(); ++i)
-            {
-                if(aLightComponentCache[i]->IsA(DirectionalLightComponent::InterfaceID))
-                {
-                    outaDirectionalLightComponentCache.push_back((DirectionalLightComponent*)aLightComponentCache[i]);
-                }
-                else if(aLightComponentCache[i]->IsA(PointLightComponent::InterfaceID))
-                {
-                    outaPointLightComponentCache.push_back((PointLightComponent*)aLightComponentCache[i]);
-                }
-                else if(aLightComponentCache[i]->IsA(AmbientLightComponent::InterfaceID))
-                {
-                    outpAmbientLight = (AmbientLightComponent*)aLightComponentCache[i];
-                }
-            }
-		}
         //----------------------------------------------------------
         /// Get Cull Predicate
         //----------------------------------------------------------
@@ -314,50 +313,84 @@ namespace ChilliSource
             return mpPerspectiveCullPredicate;
         }
         //----------------------------------------------------------
-        /// Sort Opaque
+        /// Get Opaque Sort Predicate
         //----------------------------------------------------------
-        void Renderer::SortOpaque(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables) const
+        RendererSortPredicateSPtr Renderer::GetOpaqueSortPredicate(CameraComponent* inpActiveCamera) const
         {
-            RendererSortPredicateSPtr pOpaqueSort = inpCameraComponent->GetOpaqueSortPredicate();
+            RendererSortPredicateSPtr pOpaqueSort = inpActiveCamera->GetOpaqueSortPredicate();
             if(!pOpaqueSort)
             {
                 pOpaqueSort = mpOpaqueSortPredicate;
             }
 
-            if(pOpaqueSort)
+            return pOpaqueSort;
+        }
+        //----------------------------------------------------------
+        /// Get Transparent Sort Predicate
+        //----------------------------------------------------------
+        RendererSortPredicateSPtr Renderer::GetTransparentSortPredicate(CameraComponent* inpActiveCamera) const
+        {
+            RendererSortPredicateSPtr pTransparentSort = inpActiveCamera->GetTransparentSortPredicate();
+            if(!pTransparentSort)
             {
-                pOpaqueSort->PrepareForSort(&inaRenderables);
-				std::sort(inaRenderables.begin(), inaRenderables.end(), Core::MakeDelegate(pOpaqueSort.get(), &RendererSortPredicate::SortItem));
+                pTransparentSort = mpTransparentSortPredicate;
             }
+
+            return pTransparentSort;
+        }
+        //----------------------------------------------------------
+        /// Sort Opaque
+        //----------------------------------------------------------
+        void Renderer::SortOpaque(CameraComponent* inpCameraComponent, std::vector<SortableRenderable>& inaSortables, std::vector<RenderComponent*>& outaRenderables)
+        {
+            SortRenderables(GetOpaqueSortPredicate(inpCameraComponent).get(), inaSortables, outaRenderables);
         }
         //----------------------------------------------------------
         /// Sort Transparent
         //----------------------------------------------------------
-        void Renderer::SortTransparent(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables) const
+        void Renderer::SortTransparent(CameraComponent* inpCameraComponent, std::vector<SortableRenderable>& inaSortables, std::vector<RenderComponent*>& outaRenderables)
         {
-            RendererSortPredicateSPtr pTransparentSort = inpCameraComponent->GetTransparentSortPredicate();
-            if(!pTransparentSort)
+            SortRenderables(GetTransparentSortPredicate(inpCameraComponent).get(), inaSortables, outaRenderables);
+        }
+        //----------------------------------------------------------
+        /// Sort Renderables
+        //----------------------------------------------------------
+        void Renderer::SortRenderables(RendererSortPredicate* inpSortPredicate, std::vector<SortableRenderable>& inaSortables, std::vector<RenderComponent*>& outaRenderables)
+        {
+            //Keys have already been generated during culling
+            if(inpSortPredicate != nullptr && inpSortPredicate->GeneratesSortKeys() == true)
             {
-                pTransparentSort = mpTransparentSortPredicate;
+                RenderSortUtils::RadixSort(inaSortables, m_sortScratchCache);
             }
 
-			if(pTransparentSort)
+            outaRenderables.clear();
+            outaRenderables.reserve(inaSortables.size());
+            for(const SortableRenderable& sortable : inaSortables)
             {
-				pTransparentSort->PrepareForSort(&inaRenderables);
-				std::sort(inaRenderables.begin(), inaRenderables.end(), Core::MakeDelegate(pTransparentSort.get(), &RendererSortPredicate::SortItem));
-			}
+                outaRenderables.push_back(sortable.m_renderable);
+            }
+
+            //Predicates which don't generate keys are comparators
+            if(inpSortPredicate != nullptr && inpSortPredicate->GeneratesSortKeys() == false)
+            {
+                inpSortPredicate->PrepareForSort(&outaRenderables);
+                std::sort(outaRenderables.begin(), outaRenderables.end(), [inpSortPredicate](const RenderComponent* in_a, const RenderComponent* in_b)
+                {
+                    return inpSortPredicate->SortItem(in_a, in_b);
+                });
+            }
         }
         //----------------------------------------------------------
         /// Render Shadow Map
         //----------------------------------------------------------
-        void Renderer::RenderShadowMap(CameraComponent* inpCameraComponent, std::vector<DirectionalLightComponent*>& inaLightComponents, std::vector<RenderComponent*>& inaRenderables)
+        void Renderer::RenderShadowMap(CameraComponent* inpCameraComponent, const std::vector<DirectionalLightComponent*>& inaLightComponents, const std::vector<RenderComponent*>& inaRenderables)
         {
-            std::vector<RenderComponent*> aFilteredShadowMapRenderCache;
+            m_shadowMapRenderCache.clear();
 
             if(inaLightComponents.size() > 0)
             {
                 //Cull items based on whether they cast shadows
-                FilterShadowMapRenderables(inaRenderables, aFilteredShadowMapRenderCache);
+                FilterShadowMapRenderables(inaRenderables, m_shadowMapRenderCache);
             }
 
             for(u32 i=0; i<inaLightComponents.size(); ++i)
@@ -365,14 +398,15 @@ namespace ChilliSource
                 if(inaLightComponents[i]->GetShadowMapPtr() != nullptr)
                 {
                     mpRenderSystem->SetLight(inaLightComponents[i]);
-                    RenderShadowMap(mpActiveCamera, inaLightComponents[i], aFilteredShadowMapRenderCache);
+                    RenderShadowMap(mpActiveCamera, inaLightComponents[i], m_shadowMapRenderCache);
+                    mpRenderSystem->GetRenderStats().RecordShadowCasters(m_shadowMapRenderCache.size());
                 }
             }
         }
         //----------------------------------------------------------
 		/// Render Shadow Map
 		//----------------------------------------------------------
-		void Renderer::RenderShadowMap(CameraComponent* inpCameraComponent, DirectionalLightComponent* inpLightComponent, std::vector<RenderComponent*>& inaRenderables)
+		void Renderer::RenderShadowMap(CameraComponent* inpCameraComponent, DirectionalLightComponent* inpLightComponent, const std::vector<RenderComponent*>& inaRenderables)
 		{
 			//Create a new offscreen render target using the given texture
 			RenderTarget* pRenderTarget = mpRenderSystem->CreateRenderTarget(inpLightComponent->GetShadowMapPtr()->GetWidth(), inpLightComponent->GetShadowMapPtr()->GetHeight());
@@ -393,7 +427,7 @@ namespace ChilliSource
         //----------------------------------------------------------
 		/// Render
 		//----------------------------------------------------------
-		void Renderer::Render(CameraComponent* inpCameraComponent, ShaderPass ineShaderPass, std::vector<RenderComponent*>& inaRenderables)
+		void Renderer::Render(CameraComponent* inpCameraComponent, ShaderPass ineShaderPass, const std::vector<RenderComponent*>& inaRenderables)
 		{
             for(std::vector<RenderComponent*>::const_iterator it = inaRenderables.begin(); it != inaRenderables.end(); ++it)
             {
@@ -414,39 +448,107 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Cull Renderables
         //----------------------------------------------------------
-		void Renderer::CullRenderables(CameraComponent* inpCamera, const std::vector<RenderComponent*>& inaRenderCache, std::vector<RenderComponent*>& outaRenderCache) const
+		void Renderer::CullRenderables(CameraComponent* inpCamera, const std::vector<RenderComponent*>& inaRenderCache, std::vector<SortableRenderable>& outaOpaque, std::vector<SortableRenderable>& outaTransparent)
 		{
-            ICullingPredicate * pCullingPredicate = GetCullPredicate(inpCamera).get();
+            outaOpaque.clear();
+            outaTransparent.clear();
 
-            if(pCullingPredicate == nullptr)
+            const u32 udwNumRenderables = inaRenderCache.size();
+            if(udwNumRenderables == 0)
             {
-                outaRenderCache = inaRenderCache;
                 return;
             }
 
-            outaRenderCache.reserve(inaRenderCache.size());
+            const ICullingPredicate* pCullingPredicate = GetCullPredicate(inpCamera).get();
+            //Comparator predicates sort after culling so only key generating predicates are used here
+            const RendererSortPredicate* pOpaqueSort = GetOpaqueSortPredicate(inpCamera).get();
+            const RendererSortPredicate* pTransparentSort = GetTransparentSortPredicate(inpCamera).get();
+            if(pOpaqueSort != nullptr && pOpaqueSort->GeneratesSortKeys() == false)
+            {
+                pOpaqueSort = nullptr;
+            }
+            if(pTransparentSort != nullptr && pTransparentSort->GeneratesSortKeys() == false)
+            {
+                pTransparentSort = nullptr;
+            }
 
-			for(std::vector<RenderComponent*>::const_iterator it = inaRenderCache.begin(); it != inaRenderCache.end(); ++it)
-			{
-				RenderComponent* pRenderable = (*it);
+            //Bounding shapes and sort keys are cached per renderable so are safe to calculate concurrently, but
+            //they depend on world transforms which can be shared through the entity hierarchy. These, along with
+            //the camera frustum, are resolved up front so they are only ever read from the worker threads.
+            inpCamera->GetFrustum();
+            for(std::vector<RenderComponent*>::const_iterator it = inaRenderCache.begin(); it != inaRenderCache.end(); ++it)
+            {
+                (*it)->GetTransformationMatrix();
+            }
 
-				if(pRenderable->IsVisible() == false)
-                {
-                    continue;
-                }
+            //Each chunk writes to its own output so no synchronisation is needed
+            //until the results are merged.
+            const u32 udwNumChunks = std::min((udwNumRenderables + k_minRenderablesPerCullChunk - 1) / k_minRenderablesPerCullChunk, (u32)m_cullChunks.size());
+            const u32 udwRenderablesPerChunk = (udwNumRenderables + udwNumChunks - 1) / udwNumChunks;
 
-                if(pRenderable->IsCullingEnabled() == false || pCullingPredicate->CullItem(inpCamera, pRenderable) == false)
+            m_taskScheduler->ParallelFor(udwNumChunks, 1, [&](u32 in_startChunk, u32 in_endChunk)
+            {
+                for(u32 udwChunk = in_startChunk; udwChunk < in_endChunk; ++udwChunk)
                 {
-                    outaRenderCache.push_back(pRenderable);
-                    continue;
+                    CullChunk& chunk = m_cullChunks[udwChunk];
+                    chunk.m_opaque.clear();
+                    chunk.m_transparent.clear();
+                    chunk.m_numHidden = 0;
+                    chunk.m_numCulled = 0;
+
+                    const u32 udwStart = udwChunk * udwRenderablesPerChunk;
+                    const u32 udwEnd = std::min(udwStart + udwRenderablesPerChunk, udwNumRenderables);
+                    for(u32 i = udwStart; i < udwEnd; ++i)
+                    {
+                        RenderComponent* pRenderable = inaRenderCache[i];
+
+                        if(pRenderable->IsVisible() == false)
+                        {
+                            chunk.m_numHidden++;
+                            continue;
+                        }
+
+                        if(pCullingPredicate != nullptr && pRenderable->IsCullingEnabled() == true && pCullingPredicate->CullItem(inpCamera, pRenderable) == true)
+                        {
+                            chunk.m_numCulled++;
+                            continue;
+                        }
+
+                        if(pRenderable->IsTransparent() == true)
+                        {
+                            const u64 udwSortKey = (pTransparentSort != nullptr ? pTransparentSort->GenerateSortKey(pRenderable) : 0);
+                            chunk.m_transparent.push_back({udwSortKey, pRenderable});
+                        }
+                        else
+                        {
+                            const u64 udwSortKey = (pOpaqueSort != nullptr ? pOpaqueSort->GenerateSortKey(pRenderable) : 0);
+                            chunk.m_opaque.push_back({udwSortKey, pRenderable});
+                        }
+                    }
                 }
-			}
+            });
+
+            //Merge in chunk order so the output order matches the input order
+            u32 udwNumHidden = 0;
+            u32 udwNumCulled = 0;
+            for(u32 udwChunk = 0; udwChunk < udwNumChunks; ++udwChunk)
+            {
+                const CullChunk& chunk = m_cullChunks[udwChunk];
+                outaOpaque.insert(outaOpaque.end(), chunk.m_opaque.begin(), chunk.m_opaque.end());
+                outaTransparent.insert(outaTransparent.end(), chunk.m_transparent.begin(), chunk.m_transparent.end());
+                udwNumHidden += chunk.m_numHidden;
+                udwNumCulled += chunk.m_numCulled;
+            }
+
+            mpRenderSystem->GetRenderStats().RecordCameraCulling(udwNumRenderables, udwNumHidden, udwNumCulled);
 		}
         //----------------------------------------------------------
         /// Cull Renderables
         //----------------------------------------------------------
 		void Renderer::CullRenderables(PointLightComponent* inpLightComponent, const std::vector<RenderComponent*>& inaRenderCache, std::vector<RenderComponent*>& outaRenderCache) const
         {
+            outaRenderCache.clear();
+
             //Reserve estimated space
             outaRenderCache.reserve(inaRenderCache.size());
 
@@ -461,27 +563,16 @@ namespace ChilliSource
                     outaRenderCache.push_back(*it);
                 }
             }
-        }
-        //----------------------------------------------------------
-        /// Filter Scene Renderables
-        //----------------------------------------------------------
-		void Renderer::FilterSceneRenderables(const std::vector<RenderComponent*>& inaRenderables, std::vector<RenderComponent*>& outaOpaque, std::vector<RenderComponent*>& outaTransparent) const
-		{
-            //Reserve estimated space
-            outaOpaque.reserve(inaRenderables.size());
-            outaTransparent.reserve(inaRenderables.size());
 
-			for(std::vector<RenderComponent*>::const_iterator it = inaRenderables.begin(); it != inaRenderables.end(); ++it)
-			{
-				RenderComponent* pRenderable = (*it);
-                pRenderable->IsTransparent() ? outaTransparent.push_back(pRenderable) : outaOpaque.push_back(pRenderable);
-			}
-		}
+            mpRenderSystem->GetRenderStats().RecordLightCulling(inaRenderCache.size() - outaRenderCache.size());
+        }
         //----------------------------------------------------------
         /// Filter Shadow Map Renderables
         //----------------------------------------------------------
         void Renderer::FilterShadowMapRenderables(const std::vector<RenderComponent*>& inaRenderables, std::vector<RenderComponent*>& outaRenderables) const
         {
+            outaRenderables.clear();
+
             //Reserve estimated space
             outaRenderables.reserve(inaRenderables.size());
 
@@ -511,6 +602,16 @@ namespace ChilliSource
             m_canvas = nullptr;
             m_staticDirShadowMaterial = nullptr;
             m_animDirShadowMaterial = nullptr;
+
+            m_cameraOpaqueCache.clear();
+            m_cameraTransparentCache.clear();
+            m_cameraOpaqueSortCache.clear();
+            m_cameraTransparentSortCache.clear();
+            m_sortScratchCache.clear();
+            m_pointLightOpaqueCache.clear();
+            m_shadowMapRenderCache.clear();
+            m_cullChunks.clear();
+            m_taskScheduler = nullptr;
         }
 	}
 }
@@ -32,6 +32,7 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Rendering/Base/CanvasRenderer.h>
+#include <ChilliSource/Rendering/Base/RenderSortUtils.h>
 
 namespace ChilliSource
 {
@@ -157,7 +158,7 @@ namespace ChilliSource
             /// @param Light components
             /// @param Render components
             //----------------------------------------------------------
-            void RenderShadowMap(CameraComponent* inpCameraComponent, std::vector<DirectionalLightComponent*>& inaLightComponents, std::vector<RenderComponent*>& inaRenderables);
+            void RenderShadowMap(CameraComponent* inpCameraComponent, const std::vector<DirectionalLightComponent*>& inaLightComponents, const std::vector<RenderComponent*>& inaRenderables);
             //----------------------------------------------------------
             /// Render Shadow Map
             ///
@@ -167,7 +168,7 @@ namespace ChilliSource
             /// @param Light component
             /// @param Render components
             //----------------------------------------------------------
-            void RenderShadowMap(CameraComponent* inpCameraComponent, DirectionalLightComponent* inpLightComponent, std::vector<RenderComponent*>& inaRenderables);
+            void RenderShadowMap(CameraComponent* inpCameraComponent, DirectionalLightComponent* inpLightComponent, const std::vector<RenderComponent*>& inaRenderables);
 			//----------------------------------------------------------
 			/// Render
 			///
@@ -179,7 +180,7 @@ namespace ChilliSource
             /// @param The shader pass.
             /// @param Renderables
 			//----------------------------------------------------------
-			void Render(CameraComponent* inpCameraComponent, ShaderPass ineShaderPass, std::vector<RenderComponent*>& inaRenderables);
+			void Render(CameraComponent* inpCameraComponent, ShaderPass ineShaderPass, const std::vector<RenderComponent*>& inaRenderables);
             //----------------------------------------------------------
             /// Render UI
             ///
@@ -197,28 +198,21 @@ namespace ChilliSource
             /// @param Target
             //----------------------------------------------------------
             void RenderSceneToTarget(Core::Scene* inpScene, UI::Canvas* in_canvas, RenderTarget* inpRenderTarget);
-			//----------------------------------------------------------
-			/// Find Renderable Objects In Scene
-			///
-			/// Traverse the scene graph and get handles to
-			/// all objects of render type. These objects will
-			/// be contained and sorted.
-			/// @param Handle to the scene graph
-            /// @param Out: Renderables
-            /// @param Out: Camera
-            /// @param Out: Dir lights
-            /// @param Out: Point lights
-			//----------------------------------------------------------
-			void FindRenderableObjectsInScene(Core::Scene* pScene, std::vector<RenderComponent*>& outaRenderCache, std::vector<CameraComponent*>& outaCameraCache,
-                                              std::vector<DirectionalLightComponent*>& outaDirectionalLightComponentCache, std::vector<PointLightComponent*>& outaPointLightComponentCache, AmbientLightComponent*& outpAmbientLight) const;
             //----------------------------------------------------------
             /// Cull Renderables
             ///
+            /// Culls the renderables against the camera, splits the
+            /// visible ones into opaque and transparent and generates
+            /// their sort keys. Large lists are split into chunks
+            /// which are processed concurrently on the thread pool.
+            /// The output order matches the input order.
+            ///
             /// @param Camera to cull against
             /// @param Renderables to cull
-            /// @param [Out]: Visible renderables
+            /// @param [Out]: Visible opaque renderables with their keys
+            /// @param [Out]: Visible transparent renderables with their keys
             //----------------------------------------------------------
-            void CullRenderables(CameraComponent* inpCamera, const std::vector<RenderComponent*>& inaRenderCache, std::vector<RenderComponent*>& outaRenderCache) const;
+            void CullRenderables(CameraComponent* inpCamera, const std::vector<RenderComponent*>& inaRenderCache, std::vector<SortableRenderable>& outaOpaque, std::vector<SortableRenderable>& outaTransparent);
             //----------------------------------------------------------
             /// Cull Renderables
             ///
@@ -227,16 +221,6 @@ namespace ChilliSource
             /// @param [Out]: Visible renderables
             //----------------------------------------------------------
             void CullRenderables(PointLightComponent* inpLightComponent, const std::vector<RenderComponent*>& inaRenderCache, std::vector<RenderComponent*>& outaRenderCache) const;
-			//----------------------------------------------------------
-			/// Filter Scene Renderables
-			///
-			/// Sort found renderable objects into opaque and transparent
-            ///
-            /// @param List of renderable objects
-            /// @param Out: Opaque renderables
-            /// @param Out: Transparent renderables
-			//----------------------------------------------------------
-			void FilterSceneRenderables(const std::vector<RenderComponent*>& inaRenderables, std::vector<RenderComponent*>& outaOpaque, std::vector<RenderComponent*>& outaTransparent) const;
             //----------------------------------------------------------
 			/// Filter Shadow Map Renderables
 			///
@@ -254,6 +238,20 @@ namespace ChilliSource
             /// @return Camera cull predicate or nullptr
             //----------------------------------------------------------
             ICullingPredicateSPtr GetCullPredicate(CameraComponent* inpActiveCamera) const;
+            //----------------------------------------------------------
+            /// Get Opaque Sort Predicate
+            ///
+            /// @param Camera
+            /// @return Camera opaque sort predicate, the default or nullptr
+            //----------------------------------------------------------
+            RendererSortPredicateSPtr GetOpaqueSortPredicate(CameraComponent* inpActiveCamera) const;
+            //----------------------------------------------------------
+            /// Get Transparent Sort Predicate
+            ///
+            /// @param Camera
+            /// @return Camera transparent sort predicate, the default or nullptr
+            //----------------------------------------------------------
+            RendererSortPredicateSPtr GetTransparentSortPredicate(CameraComponent* inpActiveCamera) const;
             //----------------------------------------------------------
 			/// Create Overlay Projection
             ///
@@ -266,23 +264,38 @@ namespace ChilliSource
             //----------------------------------------------------------
             /// Sort Opaque
             ///
-            /// Sort the opaque renderables by the current sort predicate
-            /// on the camera
+            /// Sort the opaque renderables using the current sort
+            /// predicate on the camera
             ///
             /// @param Camera component
-            /// @param Renderables
+            /// @param Renderables with their keys. These are sorted in place.
+            /// @param [Out]: Sorted renderables
             //----------------------------------------------------------
-            void SortOpaque(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables) const;
+            void SortOpaque(CameraComponent* inpCameraComponent, std::vector<SortableRenderable>& inaSortables, std::vector<RenderComponent*>& outaRenderables);
             //----------------------------------------------------------
             /// Sort Transparent
             ///
-            /// Sort the transparent renderables by the current sort predicate
-            /// on the camera
+            /// Sort the transparent renderables using the current sort
+            /// predicate on the camera
             ///
             /// @param Camera component
-            /// @param Renderables
+            /// @param Renderables with their keys. These are sorted in place.
+            /// @param [Out]: Sorted renderables
+            //----------------------------------------------------------
+            void SortTransparent(CameraComponent* inpCameraComponent, std::vector<SortableRenderable>& inaSortables, std::vector<RenderComponent*>& outaRenderables);
             //----------------------------------------------------------
-            void SortTransparent(CameraComponent* inpCameraComponent, std::vector<RenderComponent*>& inaRenderables) const;
+            /// Sort Renderables
+            ///
+            /// Sort the renderables with the given predicate. Key
+            /// generating predicates use the keys generated during
+            /// culling, while other predicates are used as comparators.
+            ///
+            /// @param Sort predicate. May be null, in which case the
+            /// order is unchanged.
+            /// @param Renderables with their keys. These are sorted in place.
+            /// @param [Out]: Sorted renderables
+            //----------------------------------------------------------
+            void SortRenderables(RendererSortPredicate* inpSortPredicate, std::vector<SortableRenderable>& inaSortables, std::vector<RenderComponent*>& outaRenderables);
             //------------------------------------------------
             /// Called when the application is being destroyed.
             /// This should be used to cleanup memory and
@@ -294,8 +307,20 @@ namespace ChilliSource
             //------------------------------------------------
             void OnDestroy() override;
         private:
+            //----------------------------------------------------------
+            /// The output of a single chunk of the concurrent culling
+            /// stage.
+            //----------------------------------------------------------
+            struct CullChunk
+            {
+                std::vector<SortableRenderable> m_opaque;
+                std::vector<SortableRenderable> m_transparent;
+                u32 m_numHidden = 0;
+                u32 m_numCulled = 0;
+            };
 
             CanvasRenderer* m_canvas = nullptr;
+            Core::TaskScheduler* m_taskScheduler = nullptr;
 
 			RenderSystem* mpRenderSystem;
 			CameraComponent* mpActiveCamera;
@@ -308,6 +333,17 @@ namespace ChilliSource
 
             MaterialCSPtr m_staticDirShadowMaterial;
             MaterialCSPtr m_animDirShadowMaterial;
+
+            //Scratch buffers that persist between frames to avoid
+            //reallocating them every frame.
+            std::vector<RenderComponent*> m_cameraOpaqueCache;
+            std::vector<RenderComponent*> m_cameraTransparentCache;
+            std::vector<RenderComponent*> m_pointLightOpaqueCache;
+            std::vector<RenderComponent*> m_shadowMapRenderCache;
+            std::vector<SortableRenderable> m_cameraOpaqueSortCache;
+            std::vector<SortableRenderable> m_cameraTransparentSortCache;
+            std::vector<SortableRenderable> m_sortScratchCache;
+            std::vector<CullChunk> m_cullChunks;
 		};
 	}
 }
@@ -27,11 +27,15 @@
 //
 
 #include <ChilliSource/Rendering/Base/RendererSortPredicates.h>
-#include <ChilliSource/Rendering/Base/Renderer.h>
+#include <ChilliSource/Rendering/Base/RenderComponent.h>
+#include <ChilliSource/Rendering/Base/RenderSortUtils.h>
+#include <ChilliSource/Rendering/Base/ShaderPass.h>
+#include <ChilliSource/Rendering/Material/Material.h>
+#include <ChilliSource/Rendering/Model/Mesh.h>
 #include <ChilliSource/Rendering/Model/StaticMeshComponent.h>
+#include <ChilliSource/Rendering/Shader/Shader.h>
 
-#include <ChilliSource/Core/Entity/Entity.h>
-#include <ChilliSource/Core/Entity/Transform.h>
+#include <algorithm>
 
 using namespace ChilliSource::Core;
 
@@ -39,48 +43,45 @@ namespace ChilliSource
 {
 	namespace Rendering
     {
-		void BackToFrontSortPredicate::PrepareForSort(std::vector<RenderComponent*> * inpRenderable)
+        namespace
         {
-			mCameraViewProj = Renderer::matViewProjCache;
-            
-            Matrix4 matViewTrans;
-            Matrix4 matWorld;
-            
-            for(u32 i = 0; i < inpRenderable->size(); ++i)
-            {
-				Core::Matrix4 matLocalTrans = Core::Matrix4::CreateTranslation((*inpRenderable)[i]->GetAABB().GetOrigin() - (*inpRenderable)[i]->GetEntity()->GetTransform().GetWorldPosition());
-                matWorld = (*inpRenderable)[i]->GetTransformationMatrix() * matLocalTrans;
-				matViewTrans = matWorld * mCameraViewProj;
-                (*inpRenderable)[i]->SetSortValue(matViewTrans.GetTranslation().z);
-            }
-		}
+            const u64 k_materialSortMeshBits = 0xffff;
+        }
         
-		bool BackToFrontSortPredicate::SortItem(const RenderComponent* p1, const RenderComponent* p2) const
+		u64 BackToFrontSortPredicate::GenerateSortKey(RenderComponent* in_renderable) const
         {
-			return p1->GetSortValue() > p2->GetSortValue();
+            //Far objects have the greatest depth so the depth is inverted to sort them first
+            u64 udwDepth = ~RenderSortUtils::ToSortableBits(RenderSortUtils::CalculateProjectedDepth(in_renderable));
+            u64 udwMaterial = RenderSortUtils::GetSortId(in_renderable->GetMaterial().get());
+            
+            return ((udwDepth & 0xffffffff) << 32) | udwMaterial;
 		}
         
-        bool MaterialSortPredicate::SortItem(const RenderComponent* p1, const RenderComponent* p2) const
+        u64 MaterialSortPredicate::GenerateSortKey(RenderComponent* in_renderable) const
         {
-            const Material* pM1 = p1->GetMaterial().get();
-            const Material* pM2 = p2->GetMaterial().get();
-            if(pM1 == pM2)
+            const Material* pMaterial = in_renderable->GetMaterial().get();
+            
+            u64 udwShader = 0;
+            u64 udwMaterial = 0;
+            if(pMaterial != nullptr)
             {
-                bool bp1Mesh = p1->IsA(StaticMeshComponent::InterfaceID);
-                bool bp2Mesh = p2->IsA(StaticMeshComponent::InterfaceID);
-                if(bp1Mesh && bp2Mesh)
-                {
-                    return ((StaticMeshComponent*)p1)->GetMesh().get() < ((StaticMeshComponent*)p2)->GetMesh().get();
-                }
-                else
-                {
-                    return bp1Mesh;
-                }
+                udwShader = RenderSortUtils::GetSortId(pMaterial->GetShader(ShaderPass::k_ambient).get()) & 0xffff;
+                udwMaterial = RenderSortUtils::GetSortId(pMaterial) & 0xffffff;
             }
-            else
+            
+            //Anything other than a static mesh uses the largest mesh value so it sorts after the static meshes
+            u64 udwMesh = k_materialSortMeshBits;
+            if(in_renderable->IsA(StaticMeshComponent::InterfaceID) == true)
             {
-                return p1->GetMaterial().get() < p2->GetMaterial().get();
+                const Mesh* pMesh = static_cast<StaticMeshComponent*>(in_renderable)->GetMesh().get();
+                udwMesh = std::min(RenderSortUtils::GetSortId(pMesh) & k_materialSortMeshBits, k_materialSortMeshBits - 1);
             }
+            
+            //Only the exponent of the depth is used, which is enough to draw roughly front to back.
+            //Anything behind the camera is clamped to the front.
+            u64 udwDepth = (RenderSortUtils::ToSortableBits(std::max(RenderSortUtils::CalculateProjectedDepth(in_renderable), 0.0f)) >> 23) & 0xff;
+            
+            return (udwShader << 48) | (udwMaterial << 24) | (udwMesh << 8) | udwDepth;
 		}
 	}
 }
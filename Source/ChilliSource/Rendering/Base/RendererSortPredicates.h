@@ -30,7 +30,6 @@
 #define _CHILLISOURCE_RENDERING_RENDERERSORTPREDICATES_H_
 
 #include <ChilliSource/ChilliSource.h>
-#include <ChilliSource/Core/Math/Matrix4.h>
 
 #include <vector>
 
@@ -39,14 +38,62 @@ namespace ChilliSource
 	namespace Rendering
     {
 		//---------------------------------------------------------
-		/// An abstract base for classes representing different ordering operations
+		/// A base for classes representing different ordering
+		/// operations. A predicate can describe the order in one of
+		/// two ways:
+		///
+		/// By generating a packed 64-bit key for each renderable, in
+		/// which case GeneratesSortKeys() should return true. The
+		/// renderer then sorts the renderables in ascending order of
+		/// key, and renderables with equal keys keep the order they
+		/// were in. This is the fast path used by the built-in
+		/// predicates.
+		///
+		/// Or as a comparator, by overriding SortItem() and
+		/// optionally PrepareForSort(). The renderer then sorts with
+		/// std::sort, calling SortItem() for every comparison.
 		//---------------------------------------------------------
 		class RendererSortPredicate
         {
 		public:
 			virtual ~RendererSortPredicate(){}
-			virtual void PrepareForSort(std::vector<RenderComponent*> * inpRenderables = nullptr) = 0;
-			virtual bool SortItem(const RenderComponent* p1, const RenderComponent* p2) const = 0;
+            //---------------------------------------------------------
+            /// @return Whether the predicate generates sort keys
+            /// rather than acting as a comparator.
+            //---------------------------------------------------------
+            virtual bool GeneratesSortKeys() const {return false;}
+            //---------------------------------------------------------
+            /// Generates the sort key for the given renderable. This
+            /// is only called if GeneratesSortKeys() returns true.
+            /// The renderer calls this once per renderable per frame
+            /// from its culling stage, which runs across the thread
+            /// pool, so this can be called on multiple threads
+            /// concurrently and should not modify any shared state.
+            ///
+            /// @param The renderable to generate the key for.
+            ///
+            /// @return The sort key.
+            //---------------------------------------------------------
+            virtual u64 GenerateSortKey(RenderComponent* in_renderable) const {return 0;}
+            //---------------------------------------------------------
+            /// Called on the main thread before a comparator sort.
+            /// This is only called if GeneratesSortKeys() returns
+            /// false.
+            ///
+            /// @param The renderables which are about to be sorted.
+            //---------------------------------------------------------
+            virtual void PrepareForSort(std::vector<RenderComponent*> * inpRenderables = nullptr) {}
+            //---------------------------------------------------------
+            /// Compares two renderables. This is only called if
+            /// GeneratesSortKeys() returns false.
+            ///
+            /// @param The first renderable.
+            /// @param The second renderable.
+            ///
+            /// @return Whether the first renderable should be drawn
+            /// before the second.
+            //---------------------------------------------------------
+            virtual bool SortItem(const RenderComponent* p1, const RenderComponent* p2) const {return false;}
 			bool operator()(const RenderComponent* p1, const RenderComponent* p2) const
             {
 				return SortItem(p1, p2);
@@ -59,30 +106,43 @@ namespace ChilliSource
 		class NullSortPredicate final : public RendererSortPredicate
         {
 		public:
-            void PrepareForSort(std::vector<RenderComponent*> * inpRenderables = nullptr) override {}
-            bool SortItem(const RenderComponent* p1, const RenderComponent* p2) const override {return false;}
+            bool GeneratesSortKeys() const override {return true;}
+            u64 GenerateSortKey(RenderComponent* in_renderable) const override {return 0;}
 		};
 		
 		//---------------------------------------------------------
-		/// This class sorts objects in order of far to near projected screen Z depth
+		/// This class sorts objects in order of far to near projected
+		/// screen Z depth. Objects at the same depth are grouped by
+		/// material.
+		///
+		/// Key layout:
+		///     [63..32] Inverted projected depth
+		///     [31..0]  Material
 		//---------------------------------------------------------
 		class BackToFrontSortPredicate final : public RendererSortPredicate
         {
 		public:
-            void PrepareForSort(std::vector<RenderComponent*> * inpRenderables = nullptr) override;
-            bool SortItem(const RenderComponent* p1, const RenderComponent* p2) const override;
-		private:
-			Core::Matrix4 mCameraViewProj;
+            bool GeneratesSortKeys() const override {return true;}
+            u64 GenerateSortKey(RenderComponent* in_renderable) const override;
 		};
         
         //---------------------------------------------------------
-		/// This class sorts objects by material pointer
+		/// This class sorts objects to minimise state changes: by
+		/// shader, then material, then mesh. Static meshes come before
+		/// other renderables using the same material. Objects sharing
+		/// all of these are drawn roughly front to back.
+		///
+		/// Key layout:
+		///     [63..48] Shader
+		///     [47..24] Material
+		///     [23..8]  Mesh
+		///     [7..0]   Quantised projected depth
 		//---------------------------------------------------------
 		class MaterialSortPredicate final : public RendererSortPredicate
         {
 		public:
-            void PrepareForSort(std::vector<RenderComponent*> * inpRenderables = nullptr) override {}
-            bool SortItem(const RenderComponent* p1, const RenderComponent* p2) const override;
+            bool GeneratesSortKeys() const override {return true;}
+            u64 GenerateSortKey(RenderComponent* in_renderable) const override;
 		};
 	}
 }
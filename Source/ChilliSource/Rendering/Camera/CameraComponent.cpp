@@ -139,6 +139,13 @@ namespace ChilliSource
 		//------------------------------------------------------
 		const Core::Frustum& CameraComponent::GetFrustum()
 		{
+            //The changed event may not have been sent yet in the deferred transform update mode
+            if(GetEntity() && GetEntity()->GetTransform().GetWorldVersion() != m_entityWorldVersion)
+            {
+                m_entityWorldVersion = GetEntity()->GetTransform().GetWorldVersion();
+                m_isFrustumCacheValid = false;
+            }
+            
             if(m_isFrustumCacheValid == false)
             {
                 UpdateFrustum();
@@ -206,6 +206,7 @@ namespace ChilliSource
             f32 m_farClip;
             bool m_isProjCacheValid = false;
             bool m_isFrustumCacheValid = false;
+            u32 m_entityWorldVersion = 0;
             Core::Screen* m_screen = nullptr;
 
 		private:
@@ -39,6 +39,11 @@ namespace ChilliSource
         namespace
         {
             const u32 k_spacesPerTab = 5;
+            
+            //Characters in the Basic Multilingual Plane are looked up directly in a table of
+            //indices, in which this denotes a character that isn't in the font.
+            const Core::UTF8Char k_maxBmpCharacter = 0xFFFF;
+            const u16 k_invalidBmpCharacterIndex = 0xFFFF;
         }
         
         CS_DEFINE_NAMEDTYPE(Font);
@@ -62,6 +67,8 @@ namespace ChilliSource
             CS_ASSERT(in_desc.m_supportedCharacters.size() > 0, "Font: Cannot build characters with empty character set");
             
             m_characterInfos.clear();
+            m_bmpCharacterIndices.clear();
+            m_supplementaryCharacterIndices.clear();
             m_characters = in_desc.m_supportedCharacters;
             m_texture = in_desc.m_texture;
 			
@@ -95,7 +102,7 @@ namespace ChilliSource
                 
                 m_lineHeight = std::max((f32)frame.m_height, m_lineHeight);
                 
-				m_characterInfos.insert(std::make_pair(character, info));
+				AddCharacterInfo(character, info);
                 
                 ++frameIdx;
 			}
@@ -116,17 +123,24 @@ namespace ChilliSource
             spaceCharacter.m_advance = in_desc.m_spaceAdvance;
             
             //Space
-            m_characterInfos.insert(std::make_pair(k_spaceCharacter, spaceCharacter));
+            AddCharacterInfo(k_spaceCharacter, spaceCharacter);
             
             //Non-breaking space
-            m_characterInfos.insert(std::make_pair(k_nbspCharacter, spaceCharacter));
+            AddCharacterInfo(k_nbspCharacter, spaceCharacter);
             
             //Tab
             spaceCharacter.m_size.x *= k_spacesPerTab;
-            m_characterInfos.insert(std::make_pair(k_tabCharacter, spaceCharacter));
+            AddCharacterInfo(k_tabCharacter, spaceCharacter);
             
             //Return
-            m_characterInfos.insert(std::make_pair(k_returnCharacter, CharacterInfo()));
+            AddCharacterInfo(k_returnCharacter, CharacterInfo());
+            
+            //The texture atlas is a resource in its own right so reports its own usage.
+            u64 memoryUsage = m_characters.size();
+            memoryUsage += m_characterInfos.size() * sizeof(CharacterInfo);
+            memoryUsage += m_bmpCharacterIndices.size() * sizeof(u16);
+            memoryUsage += m_supplementaryCharacterIndices.size() * (sizeof(Core::UTF8Char) + sizeof(u32));
+            SetMemoryUsage(memoryUsage);
         }
 		//-------------------------------------------
 		//-------------------------------------------
@@ -168,15 +182,76 @@ namespace ChilliSource
 		//-------------------------------------------
 		bool Font::TryGetCharacterInfo(Core::UTF8Char in_char, CharacterInfo& out_info) const
 		{
-			auto itCharEntry = m_characterInfos.find(in_char);
-			
-			if (itCharEntry != m_characterInfos.end())
+            u32 index = 0;
+			if (TryGetCharacterIndex(in_char, index) == true)
             {
-				out_info = itCharEntry->second;
+				out_info = m_characterInfos[index];
 				return true;
 			}
 			
 			return false;
 		}
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        bool Font::TryGetCharacterIndex(Core::UTF8Char in_char, u32& out_index) const
+        {
+            if (in_char <= k_maxBmpCharacter)
+            {
+                if (in_char < m_bmpCharacterIndices.size() && m_bmpCharacterIndices[in_char] != k_invalidBmpCharacterIndex)
+                {
+                    out_index = m_bmpCharacterIndices[in_char];
+                    return true;
+                }
+                
+                return false;
+            }
+            
+            auto it = m_supplementaryCharacterIndices.find(in_char);
+            if (it != m_supplementaryCharacterIndices.end())
+            {
+                out_index = it->second;
+                return true;
+            }
+            
+            return false;
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        const Font::CharacterInfo& Font::GetCharacterInfo(u32 in_index) const
+        {
+            CS_ASSERT(in_index < m_characterInfos.size(), "Font: Character index out of bounds.");
+            
+            return m_characterInfos[in_index];
+        }
+        //---------------------------------------------------------------------
+        //---------------------------------------------------------------------
+        void Font::AddCharacterInfo(Core::UTF8Char in_char, const CharacterInfo& in_info)
+        {
+            u32 existingIndex = 0;
+            if (TryGetCharacterIndex(in_char, existingIndex) == true)
+            {
+                return;
+            }
+            
+            u32 index = (u32)m_characterInfos.size();
+            m_characterInfos.push_back(in_info);
+            
+            if (in_char <= k_maxBmpCharacter)
+            {
+                CS_ASSERT(index < k_invalidBmpCharacterIndex, "Font: Too many characters in font.");
+                
+                //The table only extends as far as the highest character in the font.
+                if (in_char >= m_bmpCharacterIndices.size())
+                {
+                    m_bmpCharacterIndices.resize(in_char + 1, k_invalidBmpCharacterIndex);
+                }
+                
+                m_bmpCharacterIndices[in_char] = (u16)index;
+            }
+            else
+            {
+                m_supplementaryCharacterIndices.emplace(in_char, index);
+            }
+        }
 	}
 }
@@ -36,6 +36,7 @@
 #include <ChilliSource/Rendering/Texture/UVs.h>
 
 #include <unordered_map>
+#include <vector>
 
 namespace ChilliSource
 {
@@ -178,6 +179,24 @@ namespace ChilliSource
 			/// @return Whether the character exists in the font
 			//---------------------------------------------------------------------
 			bool TryGetCharacterInfo(Core::UTF8Char in_char, CharacterInfo& out_info) const;
+            //---------------------------------------------------------------------
+            /// Looks up the index of the given character in the font's table of
+            /// character infos. Characters in the Basic Multilingual Plane are
+            /// looked up directly, so this is intended for converting text into
+            /// character indices up front when laying it out.
+            ///
+            /// @param UTF-8 Character
+            /// @param [Out] The index of the character info.
+            ///
+            /// @return Whether the character exists in the font
+            //---------------------------------------------------------------------
+            bool TryGetCharacterIndex(Core::UTF8Char in_char, u32& out_index) const;
+            //---------------------------------------------------------------------
+            /// @param The index of a character, as returned by TryGetCharacterIndex().
+            ///
+            /// @return The info for the character.
+            //---------------------------------------------------------------------
+            const CharacterInfo& GetCharacterInfo(u32 in_index) const;
 		
         private:
             
@@ -195,10 +214,20 @@ namespace ChilliSource
             /// @author S Downie
             //---------------------------------------------------------------------
             Font() = default;
+            //---------------------------------------------------------------------
+            /// Adds the info for the given character to the character table. If
+            /// the character already exists it is left unchanged.
+            ///
+            /// @param UTF-8 Character
+            /// @param The character info.
+            //---------------------------------------------------------------------
+            void AddCharacterInfo(Core::UTF8Char in_char, const CharacterInfo& in_info);
             
         private:
             
-			std::unordered_map<Core::UTF8Char, CharacterInfo> m_characterInfos;
+			std::vector<CharacterInfo> m_characterInfos;
+            std::vector<u16> m_bmpCharacterIndices;
+            std::unordered_map<Core::UTF8Char, u32> m_supplementaryCharacterIndices;
 			CharacterSet m_characters;
             
             TextureCSPtr m_texture;
@@ -40,6 +40,7 @@ namespace ChilliSource
         //------------------------------------------------------------
         /// Base
         //------------------------------------------------------------
+        CS_FORWARDDECLARE_STRUCT(CanvasDrawCache);
         CS_FORWARDDECLARE_CLASS(CanvasRenderer);
         CS_FORWARDDECLARE_CLASS(ICullingPredicate);
         CS_FORWARDDECLARE_CLASS(ViewportCullPredicate);
@@ -54,6 +55,7 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(NullSortPredicate);
         CS_FORWARDDECLARE_CLASS(BackToFrontSortPredicate);
         CS_FORWARDDECLARE_CLASS(MaterialSortPredicate);
+        CS_FORWARDDECLARE_CLASS(RenderStats);
         CS_FORWARDDECLARE_CLASS(RenderSystem);
         CS_FORWARDDECLARE_CLASS(RenderTarget);
         CS_FORWARDDECLARE_CLASS(VertexDeclaration);
@@ -93,6 +95,8 @@ namespace ChilliSource
         /// Model
         //------------------------------------------------------------
         CS_FORWARDDECLARE_CLASS(AnimatedMeshComponent);
+        CS_FORWARDDECLARE_CLASS(AnimationUpdateSystem);
+        CS_FORWARDDECLARE_CLASS(CompressedAnimationData);
         CS_FORWARDDECLARE_CLASS(Mesh);
         CS_FORWARDDECLARE_STRUCT(MeshFeatureDescriptor);
         CS_FORWARDDECLARE_STRUCT(SubMeshDescriptor);
@@ -113,7 +117,8 @@ namespace ChilliSource
 		CS_FORWARDDECLARE_CLASS(CSParticleProvider);
 		CS_FORWARDDECLARE_CLASS(ParticleEffect);
 		CS_FORWARDDECLARE_CLASS(ParticleEffectComponent);
-		CS_FORWARDDECLARE_STRUCT(Particle);
+		CS_FORWARDDECLARE_CLASS(ParticlePool);
+		CS_FORWARDDECLARE_CLASS(ParticleUpdateSystem);
 		CS_FORWARDDECLARE_CLASS(ParticleDrawable);
 		CS_FORWARDDECLARE_CLASS(ParticleDrawableDef);
 		CS_FORWARDDECLARE_CLASS(ParticleDrawableDefFactory);
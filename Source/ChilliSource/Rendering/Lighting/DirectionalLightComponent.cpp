@@ -97,6 +97,13 @@ namespace ChilliSource
         const Core::Matrix4& DirectionalLightComponent::GetLightMatrix() const
         {
             //The matrix is a view projection
+            //The changed event may not have been sent yet in the deferred transform update mode
+            if(GetEntity() != nullptr && GetEntity()->GetTransform().GetWorldVersion() != m_entityWorldVersion)
+            {
+                m_entityWorldVersion = GetEntity()->GetTransform().GetWorldVersion();
+                mbMatrixCacheValid = false;
+            }
+            
             if(mbMatrixCacheValid == false && GetEntity() != nullptr)
             {
                 Core::Matrix4 matView = Core::Matrix4::Inverse(GetEntity()->GetTransform().GetWorldTransform());
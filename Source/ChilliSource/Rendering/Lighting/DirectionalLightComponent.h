@@ -149,6 +149,7 @@ namespace ChilliSource
             
             Core::Matrix4 mmatProj;
             mutable bool mbMatrixCacheValid;
+            mutable u32 m_entityWorldVersion = 0;
             
             Core::EventConnectionUPtr m_transformChangedConnection;
             
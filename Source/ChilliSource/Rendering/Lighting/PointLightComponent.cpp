@@ -120,6 +120,13 @@ namespace ChilliSource
         {
             //The point light matrix is simply a light view matrix
             //as the projection is done in the shader
+            //The changed event may not have been sent yet in the deferred transform update mode
+            if(GetEntity() != nullptr && GetEntity()->GetTransform().GetWorldVersion() != m_entityWorldVersion)
+            {
+                m_entityWorldVersion = GetEntity()->GetTransform().GetWorldVersion();
+                mbMatrixCacheValid = false;
+            }
+            
             if(mbMatrixCacheValid == false && GetEntity() != nullptr)
             {
                 mmatLight = Core::Matrix4::Inverse(GetEntity()->GetTransform().GetWorldTransform());
@@ -174,6 +174,7 @@ namespace ChilliSource
             f32 mfRangeOfInfluence;
             
             mutable bool mbMatrixCacheValid;
+            mutable u32 m_entityWorldVersion = 0;
 		};
     }
 }
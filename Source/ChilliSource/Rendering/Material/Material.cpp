@@ -31,6 +31,8 @@
 #include <ChilliSource/Rendering/Base/BlendMode.h>
 #include <ChilliSource/Rendering/Base/CullFace.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -310,7 +312,7 @@ namespace ChilliSource
 		//-----------------------------------------------------------
 		void Material::SetShaderVar(const std::string& in_varName, f32 in_value)
 		{
-            m_floatVars[in_varName] = in_value;
+            SetShaderVar(in_varName, ShaderVarType::k_float, &in_value, 1);
             
             m_isCacheValid = false;
             m_isVariableCacheValid = false;
@@ -319,7 +321,7 @@ namespace ChilliSource
 		//-----------------------------------------------------------
 		void Material::SetShaderVar(const std::string& in_varName, const Core::Vector2& in_value)
 		{
-			m_vec2Vars[in_varName] = in_value;
+			SetShaderVar(in_varName, ShaderVarType::k_vec2, &in_value.x, 2);
             
             m_isCacheValid = false;
             m_isVariableCacheValid = false;
@@ -328,7 +330,7 @@ namespace ChilliSource
 		//-----------------------------------------------------------
 		void Material::SetShaderVar(const std::string& in_varName, const Core::Vector3& in_value)
 		{
-			m_vec3Vars[in_varName] = in_value;
+			SetShaderVar(in_varName, ShaderVarType::k_vec3, &in_value.x, 3);
             
             m_isCacheValid = false;
             m_isVariableCacheValid = false;
@@ -337,7 +339,7 @@ namespace ChilliSource
 		//-----------------------------------------------------------
 		void Material::SetShaderVar(const std::string& in_varName, const Core::Vector4& in_value)
 		{
-            m_vec4Vars[in_varName] = in_value;
+            SetShaderVar(in_varName, ShaderVarType::k_vec4, &in_value.x, 4);
             
             m_isCacheValid = false;
             m_isVariableCacheValid = false;
@@ -346,7 +348,7 @@ namespace ChilliSource
 		//-----------------------------------------------------------
 		void Material::SetShaderVar(const std::string& in_varName, const Core::Matrix4& in_value)
 		{
-			m_mat4Vars[in_varName] = in_value;
+			SetShaderVar(in_varName, ShaderVarType::k_mat4, in_value.m, 16);
             
             m_isCacheValid = false;
             m_isVariableCacheValid = false;
@@ -355,11 +357,33 @@ namespace ChilliSource
 		//-----------------------------------------------------------
 		void Material::SetShaderVar(const std::string& in_varName, const Core::Colour& in_value)
 		{
-            m_colourVars[in_varName] = in_value;
+            SetShaderVar(in_varName, ShaderVarType::k_colour, &in_value.r, 4);
             
             m_isCacheValid = false;
             m_isVariableCacheValid = false;
 		}
+		//-----------------------------------------------------------
+		//-----------------------------------------------------------
+		void Material::SetShaderVar(const std::string& in_varName, ShaderVarType in_type, const f32* in_values, u32 in_numValues)
+		{
+            for(const auto& shaderVar : m_shaderVars)
+            {
+                if(shaderVar.m_type == in_type && shaderVar.m_name == in_varName)
+                {
+                    std::copy(in_values, in_values + in_numValues, m_shaderVarValues.begin() + shaderVar.m_offset);
+                    return;
+                }
+            }
+            
+            ShaderVar shaderVar;
+            shaderVar.m_name = in_varName;
+            shaderVar.m_type = in_type;
+            shaderVar.m_offset = (u32)m_shaderVarValues.size();
+            shaderVar.m_numValues = in_numValues;
+            m_shaderVars.push_back(shaderVar);
+            
+            m_shaderVarValues.insert(m_shaderVarValues.end(), in_values, in_values + in_numValues);
+		}
 	}
 }
 
@@ -39,7 +39,7 @@
 #include <ChilliSource/Rendering/Base/ShaderPass.h>
 
 #include <array>
-#include <unordered_map>
+#include <vector>
 
 namespace ChilliSource
 {
@@ -380,13 +380,48 @@ namespace ChilliSource
             //----------------------------------------------------------
             void SetCacheValid();
             
+            //----------------------------------------------------------
+            /// The types of custom shader variable a material can hold
+            //----------------------------------------------------------
+            enum class ShaderVarType
+            {
+                k_float,
+                k_vec2,
+                k_vec3,
+                k_vec4,
+                k_mat4,
+                k_colour
+            };
+            //----------------------------------------------------------
+            /// A custom shader variable. The value is stored as
+            /// floats in the material's flat variable buffer starting
+            /// at the given offset.
+            //----------------------------------------------------------
+            struct ShaderVar
+            {
+                std::string m_name;
+                ShaderVarType m_type;
+                u32 m_offset;
+                u32 m_numValues;
+            };
+            
+            //----------------------------------------------------------
+            /// The uniform handles of the custom shader variables in
+            /// the shader a pass was last applied with. These are
+            /// resolved by the render system, so the variable names
+            /// are only looked up when the shader or the variables
+            /// change.
+            //----------------------------------------------------------
+            struct ShaderVarHandles
+            {
+                u32 m_uniformTableId = 0;
+                std::vector<s32> m_handles;
+            };
+            
             //TODO: Make private when we rework the render system
-            std::unordered_map<std::string, f32> m_floatVars;
-			std::unordered_map<std::string, Core::Vector2> m_vec2Vars;
-			std::unordered_map<std::string, Core::Vector3> m_vec3Vars;
-			std::unordered_map<std::string, Core::Vector4> m_vec4Vars;
-			std::unordered_map<std::string, Core::Matrix4> m_mat4Vars;
-			std::unordered_map<std::string, Core::Colour> m_colourVars;
+            std::vector<ShaderVar> m_shaderVars;
+            std::vector<f32> m_shaderVarValues;
+            mutable std::array<ShaderVarHandles, (u32)ShaderPass::k_total> m_shaderVarHandles;
             
         private:
             
@@ -405,6 +440,17 @@ namespace ChilliSource
             /// @author S Downie
             //----------------------------------------------------------
             Material();
+            //----------------------------------------------------------
+            /// Sets the value of the variable with the given name and
+            /// type, adding it to the flat variable buffer if it
+            /// doesn't already exist.
+            ///
+            /// @param Variable name
+            /// @param Variable type
+            /// @param Values
+            /// @param Number of values
+            //----------------------------------------------------------
+            void SetShaderVar(const std::string& in_varName, ShaderVarType in_type, const f32* in_values, u32 in_numValues);
 
 		private:
             
@@ -32,10 +32,13 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Rendering/Model/AnimatedMeshComponent.h>
+#include <ChilliSource/Rendering/Model/AnimationUpdateSystem.h>
+#include <ChilliSource/Rendering/Model/CompressedAnimationData.h>
 #include <ChilliSource/Rendering/Model/CSAnimProvider.h>
 #include <ChilliSource/Rendering/Model/CSModelProvider.h>
 #include <ChilliSource/Rendering/Model/Mesh.h>
 #include <ChilliSource/Rendering/Model/MeshDescriptor.h>
+#include <ChilliSource/Rendering/Model/PoseKernels.h>
 #include <ChilliSource/Rendering/Model/Skeleton.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimationGroup.h>
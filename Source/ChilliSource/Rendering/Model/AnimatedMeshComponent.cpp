@@ -38,6 +38,7 @@
 
 #include <ChilliSource/Core/Entity/Entity.h>
 
+#include <ChilliSource/Rendering/Model/AnimationUpdateSystem.h>
 #include <ChilliSource/Rendering/Model/Skeleton.h>
 #include <ChilliSource/Rendering/Model/SubMesh.h>
 #include <ChilliSource/Core/Base/Application.h>
@@ -57,7 +58,7 @@ namespace ChilliSource
 		AnimatedMeshComponent::AnimatedMeshComponent() 
         : mfPlaybackPosition(0.0f), mfPlaybackSpeedMultiplier(1.0f), mfBlendlinePosition(0.0f),
         meBlendType(AnimationBlendType::k_linear), mePlaybackType(AnimationPlaybackType::k_once), meFadeType(AnimationBlendType::k_linear), mfFadeTimer(0.0f), mfFadeMaxTime(0.0f), mfFadePlaybackPosition(0.0f),
-        mfFadeBlendlinePosition(0.0f), mbFinished(false), mbAnimationDataDirty(true)
+        mfFadeBlendlinePosition(0.0f), mbFinished(false), mbAnimationDataDirty(true), mbAnimationUpdateQueued(false), mpAnimationUpdateSystem(nullptr)
 		{
             mMaterials.push_back(mpMaterial);
 		}
@@ -581,7 +582,18 @@ namespace ChilliSource
         //----------------------------------------------------------
         void AnimatedMeshComponent::OnUpdate(f32 infDeltaTime)
         {
-            UpdateAnimation(infDeltaTime);
+            if (CanUpdateAnimation() == true)
+            {
+                //the timer fires the animation events so is always updated on the main thread.
+                UpdateAnimationTimer(infDeltaTime);
+                
+                //the pose is evaluated along with all other animated meshes once all states have updated.
+                if (mbAnimationUpdateQueued == false && CanUpdateAnimation() == true)
+                {
+                    mpAnimationUpdateSystem->QueueUpdate(this);
+                    mbAnimationUpdateQueued = true;
+                }
+            }
         }
         //----------------------------------------------------------
 		/// Destructor
@@ -593,12 +605,21 @@ namespace ChilliSource
 		//----------------------------------------------------
 		void AnimatedMeshComponent::OnAddedToScene()
 		{
+            mpAnimationUpdateSystem = Core::Application::Get()->GetSystem<AnimationUpdateSystem>();
+            CS_ASSERT(mpAnimationUpdateSystem != nullptr, "Animated mesh component requires the animation update system.");
+            
             SetPlaybackPosition(0.0f);
 		}
         //----------------------------------------------------
         //----------------------------------------------------
         void AnimatedMeshComponent::OnRemovedFromScene()
         {
+            if (mbAnimationUpdateQueued == true)
+            {
+                mpAnimationUpdateSystem->CancelUpdate(this);
+                mbAnimationUpdateQueued = false;
+            }
+            
             DetatchAllEntities();
         }
 		//----------------------------------------------------------
@@ -622,11 +643,11 @@ namespace ChilliSource
                 //render the model with the animation data.
                 if (mActiveAnimationGroup->IsPrepared() == true)
                 {
-                    mpModel->Render(inpRenderSystem, GetEntity()->GetTransform().GetWorldTransform(), mMaterials,ineShaderPass, mActiveAnimationGroup);
+                    mpModel->Render(inpRenderSystem, GetEntity()->GetTransform().GetWorldTransform(), mMaterials, ineShaderPass, &maSkinningPalettes);
                 }
                 else if (mFadingAnimationGroup != nullptr && mFadingAnimationGroup->IsPrepared() == true)
                 {
-                    mpModel->Render(inpRenderSystem, GetEntity()->GetTransform().GetWorldTransform(), mMaterials, ineShaderPass, mFadingAnimationGroup);
+                    mpModel->Render(inpRenderSystem, GetEntity()->GetTransform().GetWorldTransform(), mMaterials, ineShaderPass, &maSkinningPalettes);
                 }
             }
 		}
@@ -645,11 +666,11 @@ namespace ChilliSource
                 //render the model with the animation data.
                 if (mActiveAnimationGroup->IsPrepared() == true)
                 {
-                    mpModel->Render(inpRenderSystem, GetEntity()->GetTransform().GetWorldTransform(), {in_animShadowMap}, ShaderPass::k_ambient, mActiveAnimationGroup);
+                    mpModel->Render(inpRenderSystem, GetEntity()->GetTransform().GetWorldTransform(), {in_animShadowMap}, ShaderPass::k_ambient, &maSkinningPalettes);
                 }
                 else if (mFadingAnimationGroup != nullptr && mFadingAnimationGroup->IsPrepared() == true)
                 {
-                    mpModel->Render(inpRenderSystem, GetEntity()->GetTransform().GetWorldTransform(), {in_animShadowMap}, ShaderPass::k_ambient, mFadingAnimationGroup);
+                    mpModel->Render(inpRenderSystem, GetEntity()->GetTransform().GetWorldTransform(), {in_animShadowMap}, ShaderPass::k_ambient, &maSkinningPalettes);
                 }
             }
         }
@@ -658,33 +679,59 @@ namespace ChilliSource
         //----------------------------------------------------------
         void AnimatedMeshComponent::UpdateAnimation(f32 infDeltaTime)
         {
-            if (nullptr != GetEntity() && nullptr != GetEntity()->GetScene() && nullptr != mActiveAnimationGroup && mActiveAnimationGroup->GetAnimationCount() != 0)
+            if (CanUpdateAnimation() == true)
             {
-                //update the animation timer.
                 UpdateAnimationTimer(infDeltaTime);
                 
-                //calculate the animation data and convert to matrices.
-                mActiveAnimationGroup->BuildAnimationData(meBlendType, mfPlaybackPosition, mfBlendlinePosition);
-                
-                //if there is a group fading out, then apply this to the active data.
-                if (nullptr != mFadingAnimationGroup)
+                if (CanUpdateAnimation() == true)
                 {
-                    if (mfFadeMaxTime > 0.0f && mfFadeTimer < mfFadeMaxTime)
-                    {
-                        mFadingAnimationGroup->BuildAnimationData(meBlendType, mfFadePlaybackPosition, mfFadeBlendlinePosition);
-                        f32 fGroupBlendFactor = 1.0f - (mfFadeTimer / mfFadeMaxTime);
-                        mActiveAnimationGroup->BlendGroup(meBlendType, mFadingAnimationGroup, fGroupBlendFactor);
-                    }
-                    else
-                    {
-                        mFadingAnimationGroup = SkinnedAnimationGroupSPtr();
-                    }
+                    EvaluateAnimation();
+                    ApplyAnimation();
                 }
-                mActiveAnimationGroup->BuildMatrices();
-                UpdateAttachedEntities();
-                
-                mbAnimationDataDirty = false;
             }
+        }
+        //----------------------------------------------------------
+        /// Can Update Animation
+        //----------------------------------------------------------
+        bool AnimatedMeshComponent::CanUpdateAnimation()
+        {
+            return (nullptr != GetEntity() && nullptr != GetEntity()->GetScene() && nullptr != mActiveAnimationGroup && mActiveAnimationGroup->GetAnimationCount() != 0);
+        }
+        //----------------------------------------------------------
+        /// Evaluate Animation
+        //----------------------------------------------------------
+        void AnimatedMeshComponent::EvaluateAnimation()
+        {
+            //the animations may have changed since the update was queued.
+            if (CanUpdateAnimation() == false)
+            {
+                return;
+            }
+            
+            //calculate the animation data and convert to matrices.
+            mActiveAnimationGroup->BuildAnimationData(meBlendType, mfPlaybackPosition, mfBlendlinePosition);
+            
+            //if there is a group fading out, then apply this to the active data.
+            if (nullptr != mFadingAnimationGroup && mfFadeMaxTime > 0.0f && mfFadeTimer < mfFadeMaxTime)
+            {
+                mFadingAnimationGroup->BuildAnimationData(meBlendType, mfFadePlaybackPosition, mfFadeBlendlinePosition);
+                f32 fGroupBlendFactor = 1.0f - (mfFadeTimer / mfFadeMaxTime);
+                mActiveAnimationGroup->BlendGroup(meBlendType, mFadingAnimationGroup, fGroupBlendFactor);
+            }
+            mActiveAnimationGroup->BuildMatrices();
+            
+            //build the final joint palettes once so every render pass can reuse them.
+            mpModel->BuildSkinningPalettes(mActiveAnimationGroup.get(), maSkinningPalettes);
+        }
+        //----------------------------------------------------------
+        /// Apply Animation
+        //----------------------------------------------------------
+        void AnimatedMeshComponent::ApplyAnimation()
+        {
+            UpdateAttachedEntities();
+            
+            mbAnimationDataDirty = false;
+            mbAnimationUpdateQueued = false;
         }
 		//----------------------------------------------------------
 		/// Update Animation Timer
@@ -719,10 +766,15 @@ namespace ChilliSource
                     }
                 }
                 
-                //update the fade timer
+                //update the fade timer, releasing the fading group once the fade has finished.
                 if (nullptr != mFadingAnimationGroup)
                 {
                     mfFadeTimer += infDeltaTime;
+                    
+                    if (mfFadeMaxTime <= 0.0f || mfFadeTimer >= mfFadeMaxTime)
+                    {
+                        mFadingAnimationGroup = SkinnedAnimationGroupSPtr();
+                    }
                 }
             }
 		}
@@ -758,6 +810,7 @@ namespace ChilliSource
             DetatchAllEntities();
 			mActiveAnimationGroup = SkinnedAnimationGroupSPtr(new SkinnedAnimationGroup(mpModel->GetSkeleton()));
             mFadingAnimationGroup.reset();
+            maSkinningPalettes.clear();
             mfBlendlinePosition = 0.0f;
             mfFadeTimer = 0.0f;
             SetPlaybackPosition(0.0f);
@@ -389,6 +389,7 @@ namespace ChilliSource
 			void OnUpdate(f32 infDeltaTime) override;
             
 		private:
+            friend class AnimationUpdateSystem;
 			//----------------------------------------------------
 			/// On Added To Entity
 			///
@@ -432,6 +433,30 @@ namespace ChilliSource
             /// @param The delta time.
 			//----------------------------------------------------------
 			void UpdateAnimation(f32 infDeltaTime);
+            //----------------------------------------------------------
+			/// Can Update Animation
+			///
+            /// @return Whether or not the component is in a scene and
+            /// has animations to play.
+			//----------------------------------------------------------
+			bool CanUpdateAnimation();
+            //----------------------------------------------------------
+			/// Evaluate Animation
+			///
+			/// Samples and blends the animation groups, then builds the
+            /// animation matrices and skinning palettes. This only
+            /// touches data owned by this component, so may be called
+            /// on any thread as part of a batched animation update.
+			//----------------------------------------------------------
+			void EvaluateAnimation();
+            //----------------------------------------------------------
+			/// Apply Animation
+			///
+			/// Publishes the evaluated animation, updating the
+            /// transforms of any attached entities. This must be
+            /// called on the main thread.
+			//----------------------------------------------------------
+			void ApplyAnimation();
 			//----------------------------------------------------------
 			/// Update Animation Timer
 			///
@@ -462,6 +487,7 @@ namespace ChilliSource
 			std::vector<MaterialCSPtr> mMaterials;
 			SkinnedAnimationGroupSPtr mActiveAnimationGroup;
             SkinnedAnimationGroupSPtr mFadingAnimationGroup;
+            std::vector<std::vector<Core::Vector4>> maSkinningPalettes;
 			f32 mfPlaybackPosition;
 			f32 mfPlaybackSpeedMultiplier;
             f32 mfBlendlinePosition;
@@ -474,6 +500,8 @@ namespace ChilliSource
             f32 mfFadeBlendlinePosition;
             bool mbFinished;
             bool mbAnimationDataDirty;
+            bool mbAnimationUpdateQueued;
+            AnimationUpdateSystem* mpAnimationUpdateSystem;
             AnimationCompletionEvent mAnimationCompletionEvent;
             AnimationLoopedEvent mAnimationLoopedEvent;
             AnimationChangedEvent mAnimationChangedEvent;
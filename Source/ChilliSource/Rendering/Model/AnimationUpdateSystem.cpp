@@ -0,0 +1,133 @@
+//
+//  AnimationUpdateSystem.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Model/AnimationUpdateSystem.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/ScopedProfileMarker.h>
+#include <ChilliSource/Rendering/Model/AnimatedMeshComponent.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		namespace
+		{
+			//The minimum number of components evaluated by each chunk. Fewer components than this are evaluated on the main thread.
+			const u32 k_minComponentsPerChunk = 4;
+		}
+
+		CS_DEFINE_NAMEDTYPE(AnimationUpdateSystem);
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		AnimationUpdateSystemUPtr AnimationUpdateSystem::Create()
+		{
+			return AnimationUpdateSystemUPtr(new AnimationUpdateSystem());
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		bool AnimationUpdateSystem::IsA(Core::InterfaceIDType in_interfaceId) const
+		{
+			return (AnimationUpdateSystem::InterfaceID == in_interfaceId);
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void AnimationUpdateSystem::QueueUpdate(AnimatedMeshComponent* in_component)
+		{
+			CS_ASSERT(Core::Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Animation updates must be queued on the main thread.");
+			CS_ASSERT(in_component != nullptr, "Cannot queue an animation update for a null component.");
+
+			m_queuedComponents.push_back(in_component);
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void AnimationUpdateSystem::CancelUpdate(AnimatedMeshComponent* in_component)
+		{
+			CS_ASSERT(Core::Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Animation updates must be cancelled on the main thread.");
+
+			auto it = std::find(m_queuedComponents.begin(), m_queuedComponents.end(), in_component);
+			if (it != m_queuedComponents.end())
+			{
+				m_queuedComponents.erase(it);
+			}
+
+			//the component may be removed while the results of its update are being applied.
+			std::replace(m_processingComponents.begin(), m_processingComponents.end(), in_component, (AnimatedMeshComponent*)nullptr);
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void AnimationUpdateSystem::ProcessQueuedUpdates()
+		{
+			if (m_queuedComponents.empty() == true)
+			{
+				return;
+			}
+
+			CS_PROFILE_SCOPE("AnimationUpdateSystem::ProcessQueuedUpdates");
+
+			Core::TaskScheduler* taskScheduler = Core::Application::Get()->GetTaskScheduler();
+			CS_ASSERT(taskScheduler->IsMainThread() == true, "Animation updates must be processed on the main thread.");
+
+			CS_ASSERT(m_processingComponents.empty() == true, "Cannot process animation updates while already processing them.");
+			m_processingComponents.swap(m_queuedComponents);
+
+			//Each evaluation only writes to the component's own animation groups and skinning palettes, and only
+			//reads the shared meshes, skeletons and animations, so the components can be evaluated in any order.
+			AnimatedMeshComponent** components = m_processingComponents.data();
+			taskScheduler->ParallelFor((u32)m_processingComponents.size(), k_minComponentsPerChunk, [=](u32 in_startIndex, u32 in_endIndex)
+			{
+				for (u32 i = in_startIndex; i < in_endIndex; ++i)
+				{
+					components[i]->EvaluateAnimation();
+				}
+			});
+
+			//Attached entities are part of the scene so must be updated on the main thread. This is done in queue order
+			//so the results don't depend on how the evaluation was scheduled. Applying may trigger transform events, so
+			//components can be cancelled during this loop.
+			for (u32 i = 0; i < m_processingComponents.size(); ++i)
+			{
+				if (m_processingComponents[i] != nullptr)
+				{
+					m_processingComponents[i]->ApplyAnimation();
+				}
+			}
+
+			m_processingComponents.clear();
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void AnimationUpdateSystem::OnDestroy()
+		{
+			m_queuedComponents.clear();
+			m_processingComponents.clear();
+		}
+	}
+}
@@ -0,0 +1,119 @@
+//
+//  AnimationUpdateSystem.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_MODEL_ANIMATIONUPDATESYSTEM_H_
+#define _CHILLISOURCE_RENDERING_MODEL_ANIMATIONUPDATESYSTEM_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/System/AppSystem.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		//-------------------------------------------------------------------------
+		/// A system which evaluates the poses and skinning palettes of all
+		/// animated mesh components on the thread pool. Animated mesh components
+		/// advance their playback and queue an update during the state update,
+		/// and the queued updates are evaluated together once all states have
+		/// updated.
+		///
+		/// Evaluation only touches data owned by each component, so the
+		/// components are split into chunks which are evaluated concurrently.
+		/// Dispatching blocks until every pose has been evaluated, after which
+		/// the transforms of any attached entities are applied on the main
+		/// thread in the order the updates were queued. The results are
+		/// therefore always published before the scene is rendered.
+		//-------------------------------------------------------------------------
+		class AnimationUpdateSystem final : public Core::AppSystem
+		{
+		public:
+			CS_DECLARE_NAMEDTYPE(AnimationUpdateSystem);
+			//-----------------------------------------------------------------
+			/// Allows querying of whether or not this implements the interface
+			/// described by the given interface Id.
+			/// 
+			/// @param The interface Id.
+			///
+			/// @return Whether this implements the interface.
+			//-----------------------------------------------------------------
+			bool IsA(Core::InterfaceIDType in_interfaceId) const override;
+			//-----------------------------------------------------------------
+			/// Queues an evaluation of the given animated mesh component's
+			/// animation. The component must cancel the update if it is
+			/// removed from the scene before the update is processed.
+			///
+			/// This must be called on the main thread.
+			///
+			/// @param The animated mesh component.
+			//-----------------------------------------------------------------
+			void QueueUpdate(AnimatedMeshComponent* in_component);
+			//-----------------------------------------------------------------
+			/// Removes a previously queued update for the given component.
+			/// This does nothing if the component has no update queued.
+			///
+			/// This must be called on the main thread.
+			///
+			/// @param The animated mesh component.
+			//-----------------------------------------------------------------
+			void CancelUpdate(AnimatedMeshComponent* in_component);
+			//-----------------------------------------------------------------
+			/// Evaluates all queued updates across the thread pool, blocking
+			/// until they are finished, and then applies the results to any
+			/// attached entities. This is called by the application after all
+			/// states have been updated.
+			///
+			/// This must be called on the main thread.
+			//-----------------------------------------------------------------
+			void ProcessQueuedUpdates();
+		private:
+			friend class Core::Application;
+			//-----------------------------------------------------------------
+			/// Factory method for creating new instances of this system.
+			///
+			/// @return The instance of this system.
+			//-----------------------------------------------------------------
+			static AnimationUpdateSystemUPtr Create();
+			//-----------------------------------------------------------------
+			/// Default constructor. Declared private to force the use of the
+			/// CreateSystem() method in Application.
+			//-----------------------------------------------------------------
+			AnimationUpdateSystem() = default;
+			//-----------------------------------------------------------------
+			/// Clears any updates which haven't yet been processed.
+			//-----------------------------------------------------------------
+			void OnDestroy() override;
+
+			std::vector<AnimatedMeshComponent*> m_queuedComponents;
+			std::vector<AnimatedMeshComponent*> m_processingComponents;
+		};
+	}
+}
+
+#endif
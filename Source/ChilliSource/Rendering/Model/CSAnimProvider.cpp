@@ -32,6 +32,7 @@
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Rendering/Model/CompressedAnimationData.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
 
 namespace ChilliSource
@@ -43,7 +44,8 @@ namespace ChilliSource
             const std::string k_fileExtension("csanim");
             
             const u32 k_minVersion = 4;
-            const u32 k_maxVersion = 4;
+            const u32 k_maxVersion = 5;
+            const u32 k_minCompressedVersion = 5;
             const u32 k_fileCheckValue = 7777;
             
             //----------------------------------------------------------------------------
@@ -108,6 +110,59 @@ namespace ChilliSource
                     //add frame to animation
                     out_resource->AddFrame(std::move(frame));
                 }
+                
+                const u64 frameSize = sizeof(SkinnedAnimation::Frame) + (u64)in_numSkeletonNodes * (2 * sizeof(Core::Vector3) + sizeof(Core::Quaternion));
+                out_resource->SetMemoryUsage((u64)in_numFrames * frameSize);
+            }
+            //----------------------------------------------------------------------------
+            /// Reads the compressed tracks for the animation into the SkinnedAnimation
+            /// resource. The tracks are stored as a single block which is read in one
+            /// go and sampled in place, so nothing is unpacked.
+            ///
+            /// @param The file stream.
+            /// @param The file path.
+            /// @param The number of frames.
+            /// @param The number of skeleton nodes.
+            /// @param [Out] Animation resource to populate
+            ///
+            /// @return Whether or not the tracks were valid.
+            //----------------------------------------------------------------------------
+            bool ReadCompressedAnimationData(const Core::FileStreamSPtr& in_fileStream, const std::string& in_filePath, u32 in_numFrames, s32 in_numSkeletonNodes, const SkinnedAnimationSPtr& out_resource)
+            {
+                u32 dataSize = ReadValue<u32>(in_fileStream);
+                
+                //check the block fits in the rest of the file before allocating it, so a corrupt size can't cause a huge allocation.
+                const s32 dataStart = in_fileStream->TellG();
+                in_fileStream->SeekG(0, Core::SeekDir::k_end);
+                const s32 fileEnd = in_fileStream->TellG();
+                in_fileStream->SeekG(dataStart);
+                
+                if (in_fileStream->IsBad() == true || dataStart < 0 || fileEnd < dataStart || u64(dataSize) > u64(fileEnd - dataStart))
+                {
+                    CS_LOG_ERROR("CSAnim file has an invalid compressed data size: " + in_filePath);
+                    return false;
+                }
+                
+                //the block is allocated as words so that the tracks within it are aligned.
+                std::unique_ptr<u32[]> data(new u32[(dataSize + 3) / 4]);
+                in_fileStream->Read(reinterpret_cast<s8*>(data.get()), (s32)dataSize);
+                
+                if (in_fileStream->IsBad() == true)
+                {
+                    CS_LOG_ERROR("CSAnim file has corruption(truncated compressed data): " + in_filePath);
+                    return false;
+                }
+                
+                CompressedAnimationDataUPtr compressedData = CompressedAnimationData::Create(std::move(data), dataSize, in_numFrames, (u32)in_numSkeletonNodes);
+                if (compressedData == nullptr)
+                {
+                    CS_LOG_ERROR("CSAnim file has invalid compressed tracks: " + in_filePath);
+                    return false;
+                }
+                
+                out_resource->SetCompressedData(std::move(compressedData));
+                out_resource->SetMemoryUsage(dataSize);
+                return true;
             }
             //----------------------------------------------------------------------------
 			/// Parses the header of the anim file.
@@ -116,10 +171,13 @@ namespace ChilliSource
 			///
 			/// @param The file stream.
 			/// @param the Skeletal Animation that this data is being loaded into.
+			/// @param [Out] The version of the file.
+			/// @param [Out] The number of frames.
+			/// @param [Out] The number of skeleton nodes.
             ///
 			/// @return whether or not this was successful
 			//----------------------------------------------------------------------------
-			bool ReadHeader(const Core::FileStreamSPtr& in_stream, const std::string & in_filePath, const SkinnedAnimationSPtr& out_resource, u32& out_numFrames, s32& out_numSkeletonNodes)
+			bool ReadHeader(const Core::FileStreamSPtr& in_stream, const std::string & in_filePath, const SkinnedAnimationSPtr& out_resource, u32& out_version, u32& out_numFrames, s32& out_numSkeletonNodes)
             {
                 //Check file for corruption
                 if(in_stream == nullptr || in_stream->IsBad() == true)
@@ -141,6 +199,7 @@ namespace ChilliSource
                     CS_LOG_ERROR("Unsupported CSAnim version: " + in_filePath);
                     return false;
                 }
+                out_version = versionNum;
                 
                 //build the feature declaration from the file
                 u32 numFeatures = (u32)ReadValue<u8>(in_stream);
@@ -208,22 +267,24 @@ namespace ChilliSource
 		{
 			Core::FileStreamSPtr stream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_location, in_filePath, Core::FileMode::k_readBinary);
 			
+			u32 version = 0;
 			u32 numFrames = 0;
 			s32 numSkeletonNodes = 0;
-			if(ReadHeader(stream, in_filePath, out_resource, numFrames, numSkeletonNodes) == false)
+			bool success = ReadHeader(stream, in_filePath, out_resource, version, numFrames, numSkeletonNodes);
+			if (success == false)
             {
                 CS_LOG_ERROR("Failed to read header in anim: " + in_filePath);
-                out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
-                if(in_delegate != nullptr)
-                {
-					Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
-                }
-                return;
             }
-            
-			ReadAnimationData(stream, numFrames, numSkeletonNodes, out_resource);
+            else if (version >= k_minCompressedVersion)
+            {
+                success = ReadCompressedAnimationData(stream, in_filePath, numFrames, numSkeletonNodes, out_resource);
+            }
+            else
+            {
+                ReadAnimationData(stream, numFrames, numSkeletonNodes, out_resource);
+            }
 			
-            out_resource->SetLoadState(Core::Resource::LoadState::k_loaded);
+            out_resource->SetLoadState(success ? Core::Resource::LoadState::k_loaded : Core::Resource::LoadState::k_failed);
             
             if(in_delegate != nullptr)
             {
@@ -0,0 +1,322 @@
+//
+//  CompressedAnimationData.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Model/CompressedAnimationData.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		namespace
+		{
+			//Each node has a translation, orientation and scale track, stored in that order.
+			const u32 k_tracksPerNode = 3;
+			//Smallest-three components are quantised to 15-bits over the range [-1/sqrt(2), 1/sqrt(2)].
+			const f32 k_smallestThreeRange = 0.70710678f;
+			const f32 k_smallestThreeMaxValue = 32767.0f;
+			//Animated vector tracks are quantised to 16-bits over the range of the track.
+			const f32 k_vectorMaxValue = 65535.0f;
+
+			//----------------------------------------------------------------
+			/// The description of a single track. The headers for all tracks
+			/// are stored at the start of the data, followed by the keys.
+			//----------------------------------------------------------------
+			struct TrackHeader final
+			{
+				u16 m_numKeys;
+				u16 m_reserved;
+				u32 m_dataOffset;
+			};
+			static_assert(sizeof(TrackHeader) == 8, "Track headers must match the size stored in the file.");
+
+			enum class TrackType
+			{
+				k_vector,
+				k_orientation
+			};
+			//----------------------------------------------------------------
+			/// @param The size in bytes.
+			///
+			/// @return The size rounded up to a multiple of 4 bytes.
+			//----------------------------------------------------------------
+			u32 AlignSize(u32 in_size)
+			{
+				return (in_size + 3) & ~3u;
+			}
+			//----------------------------------------------------------------
+			/// Constant vector tracks store the value at full precision.
+			/// Animated vector tracks store the minimum and extent of the
+			/// track, the frame of each key and the quantised value of each
+			/// key. Orientation tracks store the frame of each key, if there
+			/// is more than one, and the packed value of each key.
+			///
+			/// @param The type of track.
+			/// @param The number of keys in the track.
+			///
+			/// @return The size of the track's data in bytes.
+			//----------------------------------------------------------------
+			u32 CalcTrackDataSize(TrackType in_type, u32 in_numKeys)
+			{
+				const u32 keyFramesSize = (in_numKeys > 1) ? in_numKeys * sizeof(u16) : 0;
+				const u32 valuesSize = in_numKeys * 3 * sizeof(u16);
+
+				switch (in_type)
+				{
+				case TrackType::k_vector:
+					return (in_numKeys > 1) ? AlignSize(6 * sizeof(f32) + keyFramesSize + valuesSize) : 3 * sizeof(f32);
+				case TrackType::k_orientation:
+					return AlignSize(keyFramesSize + valuesSize);
+				default:
+					CS_LOG_FATAL("Invalid track type.");
+					return 0;
+				}
+			}
+			//----------------------------------------------------------------
+			/// Unpacks a smallest-three quaternion. The top bit of the first
+			/// two components holds the index of the largest component,
+			/// which is positive and rebuilt from the other three.
+			///
+			/// @param The three packed components.
+			///
+			/// @return The unpacked quaternion.
+			//----------------------------------------------------------------
+			Core::Quaternion UnpackOrientation(const u16* in_packed)
+			{
+				const u32 largestIndex = ((in_packed[0] >> 15) << 1) | (in_packed[1] >> 15);
+
+				f32 components[4];
+				f32 sumOfSquares = 0.0f;
+				for (u32 i = 0, packedIndex = 0; i < 4; ++i)
+				{
+					if (i != largestIndex)
+					{
+						const f32 normalised = (f32)(in_packed[packedIndex++] & 0x7fff) / k_smallestThreeMaxValue;
+						components[i] = (normalised * 2.0f - 1.0f) * k_smallestThreeRange;
+						sumOfSquares += components[i] * components[i];
+					}
+				}
+				components[largestIndex] = std::sqrt(std::max(1.0f - sumOfSquares, 0.0f));
+
+				return Core::Quaternion(components[0], components[1], components[2], components[3]);
+			}
+			//----------------------------------------------------------------
+			/// Finds the pair of keys which the given frame lies between.
+			///
+			/// @param The frame of each key. There must be at least two.
+			/// @param The number of keys.
+			/// @param The frame.
+			/// @param [Out] The factor to interpolate between the keys by.
+			///
+			/// @return The index of the first key in the pair.
+			//----------------------------------------------------------------
+			u32 FindKeyPair(const u16* in_keyFrames, u32 in_numKeys, f32 in_frame, f32& out_interpFactor)
+			{
+				const u16* upper = std::upper_bound(in_keyFrames, in_keyFrames + in_numKeys, in_frame, [](f32 in_value, u16 in_keyFrame)
+				{
+					return in_value < (f32)in_keyFrame;
+				});
+
+				u32 keyIndex = (u32)std::max(upper - in_keyFrames, (std::ptrdiff_t)1) - 1;
+				keyIndex = std::min(keyIndex, in_numKeys - 2);
+
+				const f32 fromFrame = (f32)in_keyFrames[keyIndex];
+				const f32 toFrame = (f32)in_keyFrames[keyIndex + 1];
+				out_interpFactor = std::min(std::max((in_frame - fromFrame) / (toFrame - fromFrame), 0.0f), 1.0f);
+
+				return keyIndex;
+			}
+			//----------------------------------------------------------------
+			/// @param The start of the track data.
+			/// @param The track header.
+			/// @param The frame.
+			///
+			/// @return The value of the vector track at the given frame.
+			//----------------------------------------------------------------
+			Core::Vector3 SampleVectorTrack(const u8* in_data, const TrackHeader& in_header, f32 in_frame)
+			{
+				const f32* floats = reinterpret_cast<const f32*>(in_data + in_header.m_dataOffset);
+				if (in_header.m_numKeys == 1)
+				{
+					return Core::Vector3(floats[0], floats[1], floats[2]);
+				}
+
+				const Core::Vector3 min(floats[0], floats[1], floats[2]);
+				const Core::Vector3 extent(floats[3], floats[4], floats[5]);
+				const u16* keyFrames = reinterpret_cast<const u16*>(floats + 6);
+				const u16* values = keyFrames + in_header.m_numKeys;
+
+				f32 interpFactor = 0.0f;
+				const u32 keyIndex = FindKeyPair(keyFrames, in_header.m_numKeys, in_frame, interpFactor);
+				const u16* from = values + keyIndex * 3;
+				const u16* to = from + 3;
+
+				const Core::Vector3 fromValue((f32)from[0], (f32)from[1], (f32)from[2]);
+				const Core::Vector3 toValue((f32)to[0], (f32)to[1], (f32)to[2]);
+				return min + extent * (Core::Vector3::Lerp(fromValue, toValue, interpFactor) / k_vectorMaxValue);
+			}
+			//----------------------------------------------------------------
+			/// @param The start of the track data.
+			/// @param The track header.
+			/// @param The frame.
+			///
+			/// @return The value of the orientation track at the given
+			/// frame.
+			//----------------------------------------------------------------
+			Core::Quaternion SampleOrientationTrack(const u8* in_data, const TrackHeader& in_header, f32 in_frame)
+			{
+				const u16* trackData = reinterpret_cast<const u16*>(in_data + in_header.m_dataOffset);
+				if (in_header.m_numKeys == 1)
+				{
+					return UnpackOrientation(trackData);
+				}
+
+				const u16* keyFrames = trackData;
+				const u16* values = keyFrames + in_header.m_numKeys;
+
+				f32 interpFactor = 0.0f;
+				const u32 keyIndex = FindKeyPair(keyFrames, in_header.m_numKeys, in_frame, interpFactor);
+				const u16* from = values + keyIndex * 3;
+
+				return Core::Quaternion::Slerp(UnpackOrientation(from), UnpackOrientation(from + 3), interpFactor);
+			}
+			//----------------------------------------------------------------
+			/// @param The start of the track data.
+			/// @param The size of the track data.
+			/// @param The track header.
+			/// @param The type of track.
+			/// @param The number of frames in the animation.
+			///
+			/// @return Whether the track lies within the data and has keys
+			/// which cover the animation in order.
+			//----------------------------------------------------------------
+			bool IsTrackValid(const u8* in_data, u32 in_dataSize, const TrackHeader& in_header, TrackType in_type, u32 in_numFrames)
+			{
+				const u32 numKeys = in_header.m_numKeys;
+				if (numKeys == 0 || numKeys > in_numFrames || (in_header.m_dataOffset & 3) != 0)
+				{
+					return false;
+				}
+
+				const u32 trackSize = CalcTrackDataSize(in_type, numKeys);
+				if (in_header.m_dataOffset > in_dataSize || trackSize > in_dataSize - in_header.m_dataOffset)
+				{
+					return false;
+				}
+
+				if (numKeys > 1)
+				{
+					const u32 keyFramesOffset = (in_type == TrackType::k_vector) ? 6 * sizeof(f32) : 0;
+					const u16* keyFrames = reinterpret_cast<const u16*>(in_data + in_header.m_dataOffset + keyFramesOffset);
+					if (keyFrames[0] != 0 || keyFrames[numKeys - 1] != in_numFrames - 1)
+					{
+						return false;
+					}
+
+					for (u32 i = 1; i < numKeys; ++i)
+					{
+						if (keyFrames[i] <= keyFrames[i - 1])
+						{
+							return false;
+						}
+					}
+				}
+
+				return true;
+			}
+		}
+		//---------------------------------------------------------------------
+		//---------------------------------------------------------------------
+		CompressedAnimationDataUPtr CompressedAnimationData::Create(std::unique_ptr<u32[]> in_data, u32 in_dataSize, u32 in_numFrames, u32 in_numNodes)
+		{
+			//calculated in 64-bits so that a corrupt node count can't wrap and pass the size check.
+			const u64 numTracks = u64(in_numNodes) * k_tracksPerNode;
+			if (in_data == nullptr || in_numFrames == 0 || in_numFrames > 0xffff || numTracks * u64(sizeof(TrackHeader)) > u64(in_dataSize))
+			{
+				return nullptr;
+			}
+
+			const u8* data = reinterpret_cast<const u8*>(in_data.get());
+			const TrackHeader* headers = reinterpret_cast<const TrackHeader*>(data);
+			for (u32 i = 0; i < u32(numTracks); ++i)
+			{
+				const TrackType type = (i % k_tracksPerNode == 1) ? TrackType::k_orientation : TrackType::k_vector;
+				if (IsTrackValid(data, in_dataSize, headers[i], type, in_numFrames) == false)
+				{
+					return nullptr;
+				}
+			}
+
+			return CompressedAnimationDataUPtr(new CompressedAnimationData(std::move(in_data), in_dataSize, in_numFrames, in_numNodes));
+		}
+		//---------------------------------------------------------------------
+		//---------------------------------------------------------------------
+		CompressedAnimationData::CompressedAnimationData(std::unique_ptr<u32[]> in_data, u32 in_dataSize, u32 in_numFrames, u32 in_numNodes)
+			: m_data(std::move(in_data)), m_dataSize(in_dataSize), m_numFrames(in_numFrames), m_numNodes(in_numNodes)
+		{
+		}
+		//---------------------------------------------------------------------
+		//---------------------------------------------------------------------
+		u32 CompressedAnimationData::GetNumFrames() const
+		{
+			return m_numFrames;
+		}
+		//---------------------------------------------------------------------
+		//---------------------------------------------------------------------
+		u32 CompressedAnimationData::GetNumNodes() const
+		{
+			return m_numNodes;
+		}
+		//---------------------------------------------------------------------
+		//---------------------------------------------------------------------
+		u32 CompressedAnimationData::GetDataSize() const
+		{
+			return m_dataSize;
+		}
+		//---------------------------------------------------------------------
+		//---------------------------------------------------------------------
+		u32 CompressedAnimationData::Sample(f32 in_frame, Core::Vector3* out_translations, Core::Quaternion* out_orientations, Core::Vector3* out_scales, u32 in_maxNodes) const
+		{
+			const f32 frame = std::min(std::max(in_frame, 0.0f), (f32)(m_numFrames - 1));
+			const u8* data = reinterpret_cast<const u8*>(m_data.get());
+			const TrackHeader* headers = reinterpret_cast<const TrackHeader*>(data);
+
+			const u32 numNodes = std::min(m_numNodes, in_maxNodes);
+			for (u32 i = 0; i < numNodes; ++i)
+			{
+				const TrackHeader* nodeHeaders = headers + i * k_tracksPerNode;
+				out_translations[i] = SampleVectorTrack(data, nodeHeaders[0], frame);
+				out_orientations[i] = SampleOrientationTrack(data, nodeHeaders[1], frame);
+				out_scales[i] = SampleVectorTrack(data, nodeHeaders[2], frame);
+			}
+
+			return numNodes;
+		}
+	}
+}
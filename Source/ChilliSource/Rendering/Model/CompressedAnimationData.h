@@ -0,0 +1,117 @@
+//
+//  CompressedAnimationData.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_MODEL_COMPRESSEDANIMATIONDATA_H_
+#define _CHILLISOURCE_RENDERING_MODEL_COMPRESSEDANIMATIONDATA_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+
+#include <memory>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		//---------------------------------------------------------------------
+		/// The keyframes of a skinned animation stored in the compact layout
+		/// used by version 5 csanim files. The data is a single contiguous
+		/// block which is read directly from the file and sampled in place
+		/// rather than being expanded into frames.
+		///
+		/// Each node has a translation, orientation and scale track. A track
+		/// holds either a single constant key, or a reduced set of keys
+		/// which are interpolated between. Orientations are stored as
+		/// 48-bit smallest-three quaternions and animated translations and
+		/// scales are quantised to 16-bits per component over the range of
+		/// the track.
+		//---------------------------------------------------------------------
+		class CompressedAnimationData final
+		{
+		public:
+			CS_DECLARE_NOCOPY(CompressedAnimationData);
+			//-------------------------------------------------------------
+			/// Creates a new instance from the given block of track data,
+			/// validating that every track lies within the block.
+			///
+			/// @param The track data. The block is 4 byte aligned and
+			/// ownership is taken.
+			/// @param The size of the track data in bytes.
+			/// @param The number of frames in the animation.
+			/// @param The number of skeleton nodes in the animation.
+			///
+			/// @return The new instance, or null if the data is invalid.
+			//-------------------------------------------------------------
+			static CompressedAnimationDataUPtr Create(std::unique_ptr<u32[]> in_data, u32 in_dataSize, u32 in_numFrames, u32 in_numNodes);
+			//-------------------------------------------------------------
+			/// @return The number of frames in the animation.
+			//-------------------------------------------------------------
+			u32 GetNumFrames() const;
+			//-------------------------------------------------------------
+			/// @return The number of skeleton nodes in the animation.
+			//-------------------------------------------------------------
+			u32 GetNumNodes() const;
+			//-------------------------------------------------------------
+			/// @return The size of the track data in bytes.
+			//-------------------------------------------------------------
+			u32 GetDataSize() const;
+			//-------------------------------------------------------------
+			/// Samples the local transform of each node at the given
+			/// position. This is thread-safe.
+			///
+			/// @param The position to sample in frames. This can lie
+			/// between frames and is clamped to the animation.
+			/// @param [Out] The translation of each node.
+			/// @param [Out] The orientation of each node.
+			/// @param [Out] The scale of each node.
+			/// @param The maximum number of nodes to output.
+			///
+			/// @return The number of nodes which were sampled.
+			//-------------------------------------------------------------
+			u32 Sample(f32 in_frame, Core::Vector3* out_translations, Core::Quaternion* out_orientations, Core::Vector3* out_scales, u32 in_maxNodes) const;
+		private:
+			//-------------------------------------------------------------
+			/// Constructor. Declared private to force the use of the
+			/// Create() method.
+			///
+			/// @param The track data.
+			/// @param The size of the track data in bytes.
+			/// @param The number of frames in the animation.
+			/// @param The number of skeleton nodes in the animation.
+			//-------------------------------------------------------------
+			CompressedAnimationData(std::unique_ptr<u32[]> in_data, u32 in_dataSize, u32 in_numFrames, u32 in_numNodes);
+
+			std::unique_ptr<u32[]> m_data;
+			u32 m_dataSize;
+			u32 m_numFrames;
+			u32 m_numNodes;
+		};
+	}
+}
+
+#endif
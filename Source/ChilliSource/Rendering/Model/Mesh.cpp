@@ -33,6 +33,7 @@
 #include <ChilliSource/Rendering/Base/RenderSystem.h>
 #include <ChilliSource/Rendering/Material/Material.h>
 #include <ChilliSource/Rendering/Model/MeshDescriptor.h>
+#include <ChilliSource/Rendering/Model/SkinnedAnimationGroup.h>
 
 #include <algorithm>
 
@@ -110,6 +111,7 @@ namespace ChilliSource
             }
             
             CalcVertexAndIndexCounts();
+            CalcMemoryUsage();
             
             //return success
             return bSuccess;
@@ -197,19 +199,20 @@ namespace ChilliSource
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		void Mesh::Render(RenderSystem* in_renderSystem, const Core::Matrix4& in_worldMat, const std::vector<MaterialCSPtr>& in_materials, ShaderPass in_shaderPass, const SkinnedAnimationGroupSPtr& in_animGroup) const
+		void Mesh::Render(RenderSystem* in_renderSystem, const Core::Matrix4& in_worldMat, const std::vector<MaterialCSPtr>& in_materials, ShaderPass in_shaderPass, const std::vector<std::vector<Core::Vector4>>* in_skinningPalettes) const
 		{
             CS_ASSERT(in_materials.size() > 0, "Must have at least one material to render");
+            CS_ASSERT(in_skinningPalettes == nullptr || in_skinningPalettes->size() == m_subMeshes.size(), "Must have a skinning palette for each sub mesh");
 
-            std::vector<SubMesh*> aOpaqueSubMeshes;
+            std::vector<u32> aOpaqueSubMeshes;
             aOpaqueSubMeshes.reserve(m_subMeshes.size());
             
-            std::vector<SubMesh*> aTransparentSubMeshes;
+            std::vector<u32> aTransparentSubMeshes;
             aTransparentSubMeshes.reserve(m_subMeshes.size());
             
             //render all opaque stuff first
 			u32 udwCurrMaterial = 0;
-			for(auto it = m_subMeshes.begin(); it != m_subMeshes.end(); ++it)
+			for(u32 i = 0; i < m_subMeshes.size(); ++i)
 			{
                 const MaterialCSPtr& pMaterial = in_materials[udwCurrMaterial];
                 ++udwCurrMaterial;
@@ -217,11 +220,11 @@ namespace ChilliSource
                 
                 if(pMaterial->IsTransparencyEnabled() == false)
                 {
-                    aOpaqueSubMeshes.push_back(it->get());
+                    aOpaqueSubMeshes.push_back(i);
                 }
                 else
                 {
-                    aTransparentSubMeshes.push_back(it->get());
+                    aTransparentSubMeshes.push_back(i);
                 }
 			}
             
@@ -232,8 +235,9 @@ namespace ChilliSource
                 const MaterialCSPtr& pMaterial = in_materials[udwCurrMaterial];
                 ++udwCurrMaterial;
                 udwCurrMaterial = std::min(udwCurrMaterial, (u32)in_materials.size()-1);
-					
-                (*it)->Render(in_renderSystem, in_worldMat, pMaterial, in_shaderPass, in_animGroup);
+                
+                const std::vector<Core::Vector4>* pSkinningPalette = (in_skinningPalettes != nullptr) ? &(*in_skinningPalettes)[*it] : nullptr;
+                m_subMeshes[*it]->Render(in_renderSystem, in_worldMat, pMaterial, in_shaderPass, pSkinningPalette);
 			}
 			
 			//then transparent stuff
@@ -243,8 +247,28 @@ namespace ChilliSource
                 const MaterialCSPtr& pMaterial = in_materials[udwCurrMaterial];
                 ++udwCurrMaterial;
                 udwCurrMaterial = (u32)std::min(udwCurrMaterial, (u32)in_materials.size()-1);
-				
-                (*it)->Render(in_renderSystem, in_worldMat, pMaterial, in_shaderPass, in_animGroup);
+                
+                const std::vector<Core::Vector4>* pSkinningPalette = (in_skinningPalettes != nullptr) ? &(*in_skinningPalettes)[*it] : nullptr;
+                m_subMeshes[*it]->Render(in_renderSystem, in_worldMat, pMaterial, in_shaderPass, pSkinningPalette);
+			}
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void Mesh::BuildSkinningPalettes(const SkinnedAnimationGroup* in_animGroup, std::vector<std::vector<Core::Vector4>>& out_skinningPalettes) const
+		{
+            CS_ASSERT(in_animGroup != nullptr, "Cannot build skinning palettes without an animation group");
+            
+            if(out_skinningPalettes.size() != m_subMeshes.size())
+            {
+                out_skinningPalettes.resize(m_subMeshes.size());
+            }
+            
+			for(u32 i = 0; i < m_subMeshes.size(); ++i)
+			{
+                const InverseBindPosePtr& pInverseBindPose = m_subMeshes[i]->mpInverseBindPose;
+                CS_ASSERT(pInverseBindPose != nullptr, "Cannot build skinning palette for a sub mesh without an inverse bind pose");
+                
+                in_animGroup->BuildSkinningPalette(pInverseBindPose->mInverseBindPoseMatrices, out_skinningPalettes[i]);
 			}
 		}
 		//-----------------------------------------------------------------
@@ -260,5 +284,27 @@ namespace ChilliSource
 				m_totalNumIndices += (*it)->GetNumIndices();
 			}
 		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void Mesh::CalcMemoryUsage()
+		{
+			u64 memoryUsage = 0;
+			
+			for(auto it = m_subMeshes.begin(); it != m_subMeshes.end(); ++it)
+			{
+				MeshBuffer* meshBuffer = (*it)->GetInternalMeshBuffer();
+				if (meshBuffer != nullptr)
+				{
+					memoryUsage += meshBuffer->GetVertexCapacity() + meshBuffer->GetIndexCapacity();
+				}
+				
+				if ((*it)->mpInverseBindPose != nullptr)
+				{
+					memoryUsage += (*it)->mpInverseBindPose->mInverseBindPoseMatrices.size() * sizeof(Core::Matrix4);
+				}
+			}
+			
+			SetMemoryUsage(memoryUsage);
+		}
 	}
 }
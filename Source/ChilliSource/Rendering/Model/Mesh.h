@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
+#include <ChilliSource/Core/Math/Vector4.h>
 #include <ChilliSource/Core/Resource/Resource.h>
 #include <ChilliSource/Rendering/Model/Skeleton.h>
 #include <ChilliSource/Rendering/Model/SubMesh.h>
@@ -132,9 +133,21 @@ namespace ChilliSource
 			/// @param World transform matrix
 			/// @param The array of materials.
             /// @param Shader pass
-            /// @param Skinned animation group
+            /// @param The packed joint palette of each sub mesh, as built by
+            /// BuildSkinningPalettes(), or null if the mesh is not skinned.
 			//-----------------------------------------------------------------
-			void Render(RenderSystem* in_renderSystem, const Core::Matrix4& in_worldMat, const std::vector<MaterialCSPtr>& in_materials, ShaderPass in_shaderPass, const SkinnedAnimationGroupSPtr& in_animGroup = SkinnedAnimationGroupSPtr()) const;
+			void Render(RenderSystem* in_renderSystem, const Core::Matrix4& in_worldMat, const std::vector<MaterialCSPtr>& in_materials, ShaderPass in_shaderPass, const std::vector<std::vector<Core::Vector4>>* in_skinningPalettes = nullptr) const;
+			//-----------------------------------------------------------------
+			/// Builds the packed joint palette of each sub mesh from the
+			/// current pose of the given animation group. This should be
+			/// called once whenever the pose changes and the result reused
+			/// for every render pass. The palettes are only reallocated if
+			/// the number of sub meshes or joints changes.
+            ///
+			/// @param The animation group.
+			/// @param [Out] The palette of each sub mesh.
+			//-----------------------------------------------------------------
+			void BuildSkinningPalettes(const SkinnedAnimationGroup* in_animGroup, std::vector<std::vector<Core::Vector4>>& out_skinningPalettes) const;
 		private:
             
             friend class Core::ResourcePool;
@@ -179,6 +192,12 @@ namespace ChilliSource
             /// @author Ian Copland
 			//-----------------------------------------------------------------
 			void CalcVertexAndIndexCounts();
+			//-----------------------------------------------------------------
+			/// Reports the memory used by the sub mesh buffers and inverse
+			/// bind poses to the resource pool. This should be called after
+			/// filling all of the submeshes with data.
+			//-----------------------------------------------------------------
+			void CalcMemoryUsage();
 			
 			//Only model loaders can alter the mesh construct
 			friend class CSModelProvider;
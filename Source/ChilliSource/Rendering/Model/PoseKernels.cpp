@@ -0,0 +1,234 @@
+//
+//  PoseKernels.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Model/PoseKernels.h>
+
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#	define CS_POSEKERNELS_SSE
+#	include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#	define CS_POSEKERNELS_NEON
+#	include <arm_neon.h>
+#endif
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		namespace PoseKernels
+		{
+			namespace
+			{
+				const u32 k_simdWidth = 4;
+				const f32 k_slerpEpsilon = 0.0001f;
+
+				static_assert(sizeof(Core::Quaternion) == 4 * sizeof(f32), "Quaternions must be tightly packed to be processed as four lanes.");
+				static_assert(sizeof(Core::Matrix4) == 16 * sizeof(f32), "Matrices must be tightly packed to be processed as four rows.");
+
+				//----------------------------------------------------------------
+				/// Writes the weighted sum of two quaternions: a * weightA + b * weightB
+				///
+				/// @param The first quaternion.
+				/// @param The weight of the first quaternion.
+				/// @param The second quaternion.
+				/// @param The weight of the second quaternion.
+				/// @param [Out] The weighted sum. May alias either input.
+				//----------------------------------------------------------------
+				void WeightedSum(const Core::Quaternion& in_a, f32 in_weightA, const Core::Quaternion& in_b, f32 in_weightB, Core::Quaternion& out_result)
+				{
+#if defined(CS_POSEKERNELS_SSE)
+					__m128 a = _mm_loadu_ps(&in_a.x);
+					__m128 b = _mm_loadu_ps(&in_b.x);
+					_mm_storeu_ps(&out_result.x, _mm_add_ps(_mm_mul_ps(a, _mm_set1_ps(in_weightA)), _mm_mul_ps(b, _mm_set1_ps(in_weightB))));
+#elif defined(CS_POSEKERNELS_NEON)
+					float32x4_t a = vld1q_f32(&in_a.x);
+					float32x4_t b = vld1q_f32(&in_b.x);
+					vst1q_f32(&out_result.x, vmlaq_n_f32(vmulq_n_f32(a, in_weightA), b, in_weightB));
+#else
+					out_result = Core::Quaternion(in_a.x * in_weightA + in_b.x * in_weightB, in_a.y * in_weightA + in_b.y * in_weightB,
+						in_a.z * in_weightA + in_b.z * in_weightB, in_a.w * in_weightA + in_b.w * in_weightB);
+#endif
+				}
+			}
+			//----------------------------------------------------------------
+			//----------------------------------------------------------------
+			void Lerp(const f32* in_from, const f32* in_to, f32 in_t, f32* out_values, u32 in_count)
+			{
+				const f32 oneMinusT = 1.0f - in_t;
+
+				u32 i = 0;
+#if defined(CS_POSEKERNELS_SSE)
+				const __m128 t = _mm_set1_ps(in_t);
+				const __m128 inverseT = _mm_set1_ps(oneMinusT);
+				for (; i + k_simdWidth <= in_count; i += k_simdWidth)
+				{
+					__m128 from = _mm_loadu_ps(in_from + i);
+					__m128 to = _mm_loadu_ps(in_to + i);
+					_mm_storeu_ps(out_values + i, _mm_add_ps(_mm_mul_ps(from, inverseT), _mm_mul_ps(to, t)));
+				}
+#elif defined(CS_POSEKERNELS_NEON)
+				for (; i + k_simdWidth <= in_count; i += k_simdWidth)
+				{
+					float32x4_t from = vld1q_f32(in_from + i);
+					float32x4_t to = vld1q_f32(in_to + i);
+					vst1q_f32(out_values + i, vmlaq_n_f32(vmulq_n_f32(from, oneMinusT), to, in_t));
+				}
+#endif
+				for (; i < in_count; ++i)
+				{
+					out_values[i] = in_from[i] * oneMinusT + in_to[i] * in_t;
+				}
+			}
+			//----------------------------------------------------------------
+			/// The per-orientation weights need acos and sin so are calculated
+			/// in scalar code; the weighted sum itself is done four lanes at
+			/// a time.
+			//----------------------------------------------------------------
+			void Slerp(const Core::Quaternion* in_from, const Core::Quaternion* in_to, f32 in_t, Core::Quaternion* out_orientations, u32 in_count)
+			{
+				if (in_t <= 0.0f || in_t >= 1.0f)
+				{
+					const Core::Quaternion* source = (in_t <= 0.0f) ? in_from : in_to;
+					if (source != out_orientations)
+					{
+						for (u32 i = 0; i < in_count; ++i)
+						{
+							out_orientations[i] = source[i];
+						}
+					}
+					return;
+				}
+
+				for (u32 i = 0; i < in_count; ++i)
+				{
+					const Core::Quaternion& a = in_from[i];
+					const Core::Quaternion& b = in_to[i];
+
+					//interpolate along the shortest path.
+					f32 aDotB = Core::Quaternion::Dot(a, b);
+					f32 sign = 1.0f;
+					if (aDotB < 0.0f)
+					{
+						sign = -1.0f;
+						aDotB = -aDotB;
+					}
+
+					if (aDotB > 1.0f - k_slerpEpsilon)
+					{
+						WeightedSum(a, 1.0f - in_t, b, in_t * sign, out_orientations[i]);
+						out_orientations[i] = Core::Quaternion::Normalise(out_orientations[i]);
+					}
+					else
+					{
+						f32 angle = std::acos(aDotB);
+						f32 inverseSinAngle = 1.0f / std::sin(angle);
+						WeightedSum(a, std::sin((1.0f - in_t) * angle) * inverseSinAngle, b, std::sin(in_t * angle) * inverseSinAngle * sign, out_orientations[i]);
+					}
+				}
+			}
+			//----------------------------------------------------------------
+			/// As the local transform is a scaled rotation plus a translation
+			/// each row of the result is a weighted sum of the parent's rows,
+			/// so the local matrix is never built.
+			//----------------------------------------------------------------
+			void ComposeTransform(const Core::Vector3& in_translation, const Core::Vector3& in_scale, const Core::Quaternion& in_orientation, const Core::Matrix4& in_parent, Core::Matrix4& out_transform)
+			{
+				CS_ASSERT(&in_parent != &out_transform, "The output transform cannot alias the parent.");
+
+				Core::Quaternion q = Core::Quaternion::Normalise(in_orientation);
+
+				f32 wSquared = q.w * q.w;
+				f32 xSquared = q.x * q.x;
+				f32 ySquared = q.y * q.y;
+				f32 zSquared = q.z * q.z;
+
+				//the rows of the rotation matrix, scaled per axis.
+				f32 rotation[3][3] =
+				{
+					{ in_scale.x * (wSquared + xSquared - ySquared - zSquared), in_scale.x * (2 * q.x * q.y + 2 * q.w * q.z), in_scale.x * (2 * q.x * q.z - 2 * q.w * q.y) },
+					{ in_scale.y * (2 * q.x * q.y - 2 * q.w * q.z), in_scale.y * (wSquared - xSquared + ySquared - zSquared), in_scale.y * (2 * q.y * q.z + 2 * q.w * q.x) },
+					{ in_scale.z * (2 * q.x * q.z + 2 * q.w * q.y), in_scale.z * (2 * q.y * q.z - 2 * q.w * q.x), in_scale.z * (wSquared - xSquared - ySquared + zSquared) }
+				};
+
+				const f32* parent = in_parent.m;
+				f32* output = out_transform.m;
+#if defined(CS_POSEKERNELS_SSE)
+				__m128 parentRow0 = _mm_loadu_ps(parent);
+				__m128 parentRow1 = _mm_loadu_ps(parent + 4);
+				__m128 parentRow2 = _mm_loadu_ps(parent + 8);
+				__m128 parentRow3 = _mm_loadu_ps(parent + 12);
+
+				for (u32 row = 0; row < 3; ++row)
+				{
+					__m128 result = _mm_mul_ps(parentRow0, _mm_set1_ps(rotation[row][0]));
+					result = _mm_add_ps(result, _mm_mul_ps(parentRow1, _mm_set1_ps(rotation[row][1])));
+					result = _mm_add_ps(result, _mm_mul_ps(parentRow2, _mm_set1_ps(rotation[row][2])));
+					_mm_storeu_ps(output + row * 4, result);
+				}
+
+				__m128 translation = _mm_mul_ps(parentRow0, _mm_set1_ps(in_translation.x));
+				translation = _mm_add_ps(translation, _mm_mul_ps(parentRow1, _mm_set1_ps(in_translation.y)));
+				translation = _mm_add_ps(translation, _mm_mul_ps(parentRow2, _mm_set1_ps(in_translation.z)));
+				_mm_storeu_ps(output + 12, _mm_add_ps(translation, parentRow3));
+#elif defined(CS_POSEKERNELS_NEON)
+				float32x4_t parentRow0 = vld1q_f32(parent);
+				float32x4_t parentRow1 = vld1q_f32(parent + 4);
+				float32x4_t parentRow2 = vld1q_f32(parent + 8);
+				float32x4_t parentRow3 = vld1q_f32(parent + 12);
+
+				for (u32 row = 0; row < 3; ++row)
+				{
+					float32x4_t result = vmulq_n_f32(parentRow0, rotation[row][0]);
+					result = vmlaq_n_f32(result, parentRow1, rotation[row][1]);
+					result = vmlaq_n_f32(result, parentRow2, rotation[row][2]);
+					vst1q_f32(output + row * 4, result);
+				}
+
+				float32x4_t translation = vmlaq_n_f32(parentRow3, parentRow0, in_translation.x);
+				translation = vmlaq_n_f32(translation, parentRow1, in_translation.y);
+				translation = vmlaq_n_f32(translation, parentRow2, in_translation.z);
+				vst1q_f32(output + 12, translation);
+#else
+				for (u32 row = 0; row < 3; ++row)
+				{
+					for (u32 column = 0; column < 4; ++column)
+					{
+						output[row * 4 + column] = rotation[row][0] * parent[column] + rotation[row][1] * parent[4 + column] + rotation[row][2] * parent[8 + column];
+					}
+				}
+
+				for (u32 column = 0; column < 4; ++column)
+				{
+					output[12 + column] = in_translation.x * parent[column] + in_translation.y * parent[4 + column] + in_translation.z * parent[8 + column] + parent[12 + column];
+				}
+#endif
+			}
+		}
+	}
+}
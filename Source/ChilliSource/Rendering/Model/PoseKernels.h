@@ -0,0 +1,91 @@
+//
+//  PoseKernels.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_MODEL_POSEKERNELS_H_
+#define _CHILLISOURCE_RENDERING_MODEL_POSEKERNELS_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		//-----------------------------------------------------------------------
+		/// Bulk operations used to sample, blend and compose skeletal poses.
+		/// These use SSE or NEON where available and fall back to scalar code
+		/// otherwise. None of them allocate and the inputs are not required to
+		/// be aligned.
+		//-----------------------------------------------------------------------
+		namespace PoseKernels
+		{
+			//----------------------------------------------------------------
+			/// Linearly interpolates between two streams of values with a
+			/// single factor: values[i] = from[i] * (1 - t) + to[i] * t. The
+			/// output may alias either input.
+			///
+			/// @param The values to interpolate from.
+			/// @param The values to interpolate to.
+			/// @param The interpolation factor.
+			/// @param [Out] The interpolated values.
+			/// @param The number of values.
+			//----------------------------------------------------------------
+			void Lerp(const f32* in_from, const f32* in_to, f32 in_t, f32* out_values, u32 in_count);
+			//----------------------------------------------------------------
+			/// Spherically interpolates between two streams of orientations
+			/// with a single factor. This gives the same results as
+			/// Core::Quaternion::Slerp(). The output may alias either input.
+			///
+			/// @param The orientations to interpolate from.
+			/// @param The orientations to interpolate to.
+			/// @param The interpolation factor.
+			/// @param [Out] The interpolated orientations.
+			/// @param The number of orientations.
+			//----------------------------------------------------------------
+			void Slerp(const Core::Quaternion* in_from, const Core::Quaternion* in_to, f32 in_t, Core::Quaternion* out_orientations, u32 in_count);
+			//----------------------------------------------------------------
+			/// Builds the local transform from the given translation, scale
+			/// and orientation and concatenates it with the parent transform.
+			/// This is equivalent to:
+			///
+			///     Matrix4::CreateTransform(translation, scale, orientation) * parent
+			///
+			/// @param The local translation.
+			/// @param The local scale.
+			/// @param The local orientation.
+			/// @param The parent transform.
+			/// @param [Out] The concatenated transform. This must not alias
+			/// the parent.
+			//----------------------------------------------------------------
+			void ComposeTransform(const Core::Vector3& in_translation, const Core::Vector3& in_scale, const Core::Quaternion& in_orientation, const Core::Matrix4& in_parent, Core::Matrix4& out_transform);
+		}
+	}
+}
+
+#endif
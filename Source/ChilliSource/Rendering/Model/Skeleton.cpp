@@ -51,6 +51,53 @@ namespace ChilliSource
             }
             
             madwJoints = in_desc.m_jointIndices;
+            
+            //order the nodes breadth first from the roots so every parent precedes its children.
+            //Nodes that can't be reached from a root are left out as they are never evaluated.
+            maudwEvaluationOrder.clear();
+            maudwEvaluationOrder.reserve(mapNodes.size());
+            for (u32 i = 0; i < mapNodes.size(); ++i)
+            {
+                if (mapNodes[i]->mdwParentIndex == -1)
+                {
+                    maudwEvaluationOrder.push_back(i);
+                }
+            }
+            
+            //gather the children of each node so the walk below is linear.
+            std::vector<u32> audwChildStarts(mapNodes.size() + 1, 0);
+            for (u32 i = 0; i < mapNodes.size(); ++i)
+            {
+                s32 dwParent = mapNodes[i]->mdwParentIndex;
+                if (dwParent >= 0 && dwParent < (s32)mapNodes.size())
+                {
+                    audwChildStarts[dwParent + 1]++;
+                }
+            }
+            for (u32 i = 0; i < mapNodes.size(); ++i)
+            {
+                audwChildStarts[i + 1] += audwChildStarts[i];
+            }
+            
+            std::vector<u32> audwChildren(audwChildStarts.back());
+            std::vector<u32> audwChildCounts(mapNodes.size(), 0);
+            for (u32 i = 0; i < mapNodes.size(); ++i)
+            {
+                s32 dwParent = mapNodes[i]->mdwParentIndex;
+                if (dwParent >= 0 && dwParent < (s32)mapNodes.size())
+                {
+                    audwChildren[audwChildStarts[dwParent] + audwChildCounts[dwParent]++] = i;
+                }
+            }
+            
+            for (u32 udwNext = 0; udwNext < maudwEvaluationOrder.size(); ++udwNext)
+            {
+                u32 udwNode = maudwEvaluationOrder[udwNext];
+                for (u32 udwChild = audwChildStarts[udwNode]; udwChild < audwChildStarts[udwNode + 1]; ++udwChild)
+                {
+                    maudwEvaluationOrder.push_back(audwChildren[udwChild]);
+                }
+            }
         }
 		//-------------------------------------------------------------------------
 		/// Get Node By Name
@@ -123,5 +170,12 @@ namespace ChilliSource
         {
             return madwJoints;
         }
+        //-------------------------------------------------------------------------
+        /// Get Evaluation Order
+        //-------------------------------------------------------------------------
+        const std::vector<u32>& Skeleton::GetEvaluationOrder() const
+        {
+            return maudwEvaluationOrder;
+        }
 	}
 }
\ No newline at end of file
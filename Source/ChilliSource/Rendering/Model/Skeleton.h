@@ -121,11 +121,22 @@ namespace ChilliSource
 			/// @return the array of joint indices
 			//-------------------------------------------------------------------------
 			const std::vector<s32>& GetJointIndices() const;
+            //-------------------------------------------------------------------------
+			/// Get Evaluation Order
+			///
+			/// The indices of all nodes reachable from a root node, ordered so
+			/// that every node comes after its parent. Walking this once is
+			/// enough to build the transform of every node from its parent.
+			///
+			/// @return the node indices in evaluation order.
+			//-------------------------------------------------------------------------
+			const std::vector<u32>& GetEvaluationOrder() const;
 			
 		private:
 			
 			std::vector<SkeletonNodeCUPtr> mapNodes;
             std::vector<s32> madwJoints;
+            std::vector<u32> maudwEvaluationOrder;
 		};
 	}
 }
@@ -68,14 +68,34 @@ namespace ChilliSource
 		//---------------------------------------------------------------------
 		u32 SkinnedAnimation::GetNumFrames() const
 		{
+            if (m_compressedData != nullptr)
+            {
+                return m_compressedData->GetNumFrames();
+            }
+            
 			return m_frames.size();
 		}
 		//---------------------------------------------------------------------
 		//---------------------------------------------------------------------
 		void SkinnedAnimation::AddFrame(SkinnedAnimation::FrameCUPtr in_frame)
 		{
+            CS_ASSERT(m_compressedData == nullptr, "Cannot add frames to a compressed skinned animation");
 			m_frames.push_back(std::move(in_frame));
 		}
+        //---------------------------------------------------------------------
+		//---------------------------------------------------------------------
+		void SkinnedAnimation::SetCompressedData(CompressedAnimationDataCUPtr in_compressedData)
+		{
+            m_frames.clear();
+            m_frames.shrink_to_fit();
+			m_compressedData = std::move(in_compressedData);
+		}
+        //---------------------------------------------------------------------
+		//---------------------------------------------------------------------
+		const CompressedAnimationData* SkinnedAnimation::GetCompressedData() const
+		{
+			return m_compressedData.get();
+		}
 		//---------------------------------------------------------------------
 		//---------------------------------------------------------------------
 		void SkinnedAnimation::SetFrameTime(f32 in_timeBetweenFrames)
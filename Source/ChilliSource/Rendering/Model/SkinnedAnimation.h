@@ -34,6 +34,7 @@
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Resource/Resource.h>
+#include <ChilliSource/Rendering/Model/CompressedAnimationData.h>
 
 namespace ChilliSource
 {
@@ -42,6 +43,9 @@ namespace ChilliSource
 		//---------------------------------------------------------------------
 		/// A resource that holds data for a single skinned animation.
         /// This largely consists of the transformations for each key frame.
+        /// The transformations are either stored as a list of frames or,
+        /// for animations loaded from compressed files, as compressed
+        /// tracks which are sampled directly.
         ///
         /// @author Ian Copland
 		//---------------------------------------------------------------------
@@ -76,6 +80,8 @@ namespace ChilliSource
 			//---------------------------------------------------------------------
 			bool IsA(Core::InterfaceIDType in_interfaceId) const override;
 			//---------------------------------------------------------------------
+			/// This is only available if the animation isn't compressed.
+			///
 			/// @author Ian Copland
 			///
 			/// @param the index to the frame
@@ -102,6 +108,18 @@ namespace ChilliSource
 			/// @param The new frame which is no owned by the resource
 			//---------------------------------------------------------------------
 			void AddFrame(SkinnedAnimation::FrameCUPtr in_frame);
+            //---------------------------------------------------------------------
+			/// Sets the compressed tracks for the animation. This replaces any
+            /// frames which have been added.
+            ///
+			/// @param The compressed animation data. Ownership is taken.
+			//---------------------------------------------------------------------
+			void SetCompressedData(CompressedAnimationDataCUPtr in_compressedData);
+            //---------------------------------------------------------------------
+			/// @return The compressed animation data, or null if the animation
+            /// is stored as frames.
+			//---------------------------------------------------------------------
+			const CompressedAnimationData* GetCompressedData() const;
 			//---------------------------------------------------------------------
 			/// Sets the frame rate of the animation. Do not use this for changing
 			/// the speed of an animation. Instead changing the speed through
@@ -137,6 +155,7 @@ namespace ChilliSource
 			
 			f32 m_frameTime;
 			std::vector<SkinnedAnimation::FrameCUPtr> m_frames;
+            CompressedAnimationDataCUPtr m_compressedData;
 		};
 	}
 }
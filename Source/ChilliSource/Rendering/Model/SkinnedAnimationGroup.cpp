@@ -30,23 +30,59 @@
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/MathUtils.h>
+#include <ChilliSource/Rendering/Model/PoseKernels.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
 #include <ChilliSource/Rendering/Model/Skeleton.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     namespace Rendering
     {
+        namespace
+        {
+            static_assert(sizeof(Core::Vector3) == 3 * sizeof(f32), "Vector3 streams must be tightly packed to be interpolated as floats.");
+            
+            //-----------------------------------------------------------
+            /// Sizes each stream of the pose to the given number of
+            /// nodes. This is the only point at which a pose allocates.
+            ///
+            /// @param The number of nodes.
+            /// @param OUT: The pose.
+            //-----------------------------------------------------------
+            template <typename TPose> void AllocatePose(u32 inudwNumNodes, TPose& outPose)
+            {
+                outPose.m_translations.resize(inudwNumNodes);
+                outPose.m_orientations.resize(inudwNumNodes);
+                outPose.m_scales.resize(inudwNumNodes);
+                outPose.m_numNodes = 0;
+            }
+            //-----------------------------------------------------------
+            /// Interpolates two streams of Vector3s as a single stream
+            /// of floats.
+            ///
+            /// @param The vectors to interpolate from.
+            /// @param The vectors to interpolate to.
+            /// @param The interpolation factor.
+            /// @param OUT: The interpolated vectors.
+            /// @param The number of vectors.
+            //-----------------------------------------------------------
+            void LerpVectors(const Core::Vector3* inpFrom, const Core::Vector3* inpTo, f32 infInterpFactor, Core::Vector3* outpVectors, u32 inudwCount)
+            {
+                PoseKernels::Lerp(&inpFrom->x, &inpTo->x, infInterpFactor, &outpVectors->x, inudwCount * 3);
+            }
+        }
         //-----------------------------------------------------------
         /// Constructor
         //-----------------------------------------------------------
         SkinnedAnimationGroup::SkinnedAnimationGroup(const Skeleton* inpSkeleton)
         : mpSkeleton(inpSkeleton), mbAnimationLengthDirty(true), mfAnimationLength(0.0f), mbPrepared(false)
         {
-            for (s32 i = 0; i < mpSkeleton->GetNumNodes(); ++i)
-            {
-                mCurrentAnimationMatrices.push_back(Core::Matrix4());
-            }
+            u32 udwNumNodes = (u32)mpSkeleton->GetNumNodes();
+            mCurrentAnimationMatrices.resize(udwNumNodes);
+            AllocatePose(udwNumNodes, mCurrentPose);
+            AllocatePose(udwNumNodes, mBlendPose);
         }
         //----------------------------------------------------------
         /// Attach Animation
@@ -90,53 +126,46 @@ namespace ChilliSource
             if (mAnimations.size() > 1)
             {
                 //find which two animations should be blended together
-                AnimationItemPtr pAnimItem1;
-                AnimationItemPtr pAnimItem2;
-                for (std::vector<AnimationItemPtr>::iterator it = mAnimations.begin(); it != mAnimations.end(); ++it)
+                const AnimationItem* pAnimItem1 = nullptr;
+                const AnimationItem* pAnimItem2 = nullptr;
+                for (std::vector<AnimationItemPtr>::const_iterator it = mAnimations.begin(); it != mAnimations.end(); ++it)
                 {
                     f32 fBlendlinePosition = (*it)->fBlendlinePosition;
                     if (fBlendlinePosition <= infBlendlinePosition && (pAnimItem1 == nullptr || fBlendlinePosition > pAnimItem1->fBlendlinePosition))
                     {
-                        pAnimItem1 = (*it);
+                        pAnimItem1 = it->get();
                     }
                     if (fBlendlinePosition >= infBlendlinePosition && (pAnimItem2 == nullptr || fBlendlinePosition < pAnimItem2->fBlendlinePosition))
                     {
-                        pAnimItem2 = (*it);
+                        pAnimItem2 = it->get();
                     }
                 }
                 
-                //get the animation frames
-                SkinnedAnimation::FrameCUPtr pFrame1;
-                if (pAnimItem1 != nullptr)
-                    pFrame1 = CalculateAnimationFrame(pAnimItem1->pSkinnedAnimation, infPlaybackPosition);
-                
-                SkinnedAnimation::FrameCUPtr pFrame2;
-                if (pAnimItem2 != nullptr)
-                    pFrame2 = CalculateAnimationFrame(pAnimItem2->pSkinnedAnimation, infPlaybackPosition);
-                
-                //check that we do indeed have two animations to blend. if not, just return the frame we do have.
-                if (pFrame1 != nullptr && pFrame2 != nullptr && pAnimItem1.get() != pAnimItem2.get())
+                //check that we do indeed have two animations to blend. if not, just use the one we do have.
+                if (pAnimItem1 != nullptr && pAnimItem2 != nullptr && pAnimItem1 != pAnimItem2)
                 {
-                    //get the interpolation factor and then apply the requested blend to the two frames.
+                    SampleAnimation(pAnimItem1->pSkinnedAnimation.get(), infPlaybackPosition, mCurrentPose);
+                    SampleAnimation(pAnimItem2->pSkinnedAnimation.get(), infPlaybackPosition, mBlendPose);
+                    
+                    //get the interpolation factor and then apply the requested blend to the two poses.
                     f32 fFactor = (infBlendlinePosition - pAnimItem1->fBlendlinePosition) / (pAnimItem2->fBlendlinePosition - pAnimItem1->fBlendlinePosition);
                     switch (ineBlendType)
                     {
                         case AnimationBlendType::k_linear:
-                            mCurrentAnimationData = LerpBetweenFrames(pFrame1.get(), pFrame2.get(), fFactor);
+                            LerpBetweenPoses(mCurrentPose, mBlendPose, fFactor, mCurrentPose);
                             break;
                         default:
                             CS_LOG_ERROR("Invalid animation blend type given.");
-                            mCurrentAnimationData = std::move(pFrame1);
                             break;
                     }
                 }
-                else if (pFrame1 != nullptr)
+                else if (pAnimItem1 != nullptr)
                 {
-                    mCurrentAnimationData = std::move(pFrame1);
+                    SampleAnimation(pAnimItem1->pSkinnedAnimation.get(), infPlaybackPosition, mCurrentPose);
                 }
-                else if (pFrame2 != nullptr)
+                else if (pAnimItem2 != nullptr)
                 {
-                    mCurrentAnimationData = std::move(pFrame2);
+                    SampleAnimation(pAnimItem2->pSkinnedAnimation.get(), infPlaybackPosition, mCurrentPose);
                 }
                 else 
                 {
@@ -147,8 +176,7 @@ namespace ChilliSource
             }
             else if (mAnimations.size() > 0) 
             {
-                const SkinnedAnimationCSPtr& pAnim = mAnimations[0]->pSkinnedAnimation;
-                mCurrentAnimationData = CalculateAnimationFrame(pAnim, infPlaybackPosition);
+                SampleAnimation(mAnimations[0]->pSkinnedAnimation.get(), infPlaybackPosition, mCurrentPose);
                 mbPrepared = true;
             }
             else
@@ -165,7 +193,7 @@ namespace ChilliSource
             switch (ineBlendType)
             {
                 case AnimationBlendType::k_linear:
-                    mCurrentAnimationData = LerpBetweenFrames(mCurrentAnimationData.get(), inpAnimationGroup->mCurrentAnimationData.get(), infBlendFactor);
+                    LerpBetweenPoses(mCurrentPose, inpAnimationGroup->mCurrentPose, infBlendFactor, mCurrentPose);
                     break;
                 default:
                     CS_LOG_ERROR("Invalid animation blend type given.");
@@ -174,31 +202,30 @@ namespace ChilliSource
         }
         //----------------------------------------------------------
         /// Build Matrices
+        ///
+        /// The evaluation order guarantees that a parent's matrix
+        /// is always built before its children's.
         //----------------------------------------------------------
-        void SkinnedAnimationGroup::BuildMatrices(s32 indwCurrentParent, const Core::Matrix4& inParentMatrix)
+        void SkinnedAnimationGroup::BuildMatrices()
         {
             const std::vector<SkeletonNodeCUPtr>& nodes = mpSkeleton->GetNodes();
-			u32 currIndex = 0;
-			for (auto it = nodes.begin(); it != nodes.end(); ++it)
-			{
-				if ((*it)->mdwParentIndex == indwCurrentParent)
-				{
-					//get the world translation and orientation
-					Core::Matrix4 localMat;
-                    if(mCurrentAnimationData->m_nodeTranslations.empty() == false)
-                    {
-						localMat = Core::Matrix4::CreateTransform(mCurrentAnimationData->m_nodeTranslations[currIndex], mCurrentAnimationData->m_nodeScales[currIndex], mCurrentAnimationData->m_nodeOrientations[currIndex]);
-                    }
-					
-					//convert to matrix and store
-					mCurrentAnimationMatrices[currIndex] =  localMat * inParentMatrix;
-					
-					//Apply to all children
-					BuildMatrices(currIndex, mCurrentAnimationMatrices[currIndex]);
-				}
+            const std::vector<u32>& evaluationOrder = mpSkeleton->GetEvaluationOrder();
+            
+            for (u32 udwNode : evaluationOrder)
+            {
+                s32 dwParent = nodes[udwNode]->mdwParentIndex;
+                const Core::Matrix4& parentMatrix = (dwParent >= 0) ? mCurrentAnimationMatrices[dwParent] : Core::Matrix4::k_identity;
                 
-				currIndex++;
-			}
+                if (udwNode < mCurrentPose.m_numNodes)
+                {
+                    PoseKernels::ComposeTransform(mCurrentPose.m_translations[udwNode], mCurrentPose.m_scales[udwNode], mCurrentPose.m_orientations[udwNode], parentMatrix, mCurrentAnimationMatrices[udwNode]);
+                }
+                else
+                {
+                    //no animation data so the local transform is the identity.
+                    mCurrentAnimationMatrices[udwNode] = parentMatrix;
+                }
+            }
         }
         //----------------------------------------------------------
         /// Get Matrix At Index
@@ -212,37 +239,34 @@ namespace ChilliSource
             return Core::Matrix4::k_identity;
         }
         //----------------------------------------------------------
-        /// Apply Inverse Bind Pose
+        /// Build Skinning Palette
         //----------------------------------------------------------
-        void SkinnedAnimationGroup::ApplyInverseBindPose(const std::vector<Core::Matrix4>& inInverseBindPoseMatrices, std::vector<Core::Matrix4>& outCombinedMatrices)
+        void SkinnedAnimationGroup::BuildSkinningPalette(const std::vector<Core::Matrix4>& inInverseBindPoseMatrices, std::vector<Core::Vector4>& outPalette) const
         {
             const std::vector<s32>& kadwJoints = mpSkeleton->GetJointIndices();
             
-            outCombinedMatrices.clear();
-            for (u32 i = 0; i < kadwJoints.size(); ++i)
-            {
-                outCombinedMatrices.push_back(Core::Matrix4());
-            }
-            
             //check that they have the same number of joints
 			if (kadwJoints.size() != inInverseBindPoseMatrices.size())
 			{
 				CS_LOG_ERROR("Cannot apply bind pose matrices to joint matrices, because they are not from the same skeleton.");
 			}
+            
+            const u32 kudwNumRowsPerJoint = 3;
+            if (outPalette.size() != kadwJoints.size() * kudwNumRowsPerJoint)
+            {
+                outPalette.resize(kadwJoints.size() * kudwNumRowsPerJoint);
+            }
 			
-			//iterate through and multiply together to get the new array
-			s32 count = 0;
-			std::vector<s32>::const_iterator joint = kadwJoints.begin();
-			for (std::vector<Core::Matrix4>::const_iterator ibp = inInverseBindPoseMatrices.begin(); 
-				 joint != kadwJoints.end() && ibp != inInverseBindPoseMatrices.end();)
+			//multiply together and drop the final column as it is always [0 0 0 1].
+            u32 udwNumJoints = std::min(kadwJoints.size(), inInverseBindPoseMatrices.size());
+			for (u32 i = 0; i < udwNumJoints; ++i)
 			{
-				//multiply together
-				outCombinedMatrices[count] = ((*ibp) * (mCurrentAnimationMatrices[*joint]));
-				
-				//incriment the iterators
-				++joint;
-				++ibp;
-				count++;
+				Core::Matrix4 joint = inInverseBindPoseMatrices[i] * mCurrentAnimationMatrices[kadwJoints[i]];
+                
+                Core::Vector4* pRows = &outPalette[i * kudwNumRowsPerJoint];
+                pRows[0] = Core::Vector4(joint.m[0], joint.m[4], joint.m[8], joint.m[12]);
+                pRows[1] = Core::Vector4(joint.m[1], joint.m[5], joint.m[9], joint.m[13]);
+                pRows[2] = Core::Vector4(joint.m[2], joint.m[6], joint.m[10], joint.m[14]);
 			}
         }
         //----------------------------------------------------------
@@ -305,9 +329,9 @@ namespace ChilliSource
             }
         }
         //----------------------------------------------------------
-        /// Calculate Animation Frame
+        /// Sample Animation
         //----------------------------------------------------------
-        SkinnedAnimation::FrameCUPtr SkinnedAnimationGroup::CalculateAnimationFrame(const SkinnedAnimationCSPtr& inpAnimation, f32 infPlaybackPosition)
+        void SkinnedAnimationGroup::SampleAnimation(const SkinnedAnimation* inpAnimation, f32 infPlaybackPosition, Pose& outPose) const
         {
             //report errors if the playback position provided does not make sense
             if (infPlaybackPosition < 0.0f)
@@ -315,6 +339,15 @@ namespace ChilliSource
                 CS_LOG_ERROR("A playback position below 0 does not make sense.");
             }
             
+            //compressed animations are sampled directly from their tracks.
+            const CompressedAnimationData* pCompressedData = inpAnimation->GetCompressedData();
+            if (pCompressedData != nullptr)
+            {
+                f32 fFrame = infPlaybackPosition / inpAnimation->GetFrameTime();
+                outPose.m_numNodes = pCompressedData->Sample(fFrame, outPose.m_translations.data(), outPose.m_orientations.data(), outPose.m_scales.data(), (u32)outPose.m_translations.size());
+                return;
+            }
+            
             //calculate the two frame indices this is between
 			f32 frames = infPlaybackPosition / inpAnimation->GetFrameTime();
 			s32 dwFrameAIndex = (s32)floorf(frames);
@@ -349,70 +382,45 @@ namespace ChilliSource
 			f32 interpFactor = (infPlaybackPosition - (dwFrameAIndex * inpAnimation->GetFrameTime())) / inpAnimation->GetFrameTime();
 			
 			//blend between frames
-            return LerpBetweenFrames(frameA, frameB, interpFactor);
+            LerpBetweenFrames(frameA, frameB, interpFactor, outPose);
         }
         //--------------------------------------------------------------
         /// Lerp Between Frames
         //--------------------------------------------------------------
-        SkinnedAnimation::FrameCUPtr SkinnedAnimationGroup::LerpBetweenFrames(const SkinnedAnimation::Frame* inFrameA, const SkinnedAnimation::Frame* inFrameB, f32 infInterpFactor)
+        void SkinnedAnimationGroup::LerpBetweenFrames(const SkinnedAnimation::Frame* inFrameA, const SkinnedAnimation::Frame* inFrameB, f32 infInterpFactor, Pose& outPose) const
         {
-            SkinnedAnimation::FrameUPtr outFrame(new SkinnedAnimation::Frame());
-			
+            outPose.m_numNodes = 0;
+            
             if(inFrameA != nullptr && inFrameB != nullptr)
             {
-                //iterate through each translation
-                outFrame->m_nodeTranslations.reserve(inFrameB->m_nodeTranslations.size());
-                std::vector<Core::Vector3>::const_iterator transAIt = inFrameA->m_nodeTranslations.begin();
-                for (std::vector<Core::Vector3>::const_iterator transBIt = inFrameB->m_nodeTranslations.begin();
-                     transAIt != inFrameA->m_nodeTranslations.end() && transBIt != inFrameB->m_nodeTranslations.end();)
-                {
-                    //lerp
-                    Core::Vector3 newTrans = Core::MathUtils::Lerp(infInterpFactor, *transAIt, *transBIt);
-                    
-                    //add to frame
-                    outFrame->m_nodeTranslations.push_back(newTrans);
-                    
-                    //incriment the iterators
-                    ++transAIt;
-                    ++transBIt;
-                }
+                //only nodes with a full transform in both frames can be interpolated.
+                size_t udwNumNodes = outPose.m_translations.size();
+                udwNumNodes = std::min(udwNumNodes, std::min(inFrameA->m_nodeTranslations.size(), inFrameB->m_nodeTranslations.size()));
+                udwNumNodes = std::min(udwNumNodes, std::min(inFrameA->m_nodeOrientations.size(), inFrameB->m_nodeOrientations.size()));
+                udwNumNodes = std::min(udwNumNodes, std::min(inFrameA->m_nodeScales.size(), inFrameB->m_nodeScales.size()));
                 
-                //iterate through each orientation
-                outFrame->m_nodeOrientations.reserve(inFrameB->m_nodeOrientations.size());
-                std::vector<Core::Quaternion>::const_iterator orientAIt = inFrameA->m_nodeOrientations.begin();
-                for (std::vector<Core::Quaternion>::const_iterator orientBIt = inFrameB->m_nodeOrientations.begin();
-                     orientAIt != inFrameA->m_nodeOrientations.end() && orientBIt != inFrameB->m_nodeOrientations.end();)
+                if (udwNumNodes > 0)
                 {
-                    //lerp
-                    Core::Quaternion newOrient = Core::Quaternion::Slerp(*orientAIt, *orientBIt, infInterpFactor);
-                    
-                    //add to frame
-                    outFrame->m_nodeOrientations.push_back(newOrient);
-                    
-                    //incriment the iterators
-                    ++orientAIt;
-                    ++orientBIt;
-                }
-                
-                //iterate through each scale
-                outFrame->m_nodeScales.reserve(inFrameB->m_nodeScales.size());
-                std::vector<Core::Vector3>::const_iterator scaleAIt = inFrameA->m_nodeScales.begin();
-                for (std::vector<Core::Vector3>::const_iterator scaleBIt = inFrameB->m_nodeScales.begin();
-                     scaleAIt != inFrameA->m_nodeScales.end() && scaleBIt != inFrameB->m_nodeScales.end();)
-                {
-                    //lerp
-                    Core::Vector3 newScale = Core::MathUtils::Lerp(infInterpFactor, *scaleAIt, *scaleBIt);
-                    
-                    //add to frame
-                    outFrame->m_nodeScales.push_back(newScale);
-                    
-                    //incriment the iterators
-                    ++scaleAIt;
-                    ++scaleBIt;
+                    outPose.m_numNodes = (u32)udwNumNodes;
+                    LerpVectors(inFrameA->m_nodeTranslations.data(), inFrameB->m_nodeTranslations.data(), infInterpFactor, outPose.m_translations.data(), outPose.m_numNodes);
+                    PoseKernels::Slerp(inFrameA->m_nodeOrientations.data(), inFrameB->m_nodeOrientations.data(), infInterpFactor, outPose.m_orientations.data(), outPose.m_numNodes);
+                    LerpVectors(inFrameA->m_nodeScales.data(), inFrameB->m_nodeScales.data(), infInterpFactor, outPose.m_scales.data(), outPose.m_numNodes);
                 }
             }
-			
-			return SkinnedAnimation::FrameCUPtr(std::move(outFrame));
+        }
+        //--------------------------------------------------------------
+        /// Lerp Between Poses
+        //--------------------------------------------------------------
+        void SkinnedAnimationGroup::LerpBetweenPoses(const Pose& inPoseA, const Pose& inPoseB, f32 infInterpFactor, Pose& outPose) const
+        {
+            u32 udwNumNodes = std::min(inPoseA.m_numNodes, inPoseB.m_numNodes);
+            if (udwNumNodes > 0)
+            {
+                LerpVectors(inPoseA.m_translations.data(), inPoseB.m_translations.data(), infInterpFactor, outPose.m_translations.data(), udwNumNodes);
+                PoseKernels::Slerp(inPoseA.m_orientations.data(), inPoseB.m_orientations.data(), infInterpFactor, outPose.m_orientations.data(), udwNumNodes);
+                LerpVectors(inPoseA.m_scales.data(), inPoseB.m_scales.data(), infInterpFactor, outPose.m_scales.data(), udwNumNodes);
+            }
+            outPose.m_numNodes = udwNumNodes;
         }
     }
 }
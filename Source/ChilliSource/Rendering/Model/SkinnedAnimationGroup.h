@@ -32,6 +32,7 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/File/FileSystem.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/Math/Vector4.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
 
 namespace ChilliSource
@@ -110,12 +111,10 @@ namespace ChilliSource
 			/// Build Matrices
             ///
             /// Builds the animation matrix data from the current
-            /// animation data.
-            ///
-            /// @param the current parent.
-            /// @param the parent matrix.
+            /// animation data. The nodes are walked once in the
+            /// skeleton's evaluation order.
 			//----------------------------------------------------------
-			void BuildMatrices(s32 indwCurrentParent = -1, const Core::Matrix4& inParentMatrix = Core::Matrix4());
+			void BuildMatrices();
             //----------------------------------------------------------
 			/// Get Matrix At Index
             ///
@@ -124,15 +123,19 @@ namespace ChilliSource
 			//----------------------------------------------------------
             const Core::Matrix4& GetMatrixAtIndex(s32 indwIndex) const;
             //----------------------------------------------------------
-			/// Apply Inverse Bind Pose
+			/// Build Skinning Palette
             ///
-            /// outputs a copy of the current animation matrix data with
-            /// the inverse bind pose matrices applied.
+            /// Applies the inverse bind pose matrices to the current
+            /// animation matrix data and writes the result in the
+            /// packed layout used by the skinning shaders: the constant
+            /// last column of each joint matrix is dropped leaving three
+            /// Vector4 rows per joint. The output is only resized if
+            /// the number of joints has changed.
             ///
             /// @param the inverse bind pose matrices.
-            /// @param OUT: The combined matrices.
+            /// @param OUT: The packed joint palette.
 			//----------------------------------------------------------
-			void ApplyInverseBindPose(const std::vector<Core::Matrix4>& inInverseBindPoseMatrices, std::vector<Core::Matrix4>& outCombinedMatrices);
+			void BuildSkinningPalette(const std::vector<Core::Matrix4>& inInverseBindPoseMatrices, std::vector<Core::Vector4>& outPalette) const;
             //----------------------------------------------------------
 			/// Get Animation Length
             ///
@@ -170,6 +173,20 @@ namespace ChilliSource
                 f32 fBlendlinePosition;
             };
             typedef std::shared_ptr<AnimationItem> AnimationItemPtr;
+            //----------------------------------------------------------
+            /// Pose
+            ///
+            /// The local transform of every node in the skeleton stored
+            /// as separate streams. Poses are sized to the skeleton on
+            /// construction so sampling and blending never allocate.
+            //----------------------------------------------------------
+            struct Pose
+            {
+                std::vector<Core::Vector3> m_translations;
+                std::vector<Core::Quaternion> m_orientations;
+                std::vector<Core::Vector3> m_scales;
+                u32 m_numNodes = 0;
+            };
             //----------------------------------------------------------
 			/// Calculate Animation Length
             ///
@@ -178,30 +195,45 @@ namespace ChilliSource
 			//----------------------------------------------------------
             void CalculateAnimationLength();
             //----------------------------------------------------------
-			/// Calculate Animation Frame
+			/// Sample Animation
             ///
-            /// Gets the frame data from a single animation.
+            /// Samples a single animation at the given playback position
+            /// into the given pose.
             ///
-            /// @param The blend type.
             /// @param the animation.
             /// @param the playback position.
+            /// @param OUT: The pose.
 			//----------------------------------------------------------
-            SkinnedAnimation::FrameCUPtr CalculateAnimationFrame(const SkinnedAnimationCSPtr& inpAnimation, f32 infPlaybackPosition);
+            void SampleAnimation(const SkinnedAnimation* inpAnimation, f32 infPlaybackPosition, Pose& outPose) const;
             //--------------------------------------------------------------
 			/// Lerp Between Frames
 			///
-			/// Linearly interpolates between two animation frames.
+			/// Linearly interpolates between two animation frames into
+			/// the given pose.
 			///
 			/// @param frame 1
 			/// @param frame 2
 			/// @param the interpolation factor
-			/// @return output interpolated frame.
+			/// @param OUT: The pose.
+			//--------------------------------------------------------------
+            void LerpBetweenFrames(const SkinnedAnimation::Frame* inFrameA, const SkinnedAnimation::Frame* inFrameB, f32 infInterpFactor, Pose& outPose) const;
+            //--------------------------------------------------------------
+			/// Lerp Between Poses
+			///
+			/// Linearly interpolates between two poses. The output may
+			/// be either of the inputs.
+			///
+			/// @param pose 1
+			/// @param pose 2
+			/// @param the interpolation factor
+			/// @param OUT: The pose.
 			//--------------------------------------------------------------
-            SkinnedAnimation::FrameCUPtr LerpBetweenFrames(const SkinnedAnimation::Frame* inFrameA, const SkinnedAnimation::Frame* inFrameB, f32 infInterpFactor);
+            void LerpBetweenPoses(const Pose& inPoseA, const Pose& inPoseB, f32 infInterpFactor, Pose& outPose) const;
             
             const Skeleton* mpSkeleton;
             std::vector<AnimationItemPtr> mAnimations;
-            SkinnedAnimation::FrameCUPtr mCurrentAnimationData;
+            Pose mCurrentPose;
+            Pose mBlendPose;
             std::vector<Core::Matrix4> mCurrentAnimationMatrices;
             bool mbAnimationLengthDirty;
             f32 mfAnimationLength;
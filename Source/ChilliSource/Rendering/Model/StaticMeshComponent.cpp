@@ -67,6 +67,11 @@ namespace ChilliSource
 		//----------------------------------------------------
 		const Core::AABB& StaticMeshComponent::GetAABB()
 		{
+            if(GetEntity())
+            {
+                CheckEntityWorldVersion();
+            }
+            
 			if(GetEntity() && !m_isAABBValid)
 			{
                 m_isAABBValid = true;
@@ -150,6 +155,11 @@ namespace ChilliSource
 		//----------------------------------------------------
 		const Core::OOBB& StaticMeshComponent::GetOOBB()
 		{
+            if(GetEntity())
+            {
+                CheckEntityWorldVersion();
+            }
+            
 			if(GetEntity() && !m_isOOBBValid)
 			{
                 m_isOOBBValid = true;
@@ -164,6 +174,11 @@ namespace ChilliSource
 		//----------------------------------------------------
 		const Core::Sphere& StaticMeshComponent::GetBoundingSphere()
 		{
+            if(GetEntity())
+            {
+                CheckEntityWorldVersion();
+            }
+            
 			if(GetEntity() && !m_isBSValid)
 			{
                 m_isBSValid = true;
@@ -335,6 +350,17 @@ namespace ChilliSource
         }
         //----------------------------------------------------
         //----------------------------------------------------
+        void StaticMeshComponent::CheckEntityWorldVersion()
+        {
+            const u32 worldVersion = GetEntity()->GetTransform().GetWorldVersion();
+            if(worldVersion != m_entityWorldVersion)
+            {
+                m_entityWorldVersion = worldVersion;
+                OnEntityTransformChanged();
+            }
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
         void StaticMeshComponent::OnRemovedFromScene()
         {
             m_transformChangedConnection = nullptr;
@@ -196,6 +196,13 @@ namespace ChilliSource
             //----------------------------------------------------
             void OnEntityTransformChanged();
             //----------------------------------------------------
+            /// Dirties the bounding volumes if the entity's world
+            /// transform has changed without the changed event
+            /// being sent yet, as happens in the deferred update
+            /// mode.
+            //----------------------------------------------------
+            void CheckEntityWorldVersion();
+            //----------------------------------------------------
             /// Triggered when the component is removed from
             /// an entity on the scene
             ///
@@ -213,6 +220,7 @@ namespace ChilliSource
             bool m_isBSValid;
             bool m_isAABBValid;
             bool m_isOOBBValid;
+            u32 m_entityWorldVersion = 0;
 		};
 	}
 }
@@ -180,7 +180,7 @@ namespace ChilliSource
 		//-----------------------------------------------------------------
 		/// Render
 		//-----------------------------------------------------------------
-		void SubMesh::Render(RenderSystem* inpRenderSystem, const Core::Matrix4 &inmatWorld, const MaterialCSPtr& inpMaterial, ShaderPass in_shaderPass, const SkinnedAnimationGroupSPtr& inpAnimationGroup) const
+		void SubMesh::Render(RenderSystem* inpRenderSystem, const Core::Matrix4 &inmatWorld, const MaterialCSPtr& inpMaterial, ShaderPass in_shaderPass, const std::vector<Core::Vector4>* inpSkinningPalette) const
 		{
             CS_ASSERT(mpMeshBuffer->GetVertexCount() > 0, "Cannot render Sub Mesh without vertices");
             
@@ -188,12 +188,9 @@ namespace ChilliSource
             {
                 inpRenderSystem->ApplyMaterial(inpMaterial, in_shaderPass);
                 
-                if (inpAnimationGroup != nullptr)
+                if (inpSkinningPalette != nullptr)
                 {
-                    //Apply inverse bind pose matrix.
-                    std::vector<Core::Matrix4> combinedMatrices;
-                    inpAnimationGroup->ApplyInverseBindPose(mpInverseBindPose->mInverseBindPoseMatrices, combinedMatrices);
-                    inpRenderSystem->ApplyJoints(combinedMatrices);
+                    inpRenderSystem->ApplyJoints(*inpSkinningPalette);
                 }
                 
                 mpMeshBuffer->Bind();
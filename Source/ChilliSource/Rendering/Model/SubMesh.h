@@ -149,8 +149,12 @@ namespace ChilliSource
 			///
 			/// @param the render system.
 			/// @param World transform matrix
+			/// @param The material.
+			/// @param Shader pass
+			/// @param The packed joint palette for this sub mesh or null
+			/// if it is not skinned.
 			//-----------------------------------------------------------------
-			void Render(RenderSystem* inpRenderSystem, const Core::Matrix4 &inmatWorld, const MaterialCSPtr& inpMaterial, ShaderPass in_shaderPass, const SkinnedAnimationGroupSPtr& inpAnimationGroup) const;
+			void Render(RenderSystem* inpRenderSystem, const Core::Matrix4 &inmatWorld, const MaterialCSPtr& inpMaterial, ShaderPass in_shaderPass, const std::vector<Core::Vector4>* inpSkinningPalette) const;
 			
 			friend class Mesh;
 			
@@ -32,9 +32,11 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Rendering/Particle/CSParticleProvider.h>
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffectComponent.h>
+#include <ChilliSource/Rendering/Particle/ParticleKernels.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
+#include <ChilliSource/Rendering/Particle/ParticleUpdateSystem.h>
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffector.h>
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffectorDef.h>
 #include <ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffector.h>
@@ -29,8 +29,9 @@
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleKernels.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffectorDef.h>
 
 namespace ChilliSource
@@ -39,9 +40,13 @@ namespace ChilliSource
 	{
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		AccelerationParticleAffector::AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray)
-			: ParticleAffector(in_affectorDef, in_particleArray), m_particleAcceleration(in_particleArray->size())
+		AccelerationParticleAffector::AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool)
+			: ParticleAffector(in_affectorDef, in_particlePool)
 		{
+			m_accelerationXStream = in_particlePool->AddCustomStream();
+			m_accelerationYStream = in_particlePool->AddCustomStream();
+			m_accelerationZStream = in_particlePool->AddCustomStream();
+
 			//This can only be created by the AccelerationParticleAffectorDef so this is safe.
 			m_accelerationAffectorDef = static_cast<const AccelerationParticleAffectorDef*>(in_affectorDef);
 		}
@@ -49,22 +54,24 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void AccelerationParticleAffector::ActivateParticle(u32 in_index, f32 in_effectProgress)
 		{
-			CS_ASSERT(in_index >= 0 && in_index < m_particleAcceleration.size(), "Index out of bounds!");
+			ParticlePool* particlePool = GetParticlePool();
+			CS_ASSERT(in_index < particlePool->GetNumActive(), "Index out of bounds!");
 
-			m_particleAcceleration[in_index] = m_accelerationAffectorDef->GetAccelerationProperty()->GenerateValue(in_effectProgress);
+			Core::Vector3 acceleration = m_accelerationAffectorDef->GetAccelerationProperty()->GenerateValue(in_effectProgress);
+			particlePool->GetCustomStream(m_accelerationXStream)[in_index] = acceleration.x;
+			particlePool->GetCustomStream(m_accelerationYStream)[in_index] = acceleration.y;
+			particlePool->GetCustomStream(m_accelerationZStream)[in_index] = acceleration.z;
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void AccelerationParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
+		void AccelerationParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_startIndex, u32 in_endIndex)
 		{
-			Core::dynamic_array<Particle>* particleArray = GetParticleArray();
-			for (u32 i = 0; i < particleArray->size(); ++i)
-			{
-				Particle& particle = particleArray->at(i);
-				Core::Vector3& acceleration = m_particleAcceleration[i];
+			ParticlePool* particlePool = GetParticlePool();
+			const u32 count = in_endIndex - in_startIndex;
 
-				particle.m_velocity += acceleration * in_deltaTime;
-			}
+			ParticleKernels::MultiplyAdd(particlePool->GetStream(ParticlePool::Stream::k_velocityX) + in_startIndex, particlePool->GetCustomStream(m_accelerationXStream) + in_startIndex, in_deltaTime, count);
+			ParticleKernels::MultiplyAdd(particlePool->GetStream(ParticlePool::Stream::k_velocityY) + in_startIndex, particlePool->GetCustomStream(m_accelerationYStream) + in_startIndex, in_deltaTime, count);
+			ParticleKernels::MultiplyAdd(particlePool->GetStream(ParticlePool::Stream::k_velocityZ) + in_startIndex, particlePool->GetCustomStream(m_accelerationZStream) + in_startIndex, in_deltaTime, count);
 		}
 	}
 }
\ No newline at end of file
@@ -31,7 +31,6 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/Colour.h>
-#include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
 
 namespace ChilliSource
@@ -58,15 +57,15 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			void ActivateParticle(u32 in_index, f32 in_effectProgress) override;
 			//----------------------------------------------------------------
-			/// Accelerates all active particles.
+			/// Accelerates the given range of particles.
 			///
-			/// @author Ian Copland
-            ///
             /// @param The delta time.
             /// @param The current normalised (0.0 to 1.0) progress through
             /// playback of the particle effect.
+			/// @param The index of the first particle in the range.
+			/// @param The index one past the last particle in the range.
 			//----------------------------------------------------------------
-			void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) override;
+			void AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_startIndex, u32 in_endIndex) override;
 			//----------------------------------------------------------------
 			/// Destructor
 			///
@@ -81,12 +80,14 @@ namespace ChilliSource
 			/// @author Ian Copland
 			///
 			/// @param The particle affector definition.
-			/// @param The particle array.
+			/// @param The particle pool.
 			//----------------------------------------------------------------
-			AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray);
+			AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool);
 
 			const AccelerationParticleAffectorDef* m_accelerationAffectorDef = nullptr;
-			Core::dynamic_array<Core::Vector3> m_particleAcceleration;
+			u32 m_accelerationXStream = 0;
+			u32 m_accelerationYStream = 0;
+			u32 m_accelerationZStream = 0;
 		};
 	}
 }
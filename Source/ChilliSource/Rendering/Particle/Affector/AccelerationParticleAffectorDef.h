@@ -97,11 +97,11 @@ namespace ChilliSource
 			///
 			/// @author Ian Copland.
 			///
-			/// @param The particle array.
+			/// @param The particle pool.
 			///
 			/// @return the instance.
 			//----------------------------------------------------------------
-			ParticleAffectorUPtr CreateInstance(Core::dynamic_array<Particle>* in_particleArray) const override;
+			ParticleAffectorUPtr CreateInstance(ParticlePool* in_particlePool) const override;
 			//----------------------------------------------------------------
 			/// @author Ian Copland
 			///
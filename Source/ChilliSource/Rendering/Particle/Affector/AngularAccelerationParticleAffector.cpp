@@ -29,8 +29,9 @@
 #include <ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleKernels.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
 #include <ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffectorDef.h>
 
 namespace ChilliSource
@@ -39,9 +40,11 @@ namespace ChilliSource
 	{
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		AngularAccelerationParticleAffector::AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray)
-			: ParticleAffector(in_affectorDef, in_particleArray), m_particleAngularAcceleration(in_particleArray->size())
+		AngularAccelerationParticleAffector::AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool)
+			: ParticleAffector(in_affectorDef, in_particlePool)
 		{
+			m_angularAccelerationStream = in_particlePool->AddCustomStream();
+
 			//This can only be created by the AngularAccelerationParticleAffectorDef so this is safe.
 			m_angularAccelerationAffectorDef = static_cast<const AngularAccelerationParticleAffectorDef*>(in_affectorDef);
 		}
@@ -49,21 +52,17 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void AngularAccelerationParticleAffector::ActivateParticle(u32 in_index, f32 in_effectProgress)
 		{
-			CS_ASSERT(in_index >= 0 && in_index < m_particleAngularAcceleration.size(), "Index out of bounds!");
+			ParticlePool* particlePool = GetParticlePool();
+			CS_ASSERT(in_index < particlePool->GetNumActive(), "Index out of bounds!");
 
-			m_particleAngularAcceleration[in_index] = m_angularAccelerationAffectorDef->GetAngularAccelerationProperty()->GenerateValue(in_effectProgress);
+			particlePool->GetCustomStream(m_angularAccelerationStream)[in_index] = m_angularAccelerationAffectorDef->GetAngularAccelerationProperty()->GenerateValue(in_effectProgress);
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void AngularAccelerationParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
+		void AngularAccelerationParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_startIndex, u32 in_endIndex)
 		{
-			Core::dynamic_array<Particle>* particleArray = GetParticleArray();
-			for (u32 i = 0; i < particleArray->size(); ++i)
-			{
-				Particle& particle = particleArray->at(i);
-				f32 angularAcceleration = m_particleAngularAcceleration[i];
-				particle.m_angularVelocity += angularAcceleration * in_deltaTime;
-			}
+			ParticlePool* particlePool = GetParticlePool();
+			ParticleKernels::MultiplyAdd(particlePool->GetStream(ParticlePool::Stream::k_angularVelocity) + in_startIndex, particlePool->GetCustomStream(m_angularAccelerationStream) + in_startIndex, in_deltaTime, in_endIndex - in_startIndex);
 		}
 	}
 }
\ No newline at end of file
@@ -30,7 +30,6 @@
 #define _CHILLISOURCE_RENDERING_PARTICLE_AFFECTOR_ANGULARACCELERATIONPARTICLEAFFECTOR_H_
 
 #include <ChilliSource/ChilliSource.h>
-#include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
 
 namespace ChilliSource
@@ -58,15 +57,15 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			void ActivateParticle(u32 in_index, f32 in_effectProgress) override;
 			//----------------------------------------------------------------
-			/// Angularly accelerates each active particle.
+			/// Angularly accelerates each particle in the given range.
 			///
-			/// @author Ian Copland
-            ///
             /// @param The delta time.
             /// @param The current normalised (0.0 to 1.0) progress through
             /// playback of the particle effect.
+			/// @param The index of the first particle in the range.
+			/// @param The index one past the last particle in the range.
 			//----------------------------------------------------------------
-			void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) override;
+			void AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_startIndex, u32 in_endIndex) override;
 			//----------------------------------------------------------------
 			/// Destructor
 			///
@@ -81,12 +80,12 @@ namespace ChilliSource
 			/// @author Ian Copland
 			///
 			/// @param The particle affector definition.
-			/// @param The particle array.
+			/// @param The particle pool.
 			//----------------------------------------------------------------
-			AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray);
+			AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool);
 
 			const AngularAccelerationParticleAffectorDef* m_angularAccelerationAffectorDef = nullptr;
-			Core::dynamic_array<f32> m_particleAngularAcceleration;
+			u32 m_angularAccelerationStream = 0;
 		};
 	}
 }
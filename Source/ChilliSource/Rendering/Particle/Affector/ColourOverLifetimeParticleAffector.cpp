@@ -29,19 +29,30 @@
 #include <ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleKernels.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
 #include <ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffectorDef.h>
 
 namespace ChilliSource
 {
 	namespace Rendering
 	{
+		namespace
+		{
+			const ParticlePool::Stream k_colourStreams[] = { ParticlePool::Stream::k_colourR, ParticlePool::Stream::k_colourG, ParticlePool::Stream::k_colourB, ParticlePool::Stream::k_colourA };
+		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ColourOverLifetimeParticleAffector::ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray)
-			: ParticleAffector(in_affectorDef, in_particleArray), m_particleColourData(in_particleArray->size())
+		ColourOverLifetimeParticleAffector::ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool)
+			: ParticleAffector(in_affectorDef, in_particlePool)
 		{
+			for (u32 i = 0; i < k_numColourComponents; ++i)
+			{
+				m_initialColourStreams[i] = in_particlePool->AddCustomStream();
+				m_targetColourStreams[i] = in_particlePool->AddCustomStream();
+			}
+
 			//This can only be created by the ColourOverLifetimeParticleAffectorDef so this is safe.
 			m_colourOverLifetimeAffectorDef = static_cast<const ColourOverLifetimeParticleAffectorDef*>(in_affectorDef);
 		}
@@ -49,27 +60,29 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void ColourOverLifetimeParticleAffector::ActivateParticle(u32 in_index, f32 in_effectProgress)
 		{
-			CS_ASSERT(in_index >= 0 && in_index < m_particleColourData.size(), "Index out of bounds!");
+			ParticlePool* particlePool = GetParticlePool();
+			CS_ASSERT(in_index < particlePool->GetNumActive(), "Index out of bounds!");
 
-			ColourData& colourData = m_particleColourData[in_index];
-			const Particle& particle = GetParticleArray()->at(in_index);
-			
-			colourData.m_initialColour = particle.m_colour;
+			Core::Colour targetColour = m_colourOverLifetimeAffectorDef->GetTargetColourProperty()->GenerateValue(in_effectProgress);
+			const f32 targetComponents[k_numColourComponents] = { targetColour.r, targetColour.g, targetColour.b, targetColour.a };
 
-			colourData.m_targetColour = m_colourOverLifetimeAffectorDef->GetTargetColourProperty()->GenerateValue(in_effectProgress);
+			for (u32 i = 0; i < k_numColourComponents; ++i)
+			{
+				particlePool->GetCustomStream(m_initialColourStreams[i])[in_index] = particlePool->GetStream(k_colourStreams[i])[in_index];
+				particlePool->GetCustomStream(m_targetColourStreams[i])[in_index] = targetComponents[i];
+			}
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void ColourOverLifetimeParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
+		void ColourOverLifetimeParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_startIndex, u32 in_endIndex)
 		{
-			Core::dynamic_array<Particle>* particleArray = GetParticleArray();
-			for (u32 i = 0; i < particleArray->size(); ++i)
-			{
-				Particle& particle = particleArray->at(i);
-				ColourData& colourData = m_particleColourData[i];
+			ParticlePool* particlePool = GetParticlePool();
+			const f32* lifeProgress = particlePool->GetStream(ParticlePool::Stream::k_lifeProgress) + in_startIndex;
+			const u32 count = in_endIndex - in_startIndex;
 
-				f32 normalisedLifeProgress = 1.0f - (particle.m_energy / particle.m_lifetime);
-				particle.m_colour = colourData.m_initialColour + (colourData.m_targetColour - colourData.m_initialColour) * normalisedLifeProgress;
+			for (u32 i = 0; i < k_numColourComponents; ++i)
+			{
+				ParticleKernels::Lerp(particlePool->GetCustomStream(m_initialColourStreams[i]) + in_startIndex, particlePool->GetCustomStream(m_targetColourStreams[i]) + in_startIndex, lifeProgress, particlePool->GetStream(k_colourStreams[i]) + in_startIndex, count);
 			}
 		}
 	}
@@ -31,7 +31,6 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/Colour.h>
-#include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
 
 namespace ChilliSource
@@ -60,15 +59,15 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			void ActivateParticle(u32 in_index, f32 in_effectProgress) override;
 			//----------------------------------------------------------------
-			/// Updates the colour of each particle.
+			/// Updates the colour of each particle in the given range.
 			///
-			/// @author Ian Copland
-            ///
             /// @param The delta time.
             /// @param The current normalised (0.0 to 1.0) progress through
             /// playback of the particle effect.
+			/// @param The index of the first particle in the range.
+			/// @param The index one past the last particle in the range.
 			//----------------------------------------------------------------
-			void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) override;
+			void AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_startIndex, u32 in_endIndex) override;
 			//----------------------------------------------------------------
 			/// Destructor
 			///
@@ -83,23 +82,15 @@ namespace ChilliSource
 			/// @author Ian Copland
 			///
 			/// @param The particle affector definition.
-			/// @param The particle array.
-			//----------------------------------------------------------------
-			ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray);
+			/// @param The particle pool.
 			//----------------------------------------------------------------
-			/// A container for the initial and target colour of a single 
-			/// particle.
-			///
-			/// @author Ian Copland.
-			//----------------------------------------------------------------
-			struct ColourData
-			{
-				Core::Colour m_initialColour;
-				Core::Colour m_targetColour;
-			};
+			ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool);
+
+			static const u32 k_numColourComponents = 4;
 
 			const ColourOverLifetimeParticleAffectorDef* m_colourOverLifetimeAffectorDef = nullptr;
-			Core::dynamic_array<ColourData> m_particleColourData;
+			u32 m_initialColourStreams[k_numColourComponents];
+			u32 m_targetColourStreams[k_numColourComponents];
 		};
 	}
 }
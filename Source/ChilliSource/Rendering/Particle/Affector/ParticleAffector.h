@@ -53,11 +53,12 @@ namespace ChilliSource
 			/// @author Ian Copland
 			///
 			/// @param The particle affector definition.
-			/// @param The particle array.
+			/// @param The particle pool.
 			//----------------------------------------------------------------
-			ParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray);
+			ParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool);
 			//----------------------------------------------------------------
-			/// Activates the particle with the given index.
+			/// Activates the particle with the given index. The particle's
+			/// built-in streams will already have been set by the emitter.
 			///
 			/// This will be called on a background thread.
 			///
@@ -69,17 +70,20 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			virtual void ActivateParticle(u32 in_index, f32 in_effectProgress) = 0;
 			//----------------------------------------------------------------
-			/// Applies the affect to each of the active particles.
+			/// Applies the affect to the given range of active particles.
+			/// Large effects are split into several ranges which are
+			/// updated concurrently, so implementations must only touch
+			/// particles inside the range.
 			///
 			/// This will be called on a background thread.
 			///
-			/// @author Ian Copland
-			///
 			/// @param The delta time.
             /// @param The current normalised (0.0 to 1.0) progress through
             /// playback of the particle effect.
+			/// @param The index of the first particle in the range.
+			/// @param The index one past the last particle in the range.
 			//----------------------------------------------------------------
-			virtual void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) = 0;
+			virtual void AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_startIndex, u32 in_endIndex) = 0;
 			//----------------------------------------------------------------
 			/// Destructor
 			///
@@ -96,13 +100,13 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			/// @author Ian Copland
 			///
-			/// @return The particle array.
+			/// @return The particle pool.
 			//----------------------------------------------------------------
-			Core::dynamic_array<Particle>* GetParticleArray() const;
+			ParticlePool* GetParticlePool() const;
 		private:
 
 			const ParticleAffectorDef* m_affectorDef = nullptr;
-			Core::dynamic_array<Particle>* m_particleArray = nullptr;
+			ParticlePool* m_particlePool = nullptr;
 		};
 	}
 }
@@ -29,8 +29,9 @@
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleKernels.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffectorDef.h>
 
 namespace ChilliSource
@@ -39,9 +40,14 @@ namespace ChilliSource
 	{
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ScaleOverLifetimeParticleAffector::ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray)
-			: ParticleAffector(in_affectorDef, in_particleArray), m_particleScaleData(in_particleArray->size())
+		ScaleOverLifetimeParticleAffector::ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool)
+			: ParticleAffector(in_affectorDef, in_particlePool)
 		{
+			m_initialScaleXStream = in_particlePool->AddCustomStream();
+			m_initialScaleYStream = in_particlePool->AddCustomStream();
+			m_targetScaleXStream = in_particlePool->AddCustomStream();
+			m_targetScaleYStream = in_particlePool->AddCustomStream();
+
 			//This can only be created by the ScaleOverLifetimeParticleAffectorDef so this is safe.
 			m_scaleOverLifetimeAffectorDef = static_cast<const ScaleOverLifetimeParticleAffectorDef*>(in_affectorDef);
 		}
@@ -49,28 +55,27 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void ScaleOverLifetimeParticleAffector::ActivateParticle(u32 in_index, f32 in_effectProgress)
 		{
-			CS_ASSERT(in_index >= 0 && in_index < m_particleScaleData.size(), "Index out of bounds!");
+			ParticlePool* particlePool = GetParticlePool();
+			CS_ASSERT(in_index < particlePool->GetNumActive(), "Index out of bounds!");
 
-			ScaleData& scaleData = m_particleScaleData[in_index];
-			const Particle& particle = GetParticleArray()->at(in_index);
-			
-			scaleData.m_initialScale = particle.m_scale;
+			Core::Vector2 initialScale(particlePool->GetStream(ParticlePool::Stream::k_scaleX)[in_index], particlePool->GetStream(ParticlePool::Stream::k_scaleY)[in_index]);
+			Core::Vector2 targetScale = initialScale * m_scaleOverLifetimeAffectorDef->GetScaleProperty()->GenerateValue(in_effectProgress);
 
-			scaleData.m_targetScale = scaleData.m_initialScale * m_scaleOverLifetimeAffectorDef->GetScaleProperty()->GenerateValue(in_effectProgress);
+			particlePool->GetCustomStream(m_initialScaleXStream)[in_index] = initialScale.x;
+			particlePool->GetCustomStream(m_initialScaleYStream)[in_index] = initialScale.y;
+			particlePool->GetCustomStream(m_targetScaleXStream)[in_index] = targetScale.x;
+			particlePool->GetCustomStream(m_targetScaleYStream)[in_index] = targetScale.y;
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void ScaleOverLifetimeParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
+		void ScaleOverLifetimeParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_startIndex, u32 in_endIndex)
 		{
-			Core::dynamic_array<Particle>* particleArray = GetParticleArray();
-			for (u32 i = 0; i < particleArray->size(); ++i)
-			{
-				Particle& particle = particleArray->at(i);
-				ScaleData& scaleData = m_particleScaleData[i];
+			ParticlePool* particlePool = GetParticlePool();
+			const f32* lifeProgress = particlePool->GetStream(ParticlePool::Stream::k_lifeProgress) + in_startIndex;
+			const u32 count = in_endIndex - in_startIndex;
 
-				f32 normalisedLifeProgress = 1.0f - (particle.m_energy / particle.m_lifetime);
-				particle.m_scale = scaleData.m_initialScale + (scaleData.m_targetScale - scaleData.m_initialScale) * normalisedLifeProgress;
-			}
+			ParticleKernels::Lerp(particlePool->GetCustomStream(m_initialScaleXStream) + in_startIndex, particlePool->GetCustomStream(m_targetScaleXStream) + in_startIndex, lifeProgress, particlePool->GetStream(ParticlePool::Stream::k_scaleX) + in_startIndex, count);
+			ParticleKernels::Lerp(particlePool->GetCustomStream(m_initialScaleYStream) + in_startIndex, particlePool->GetCustomStream(m_targetScaleYStream) + in_startIndex, lifeProgress, particlePool->GetStream(ParticlePool::Stream::k_scaleY) + in_startIndex, count);
 		}
 	}
 }
\ No newline at end of file
@@ -31,7 +31,6 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Math/Vector2.h>
-#include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
 
 namespace ChilliSource
@@ -60,15 +59,15 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			void ActivateParticle(u32 in_index, f32 in_effectProgress) override;
 			//----------------------------------------------------------------
-			/// Updates the size of each particle.
+			/// Updates the size of each particle in the given range.
 			///
-			/// @author Ian Copland
-            ///
             /// @param The delta time.
             /// @param The current normalised (0.0 to 1.0) progress through
             /// playback of the particle effect.
+			/// @param The index of the first particle in the range.
+			/// @param The index one past the last particle in the range.
 			//----------------------------------------------------------------
-			void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) override;
+			void AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_startIndex, u32 in_endIndex) override;
 			//----------------------------------------------------------------
 			/// Destructor
 			///
@@ -83,23 +82,15 @@ namespace ChilliSource
 			/// @author Ian Copland
 			///
 			/// @param The particle affector definition.
-			/// @param The particle array.
-			//----------------------------------------------------------------
-			ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray);
-			//----------------------------------------------------------------
-			/// A container for the initial scale and scale factor of a single 
-			/// particle.
-			///
-			/// @author Ian Copland.
+			/// @param The particle pool.
 			//----------------------------------------------------------------
-			struct ScaleData
-			{
-				Core::Vector2 m_initialScale;
-				Core::Vector2 m_targetScale;
-			};
+			ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticlePool* in_particlePool);
 
 			const ScaleOverLifetimeParticleAffectorDef* m_scaleOverLifetimeAffectorDef = nullptr;
-			Core::dynamic_array<ScaleData> m_particleScaleData;
+			u32 m_initialScaleXStream = 0;
+			u32 m_initialScaleYStream = 0;
+			u32 m_targetScaleXStream = 0;
+			u32 m_targetScaleYStream = 0;
 		};
 	}
 }
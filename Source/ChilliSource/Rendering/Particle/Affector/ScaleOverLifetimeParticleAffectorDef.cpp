@@ -65,9 +65,9 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ParticleAffectorUPtr ScaleOverLifetimeParticleAffectorDef::CreateInstance(Core::dynamic_array<Particle>* in_particleArray) const
+		ParticleAffectorUPtr ScaleOverLifetimeParticleAffectorDef::CreateInstance(ParticlePool* in_particlePool) const
 		{
-			return ParticleAffectorUPtr(new ScaleOverLifetimeParticleAffector(this, in_particleArray));
+			return ParticleAffectorUPtr(new ScaleOverLifetimeParticleAffector(this, in_particlePool));
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
@@ -28,7 +28,7 @@
 
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
 
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
 
 namespace ChilliSource
 {
@@ -37,103 +37,117 @@ namespace ChilliSource
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
 		ConcurrentParticleData::ConcurrentParticleData(u32 in_particleCount)
-			: m_particles(in_particleCount), m_lock(m_mutex, std::defer_lock)
+			: m_frontIndex(0), m_updating(false), m_unharvestedCommit(false)
 		{
+			for (auto& buffer : m_buffers)
+			{
+				buffer.m_particles.reserve(in_particleCount);
+			}
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
 		bool ConcurrentParticleData::StartUpdate()
 		{
-			std::unique_lock<std::recursive_mutex> lock(m_mutex);
-			if (m_updating == false)
+			//the in flight flag must be read before harvesting: the writer publishes its commit before clearing
+			//the flag, so if no update is in flight then the latest commit is guaranteed to be harvested below.
+			const bool updating = m_updating.load(std::memory_order_acquire);
+			HarvestNewIndices();
+
+			if (updating == true)
 			{
-				m_updating = true;
-				return true;
+				return false;
 			}
 
-			return false;
+			m_updating.store(true, std::memory_order_relaxed);
+			return true;
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
 		bool ConcurrentParticleData::HasActiveParticles() const
 		{
-			std::unique_lock<std::recursive_mutex> lock(m_mutex);
-			return m_activeParticles;
+			return m_buffers[m_frontIndex.load(std::memory_order_acquire)].m_activeParticles;
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		Core::AABB ConcurrentParticleData::GetAABB() const
+		const Core::AABB& ConcurrentParticleData::GetAABB() const
 		{
-			std::unique_lock<std::recursive_mutex> lock(m_mutex);
-			return m_aabb;
+			return m_buffers[m_frontIndex.load(std::memory_order_acquire)].m_aabb;
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		Core::Sphere ConcurrentParticleData::GetBoundingSphere() const
+		const Core::Sphere& ConcurrentParticleData::GetBoundingSphere() const
 		{
-			std::unique_lock<std::recursive_mutex> lock(m_mutex);
-			return m_boundingSphere;
-		}
-		//-----------------------------------------------------------------
-		//-----------------------------------------------------------------
-		void ConcurrentParticleData::Lock() const
-		{
-			m_lock.lock();
+			return m_buffers[m_frontIndex.load(std::memory_order_acquire)].m_boundingSphere;
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
 		std::vector<u32> ConcurrentParticleData::TakeNewIndices()
 		{
-			CS_ASSERT(m_lock.owns_lock() == true, "Must be locked when taking new indices!")
+			HarvestNewIndices();
 
-			std::vector<u32> output = m_newParticleIndices;
-			m_newParticleIndices.clear();
+			std::vector<u32> output;
+			output.swap(m_pendingNewParticleIndices);
 			return output;
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		const Core::dynamic_array<ConcurrentParticleData::Particle>& ConcurrentParticleData::GetParticles() const
-		{
-			CS_ASSERT(m_lock.owns_lock() == true, "Must be locked when getting particles!");
-
-			return m_particles;
-		}
-		//-----------------------------------------------------------------
-		//-----------------------------------------------------------------
-		void ConcurrentParticleData::Unlock() const
+		const std::vector<ConcurrentParticleData::Particle>& ConcurrentParticleData::GetParticles() const
 		{
-			m_lock.unlock();
+			return m_buffers[m_frontIndex.load(std::memory_order_acquire)].m_particles;
 		}
 		//-----------------------------------------------------------------
 		//-----------------------------------------------------------------
-		void ConcurrentParticleData::CommitParticleData(const Core::dynamic_array<Rendering::Particle>* in_particles, const std::vector<u32>& in_newIndices, const Core::AABB& in_aabb, const Core::Sphere& in_boundingSphere)
+		void ConcurrentParticleData::CommitParticleData(const ParticlePool* in_particlePool, const std::vector<u32>& in_newIds, const Core::AABB& in_aabb, const Core::Sphere& in_boundingSphere)
 		{
-			std::unique_lock<std::recursive_mutex> lock(m_mutex);
+			CS_ASSERT(m_updating.load(std::memory_order_relaxed) == true, "Cannot commit particle data without first starting an update.");
 
-			CS_ASSERT(in_particles->size() == m_particles.size(), "Particle data lists must be the same size.");
+			const u32 backIndex = 1 - m_frontIndex.load(std::memory_order_relaxed);
+			Buffer& buffer = m_buffers[backIndex];
 
-			m_activeParticles = false;
-			for (u32 i = 0; i < m_particles.size(); ++i)
-			{
-				Particle& concurrentParticle = m_particles[i];
-				const Rendering::Particle& particle = (*in_particles)[i];
+			CS_ASSERT(in_particlePool->GetCapacity() <= buffer.m_particles.capacity(), "Particle pool is larger than the concurrent particle data.");
+
+			const f32* positionX = in_particlePool->GetStream(ParticlePool::Stream::k_positionX);
+			const f32* positionY = in_particlePool->GetStream(ParticlePool::Stream::k_positionY);
+			const f32* positionZ = in_particlePool->GetStream(ParticlePool::Stream::k_positionZ);
+			const f32* scaleX = in_particlePool->GetStream(ParticlePool::Stream::k_scaleX);
+			const f32* scaleY = in_particlePool->GetStream(ParticlePool::Stream::k_scaleY);
+			const f32* rotation = in_particlePool->GetStream(ParticlePool::Stream::k_rotation);
+			const f32* colourR = in_particlePool->GetStream(ParticlePool::Stream::k_colourR);
+			const f32* colourG = in_particlePool->GetStream(ParticlePool::Stream::k_colourG);
+			const f32* colourB = in_particlePool->GetStream(ParticlePool::Stream::k_colourB);
+			const f32* colourA = in_particlePool->GetStream(ParticlePool::Stream::k_colourA);
 
-				concurrentParticle.m_isActive = particle.m_isActive;
-				concurrentParticle.m_position = particle.m_position;
-				concurrentParticle.m_rotation = particle.m_rotation;
-				concurrentParticle.m_scale = particle.m_scale;
-				concurrentParticle.m_colour = particle.m_colour;
+			const u32 numActive = in_particlePool->GetNumActive();
+			buffer.m_particles.resize(numActive);
+			for (u32 i = 0; i < numActive; ++i)
+			{
+				Particle& concurrentParticle = buffer.m_particles[i];
 
-				if (concurrentParticle.m_isActive == true)
-				{
-					m_activeParticles = true;
-				}
+				concurrentParticle.m_id = in_particlePool->GetId(i);
+				concurrentParticle.m_position = Core::Vector3(positionX[i], positionY[i], positionZ[i]);
+				concurrentParticle.m_rotation = rotation[i];
+				concurrentParticle.m_scale = Core::Vector2(scaleX[i], scaleY[i]);
+				concurrentParticle.m_colour = Core::Colour(colourR[i], colourG[i], colourB[i], colourA[i]);
 			}
 
-			m_newParticleIndices.insert(m_newParticleIndices.end(), in_newIndices.begin(), in_newIndices.end());
-			m_aabb = in_aabb;
-			m_boundingSphere = in_boundingSphere;
-			m_updating = false;
+			buffer.m_activeParticles = (numActive > 0);
+			buffer.m_newParticleIndices.assign(in_newIds.begin(), in_newIds.end());
+			buffer.m_aabb = in_aabb;
+			buffer.m_boundingSphere = in_boundingSphere;
+
+			m_frontIndex.store(backIndex, std::memory_order_release);
+			m_unharvestedCommit.store(true, std::memory_order_release);
+			m_updating.store(false, std::memory_order_release);
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void ConcurrentParticleData::HarvestNewIndices()
+		{
+			if (m_unharvestedCommit.exchange(false, std::memory_order_acq_rel) == true)
+			{
+				const Buffer& front = m_buffers[m_frontIndex.load(std::memory_order_acquire)];
+				m_pendingNewParticleIndices.insert(m_pendingNewParticleIndices.end(), front.m_newParticleIndices.begin(), front.m_newParticleIndices.end());
+			}
 		}
 	}
-}
\ No newline at end of file
+}
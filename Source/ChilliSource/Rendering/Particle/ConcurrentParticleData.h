@@ -31,12 +31,11 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/Colour.h>
-#include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
 
-#include <mutex>
+#include <atomic>
 #include <vector>
 
 namespace ChilliSource
@@ -49,20 +48,28 @@ namespace ChilliSource
 		/// draw information for each particle, the list of newly updated particles
 		/// and the total bounds of the particle effect.
 		///
+		/// The data is double buffered: the update thread writes into the back
+		/// buffer and publishes it with a single atomic store when committing,
+		/// while the main thread only ever reads the front buffer. This means
+		/// neither thread needs to take a lock. Only one update can be in flight
+		/// at a time, so the back buffer is never read while it is written.
+		///
 		/// @author Ian Copland
 		//------------------------------------------------------------------------
 		class ConcurrentParticleData final
 		{
 		public:
+			CS_DECLARE_NOCOPY(ConcurrentParticleData);
 			//-----------------------------------------------------------------
 			/// A struct containing just the information required for drawing a
-			/// particle.
+			/// particle. The id is the particle pool id of the particle, which
+			/// will remain the same for the life of the particle.
 			///
 			/// @author Ian Copland
 			//-----------------------------------------------------------------
 			struct Particle final
 			{
-				bool m_isActive = false;
+				u32 m_id = 0;
 				Core::Vector3 m_position;
                 Core::Vector2 m_scale = Core::Vector2::k_zero;
 				f32 m_rotation = 0.0f;
@@ -73,15 +80,17 @@ namespace ChilliSource
 			///
 			/// @author Ian Copland
 			///
-			/// @param The number of particles.
+			/// @param The maximum number of particles.
 			//-----------------------------------------------------------------
 			ConcurrentParticleData(u32 in_particleCount);
 			//-----------------------------------------------------------------
-			/// This will return false if no particle data has been commited
-			/// since the last time this was called. If false is returned a 
-			/// new update should not be started.
+			/// This will return false if the previous update has not yet
+			/// committed its particle data. If false is returned a new update
+			/// should not be started. If true is returned, CommitParticleData()
+			/// must be called exactly once before the next update can start.
 			///
-			/// This is thread-safe.
+			/// This invalidates any particle list previously returned by
+			/// GetParticles(). This must be called on the main thread.
 			///
 			/// @author Ian Copland
 			///
@@ -89,7 +98,7 @@ namespace ChilliSource
 			//-----------------------------------------------------------------
 			bool StartUpdate();
 			//-----------------------------------------------------------------
-			/// This is thread-safe, lock doesn't need to be called first.
+			/// This must be called on the main thread.
 			///
 			/// @author Ian Copland
 			///
@@ -97,88 +106,79 @@ namespace ChilliSource
 			//-----------------------------------------------------------------
 			bool HasActiveParticles() const;
 			//-----------------------------------------------------------------
-			/// This is thread-safe, lock doesn't need to be called first.
-			///
-			/// @author Ian Copland
+			/// This must be called on the main thread.
 			///
 			/// @author The AABB for the particle effect. Whether or not this
 			/// is in world or local space is determined by the simulation space
 			/// of a particle.
 			//-----------------------------------------------------------------
-			Core::AABB GetAABB() const;
+			const Core::AABB& GetAABB() const;
 			//-----------------------------------------------------------------
-			/// This is thread-safe, lock doesn't need to be called first.
-			///
-			/// @author Ian Copland
+			/// This must be called on the main thread.
 			///
 			/// @author The bounding sphere for the particle effect. Whether or 
 			/// not this is in world or local space is determined by the 
 			/// simulation space of a particle.
 			//-----------------------------------------------------------------
-			Core::Sphere GetBoundingSphere() const;
+			const Core::Sphere& GetBoundingSphere() const;
 			//-----------------------------------------------------------------
-			/// Locks the container so other threads cannot update it while
-			/// accessing the new indices and particle list.
+			/// Returns the list of ids of the particles that have been
+			/// activated since the last time this was called. The list will
+			/// be cleared when called.
 			///
-			/// @author Ian Copland
-			//-----------------------------------------------------------------
-			void Lock() const;
-			//-----------------------------------------------------------------
-			/// Returns the list of indices that have changed since the last
-			/// time this was called. The list will be cleared when called.
-			/// Before this is called the container must be locked to ensure
-			/// that new particles are not activated prior to being rendered.
-			/// If the container is not locked the app is considered to be
-			/// in an irrecoverable state and will terminate.
+			/// This must be called on the main thread.
 			/// 
 			/// @author Ian Copland
 			///
-			/// @author A vector of particle indices.
+			/// @author A vector of particle ids.
 			//-----------------------------------------------------------------
 			std::vector<u32> TakeNewIndices();
 			//-----------------------------------------------------------------
-			/// Before this is called the container must be locked to ensure
-			/// that any iteration over the particle data is safe. If not the
-			/// app is considered to be in an irrecoverable state and will
-			/// terminate.
+			/// The returned list remains valid until the next call to
+			/// StartUpdate().
 			///
-			/// @author Ian Copland
+			/// This must be called on the main thread.
 			///
-			/// @param The particle list.
+			/// @param The list of active particles.
 			//-----------------------------------------------------------------
-			const Core::dynamic_array<ConcurrentParticleData::Particle>& GetParticles() const;
+			const std::vector<ConcurrentParticleData::Particle>& GetParticles() const;
 			//-----------------------------------------------------------------
-			/// Unlocks the container. This should be called as soon as possible
-			/// after dealing with data that needs to be locked.
+			/// Writes the particle data into the back buffer and then
+			/// publishes it as the new front buffer. This must only be called
+			/// once for each successful call to StartUpdate().
 			///
-			/// @author Ian Copland
-			//-----------------------------------------------------------------
-			void Unlock() const;
-			//-----------------------------------------------------------------
-			/// Updates the particle data.
-			///
-			/// This is thread-safe, lock doesn't need to be called first.
+			/// This can be called on any thread.
 			///
-			/// @author Ian Copland
-			///
-			/// @param The list of particles.
-			/// @param The new indices.
+			/// @param The particle pool.
+			/// @param The ids of the newly activated particles.
 			/// @param The aabb.
-			/// @param The obb.
 			/// @param The bounding sphere.
 			//-----------------------------------------------------------------
-			void CommitParticleData(const Core::dynamic_array<Rendering::Particle>* in_particles, const std::vector<u32>& in_newIndices, const Core::AABB& in_aabb, const Core::Sphere& in_boundingSphere);
+			void CommitParticleData(const ParticlePool* in_particlePool, const std::vector<u32>& in_newIds, const Core::AABB& in_aabb, const Core::Sphere& in_boundingSphere);
 		private:
+			//-----------------------------------------------------------------
+			/// A single buffer of committed particle data.
+			//-----------------------------------------------------------------
+			struct Buffer final
+			{
+				std::vector<ConcurrentParticleData::Particle> m_particles;
+				std::vector<u32> m_newParticleIndices;
+				Core::AABB m_aabb;
+				Core::Sphere m_boundingSphere;
+				bool m_activeParticles = false;
+			};
+			//-----------------------------------------------------------------
+			/// Moves the new particle ids from the most recently published
+			/// buffer into the main thread's pending list, if they haven't
+			/// already been. This must be called on the main thread.
+			//-----------------------------------------------------------------
+			void HarvestNewIndices();
 
-			Core::dynamic_array<ConcurrentParticleData::Particle> m_particles;
-			std::vector<u32> m_newParticleIndices;
-			Core::AABB m_aabb;
-			Core::Sphere m_boundingSphere;
-			bool m_updating = false;
-			bool m_activeParticles = false;
-			
-			mutable std::recursive_mutex m_mutex;
-			mutable std::unique_lock<std::recursive_mutex> m_lock;
+			Buffer m_buffers[2];
+			std::vector<u32> m_pendingNewParticleIndices;
+			std::atomic<u32> m_frontIndex;
+			std::atomic<bool> m_updating;
+			std::atomic<bool> m_unharvestedCommit;
 		};
 	}
 }
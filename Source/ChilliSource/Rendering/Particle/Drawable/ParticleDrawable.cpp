@@ -44,17 +44,15 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void ParticleDrawable::Draw(const CameraComponent* in_camera)
 		{
-			m_concurrentParticleData->Lock();
+			const auto& particles = m_concurrentParticleData->GetParticles();
 
-			auto newIndices = m_concurrentParticleData->TakeNewIndices();
-			for (const auto& index : newIndices)
+			auto newIds = m_concurrentParticleData->TakeNewIndices();
+			for (const auto& id : newIds)
 			{
-				ActivateParticle(m_concurrentParticleData->GetParticles(), index);
+				ActivateParticle(particles, id);
 			}
 
-			DrawParticles(m_concurrentParticleData->GetParticles(), in_camera);
-
-			m_concurrentParticleData->Unlock();
+			DrawParticles(particles, in_camera);
 		}
 		//----------------------------------------------
 		//----------------------------------------------
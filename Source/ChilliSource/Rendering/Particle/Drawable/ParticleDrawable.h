@@ -94,18 +94,16 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			const ParticleDrawableDef* GetDrawableDef() const;
 			//----------------------------------------------------------------
-			/// Activates the particle with the given index.
+			/// Activates the particle with the given id.
 			///
 			/// This is called on the main thread, but the particle data can 
 			/// be modified on other threads so make sure to lock it prior to 
 			/// use.
 			///
-			/// @author Ian Copland
-			///
 			/// @param The particle draw data.
-			/// @param The index of the particle to activate.
+			/// @param The id of the particle to activate.
 			//----------------------------------------------------------------
-			virtual void ActivateParticle(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_index) = 0;
+			virtual void ActivateParticle(const std::vector<ConcurrentParticleData::Particle>& in_particleData, u32 in_particleId) = 0;
 			//----------------------------------------------------------------
 			/// Renders all active particles in the effect. 
 			///
@@ -116,7 +114,7 @@ namespace ChilliSource
 			/// @param The particle draw data.
 			/// @param The camera component used to render.
 			//----------------------------------------------------------------
-			virtual void DrawParticles(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) = 0;
+			virtual void DrawParticles(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) = 0;
 		private:
 			const Core::Entity* m_entity = nullptr;
 			const ParticleDrawableDef* m_drawableDef = nullptr;
@@ -48,6 +48,8 @@
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 
+#include <cmath>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -88,63 +90,51 @@ namespace ChilliSource
 				}
 			}
 			//-----------------------------------------------------------------------------
-			/// Builds world space sprite data for a particle from the given parameters.
-			///
-			/// @author Ian Copland
+			/// Writes the four vertices of a camera facing billboard for a particle. The
+			/// billboard is expanded along the given right and up vectors, so no
+			/// quaternion rotations are required per particle.
 			///
-			/// @param The material.
+			/// @param [Out] The four vertices of the billboard.
 			/// @param The uvs.
 			/// @param The local bottom left vertex position of the sprite.
 			/// @param The local top right vertex position of the sprite.
 			/// @param The world position of the sprite.
 			/// @param The world scale of the sprite.
-			/// @param The world orientation of the sprite.
+			/// @param The world right vector of the sprite.
+			/// @param The world up vector of the sprite.
 			/// @param The colour of the sprite.
-			///
-			/// @param The sprite data.
 			//-----------------------------------------------------------------------------
-			SpriteBatch::SpriteData BuildSpriteData(const MaterialCSPtr& in_material, const UVs& in_uvs, const Core::Vector2& in_localBL,
-				const Core::Vector2& in_localTR, const Core::Vector3& in_worldPosition, const Core::Vector2& in_worldScale, const Core::Quaternion& in_worldOrientation,
-				const Core::Colour& in_colour)
+			void WriteBillboardVertices(SpriteBatch::SpriteVertex* out_vertices, const UVs& in_uvs, const Core::Vector2& in_localBL, const Core::Vector2& in_localTR,
+				const Core::Vector3& in_worldPosition, const Core::Vector2& in_worldScale, const Core::Vector3& in_right, const Core::Vector3& in_up, const Core::ByteColour& in_colour)
 			{
-				SpriteBatch::SpriteData spriteData;
-				spriteData.pMaterial = in_material;
-
-				//set the sprite colour
-				Core::ByteColour colour = Core::ColourUtils::ColourToByteColour(in_colour);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].Col = colour;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].Col = colour;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].Col = colour;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].Col = colour;
-
-				//set the UVs.
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].vTex.x = in_uvs.m_u;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].vTex.y = in_uvs.m_v;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].vTex.x = in_uvs.m_u;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].vTex.y = in_uvs.m_v + in_uvs.m_t;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].vTex.x = in_uvs.m_u + in_uvs.m_s;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].vTex.y = in_uvs.m_v;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vTex.x = in_uvs.m_u + in_uvs.m_s;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vTex.y = in_uvs.m_v + in_uvs.m_t;
-
-				//Build the vertex data.
-				Core::Vector3 localTopLeft(in_localBL.x * in_worldScale.x, in_localTR.y * in_worldScale.y, 0.0f);
-				Core::Vector3 worldTopLeft = in_worldPosition + Core::Vector3::Rotate(localTopLeft, in_worldOrientation);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].vPos = Core::Vector4(worldTopLeft, 1.0f);
-
-				Core::Vector3 localTopRight(in_localTR.x * in_worldScale.x, in_localTR.y * in_worldScale.y, 0.0f);
-				Core::Vector3 worldTopRight = in_worldPosition + Core::Vector3::Rotate(localTopRight, in_worldOrientation);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].vPos = Core::Vector4(worldTopRight, 1.0f);
-
-				Core::Vector3 localBottomLeft(in_localBL.x * in_worldScale.x, in_localBL.y * in_worldScale.y, 0.0f);
-				Core::Vector3 worldBottomLeft = in_worldPosition + Core::Vector3::Rotate(localBottomLeft, in_worldOrientation);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].vPos = Core::Vector4(worldBottomLeft, 1.0f);
-
-				Core::Vector3 localBottomRight(in_localTR.x * in_worldScale.x, in_localBL.y * in_worldScale.y, 0.0f);
-				Core::Vector3 worldBottomRight = in_worldPosition + Core::Vector3::Rotate(localBottomRight, in_worldOrientation);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vPos = Core::Vector4(worldBottomRight, 1.0f);
-
-				return spriteData;
+				Core::Vector3 left = in_right * (in_localBL.x * in_worldScale.x);
+				Core::Vector3 right = in_right * (in_localTR.x * in_worldScale.x);
+				Core::Vector3 top = in_up * (in_localTR.y * in_worldScale.y);
+				Core::Vector3 bottom = in_up * (in_localBL.y * in_worldScale.y);
+
+				SpriteBatch::SpriteVertex& topLeft = out_vertices[(u32)SpriteBatch::Verts::k_topLeft];
+				topLeft.vPos = Core::Vector4(in_worldPosition + left + top, 1.0f);
+				topLeft.vTex.x = in_uvs.m_u;
+				topLeft.vTex.y = in_uvs.m_v;
+				topLeft.Col = in_colour;
+
+				SpriteBatch::SpriteVertex& bottomLeft = out_vertices[(u32)SpriteBatch::Verts::k_bottomLeft];
+				bottomLeft.vPos = Core::Vector4(in_worldPosition + left + bottom, 1.0f);
+				bottomLeft.vTex.x = in_uvs.m_u;
+				bottomLeft.vTex.y = in_uvs.m_v + in_uvs.m_t;
+				bottomLeft.Col = in_colour;
+
+				SpriteBatch::SpriteVertex& topRight = out_vertices[(u32)SpriteBatch::Verts::k_topRight];
+				topRight.vPos = Core::Vector4(in_worldPosition + right + top, 1.0f);
+				topRight.vTex.x = in_uvs.m_u + in_uvs.m_s;
+				topRight.vTex.y = in_uvs.m_v;
+				topRight.Col = in_colour;
+
+				SpriteBatch::SpriteVertex& bottomRight = out_vertices[(u32)SpriteBatch::Verts::k_bottomRight];
+				bottomRight.vPos = Core::Vector4(in_worldPosition + right + bottom, 1.0f);
+				bottomRight.vTex.x = in_uvs.m_u + in_uvs.m_s;
+				bottomRight.vTex.y = in_uvs.m_v + in_uvs.m_t;
+				bottomRight.Col = in_colour;
 			}
 		}
 
@@ -158,21 +148,21 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void StaticBillboardParticleDrawable::ActivateParticle(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_index)
+		void StaticBillboardParticleDrawable::ActivateParticle(const std::vector<ConcurrentParticleData::Particle>& in_particleData, u32 in_particleId)
 		{
-			CS_ASSERT(in_index >= 0 && in_index < m_particleBillboardIndices.size(), "Index out of bounds!");
+			CS_ASSERT(in_particleId < m_particleBillboardIndices.size(), "Index out of bounds!");
 
 			switch (m_billboardDrawableDef->GetImageSelectionType())
 			{
 			case StaticBillboardParticleDrawableDef::ImageSelectionType::k_cycle:
-				m_particleBillboardIndices[in_index] = m_nextBillboardIndex++;
+				m_particleBillboardIndices[in_particleId] = m_nextBillboardIndex++;
 				if (m_nextBillboardIndex >= m_billboards->size())
 				{
 					m_nextBillboardIndex = 0;
 				}
 				break;
 			case StaticBillboardParticleDrawableDef::ImageSelectionType::k_random:
-				m_particleBillboardIndices[in_index] = Core::Random::Generate<u32>(0, m_billboards->size() - 1);
+				m_particleBillboardIndices[in_particleId] = Core::Random::Generate<u32>(0, m_billboards->size() - 1);
 				break;
 			default:
 				CS_LOG_FATAL("Invalid image selection type.");
@@ -181,7 +171,7 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void StaticBillboardParticleDrawable::DrawParticles(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera)
+		void StaticBillboardParticleDrawable::DrawParticles(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera)
 		{
 			switch (GetDrawableDef()->GetParticleEffect()->GetSimulationSpace())
 			{
@@ -252,9 +242,8 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void StaticBillboardParticleDrawable::DrawLocalSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const
+		void StaticBillboardParticleDrawable::DrawLocalSpace(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const
 		{
-			const auto& material = m_billboardDrawableDef->GetMaterial();
 			auto entityWorldTransform = GetEntity()->GetTransform().GetWorldTransform();
 
 			//we can't directly apply the parent entities scale to the particles as this would look strange as
@@ -263,52 +252,63 @@ namespace ChilliSource
 			auto entityScale = GetEntity()->GetTransform().GetWorldScale();
 			f32 particleScaleFactor = (entityScale.x + entityScale.y + entityScale.z) / 3.0f;
 
-			//billboard by applying the inverse of the view orientation. The view orientation is the inverse of the camera entity orientation.
-			auto inverseView = in_camera->GetEntity()->GetTransform().GetWorldOrientation();
-
-			for (u32 i = 0; i < in_particleData.size(); ++i)
-			{
-				const auto& particle = in_particleData[i];
-
-				if (particle.m_isActive == true && particle.m_colour != Core::Colour::k_transparent)
-				{
-					auto worldPosition = particle.m_position * entityWorldTransform;
-					auto worldScale = particle.m_scale * particleScaleFactor;
-
-					//rotate locally in the XY plane before rotating to face the camera.
-					auto worldOrientation = Core::Quaternion(Core::Vector3::k_unitPositiveZ, particle.m_rotation) * inverseView;
-
-					const auto& billboardData = m_billboards->at(m_particleBillboardIndices[i]);
-					auto spriteData = BuildSpriteData(material, billboardData.m_uvs, billboardData.m_bottomLeft, billboardData.m_topRight, worldPosition, worldScale, worldOrientation,
-						particle.m_colour);
-
-					Core::Application::Get()->GetRenderSystem()->GetDynamicSpriteBatchPtr()->Render(spriteData, nullptr);
-				}
-			}
+			DrawBillboards(in_particleData, in_camera, &entityWorldTransform, particleScaleFactor);
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		void StaticBillboardParticleDrawable::DrawWorldSpace(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const
+		{
+			DrawBillboards(in_particleData, in_camera, nullptr, 1.0f);
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void StaticBillboardParticleDrawable::DrawWorldSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const
+		void StaticBillboardParticleDrawable::DrawBillboards(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera, const Core::Matrix4* in_transform, f32 in_scaleFactor) const
 		{
 			const auto& material = m_billboardDrawableDef->GetMaterial();
+			auto spriteBatch = Core::Application::Get()->GetRenderSystem()->GetDynamicSpriteBatchPtr();
 
-			//billboard by applying the inverse of the view orientation. The view orientation is the inverse of the camera entity orientation.
+			//billboard along the camera axes. The view orientation is the inverse of the camera entity orientation.
 			auto inverseView = in_camera->GetEntity()->GetTransform().GetWorldOrientation();
+			auto cameraRight = Core::Vector3::Rotate(Core::Vector3::k_unitPositiveX, inverseView);
+			auto cameraUp = Core::Vector3::Rotate(Core::Vector3::k_unitPositiveY, inverseView);
 
-			for (u32 i = 0; i < in_particleData.size(); ++i)
+			//count the visible particles so they can be reserved in the sprite batch in bulk.
+			u32 numToDraw = 0;
+			for (const auto& particle : in_particleData)
 			{
-				const auto& particle = in_particleData[i];
-
-				if (particle.m_isActive == true && particle.m_colour != Core::Colour::k_transparent)
+				if (particle.m_colour != Core::Colour::k_transparent)
 				{
-					//rotate locally in the XY plane before rotating to face the camera.
-					auto worldOrientation = Core::Quaternion(Core::Vector3::k_unitPositiveZ, particle.m_rotation) * inverseView;
-
-					const auto& billboardData = m_billboards->at(m_particleBillboardIndices[i]);
-					auto spriteData = BuildSpriteData(material, billboardData.m_uvs, billboardData.m_bottomLeft, billboardData.m_topRight, particle.m_position, particle.m_scale,
-						worldOrientation, particle.m_colour);
+					++numToDraw;
+				}
+			}
 
-					Core::Application::Get()->GetRenderSystem()->GetDynamicSpriteBatchPtr()->Render(spriteData, nullptr);
+			SpriteBatch::SpriteVertex* vertices = nullptr;
+			u32 numReserved = 0;
+			for (const auto& particle : in_particleData)
+			{
+				if (particle.m_colour != Core::Colour::k_transparent)
+				{
+					if (numReserved == 0)
+					{
+						numReserved = spriteBatch->ReserveSprites(material, numToDraw, vertices);
+						numToDraw -= numReserved;
+					}
+
+					auto worldPosition = (in_transform != nullptr) ? particle.m_position * (*in_transform) : particle.m_position;
+					auto worldScale = particle.m_scale * in_scaleFactor;
+
+					//rotate the camera axes locally in the XY plane.
+					f32 sinRotation = std::sin(particle.m_rotation);
+					f32 cosRotation = std::cos(particle.m_rotation);
+					auto right = cameraRight * cosRotation + cameraUp * sinRotation;
+					auto up = cameraUp * cosRotation - cameraRight * sinRotation;
+
+					const auto& billboardData = m_billboards->at(m_particleBillboardIndices[particle.m_id]);
+					WriteBillboardVertices(vertices, billboardData.m_uvs, billboardData.m_bottomLeft, billboardData.m_topRight, worldPosition, worldScale, right, up,
+						Core::ColourUtils::ColourToByteColour(particle.m_colour));
+
+					vertices += k_numSpriteVerts;
+					--numReserved;
 				}
 			}
 		}
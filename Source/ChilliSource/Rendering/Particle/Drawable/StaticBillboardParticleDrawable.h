@@ -71,14 +71,12 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			StaticBillboardParticleDrawable(const Core::Entity* in_entity, const ParticleDrawableDef* in_drawableDef, ConcurrentParticleData* in_concurrentParticleData);
 			//----------------------------------------------------------------
-			/// Activates the particle with the given index.
-			///
-			/// @author Ian Copland
+			/// Activates the particle with the given id.
 			///
 			/// @param The particle draw data.
-			/// @param The index of the particle to activate.
+			/// @param The id of the particle to activate.
 			//----------------------------------------------------------------
-			void ActivateParticle(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_index) override;
+			void ActivateParticle(const std::vector<ConcurrentParticleData::Particle>& in_particleData, u32 in_particleId) override;
 			//----------------------------------------------------------------
 			/// Renders all active particles in the effect.
 			///
@@ -87,7 +85,7 @@ namespace ChilliSource
 			/// @param The particle draw data.
 			/// @param The camera component used to render.
 			//----------------------------------------------------------------
-			void DrawParticles(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) override;
+			void DrawParticles(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) override;
 			//----------------------------------------------------------------
 			/// Builds the billboard image data from the provided texture
 			/// or texture atlas.
@@ -112,7 +110,7 @@ namespace ChilliSource
 			/// @param The particle draw data.
 			/// @param The camera component used to render.
 			//----------------------------------------------------------------
-			void DrawLocalSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const;
+			void DrawLocalSpace(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const;
 			//----------------------------------------------------------------
 			/// Draws the particles without taking into account the world
 			/// space transform of the owning entity as the particles are
@@ -123,7 +121,18 @@ namespace ChilliSource
 			/// @param The particle draw data.
 			/// @param The camera component used to render.
 			//----------------------------------------------------------------
-			void DrawWorldSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const;
+			void DrawWorldSpace(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const;
+			//----------------------------------------------------------------
+			/// Writes a camera facing billboard for each visible particle
+			/// directly into the dynamic sprite batch.
+			///
+			/// @param The particle draw data.
+			/// @param The camera component used to render.
+			/// @param The transform to apply to each particle position, or
+			/// null if the positions are already in world space.
+			/// @param The uniform scale factor to apply to each particle.
+			//----------------------------------------------------------------
+			void DrawBillboards(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera, const Core::Matrix4* in_transform, f32 in_scaleFactor) const;
 
 			const StaticBillboardParticleDrawableDef* m_billboardDrawableDef;
 			std::unique_ptr <Core::dynamic_array<BillboardData>> m_billboards;
@@ -126,8 +126,8 @@ namespace ChilliSource
 
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ConeParticleEmitter::ConeParticleEmitter(const ParticleEmitterDef* in_particleEmitter, Core::dynamic_array<Particle>* in_particleArray)
-			: ParticleEmitter(in_particleEmitter, in_particleArray)
+		ConeParticleEmitter::ConeParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticlePool* in_particlePool)
+			: ParticleEmitter(in_particleEmitter, in_particlePool)
 		{
 			//Only the sphere emitter def can create this, so this is safe.
 			m_coneParticleEmitterDef = static_cast<const ConeParticleEmitterDef*>(in_particleEmitter);
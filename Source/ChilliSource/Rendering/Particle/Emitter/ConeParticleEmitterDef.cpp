@@ -159,9 +159,9 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ParticleEmitterUPtr ConeParticleEmitterDef::CreateInstance(Core::dynamic_array<Particle>* in_particleArray) const
+		ParticleEmitterUPtr ConeParticleEmitterDef::CreateInstance(ParticlePool* in_particlePool) const
 		{
-			return ParticleEmitterUPtr(new ConeParticleEmitter(this, in_particleArray));
+			return ParticleEmitterUPtr(new ConeParticleEmitter(this, in_particlePool));
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
@@ -153,11 +153,11 @@ namespace ChilliSource
 			///
 			/// @author Ian Copland.
 			///
-			/// @param The particle array.
+			/// @param The particle pool.
 			///
 			/// @return the instance.
 			//----------------------------------------------------------------
-			ParticleEmitterUPtr CreateInstance(Core::dynamic_array<Particle>* in_particleArray) const override;
+			ParticleEmitterUPtr CreateInstance(ParticlePool* in_particlePool) const override;
 			//----------------------------------------------------------------
 			/// @author Ian Copland.
 			///
@@ -28,12 +28,11 @@
 
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitter.h>
 
-#include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/Entity/Transform.h>
 #include <ChilliSource/Core/Math/Random.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.h>
 
 #include <algorithm>
@@ -44,11 +43,11 @@ namespace ChilliSource
 	{
 		//----------------------------------------------
 		//----------------------------------------------
-		ParticleEmitter::ParticleEmitter(const ParticleEmitterDef* in_emitterDef, Core::dynamic_array<Particle>* in_particleArray)
-			: m_emitterDef(in_emitterDef), m_particleArray(in_particleArray)
+		ParticleEmitter::ParticleEmitter(const ParticleEmitterDef* in_emitterDef, ParticlePool* in_particlePool)
+			: m_emitterDef(in_emitterDef), m_particlePool(in_particlePool)
 		{
 			CS_ASSERT(m_emitterDef != nullptr, "Cannot create particle emitter with null emitter def.");
-			CS_ASSERT(m_particleArray != nullptr, "Cannot create particle emitter with null particle array.");
+			CS_ASSERT(m_particlePool != nullptr, "Cannot create particle emitter with null particle pool.");
 		}
 		//----------------------------------------------
 		//----------------------------------------------
@@ -178,15 +177,9 @@ namespace ChilliSource
 		{
 			const ParticleEffect* particleEffect = m_emitterDef->GetParticleEffect();
 
-			u32 particleIndex = m_nextParticleIndex++;
-			Particle& particle = m_particleArray->at(particleIndex);
-			if (m_nextParticleIndex >= particleEffect->GetMaxParticles())
-			{
-				m_nextParticleIndex = 0;
-			}
-
-			if (particle.m_isActive == false)
+			if (m_particlePool->IsFull() == false)
 			{
+				u32 particleIndex = m_particlePool->ActivateParticle();
 				inout_emittedParticles.push_back(particleIndex);
 
 				//Get the emission position and direction.
@@ -200,29 +193,32 @@ namespace ChilliSource
 				f32 localSpeed = particleEffect->GetInitialSpeedProperty()->GenerateValue(in_normalisedEmissionTime);
 
 				//apply these in the correct simulation space.
+				Core::Vector3 position;
+				Core::Vector2 scale;
+				Core::Vector3 velocity;
 				switch (particleEffect->GetSimulationSpace())
 				{
 					case ParticleEffect::SimulationSpace::k_world:
 					{
 						//transform the position into world space.
 						const Core::Matrix4 worldTransform = Core::Matrix4::CreateTransform(in_emissionPosition, in_emissionScale, in_emissionOrientation);
-						particle.m_position = localPosition * worldTransform;
+						position = localPosition * worldTransform;
 
 						//we can't directly apply the emission scale to the particles as this would look strange as
 						//the camera moved around an emitting entity with a non-uniform scale, so this works out a uniform
 						//scale from the average of the components.
 						f32 particleScaleFactor = (in_emissionScale.x + in_emissionScale.y + in_emissionScale.z) / 3.0f;
-						particle.m_scale = localScale * particleScaleFactor;
+						scale = localScale * particleScaleFactor;
 
 						//transform the velocity into world space.
-						particle.m_velocity = Core::Vector3::Rotate(((localDirection * localSpeed) * in_emissionScale), in_emissionOrientation);
+						velocity = Core::Vector3::Rotate(((localDirection * localSpeed) * in_emissionScale), in_emissionOrientation);
 						break;
 					}
 					case ParticleEffect::SimulationSpace::k_local:
 					{
-						particle.m_position = localPosition;
-						particle.m_scale = localScale;
-						particle.m_velocity = localDirection * localSpeed;
+						position = localPosition;
+						scale = localScale;
+						velocity = localDirection * localSpeed;
 						break;
 					}
 					default:
@@ -232,13 +228,27 @@ namespace ChilliSource
 					}
 				}
 
-				//apply the remaining properties.
-				particle.m_lifetime = particleEffect->GetLifetimeProperty()->GenerateValue(in_normalisedEmissionTime);
-				particle.m_energy = particle.m_lifetime;
-				particle.m_colour = particleEffect->GetInitialColourProperty()->GenerateValue(in_normalisedEmissionTime);
-				particle.m_rotation = localRotation;
-				particle.m_angularVelocity = particleEffect->GetInitialAngularVelocityProperty()->GenerateValue(in_normalisedEmissionTime);
-				particle.m_isActive = true;
+				f32 lifetime = particleEffect->GetLifetimeProperty()->GenerateValue(in_normalisedEmissionTime);
+				Core::Colour colour = particleEffect->GetInitialColourProperty()->GenerateValue(in_normalisedEmissionTime);
+
+				//write the new particle into the pool streams.
+				m_particlePool->GetStream(ParticlePool::Stream::k_positionX)[particleIndex] = position.x;
+				m_particlePool->GetStream(ParticlePool::Stream::k_positionY)[particleIndex] = position.y;
+				m_particlePool->GetStream(ParticlePool::Stream::k_positionZ)[particleIndex] = position.z;
+				m_particlePool->GetStream(ParticlePool::Stream::k_velocityX)[particleIndex] = velocity.x;
+				m_particlePool->GetStream(ParticlePool::Stream::k_velocityY)[particleIndex] = velocity.y;
+				m_particlePool->GetStream(ParticlePool::Stream::k_velocityZ)[particleIndex] = velocity.z;
+				m_particlePool->GetStream(ParticlePool::Stream::k_scaleX)[particleIndex] = scale.x;
+				m_particlePool->GetStream(ParticlePool::Stream::k_scaleY)[particleIndex] = scale.y;
+				m_particlePool->GetStream(ParticlePool::Stream::k_rotation)[particleIndex] = localRotation;
+				m_particlePool->GetStream(ParticlePool::Stream::k_angularVelocity)[particleIndex] = particleEffect->GetInitialAngularVelocityProperty()->GenerateValue(in_normalisedEmissionTime);
+				m_particlePool->GetStream(ParticlePool::Stream::k_colourR)[particleIndex] = colour.r;
+				m_particlePool->GetStream(ParticlePool::Stream::k_colourG)[particleIndex] = colour.g;
+				m_particlePool->GetStream(ParticlePool::Stream::k_colourB)[particleIndex] = colour.b;
+				m_particlePool->GetStream(ParticlePool::Stream::k_colourA)[particleIndex] = colour.a;
+				m_particlePool->GetStream(ParticlePool::Stream::k_lifetime)[particleIndex] = lifetime;
+				m_particlePool->GetStream(ParticlePool::Stream::k_energy)[particleIndex] = lifetime;
+				m_particlePool->GetStream(ParticlePool::Stream::k_lifeProgress)[particleIndex] = 0.0f;
 			}
 		}
 	}
@@ -132,11 +132,11 @@ namespace ChilliSource
 			/// @author Ian Copland.
 			///
 			/// @param The particle effect.
-			/// @param The particle array.
+			/// @param The particle pool.
 			///
 			/// @return the instance.
 			//----------------------------------------------------------------
-			virtual ParticleEmitterUPtr CreateInstance(Core::dynamic_array<Particle>* in_particleArray) const = 0;
+			virtual ParticleEmitterUPtr CreateInstance(ParticlePool* in_particlePool) const = 0;
 			//----------------------------------------------------------------
 			/// @author Ian Copland
 			///
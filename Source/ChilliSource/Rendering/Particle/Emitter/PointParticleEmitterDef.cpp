@@ -61,9 +61,9 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		ParticleEmitterUPtr PointParticleEmitterDef::CreateInstance(Core::dynamic_array<Particle>* in_particleArray) const
+		ParticleEmitterUPtr PointParticleEmitterDef::CreateInstance(ParticlePool* in_particlePool) const
 		{
-			return ParticleEmitterUPtr(new PointParticleEmitter(this, in_particleArray));
+			return ParticleEmitterUPtr(new PointParticleEmitter(this, in_particlePool));
 		}
 	}
 }
\ No newline at end of file
@@ -29,15 +29,15 @@
 #include <ChilliSource/Rendering/Particle/ParticleEffectComponent.h>
 
 #include <ChilliSource/Core/Base/Application.h>
-#include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/State/State.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Camera/PerspectiveCameraComponent.h>
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
+#include <ChilliSource/Rendering/Particle/ParticleUpdateSystem.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDef.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawable.h>
@@ -73,133 +73,6 @@ namespace ChilliSource
 				CS_ASSERT(in_particleEffect->GetInitialSpeedProperty() != nullptr, "Trying to use incomplete particle effect: Initial speed property missing.");
 				CS_ASSERT(in_particleEffect->GetInitialAngularVelocityProperty() != nullptr, "Trying to use incomplete particle effect: Initial angular velocity property missing.");
 			}
-			//----------------------------------------------------------------
-			/// Calculates the bounding shapes for the given set of particles.
-			///
-			/// @author Ian Copland
-			///
-			/// @param The particle effect.
-			/// @param The array of particles.
-			/// 
-			/// @return a pair containing the AABB and the Bounding Sphere.
-			//----------------------------------------------------------------
-			std::pair<Core::AABB, Core::Sphere> CalculateBoundingShapes(const ParticleEffect* in_particleEffect, const Core::dynamic_array<Particle>* in_particleArray)
-			{
-				Core::Vector3 min = CSCore::Vector3(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
-				Core::Vector3 max = CSCore::Vector3(-std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max());
-
-				bool anyActive = false;
-				for (const auto& particle : *in_particleArray)
-				{
-					if (particle.m_isActive == true)
-					{
-						anyActive = true;
-
-						if (particle.m_position.x < min.x)
-							min.x = particle.m_position.x;
-						if (particle.m_position.y < min.y)
-							min.y = particle.m_position.y;
-						if (particle.m_position.z < min.z)
-							min.z = particle.m_position.z;
-
-						if (particle.m_position.x > max.x)
-							max.x = particle.m_position.x;
-						if (particle.m_position.y > max.y)
-							max.y = particle.m_position.y;
-						if (particle.m_position.z > max.z)
-							max.z = particle.m_position.z;
-					}
-				}
-
-				if (anyActive == false)
-				{
-					min = CSCore::Vector3::k_zero;
-					max = CSCore::Vector3::k_zero;
-				}
-
-				Core::Vector3 size = max - min;
-				Core::Vector3 centre = min + 0.5f * size;
-
-				return std::make_pair(Core::AABB(centre, size), Core::Sphere(centre, size.Length() * 0.5f));
-			}
-			//----------------------------------------------------------------
-			/// Updates the particles on a background thread. This will emit
-			/// new particles, update existing particles and apply particle
-			/// affectors. These changes will then be committed to the 
-			/// draw data array to update the next render.
-			///
-			/// @author Ian Copland
-			///
-			/// @param Whether or not this needs to initialise the particles.
-			/// @param The particle effect.
-			/// @param The particle emitter. If null, the effect is no longer
-			/// emitting.
-			/// @param The list of particle affectors.
-			/// @param The array of particles.
-			/// @param The particle draw data array.
-			/// @param The playback time.
-			/// @param The delta time.
-			/// @param The entity's world position.
-			/// @param The entity's world scale.
-			/// @param The entity's world orientation.
-			/// @param Whether or not to interpolate the particles point
-			/// of emission since the last frame.
-			//----------------------------------------------------------------
-			void ParticleUpdateTask(ParticleEffectCSPtr in_particleEffect, ParticleEmitterSPtr in_particleEmitter, std::vector<ParticleAffectorSPtr> in_particleAffectors, 
-				std::shared_ptr<Core::dynamic_array<Particle>> in_particleArray, ConcurrentParticleDataSPtr in_concurrentParticleData, f32 in_playbackTime, 
-				f32 in_deltaTime, Core::Vector3 in_entityPosition, Core::Vector3 in_entityScale, Core::Quaternion in_entityOrientation, bool in_interpolateEmission)
-			{
-				CS_ASSERT(in_particleEffect != nullptr, "Cannot update particles with null particle effect.");
-				CS_ASSERT(in_particleArray != nullptr, "Cannot update particles with null particle array.");
-				CS_ASSERT(in_concurrentParticleData != nullptr, "Cannot update particles with null concurrent particle data.");
-
-				//update the particles
-				for (auto& particle : *in_particleArray)
-				{
-					if (particle.m_isActive == true)
-					{
-						particle.m_energy -= in_deltaTime;
-						if (particle.m_energy > 0.0f)
-						{
-							particle.m_position += particle.m_velocity * in_deltaTime;
-							particle.m_rotation += particle.m_angularVelocity * in_deltaTime;
-						}
-						else
-						{
-							particle.m_energy = 0.0f;
-							particle.m_isActive = false;
-						}
-					}
-				}
-
-                //calculate the normalised playback progress.
-                const f32 effectProgress = in_playbackTime / in_particleEffect->GetDuration();
-                
-				//apply affectors
-				for (auto& affector : in_particleAffectors)
-				{
-					affector->AffectParticles(in_deltaTime, effectProgress);
-				}
-
-				//try to emit
-				std::vector<u32> newIndices;
-				if (in_particleEmitter != nullptr)
-				{
-					newIndices = in_particleEmitter->TryEmit(in_playbackTime, in_entityPosition, in_entityScale, in_entityOrientation, in_interpolateEmission);
-				}
-
-				//Initialise any new particles in each affector.
-				for (u32 newIndex : newIndices)
-				{
-					for (auto& affector : in_particleAffectors)
-					{
-						affector->ActivateParticle(newIndex, effectProgress);
-					}
-				}
-
-				auto boundingShapes = CalculateBoundingShapes(in_particleEffect.get(), in_particleArray.get());
-				in_concurrentParticleData->CommitParticleData(in_particleArray.get(), newIndices, boundingShapes.first, boundingShapes.second);
-			}
 		}
 		CS_DEFINE_NAMEDTYPE(ParticleEffectComponent);
 		//-------------------------------------------------------
@@ -250,8 +123,6 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		const Core::AABB& ParticleEffectComponent::GetAABB()
 		{
-			CS_ASSERT(Core::Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Can only query for particle effect bounding shapes on the main thread.");
-
 			UpdateWorldBoundingShapes();
 			return mBoundingBox;
 		}
@@ -259,8 +130,6 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		const Core::OOBB& ParticleEffectComponent::GetOOBB()
 		{
-			CS_ASSERT(Core::Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Can only query for particle effect bounding shapes on the main thread.");
-
 			UpdateWorldBoundingShapes();
 			return mOBBoundingBox;
 		}
@@ -268,8 +137,6 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		const Core::Sphere& ParticleEffectComponent::GetBoundingSphere()
 		{
-			CS_ASSERT(Core::Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Can only query for particle effect bounding shapes on the main thread.");
-
 			UpdateWorldBoundingShapes();
 			return mBoundingSphere;
 		}
@@ -373,19 +240,19 @@ namespace ChilliSource
 			{
 				ValidateParticleEffect(m_particleEffect);
 
-				m_particleArray = std::make_shared<Core::dynamic_array<Particle>>(m_particleEffect->GetMaxParticles());
+				m_particlePool = std::make_shared<ParticlePool>(m_particleEffect->GetMaxParticles());
 				m_concurrentParticleData = std::make_shared<ConcurrentParticleData>(m_particleEffect->GetMaxParticles());
 
 				m_drawable = m_particleEffect->GetDrawableDef()->CreateInstance(GetEntity(), m_concurrentParticleData.get());
 				CS_ASSERT(m_drawable != nullptr, "Failed to create particle drawable.");
 
-				m_emitter = m_particleEffect->GetEmitterDef()->CreateInstance(m_particleArray.get());
+				m_emitter = m_particleEffect->GetEmitterDef()->CreateInstance(m_particlePool.get());
 				CS_ASSERT(m_emitter != nullptr, "Failed to create particle emitter.");
 
 				const std::vector<const ParticleAffectorDef*> affectorDefs = m_particleEffect->GetAffectorDefs();
 				for (const auto& affectorDef : affectorDefs)
 				{
-					ParticleAffectorSPtr affector = affectorDef->CreateInstance(m_particleArray.get());
+					ParticleAffectorSPtr affector = affectorDef->CreateInstance(m_particlePool.get());
 					CS_ASSERT(affector != nullptr, "Failed to create particle emitter.");
 
 					m_affectors.push_back(affector);
@@ -403,7 +270,7 @@ namespace ChilliSource
 		//-------------------------------------------------------
 		void ParticleEffectComponent::CleanupParticleEffect()
 		{
-			m_particleArray.reset();
+			m_particlePool.reset();
 			m_concurrentParticleData.reset();
 			m_drawable.reset();
 			m_emitter.reset();
@@ -425,6 +292,14 @@ namespace ChilliSource
 		{
 			CS_ASSERT(GetEntity() != nullptr, "Cannot get world bounding shapes without being attached to an entity.");
 
+			//The changed event may not have been sent yet in the deferred transform update mode
+			const u32 worldVersion = GetEntity()->GetTransform().GetWorldVersion();
+			if (worldVersion != m_entityWorldVersion)
+			{
+				m_entityWorldVersion = worldVersion;
+				m_invalidateBoundingShapeCache = true;
+			}
+
 			if (m_invalidateBoundingShapeCache == true)
 			{
 				if (m_particleEffect != nullptr && m_particleEffect->GetSimulationSpace() == ParticleEffect::SimulationSpace::k_world)
@@ -496,6 +371,9 @@ namespace ChilliSource
 		//-------------------------------------------------------
 		void ParticleEffectComponent::OnAddedToScene()
 		{
+			m_particleUpdateSystem = Core::Application::Get()->GetSystem<ParticleUpdateSystem>();
+			CS_ASSERT(m_particleUpdateSystem != nullptr, "Particle effect component requires the particle update system.");
+
 			Play();
 		}
 		//-------------------------------------------------------
@@ -531,11 +409,8 @@ namespace ChilliSource
 			if (m_concurrentParticleData->StartUpdate() == true)
 			{
 				//intialise the particles by disabling them all.
-				for (auto& particle : *m_particleArray)
-				{
-					particle.m_isActive = false;
-				}
-				m_concurrentParticleData->CommitParticleData(m_particleArray.get(), std::vector<u32>(), Core::AABB(), Core::Sphere());
+				m_particlePool->Clear();
+				m_concurrentParticleData->CommitParticleData(m_particlePool.get(), std::vector<u32>(), Core::AABB(), Core::Sphere());
 
 				m_playbackState = PlaybackState::k_playing;
 				UpdatePlayingState(in_deltaTime);
@@ -573,8 +448,8 @@ namespace ChilliSource
 				StoreLocalBoundingShapes();
 
 				bool shouldInterpolateEmission = (m_firstFrame == false);
-				Core::Application::Get()->GetTaskScheduler()->ScheduleTask(std::bind(ParticleUpdateTask, m_particleEffect, m_emitter, m_affectors, m_particleArray, m_concurrentParticleData,
-					m_playbackTimer, m_accumulatedDeltaTime, GetEntity()->GetTransform().GetWorldPosition(), GetEntity()->GetTransform().GetWorldScale(), GetEntity()->GetTransform().GetWorldOrientation(), shouldInterpolateEmission));
+				m_particleUpdateSystem->QueueUpdate(m_particleEffect, m_emitter, m_affectors, m_particlePool, m_concurrentParticleData, m_playbackTimer, m_accumulatedDeltaTime,
+					GetEntity()->GetTransform().GetWorldPosition(), GetEntity()->GetTransform().GetWorldScale(), GetEntity()->GetTransform().GetWorldOrientation(), shouldInterpolateEmission);
 
 				m_firstFrame = false;
 				m_accumulatedDeltaTime = 0.0f;
@@ -596,8 +471,8 @@ namespace ChilliSource
 					StoreLocalBoundingShapes();
 
 					bool shouldInterpolateEmission = (m_firstFrame == false);
-					Core::Application::Get()->GetTaskScheduler()->ScheduleTask(std::bind(ParticleUpdateTask, m_particleEffect, nullptr, m_affectors, m_particleArray, m_concurrentParticleData,
-						m_playbackTimer, m_accumulatedDeltaTime, GetEntity()->GetTransform().GetWorldPosition(), GetEntity()->GetTransform().GetWorldScale(), GetEntity()->GetTransform().GetWorldOrientation(), shouldInterpolateEmission));
+					m_particleUpdateSystem->QueueUpdate(m_particleEffect, nullptr, m_affectors, m_particlePool, m_concurrentParticleData, m_playbackTimer, m_accumulatedDeltaTime,
+						GetEntity()->GetTransform().GetWorldPosition(), GetEntity()->GetTransform().GetWorldScale(), GetEntity()->GetTransform().GetWorldOrientation(), shouldInterpolateEmission);
 
 					m_firstFrame = false;
 					m_accumulatedDeltaTime = 0.0f;
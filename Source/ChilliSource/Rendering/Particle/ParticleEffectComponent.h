@@ -149,19 +149,25 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			/// @author Ian Copland
 			///
-			/// @return The world space AABB of the effect.
+			/// @return The world space AABB of the effect. The local bounds
+			/// are only ever updated during OnUpdate() so this is safe to
+			/// call from the renderer's culling stage on other threads.
 			//----------------------------------------------------------------
 			const Core::AABB& GetAABB() override;
 			//----------------------------------------------------------------
 			/// @author Ian Copland
 			/// 
-			/// @return The world space OBB of the effect.
+			/// @return The world space OBB of the effect. The local bounds
+			/// are only ever updated during OnUpdate() so this is safe to
+			/// call from the renderer's culling stage on other threads.
 			//----------------------------------------------------------------
 			const Core::OOBB& GetOOBB() override;
 			//----------------------------------------------------------------
 			/// @author Ian Copland
 			///
-			/// @param The world space bounding sphere of the effect.
+			/// @param The world space bounding sphere of the effect. The local
+			/// bounds are only ever updated during OnUpdate() so this is safe
+			/// to call from the renderer's culling stage on other threads.
 			//----------------------------------------------------------------
 			const Core::Sphere& GetBoundingSphere() override;
 			//----------------------------------------------------------------
@@ -327,7 +333,8 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			void UpdateStartingState(f32 in_deltaTime);
 			//----------------------------------------------------------------
-			/// This will fire off a new particle update background task.
+			/// This will queue a new particle update with the particle update
+			/// system, which will run it on the thread pool.
 			///
 			/// @author Ian Copland
 			///
@@ -393,8 +400,9 @@ namespace ChilliSource
 			ParticleDrawableUPtr m_drawable;
 			ParticleEmitterSPtr m_emitter;
 			std::vector<ParticleAffectorSPtr> m_affectors;
-			std::shared_ptr<Core::dynamic_array<Particle>> m_particleArray;
+			std::shared_ptr<ParticlePool> m_particlePool;
 			ConcurrentParticleDataSPtr m_concurrentParticleData;
+			ParticleUpdateSystem* m_particleUpdateSystem = nullptr;
 
 			PlaybackType m_playbackType = PlaybackType::k_once;
 			PlaybackState m_playbackState = PlaybackState::k_notPlaying;
@@ -407,6 +415,7 @@ namespace ChilliSource
 			Core::AABB m_localAABB;
 			Core::Sphere m_localBoundingSphere;
 			bool m_invalidateBoundingShapeCache = true;
+			u32 m_entityWorldVersion = 0;
 			Core::EventConnectionUPtr m_entityTransformConnection;
 		};
 	}
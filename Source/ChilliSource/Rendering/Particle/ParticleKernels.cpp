@@ -0,0 +1,239 @@
+//
+//  ParticleKernels.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/ParticleKernels.h>
+
+#include <ChilliSource/Core/Math/Vector3.h>
+
+#include <algorithm>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#	define CS_PARTICLEKERNELS_SSE
+#	include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#	define CS_PARTICLEKERNELS_NEON
+#	include <arm_neon.h>
+#endif
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		namespace ParticleKernels
+		{
+			namespace
+			{
+				const u32 k_simdWidth = 4;
+#if defined(CS_PARTICLEKERNELS_NEON)
+				//----------------------------------------------------------------
+				/// NEON has no divide instruction on all targets so this refines
+				/// the reciprocal estimate to near full precision.
+				///
+				/// @param The values.
+				///
+				/// @return The reciprocals of the values.
+				//----------------------------------------------------------------
+				float32x4_t Reciprocal(float32x4_t in_values)
+				{
+					float32x4_t reciprocal = vrecpeq_f32(in_values);
+					reciprocal = vmulq_f32(vrecpsq_f32(in_values, reciprocal), reciprocal);
+					reciprocal = vmulq_f32(vrecpsq_f32(in_values, reciprocal), reciprocal);
+					return reciprocal;
+				}
+#endif
+			}
+			//----------------------------------------------------------------
+			//----------------------------------------------------------------
+			void AddScalar(f32* inout_values, f32 in_scalar, u32 in_count)
+			{
+				u32 i = 0;
+#if defined(CS_PARTICLEKERNELS_SSE)
+				const __m128 scalar = _mm_set1_ps(in_scalar);
+				for (; i + k_simdWidth <= in_count; i += k_simdWidth)
+				{
+					_mm_storeu_ps(inout_values + i, _mm_add_ps(_mm_loadu_ps(inout_values + i), scalar));
+				}
+#elif defined(CS_PARTICLEKERNELS_NEON)
+				const float32x4_t scalar = vdupq_n_f32(in_scalar);
+				for (; i + k_simdWidth <= in_count; i += k_simdWidth)
+				{
+					vst1q_f32(inout_values + i, vaddq_f32(vld1q_f32(inout_values + i), scalar));
+				}
+#endif
+				for (; i < in_count; ++i)
+				{
+					inout_values[i] += in_scalar;
+				}
+			}
+			//----------------------------------------------------------------
+			//----------------------------------------------------------------
+			void MultiplyAdd(f32* inout_values, const f32* in_rates, f32 in_scale, u32 in_count)
+			{
+				u32 i = 0;
+#if defined(CS_PARTICLEKERNELS_SSE)
+				const __m128 scale = _mm_set1_ps(in_scale);
+				for (; i + k_simdWidth <= in_count; i += k_simdWidth)
+				{
+					__m128 values = _mm_loadu_ps(inout_values + i);
+					__m128 rates = _mm_loadu_ps(in_rates + i);
+					_mm_storeu_ps(inout_values + i, _mm_add_ps(values, _mm_mul_ps(rates, scale)));
+				}
+#elif defined(CS_PARTICLEKERNELS_NEON)
+				for (; i + k_simdWidth <= in_count; i += k_simdWidth)
+				{
+					float32x4_t values = vld1q_f32(inout_values + i);
+					float32x4_t rates = vld1q_f32(in_rates + i);
+					vst1q_f32(inout_values + i, vmlaq_n_f32(values, rates, in_scale));
+				}
+#endif
+				for (; i < in_count; ++i)
+				{
+					inout_values[i] += in_rates[i] * in_scale;
+				}
+			}
+			//----------------------------------------------------------------
+			//----------------------------------------------------------------
+			void CalculateLifeProgress(const f32* in_energy, const f32* in_lifetime, f32* out_progress, u32 in_count)
+			{
+				u32 i = 0;
+#if defined(CS_PARTICLEKERNELS_SSE)
+				const __m128 one = _mm_set1_ps(1.0f);
+				for (; i + k_simdWidth <= in_count; i += k_simdWidth)
+				{
+					__m128 energy = _mm_loadu_ps(in_energy + i);
+					__m128 lifetime = _mm_loadu_ps(in_lifetime + i);
+					_mm_storeu_ps(out_progress + i, _mm_sub_ps(one, _mm_div_ps(energy, lifetime)));
+				}
+#elif defined(CS_PARTICLEKERNELS_NEON)
+				const float32x4_t one = vdupq_n_f32(1.0f);
+				for (; i + k_simdWidth <= in_count; i += k_simdWidth)
+				{
+					float32x4_t energy = vld1q_f32(in_energy + i);
+					float32x4_t lifetime = vld1q_f32(in_lifetime + i);
+					vst1q_f32(out_progress + i, vmlsq_f32(one, energy, Reciprocal(lifetime)));
+				}
+#endif
+				for (; i < in_count; ++i)
+				{
+					out_progress[i] = 1.0f - (in_energy[i] / in_lifetime[i]);
+				}
+			}
+			//----------------------------------------------------------------
+			//----------------------------------------------------------------
+			void Lerp(const f32* in_from, const f32* in_to, const f32* in_t, f32* out_values, u32 in_count)
+			{
+				u32 i = 0;
+#if defined(CS_PARTICLEKERNELS_SSE)
+				for (; i + k_simdWidth <= in_count; i += k_simdWidth)
+				{
+					__m128 from = _mm_loadu_ps(in_from + i);
+					__m128 to = _mm_loadu_ps(in_to + i);
+					__m128 t = _mm_loadu_ps(in_t + i);
+					_mm_storeu_ps(out_values + i, _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(to, from), t)));
+				}
+#elif defined(CS_PARTICLEKERNELS_NEON)
+				for (; i + k_simdWidth <= in_count; i += k_simdWidth)
+				{
+					float32x4_t from = vld1q_f32(in_from + i);
+					float32x4_t to = vld1q_f32(in_to + i);
+					float32x4_t t = vld1q_f32(in_t + i);
+					vst1q_f32(out_values + i, vmlaq_f32(from, vsubq_f32(to, from), t));
+				}
+#endif
+				for (; i < in_count; ++i)
+				{
+					out_values[i] = in_from[i] + (in_to[i] - in_from[i]) * in_t[i];
+				}
+			}
+			//----------------------------------------------------------------
+			//----------------------------------------------------------------
+			void CalculateBounds(const f32* in_x, const f32* in_y, const f32* in_z, u32 in_count, Core::Vector3& out_min, Core::Vector3& out_max)
+			{
+				if (in_count == 0)
+				{
+					out_min = Core::Vector3::k_zero;
+					out_max = Core::Vector3::k_zero;
+					return;
+				}
+
+				Core::Vector3 min(in_x[0], in_y[0], in_z[0]);
+				Core::Vector3 max = min;
+
+				u32 i = 0;
+#if defined(CS_PARTICLEKERNELS_SSE)
+				if (in_count >= k_simdWidth)
+				{
+					__m128 minX = _mm_loadu_ps(in_x), minY = _mm_loadu_ps(in_y), minZ = _mm_loadu_ps(in_z);
+					__m128 maxX = minX, maxY = minY, maxZ = minZ;
+					for (i = k_simdWidth; i + k_simdWidth <= in_count; i += k_simdWidth)
+					{
+						__m128 x = _mm_loadu_ps(in_x + i), y = _mm_loadu_ps(in_y + i), z = _mm_loadu_ps(in_z + i);
+						minX = _mm_min_ps(minX, x); minY = _mm_min_ps(minY, y); minZ = _mm_min_ps(minZ, z);
+						maxX = _mm_max_ps(maxX, x); maxY = _mm_max_ps(maxY, y); maxZ = _mm_max_ps(maxZ, z);
+					}
+
+					f32 lanes[k_simdWidth];
+					_mm_storeu_ps(lanes, minX); min.x = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+					_mm_storeu_ps(lanes, minY); min.y = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+					_mm_storeu_ps(lanes, minZ); min.z = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+					_mm_storeu_ps(lanes, maxX); max.x = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+					_mm_storeu_ps(lanes, maxY); max.y = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+					_mm_storeu_ps(lanes, maxZ); max.z = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+				}
+#elif defined(CS_PARTICLEKERNELS_NEON)
+				if (in_count >= k_simdWidth)
+				{
+					float32x4_t minX = vld1q_f32(in_x), minY = vld1q_f32(in_y), minZ = vld1q_f32(in_z);
+					float32x4_t maxX = minX, maxY = minY, maxZ = minZ;
+					for (i = k_simdWidth; i + k_simdWidth <= in_count; i += k_simdWidth)
+					{
+						float32x4_t x = vld1q_f32(in_x + i), y = vld1q_f32(in_y + i), z = vld1q_f32(in_z + i);
+						minX = vminq_f32(minX, x); minY = vminq_f32(minY, y); minZ = vminq_f32(minZ, z);
+						maxX = vmaxq_f32(maxX, x); maxY = vmaxq_f32(maxY, y); maxZ = vmaxq_f32(maxZ, z);
+					}
+
+					f32 lanes[k_simdWidth];
+					vst1q_f32(lanes, minX); min.x = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+					vst1q_f32(lanes, minY); min.y = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+					vst1q_f32(lanes, minZ); min.z = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+					vst1q_f32(lanes, maxX); max.x = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+					vst1q_f32(lanes, maxY); max.y = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+					vst1q_f32(lanes, maxZ); max.z = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+				}
+#endif
+				for (; i < in_count; ++i)
+				{
+					min.x = std::min(min.x, in_x[i]); min.y = std::min(min.y, in_y[i]); min.z = std::min(min.z, in_z[i]);
+					max.x = std::max(max.x, in_x[i]); max.y = std::max(max.y, in_y[i]); max.z = std::max(max.z, in_z[i]);
+				}
+
+				out_min = min;
+				out_max = max;
+			}
+		}
+	}
+}
@@ -0,0 +1,99 @@
+//
+//  ParticleKernels.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEKERNELS_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEKERNELS_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		//-----------------------------------------------------------------------
+		/// Bulk operations over particle pool streams. These process four
+		/// particles at a time using SSE or NEON where available and fall back
+		/// to scalar code otherwise. Streams are not required to be aligned.
+		//-----------------------------------------------------------------------
+		namespace ParticleKernels
+		{
+			//----------------------------------------------------------------
+			/// Adds the scalar to each value: values[i] += scalar
+			///
+			/// @param [In/Out] The values.
+			/// @param The scalar.
+			/// @param The number of values.
+			//----------------------------------------------------------------
+			void AddScalar(f32* inout_values, f32 in_scalar, u32 in_count);
+			//----------------------------------------------------------------
+			/// Adds the scaled rates to the values: values[i] += rates[i] * scale.
+			/// This is used to integrate one stream by another over a time step.
+			///
+			/// @param [In/Out] The values.
+			/// @param The rates.
+			/// @param The scale.
+			/// @param The number of values.
+			//----------------------------------------------------------------
+			void MultiplyAdd(f32* inout_values, const f32* in_rates, f32 in_scale, u32 in_count);
+			//----------------------------------------------------------------
+			/// Calculates the normalised (0.0 to 1.0) progress through the
+			/// life of each particle: progress[i] = 1 - energy[i] / lifetime[i]
+			///
+			/// @param The remaining energy of each particle.
+			/// @param The lifetime of each particle.
+			/// @param [Out] The life progress of each particle.
+			/// @param The number of particles.
+			//----------------------------------------------------------------
+			void CalculateLifeProgress(const f32* in_energy, const f32* in_lifetime, f32* out_progress, u32 in_count);
+			//----------------------------------------------------------------
+			/// Linearly interpolates between two streams:
+			/// values[i] = from[i] + (to[i] - from[i]) * t[i]
+			///
+			/// @param The values to interpolate from.
+			/// @param The values to interpolate to.
+			/// @param The interpolation factors.
+			/// @param [Out] The interpolated values.
+			/// @param The number of values.
+			//----------------------------------------------------------------
+			void Lerp(const f32* in_from, const f32* in_to, const f32* in_t, f32* out_values, u32 in_count);
+			//----------------------------------------------------------------
+			/// Calculates the minimum and maximum of the given positions.
+			/// If there are no positions both are zero.
+			///
+			/// @param The x components.
+			/// @param The y components.
+			/// @param The z components.
+			/// @param The number of positions.
+			/// @param [Out] The minimum of each component.
+			/// @param [Out] The maximum of each component.
+			//----------------------------------------------------------------
+			void CalculateBounds(const f32* in_x, const f32* in_y, const f32* in_z, u32 in_count, Core::Vector3& out_min, Core::Vector3& out_max);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,190 @@
+//
+//  ParticlePool.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		ParticlePool::ParticlePool(u32 in_capacity)
+			: m_capacity(in_capacity), m_ids(new u32[in_capacity])
+		{
+			CS_ASSERT(m_capacity > 0, "Cannot create a particle pool with no capacity.");
+
+			for (u32 i = 0; i < (u32)Stream::k_total; ++i)
+			{
+				m_streams.push_back(std::unique_ptr<f32[]>(new f32[m_capacity]));
+			}
+
+			m_freeIds.reserve(m_capacity);
+			m_survivingIndices.reserve(m_capacity);
+			Clear();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		u32 ParticlePool::GetCapacity() const
+		{
+			return m_capacity;
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		u32 ParticlePool::GetNumActive() const
+		{
+			return m_numActive;
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		bool ParticlePool::IsFull() const
+		{
+			return (m_numActive == m_capacity);
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		u32 ParticlePool::AddCustomStream()
+		{
+			m_streams.push_back(std::unique_ptr<f32[]>(new f32[m_capacity]));
+			return m_streams.size() - 1 - (u32)Stream::k_total;
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		f32* ParticlePool::GetStream(Stream in_stream)
+		{
+			CS_ASSERT(in_stream != Stream::k_total, "Invalid particle stream.");
+
+			return m_streams[(u32)in_stream].get();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		const f32* ParticlePool::GetStream(Stream in_stream) const
+		{
+			CS_ASSERT(in_stream != Stream::k_total, "Invalid particle stream.");
+
+			return m_streams[(u32)in_stream].get();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		f32* ParticlePool::GetCustomStream(u32 in_stream)
+		{
+			CS_ASSERT((u32)Stream::k_total + in_stream < m_streams.size(), "Invalid custom particle stream.");
+
+			return m_streams[(u32)Stream::k_total + in_stream].get();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		const f32* ParticlePool::GetCustomStream(u32 in_stream) const
+		{
+			CS_ASSERT((u32)Stream::k_total + in_stream < m_streams.size(), "Invalid custom particle stream.");
+
+			return m_streams[(u32)Stream::k_total + in_stream].get();
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		u32 ParticlePool::GetId(u32 in_index) const
+		{
+			CS_ASSERT(in_index < m_numActive, "Index out of bounds!");
+
+			return m_ids[in_index];
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		u32 ParticlePool::ActivateParticle()
+		{
+			CS_ASSERT(IsFull() == false, "Cannot activate a particle in a full particle pool.");
+
+			u32 index = m_numActive++;
+			m_ids[index] = m_freeIds.back();
+			m_freeIds.pop_back();
+
+			return index;
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		void ParticlePool::RemoveExpiredParticles()
+		{
+			const f32* energy = GetStream(Stream::k_energy);
+
+			m_survivingIndices.clear();
+			for (u32 i = 0; i < m_numActive; ++i)
+			{
+				if (energy[i] > 0.0f)
+				{
+					m_survivingIndices.push_back(i);
+				}
+				else
+				{
+					m_freeIds.push_back(m_ids[i]);
+				}
+			}
+
+			const u32 numSurviving = m_survivingIndices.size();
+			if (numSurviving == m_numActive)
+			{
+				return;
+			}
+
+			//Everything before the first expired particle is already in place. The rest are packed
+			//one stream at a time so each pass only walks through a single array.
+			u32 firstMoved = 0;
+			while (firstMoved < numSurviving && m_survivingIndices[firstMoved] == firstMoved)
+			{
+				++firstMoved;
+			}
+
+			for (const auto& stream : m_streams)
+			{
+				f32* values = stream.get();
+				for (u32 i = firstMoved; i < numSurviving; ++i)
+				{
+					values[i] = values[m_survivingIndices[i]];
+				}
+			}
+
+			for (u32 i = firstMoved; i < numSurviving; ++i)
+			{
+				m_ids[i] = m_ids[m_survivingIndices[i]];
+			}
+
+			m_numActive = numSurviving;
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		void ParticlePool::Clear()
+		{
+			m_numActive = 0;
+
+			//Ids are handed out from the back so the first particles get the lowest ids.
+			m_freeIds.clear();
+			for (u32 i = 0; i < m_capacity; ++i)
+			{
+				m_freeIds.push_back(m_capacity - 1 - i);
+			}
+		}
+	}
+}
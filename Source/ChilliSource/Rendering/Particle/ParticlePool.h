@@ -0,0 +1,180 @@
+//
+//  ParticlePool.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEPOOL_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEPOOL_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <memory>
+#include <vector>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		//-----------------------------------------------------------------------
+		/// Storage for the particles of a single particle effect. Each property
+		/// is stored in its own array of floats (a "stream") so that updates
+		/// can process many particles at a time with SIMD kernels. Active
+		/// particles are always packed at the front of every stream, so
+		/// updates only ever touch live particles.
+		///
+		/// As particles are packed, the index of a particle changes when
+		/// particles before it expire. Each particle also has an id which stays
+		/// the same for as long as the particle is alive; this is used by
+		/// anything that needs to associate data with a particle across
+		/// updates, for example the particle drawables.
+		///
+		/// Affectors which need to store per-particle data should add custom
+		/// streams so that their data is packed along with the particle.
+		///
+		/// Particle pools are updated as part of a background task and should
+		/// not be accessed from other threads.
+		//-----------------------------------------------------------------------
+		class ParticlePool final
+		{
+		public:
+			CS_DECLARE_NOCOPY(ParticlePool);
+			//----------------------------------------------------------------
+			/// The built-in particle property streams.
+			//----------------------------------------------------------------
+			enum class Stream
+			{
+				k_positionX,
+				k_positionY,
+				k_positionZ,
+				k_velocityX,
+				k_velocityY,
+				k_velocityZ,
+				k_scaleX,
+				k_scaleY,
+				k_rotation,
+				k_angularVelocity,
+				k_colourR,
+				k_colourG,
+				k_colourB,
+				k_colourA,
+				k_energy,
+				k_lifetime,
+				k_lifeProgress,
+				k_total
+			};
+			//----------------------------------------------------------------
+			/// Constructor.
+			///
+			/// @param The maximum number of particles.
+			//----------------------------------------------------------------
+			ParticlePool(u32 in_capacity);
+			//----------------------------------------------------------------
+			/// @return The maximum number of particles.
+			//----------------------------------------------------------------
+			u32 GetCapacity() const;
+			//----------------------------------------------------------------
+			/// @return The number of active particles. These are stored at
+			/// indices 0 to GetNumActive() - 1 in each stream.
+			//----------------------------------------------------------------
+			u32 GetNumActive() const;
+			//----------------------------------------------------------------
+			/// @return Whether or not there are no free particles.
+			//----------------------------------------------------------------
+			bool IsFull() const;
+			//----------------------------------------------------------------
+			/// Adds a new per-particle stream of floats. The values of the new
+			/// stream for particles which are already active are undefined.
+			///
+			/// @return The handle to the custom stream.
+			//----------------------------------------------------------------
+			u32 AddCustomStream();
+			//----------------------------------------------------------------
+			/// @param The stream.
+			///
+			/// @return The array of values for the stream. This contains
+			/// GetCapacity() values, of which the first GetNumActive() are
+			/// valid. This will not change for the life of the pool.
+			//----------------------------------------------------------------
+			f32* GetStream(Stream in_stream);
+			//----------------------------------------------------------------
+			/// @param The stream.
+			///
+			/// @return The array of values for the stream. This contains
+			/// GetCapacity() values, of which the first GetNumActive() are
+			/// valid. This will not change for the life of the pool.
+			//----------------------------------------------------------------
+			const f32* GetStream(Stream in_stream) const;
+			//----------------------------------------------------------------
+			/// @param The custom stream handle.
+			///
+			/// @return The array of values for the custom stream. This will
+			/// not change for the life of the pool.
+			//----------------------------------------------------------------
+			f32* GetCustomStream(u32 in_stream);
+			//----------------------------------------------------------------
+			/// @param The custom stream handle.
+			///
+			/// @return The array of values for the custom stream. This will
+			/// not change for the life of the pool.
+			//----------------------------------------------------------------
+			const f32* GetCustomStream(u32 in_stream) const;
+			//----------------------------------------------------------------
+			/// @param The index of an active particle.
+			///
+			/// @return The id of the particle. This is in the range 0 to
+			/// GetCapacity() - 1 and is unique among the active particles.
+			//----------------------------------------------------------------
+			u32 GetId(u32 in_index) const;
+			//----------------------------------------------------------------
+			/// Activates a new particle at the end of the active particles.
+			/// The pool must not be full. The values of the new particle's
+			/// streams are undefined until they are set by the caller.
+			///
+			/// @return The index of the new particle.
+			//----------------------------------------------------------------
+			u32 ActivateParticle();
+			//----------------------------------------------------------------
+			/// Removes all particles which have run out of energy, packing
+			/// the remaining particles at the front of each stream. The
+			/// relative order of the remaining particles is preserved.
+			//----------------------------------------------------------------
+			void RemoveExpiredParticles();
+			//----------------------------------------------------------------
+			/// Deactivates all particles.
+			//----------------------------------------------------------------
+			void Clear();
+
+		private:
+			u32 m_capacity = 0;
+			u32 m_numActive = 0;
+			std::vector<std::unique_ptr<f32[]>> m_streams;
+			std::unique_ptr<u32[]> m_ids;
+			std::vector<u32> m_freeIds;
+			std::vector<u32> m_survivingIndices;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,297 @@
+//
+//  ParticleUpdateSystem.cpp
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/ParticleUpdateSystem.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Math/Geometry/Shapes.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
+#include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleKernels.h>
+#include <ChilliSource/Rendering/Particle/ParticlePool.h>
+#include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
+#include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitter.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		namespace
+		{
+			//Effects with at least this many active particles are split into blocks which are updated across the thread pool.
+			const u32 k_minParticlesToSplit = 4096;
+			//The minimum number of particles in each block of a split effect.
+			const u32 k_particlesPerBlock = 1024;
+			//Small effects are gathered into a single task until the batch contains roughly this many particles.
+			const u32 k_particlesPerBatch = 2048;
+			//The cost, in particles, assumed for each effect in a batch. This accounts for the fixed overhead of updating
+			//an effect, such as emission and committing, so that many tiny effects are still spread over several tasks.
+			const u32 k_minParticleCostPerEffect = 64;
+
+			//----------------------------------------------------------------
+			/// Calls the given task with ranges covering the given number of
+			/// particles. If a task scheduler is supplied the particles are
+			/// split into blocks and processed across the thread pool,
+			/// otherwise the whole range is processed on the current thread.
+			///
+			/// @param The task scheduler, or null to process in serial.
+			/// @param The number of particles.
+			/// @param The task, which takes the start and end index of the
+			/// range to process.
+			//----------------------------------------------------------------
+			template <typename TTask> void ForEachParticleBlock(Core::TaskScheduler* in_taskScheduler, u32 in_numParticles, const TTask& in_task)
+			{
+				if (in_taskScheduler != nullptr && in_numParticles > k_particlesPerBlock)
+				{
+					in_taskScheduler->ParallelFor(in_numParticles, k_particlesPerBlock, in_task);
+				}
+				else if (in_numParticles > 0)
+				{
+					in_task(0, in_numParticles);
+				}
+			}
+			//----------------------------------------------------------------
+			/// Calculates the bounding shapes for the active particles in the
+			/// given particle pool.
+			///
+			/// @param The particle pool.
+			/// 
+			/// @return a pair containing the AABB and the Bounding Sphere.
+			//----------------------------------------------------------------
+			std::pair<Core::AABB, Core::Sphere> CalculateBoundingShapes(const ParticlePool* in_particlePool)
+			{
+				Core::Vector3 min, max;
+				ParticleKernels::CalculateBounds(in_particlePool->GetStream(ParticlePool::Stream::k_positionX), in_particlePool->GetStream(ParticlePool::Stream::k_positionY),
+					in_particlePool->GetStream(ParticlePool::Stream::k_positionZ), in_particlePool->GetNumActive(), min, max);
+
+				Core::Vector3 size = max - min;
+				Core::Vector3 centre = min + 0.5f * size;
+
+				return std::make_pair(Core::AABB(centre, size), Core::Sphere(centre, size.Length() * 0.5f));
+			}
+			//----------------------------------------------------------------
+			/// Updates a single particle effect. This will emit new particles,
+			/// update existing particles and apply particle affectors. These
+			/// changes will then be committed to the concurrent particle data
+			/// to update the next render.
+			///
+			/// The per-particle work is independent for each particle, so if
+			/// a task scheduler is supplied it is split into blocks and spread
+			/// across the thread pool. Compaction, emission and committing
+			/// work on the pool as a whole and are always performed in serial.
+			///
+			/// This will be called on a background thread.
+			///
+			/// @param The update request.
+			/// @param The task scheduler used to split the update, or null
+			/// if the update should be performed in serial.
+			//----------------------------------------------------------------
+			void UpdateParticleEffect(const ParticleUpdateSystem::UpdateRequest& in_request, Core::TaskScheduler* in_taskScheduler)
+			{
+				CS_ASSERT(in_request.m_particleEffect != nullptr, "Cannot update particles with null particle effect.");
+				CS_ASSERT(in_request.m_particlePool != nullptr, "Cannot update particles with null particle pool.");
+				CS_ASSERT(in_request.m_concurrentParticleData != nullptr, "Cannot update particles with null concurrent particle data.");
+
+				ParticlePool* particlePool = in_request.m_particlePool.get();
+				const f32 deltaTime = in_request.m_deltaTime;
+
+				//remove any particles which have run out of energy before integrating the rest.
+				f32* energy = particlePool->GetStream(ParticlePool::Stream::k_energy);
+				ForEachParticleBlock(in_taskScheduler, particlePool->GetNumActive(), [=](u32 in_startIndex, u32 in_endIndex)
+				{
+					ParticleKernels::AddScalar(energy + in_startIndex, -deltaTime, in_endIndex - in_startIndex);
+				});
+				particlePool->RemoveExpiredParticles();
+
+				//calculate the normalised playback progress.
+				const f32 effectProgress = in_request.m_playbackTime / in_request.m_particleEffect->GetDuration();
+
+				//integrate and apply affectors to each block in a single pass so the block stays in cache.
+				f32* positionX = particlePool->GetStream(ParticlePool::Stream::k_positionX);
+				f32* positionY = particlePool->GetStream(ParticlePool::Stream::k_positionY);
+				f32* positionZ = particlePool->GetStream(ParticlePool::Stream::k_positionZ);
+				f32* rotation = particlePool->GetStream(ParticlePool::Stream::k_rotation);
+				f32* lifeProgress = particlePool->GetStream(ParticlePool::Stream::k_lifeProgress);
+				const f32* velocityX = particlePool->GetStream(ParticlePool::Stream::k_velocityX);
+				const f32* velocityY = particlePool->GetStream(ParticlePool::Stream::k_velocityY);
+				const f32* velocityZ = particlePool->GetStream(ParticlePool::Stream::k_velocityZ);
+				const f32* angularVelocity = particlePool->GetStream(ParticlePool::Stream::k_angularVelocity);
+				const f32* lifetime = particlePool->GetStream(ParticlePool::Stream::k_lifetime);
+				const auto& affectors = in_request.m_particleAffectors;
+
+				ForEachParticleBlock(in_taskScheduler, particlePool->GetNumActive(), [&](u32 in_startIndex, u32 in_endIndex)
+				{
+					const u32 count = in_endIndex - in_startIndex;
+					ParticleKernels::MultiplyAdd(positionX + in_startIndex, velocityX + in_startIndex, deltaTime, count);
+					ParticleKernels::MultiplyAdd(positionY + in_startIndex, velocityY + in_startIndex, deltaTime, count);
+					ParticleKernels::MultiplyAdd(positionZ + in_startIndex, velocityZ + in_startIndex, deltaTime, count);
+					ParticleKernels::MultiplyAdd(rotation + in_startIndex, angularVelocity + in_startIndex, deltaTime, count);
+					ParticleKernels::CalculateLifeProgress(energy + in_startIndex, lifetime + in_startIndex, lifeProgress + in_startIndex, count);
+
+					for (auto& affector : affectors)
+					{
+						affector->AffectParticles(deltaTime, effectProgress, in_startIndex, in_endIndex);
+					}
+				});
+
+				//try to emit
+				std::vector<u32> newIndices;
+				if (in_request.m_particleEmitter != nullptr)
+				{
+					newIndices = in_request.m_particleEmitter->TryEmit(in_request.m_playbackTime, in_request.m_entityPosition, in_request.m_entityScale, in_request.m_entityOrientation, in_request.m_interpolateEmission);
+				}
+
+				//Initialise any new particles in each affector. The draw data refers to particles by id rather than index.
+				std::vector<u32> newIds;
+				newIds.reserve(newIndices.size());
+				for (u32 newIndex : newIndices)
+				{
+					for (auto& affector : affectors)
+					{
+						affector->ActivateParticle(newIndex, effectProgress);
+					}
+
+					newIds.push_back(particlePool->GetId(newIndex));
+				}
+
+				auto boundingShapes = CalculateBoundingShapes(particlePool);
+				in_request.m_concurrentParticleData->CommitParticleData(particlePool, newIds, boundingShapes.first, boundingShapes.second);
+			}
+			//----------------------------------------------------------------
+			/// Schedules a single task which updates each of the effects in
+			/// the given batch in turn. The batch will be empty afterwards.
+			///
+			/// @param The task scheduler.
+			/// @param [In/Out] The batch of update requests.
+			//----------------------------------------------------------------
+			void ScheduleBatch(Core::TaskScheduler* in_taskScheduler, std::vector<ParticleUpdateSystem::UpdateRequest>& inout_batch)
+			{
+				auto batch = std::make_shared<std::vector<ParticleUpdateSystem::UpdateRequest>>(std::move(inout_batch));
+				inout_batch.clear();
+
+				in_taskScheduler->ScheduleTask([batch]()
+				{
+					for (const auto& request : *batch)
+					{
+						UpdateParticleEffect(request, nullptr);
+					}
+				}, Core::TaskPriority::k_high);
+			}
+		}
+
+		CS_DEFINE_NAMEDTYPE(ParticleUpdateSystem);
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		ParticleUpdateSystemUPtr ParticleUpdateSystem::Create()
+		{
+			return ParticleUpdateSystemUPtr(new ParticleUpdateSystem());
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		bool ParticleUpdateSystem::IsA(Core::InterfaceIDType in_interfaceId) const
+		{
+			return (ParticleUpdateSystem::InterfaceID == in_interfaceId);
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void ParticleUpdateSystem::QueueUpdate(const ParticleEffectCSPtr& in_particleEffect, const ParticleEmitterSPtr& in_particleEmitter, const std::vector<ParticleAffectorSPtr>& in_particleAffectors,
+			const std::shared_ptr<ParticlePool>& in_particlePool, const ConcurrentParticleDataSPtr& in_concurrentParticleData, f32 in_playbackTime, f32 in_deltaTime,
+			const Core::Vector3& in_entityPosition, const Core::Vector3& in_entityScale, const Core::Quaternion& in_entityOrientation, bool in_interpolateEmission)
+		{
+			CS_ASSERT(Core::Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Particle updates must be queued on the main thread.");
+
+			UpdateRequest request;
+			request.m_particleEffect = in_particleEffect;
+			request.m_particleEmitter = in_particleEmitter;
+			request.m_particleAffectors = in_particleAffectors;
+			request.m_particlePool = in_particlePool;
+			request.m_concurrentParticleData = in_concurrentParticleData;
+			request.m_playbackTime = in_playbackTime;
+			request.m_deltaTime = in_deltaTime;
+			request.m_entityPosition = in_entityPosition;
+			request.m_entityScale = in_entityScale;
+			request.m_entityOrientation = in_entityOrientation;
+			request.m_interpolateEmission = in_interpolateEmission;
+			m_queuedRequests.push_back(std::move(request));
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void ParticleUpdateSystem::ProcessQueuedUpdates()
+		{
+			if (m_queuedRequests.empty() == true)
+			{
+				return;
+			}
+
+			Core::TaskScheduler* taskScheduler = Core::Application::Get()->GetTaskScheduler();
+			CS_ASSERT(taskScheduler->IsMainThread() == true, "Particle updates must be dispatched on the main thread.");
+
+			//The pools of queued effects aren't being updated, so the number of active particles can safely be read here.
+			std::vector<UpdateRequest> batch;
+			u32 numBatchedParticles = 0;
+			for (auto& request : m_queuedRequests)
+			{
+				const u32 numParticles = request.m_particlePool->GetNumActive();
+				if (numParticles >= k_minParticlesToSplit)
+				{
+					auto splitRequest = std::make_shared<UpdateRequest>(std::move(request));
+					taskScheduler->ScheduleTask([splitRequest, taskScheduler]()
+					{
+						UpdateParticleEffect(*splitRequest, taskScheduler);
+					}, Core::TaskPriority::k_high);
+				}
+				else
+				{
+					batch.push_back(std::move(request));
+					numBatchedParticles += std::max(numParticles, k_minParticleCostPerEffect);
+
+					if (numBatchedParticles >= k_particlesPerBatch)
+					{
+						ScheduleBatch(taskScheduler, batch);
+						numBatchedParticles = 0;
+					}
+				}
+			}
+
+			if (batch.empty() == false)
+			{
+				ScheduleBatch(taskScheduler, batch);
+			}
+
+			m_queuedRequests.clear();
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void ParticleUpdateSystem::OnDestroy()
+		{
+			m_queuedRequests.clear();
+		}
+	}
+}
@@ -0,0 +1,142 @@
+//
+//  ParticleUpdateSystem.h
+//  Chilli Source
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEUPDATESYSTEM_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEUPDATESYSTEM_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Core/System/AppSystem.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		//-------------------------------------------------------------------------
+		/// A system which simulates all particle effects on the thread pool.
+		/// Particle effect components queue an update request during the state
+		/// update and the requests are dispatched together once all states have
+		/// updated.
+		///
+		/// Dispatching all effects at once lets the work be shaped to fit the
+		/// thread pool: small effects are batched together so that a single task
+		/// updates many of them, and large effects are given their own task which
+		/// splits the particles into blocks that are simulated across all of the
+		/// worker threads.
+		//-------------------------------------------------------------------------
+		class ParticleUpdateSystem final : public Core::AppSystem
+		{
+		public:
+			CS_DECLARE_NAMEDTYPE(ParticleUpdateSystem);
+			//-----------------------------------------------------------------
+			/// Allows querying of whether or not this implements the interface
+			/// described by the given interface Id.
+			/// 
+			/// @param The interface Id.
+			///
+			/// @return Whether this implements the interface.
+			//-----------------------------------------------------------------
+			bool IsA(Core::InterfaceIDType in_interfaceId) const override;
+			//-----------------------------------------------------------------
+			/// Queues an update of the given particle effect instance. The
+			/// update will be dispatched to the thread pool at the end of the
+			/// current application update. StartUpdate() must have been
+			/// successfully called on the concurrent particle data prior to
+			/// this; the update will commit to it when finished.
+			///
+			/// This must be called on the main thread.
+			///
+			/// @param The particle effect.
+			/// @param The particle emitter. If null, the effect is no longer
+			/// emitting.
+			/// @param The list of particle affectors.
+			/// @param The particle pool.
+			/// @param The concurrent particle data.
+			/// @param The playback time.
+			/// @param The delta time.
+			/// @param The entity's world position.
+			/// @param The entity's world scale.
+			/// @param The entity's world orientation.
+			/// @param Whether or not to interpolate the particles point
+			/// of emission since the last frame.
+			//-----------------------------------------------------------------
+			void QueueUpdate(const ParticleEffectCSPtr& in_particleEffect, const ParticleEmitterSPtr& in_particleEmitter, const std::vector<ParticleAffectorSPtr>& in_particleAffectors,
+				const std::shared_ptr<ParticlePool>& in_particlePool, const ConcurrentParticleDataSPtr& in_concurrentParticleData, f32 in_playbackTime, f32 in_deltaTime,
+				const Core::Vector3& in_entityPosition, const Core::Vector3& in_entityScale, const Core::Quaternion& in_entityOrientation, bool in_interpolateEmission);
+			//-----------------------------------------------------------------
+			/// Dispatches all queued updates to the thread pool. This is
+			/// called by the application after all states have been updated.
+			///
+			/// This must be called on the main thread.
+			//-----------------------------------------------------------------
+			void ProcessQueuedUpdates();
+			//-----------------------------------------------------------------
+			/// A single queued particle effect update. Everything the update
+			/// needs is held by value or shared pointer so that the effect
+			/// can be safely destroyed while its update is in flight.
+			//-----------------------------------------------------------------
+			struct UpdateRequest final
+			{
+				ParticleEffectCSPtr m_particleEffect;
+				ParticleEmitterSPtr m_particleEmitter;
+				std::vector<ParticleAffectorSPtr> m_particleAffectors;
+				std::shared_ptr<ParticlePool> m_particlePool;
+				ConcurrentParticleDataSPtr m_concurrentParticleData;
+				f32 m_playbackTime = 0.0f;
+				f32 m_deltaTime = 0.0f;
+				Core::Vector3 m_entityPosition;
+				Core::Vector3 m_entityScale;
+				Core::Quaternion m_entityOrientation;
+				bool m_interpolateEmission = false;
+			};
+		private:
+			friend class Core::Application;
+			//-----------------------------------------------------------------
+			/// Factory method for creating new instances of this system.
+			///
+			/// @return The instance of this system.
+			//-----------------------------------------------------------------
+			static ParticleUpdateSystemUPtr Create();
+			//-----------------------------------------------------------------
+			/// Default constructor. Declared private to force the use of the
+			/// CreateSystem() method in Application.
+			//-----------------------------------------------------------------
+			ParticleUpdateSystem() = default;
+			//-----------------------------------------------------------------
+			/// Clears any updates which haven't yet been dispatched.
+			//-----------------------------------------------------------------
+			void OnDestroy() override;
+
+			std::vector<UpdateRequest> m_queuedRequests;
+		};
+	}
+}
+
+#endif
@@ -30,6 +30,8 @@
 
 #if defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
 #include <CSBackend/Rendering/OpenGL/Shader/Shader.h>
+#elif defined CS_TARGETPLATFORM_LINUX
+#include <CSBackend/Rendering/Null/Shader/Shader.h>
 #endif
 
 namespace ChilliSource
@@ -43,6 +45,8 @@ namespace ChilliSource
         {
 #if defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
             return ShaderUPtr(new CSBackend::OpenGL::Shader());
+#elif defined CS_TARGETPLATFORM_LINUX
+            return ShaderUPtr(new CSBackend::Null::Shader());
 #else
             return nullptr;
 #endif
@@ -33,6 +33,8 @@
 #include <ChilliSource/Rendering/Base/RenderSystem.h>
 #include <ChilliSource/Rendering/Material/Material.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -45,13 +47,14 @@ namespace ChilliSource
 		/// Default
 		//-------------------------------------------------------
 		DynamicSpriteBatch::DynamicSpriteBatch(RenderSystem* inpRenderSystem) 
-        : m_renderSystem(inpRenderSystem), mudwCurrentRenderSpriteBatch(0), mudwSpriteCommandCounter(0)
+        : mudwNumCachedSprites(0), mudwCurrentRenderSpriteBatch(0), mudwSpriteCommandCounter(0), m_renderSystem(inpRenderSystem)
 		{
             for(u32 i=0; i<kudwNumBuffers; ++i)
             {
                 mpBatch[i] = new SpriteBatch(kudwMaxSpritesInDynamicBatch, inpRenderSystem, BufferUsage::k_dynamic);
             }
             
+            maVertexCache.resize(kudwMaxSpritesInDynamicBatch * k_numSpriteVerts);
             maRenderCommands.reserve(50);
 		}
         //-------------------------------------------------------
@@ -67,32 +70,77 @@ namespace ChilliSource
 		void DynamicSpriteBatch::Render(const SpriteBatch::SpriteData& inpSprite, const Core::Matrix4 * inpTransform)
 		{
             //If we exceed the capacity of the buffer then we will be forced to flush it
-            if(maSpriteCache.size() >= kudwMaxSpritesInDynamicBatch)
+            if(mudwNumCachedSprites >= kudwMaxSpritesInDynamicBatch)
             {
-                ForceRender();
+                Flush(RenderStats::SpriteBatchBreak::k_bufferFull);
             }
             
-            //As all the contents of the mesh buffer have the same vertex format we can push sprites into the buffer
-            //regardless of the material. However we cannot render the buffer in a single draw call we must render
-            //subsets of the buffer based on materials
-            if(mpLastMaterial && mpLastMaterial != inpSprite.pMaterial)
-            {
-                InsertDrawCommand();
-            }
+            SetMaterial(inpSprite.pMaterial);
             
-            maSpriteCache.push_back(inpSprite);
-            if(inpTransform)
+            SpriteBatch::SpriteVertex* pVerts = &maVertexCache[mudwNumCachedSprites * k_numSpriteVerts];
+            for(u32 i = 0; i < k_numSpriteVerts; i++)
             {
-                for(u32 i = 0; i < k_numSpriteVerts; i++)
-					maSpriteCache.back().sVerts[i].vPos = inpSprite.sVerts[i].vPos * *inpTransform;
+                pVerts[i] = inpSprite.sVerts[i];
+                if(inpTransform)
+                {
+                    pVerts[i].vPos = inpSprite.sVerts[i].vPos * *inpTransform;
+                }
             }
-            mpLastMaterial = inpSprite.pMaterial;
+            
+            ++mudwNumCachedSprites;
             ++mudwSpriteCommandCounter;
 		}
         //-------------------------------------------------------
         //-------------------------------------------------------
+        u32 DynamicSpriteBatch::ReserveSprites(const MaterialCSPtr& in_material, u32 in_numSprites, SpriteBatch::SpriteVertex*& out_vertices)
+        {
+            CS_ASSERT(in_numSprites > 0, "Cannot reserve zero sprites.");
+            
+            if(mudwNumCachedSprites >= kudwMaxSpritesInDynamicBatch)
+            {
+                Flush(RenderStats::SpriteBatchBreak::k_bufferFull);
+            }
+            
+            SetMaterial(in_material);
+            
+            u32 udwNumReserved = std::min(in_numSprites, kudwMaxSpritesInDynamicBatch - mudwNumCachedSprites);
+            out_vertices = &maVertexCache[mudwNumCachedSprites * k_numSpriteVerts];
+            
+            mudwNumCachedSprites += udwNumReserved;
+            mudwSpriteCommandCounter += udwNumReserved;
+            
+            return udwNumReserved;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void DynamicSpriteBatch::SetMaterial(const MaterialCSPtr& in_material)
+        {
+            //As all the contents of the mesh buffer have the same vertex format we can push sprites into the buffer
+            //regardless of the material. However we cannot render the buffer in a single draw call we must render
+            //subsets of the buffer based on materials. Only touch the material pointer when it changes to avoid
+            //reference counting for every sprite.
+            if(mpLastMaterial != in_material)
+            {
+                if(mpLastMaterial)
+                {
+                    if(mudwSpriteCommandCounter > 0)
+                    {
+                        m_renderSystem->GetRenderStats().RecordSpriteBatchBreak(RenderStats::SpriteBatchBreak::k_materialChange);
+                    }
+                    InsertDrawCommand();
+                }
+                
+                mpLastMaterial = in_material;
+            }
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
         void DynamicSpriteBatch::EnableScissoring(const Core::Vector2& in_pos, const Core::Vector2& in_size)
         {
+            if(mudwSpriteCommandCounter > 0)
+            {
+                m_renderSystem->GetRenderStats().RecordSpriteBatchBreak(RenderStats::SpriteBatchBreak::k_scissorChange);
+            }
             InsertDrawCommand();
             
             maRenderCommands.resize(maRenderCommands.size() + 1);
@@ -106,6 +154,10 @@ namespace ChilliSource
         //-------------------------------------------------------
         void DynamicSpriteBatch::DisableScissoring()
         {
+            if(mudwSpriteCommandCounter > 0)
+            {
+                m_renderSystem->GetRenderStats().RecordSpriteBatchBreak(RenderStats::SpriteBatchBreak::k_scissorChange);
+            }
             InsertDrawCommand();
             
             maRenderCommands.resize(maRenderCommands.size() + 1);
@@ -117,7 +169,7 @@ namespace ChilliSource
         //-------------------------------------------------------
 		void DynamicSpriteBatch::InsertDrawCommand()
 		{
-            if(!maSpriteCache.empty())
+            if(mudwSpriteCommandCounter > 0)
             {
                 maRenderCommands.resize(maRenderCommands.size() + 1);
                 
@@ -126,7 +178,7 @@ namespace ChilliSource
                 sLastCommand.m_type = CommandType::k_draw;
                 sLastCommand.m_material = mpLastMaterial;
                 //The offset of the indices for this batch
-                sLastCommand.m_offset = ((maSpriteCache.size() - mudwSpriteCommandCounter) * k_numSpriteIndices) * sizeof(s16);
+                sLastCommand.m_offset = ((mudwNumCachedSprites - mudwSpriteCommandCounter) * k_numSpriteIndices) * sizeof(s16);
                 //The number of indices in this batch
                 sLastCommand.m_stride = mudwSpriteCommandCounter * k_numSpriteIndices;
                 
@@ -143,8 +195,16 @@ namespace ChilliSource
         //-------------------------------------------------------
         void DynamicSpriteBatch::ForceRender()
         {
-            if(!maSpriteCache.empty())
+            Flush(RenderStats::SpriteBatchBreak::k_forced);
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void DynamicSpriteBatch::Flush(RenderStats::SpriteBatchBreak in_reason)
+        {
+            if(mudwNumCachedSprites > 0)
             {
+                m_renderSystem->GetRenderStats().RecordSpriteBatchBreak(in_reason);
+                
                 //Close off the batch
                 InsertDrawCommand();
                 
@@ -162,11 +222,11 @@ namespace ChilliSource
         //----------------------------------------------------------
 		void DynamicSpriteBatch::BuildAndFlushBatch()
         {
-            if(!maSpriteCache.empty())
+            if(mudwNumCachedSprites > 0)
             {
                 //Build the next buffer
-                mpBatch[mudwCurrentRenderSpriteBatch]->Build(maSpriteCache);
-                maSpriteCache.clear();
+                mpBatch[mudwCurrentRenderSpriteBatch]->Build(maVertexCache.data(), mudwNumCachedSprites);
+                mudwNumCachedSprites = 0;
             }   
             
             //Loop round all the render commands and draw the sections of the buffer with the correct material
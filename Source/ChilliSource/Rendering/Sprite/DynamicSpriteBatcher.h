@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_RENDERING_DYNAMICSPRITEBATCH_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Rendering/Base/RenderStats.h>
 #include <ChilliSource/Rendering/Sprite/SpriteBatch.h>
 
 namespace ChilliSource
@@ -75,6 +76,27 @@ namespace ChilliSource
             /// @param Sprite data to batch
 			//-------------------------------------------------------
 			void Render(const SpriteBatch::SpriteData& inpSprite, const Core::Matrix4 * inpTransform = nullptr);
+            //-------------------------------------------------------
+            /// Reserves space for a number of sprites which share
+            /// the given material, returning a pointer to their
+            /// vertices so that they can be written directly into
+            /// the batch without building a SpriteData per sprite.
+            /// The vertices for each sprite are laid out in the
+            /// order given by SpriteBatch::Verts.
+            ///
+            /// If the request doesn't fit in the batch then fewer
+            /// sprites than requested will be reserved and the
+            /// caller should reserve again for the remainder. At
+            /// least one sprite is always reserved.
+            ///
+            /// @param The material for the sprites.
+            /// @param The number of sprites required.
+            /// @param [Out] The vertices of the reserved sprites.
+            /// This is only valid until the next call to the batch.
+            ///
+            /// @return The number of sprites reserved.
+            //-------------------------------------------------------
+            u32 ReserveSprites(const MaterialCSPtr& in_material, u32 in_numSprites, SpriteBatch::SpriteVertex*& out_vertices);
             //-------------------------------------------------------
 			/// Enable scissoring with the given region. Any
             /// subsequent renders to the batcher will be clipped
@@ -110,6 +132,21 @@ namespace ChilliSource
             /// @author S Downie
             //-------------------------------------------------------
             void InsertDrawCommand();
+            //-------------------------------------------------------
+            /// Sets the material of the sprites that will be added
+            /// next, closing off the current draw command if the
+            /// material has changed.
+            ///
+            /// @param The material.
+            //-------------------------------------------------------
+            void SetMaterial(const MaterialCSPtr& in_material);
+            //-------------------------------------------------------
+            /// Renders the currently batched sprites, if there
+            /// are any.
+            ///
+            /// @param The reason the batch is being flushed.
+            //-------------------------------------------------------
+            void Flush(RenderStats::SpriteBatchBreak in_reason);
             //----------------------------------------------------------
             /// Build and Flush Batch
             ///
@@ -123,11 +160,12 @@ namespace ChilliSource
 		private:
         
 			SpriteBatch* mpBatch[kudwNumBuffers];
-			std::vector<SpriteBatch::SpriteData> maSpriteCache;
+			std::vector<SpriteBatch::SpriteVertex> maVertexCache;
             std::vector<RenderCommand> maRenderCommands;
             
             MaterialCSPtr mpLastMaterial;
             
+            u32 mudwNumCachedSprites;
             u32 mudwCurrentRenderSpriteBatch;
             u32 mudwSpriteCommandCounter;
             
@@ -32,6 +32,8 @@
 #include <ChilliSource/Rendering/Base/VertexLayouts.h>
 #include <ChilliSource/Rendering/Base/RenderSystem.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -94,6 +96,23 @@ namespace ChilliSource
 
 			BuildIndicesForNumberSprites(udwNumSprites);
 		}
+		//------------------------------------------------------
+		//------------------------------------------------------
+		void SpriteBatch::Build(const SpriteVertex* in_vertices, u32 in_numSprites)
+		{
+			const u32 udwNumVerts = k_numSpriteVerts * in_numSprites;
+			
+			mpSpriteBuffer->Bind();
+			mpSpriteBuffer->SetVertexCount(udwNumVerts);
+			mpSpriteBuffer->SetIndexCount(k_numSpriteIndices * in_numSprites);
+			
+			SpriteVertex* pVBuffer = nullptr;
+			mpSpriteBuffer->LockVertex((f32**)&pVBuffer, 0, 0);
+			std::copy(in_vertices, in_vertices + udwNumVerts, pVBuffer);
+			mpSpriteBuffer->UnlockVertex();
+
+			BuildIndicesForNumberSprites(in_numSprites);
+		}
         //-------------------------------------------------------
         /// Map Sprite Into Buffer
         ///
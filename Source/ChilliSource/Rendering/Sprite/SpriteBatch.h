@@ -93,6 +93,16 @@ namespace ChilliSource
 			//------------------------------------------------------
 			void Build(const std::vector<SpriteData>& in_sprites);
 			//------------------------------------------------------
+			/// Finalise the batch from pre-built vertex data.
+			/// Nothing can be changed once the batch is built.
+			///
+			/// @param The vertices of the sprites. There should be
+			/// k_numSpriteVerts per sprite in the order given by
+			/// Verts.
+			/// @param The number of sprites.
+			//------------------------------------------------------
+			void Build(const SpriteVertex* in_vertices, u32 in_numSprites);
+			//------------------------------------------------------
 			/// Render
 			///
 			/// Draw the contents of the mesh buffer
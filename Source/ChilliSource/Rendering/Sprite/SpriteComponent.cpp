@@ -178,6 +178,11 @@ namespace ChilliSource
                 SetTextureSizeCacheValid();
             }
             
+            if(GetEntity())
+            {
+                CheckEntityWorldVersion();
+            }
+            
 			if(GetEntity() && m_isAABBValid == false)
 			{
                 m_isAABBValid = true;
@@ -203,6 +208,11 @@ namespace ChilliSource
                 SetTextureSizeCacheValid();
             }
             
+            if(GetEntity())
+            {
+                CheckEntityWorldVersion();
+            }
+            
 			if(GetEntity() && m_isOOBBValid == false)
 			{
                 m_isOOBBValid = true;
@@ -229,6 +239,11 @@ namespace ChilliSource
                 SetTextureSizeCacheValid();
             }
             
+            if(GetEntity())
+            {
+                CheckEntityWorldVersion();
+            }
+            
 			if(GetEntity() && m_isBSValid == false)
 			{
                 m_isBSValid = true;
@@ -401,6 +416,8 @@ namespace ChilliSource
                     SetTextureSizeCacheValid();
                 }
                 
+                CheckEntityWorldVersion();
+                
                 if(m_vertexPositionsValid == false)
                 {
                     //We have been transformed so we need to recalculate our vertices
@@ -425,6 +442,17 @@ namespace ChilliSource
             m_isAABBValid = false;
             m_isOOBBValid = false;
         }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        void SpriteComponent::CheckEntityWorldVersion()
+        {
+            const u32 worldVersion = GetEntity()->GetTransform().GetWorldVersion();
+            if(worldVersion != m_entityWorldVersion)
+            {
+                m_entityWorldVersion = worldVersion;
+                OnTransformChanged();
+            }
+        }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
         bool SpriteComponent::IsTextureSizeCacheValid() const
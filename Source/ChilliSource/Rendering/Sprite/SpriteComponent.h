@@ -312,6 +312,12 @@ namespace ChilliSource
             /// We must rebuild our sprite data
             //------------------------------------------------------------
             void OnTransformChanged();
+            //------------------------------------------------------------
+            /// Rebuilds our sprite data if the entity's world transform
+            /// has changed without the changed event being sent yet, as
+            /// happens in the deferred update mode.
+            //------------------------------------------------------------
+            void CheckEntityWorldVersion();
             //-----------------------------------------------------------
             /// If the transform cache is invalid we must calculate
             /// the corner positions from the new world transform
@@ -376,6 +382,7 @@ namespace ChilliSource
             bool m_isBSValid = false;
             bool m_isAABBValid = false;
             bool m_isOOBBValid = false;
+            u32 m_entityWorldVersion = 0;
 		};
 	}
 }
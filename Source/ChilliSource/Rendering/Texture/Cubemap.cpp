@@ -30,6 +30,8 @@
 
 #if defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
 #include <CSBackend/Rendering/OpenGL/Texture/Cubemap.h>
+#elif defined CS_TARGETPLATFORM_LINUX
+#include <CSBackend/Rendering/Null/Texture/Cubemap.h>
 #endif
 
 namespace ChilliSource
@@ -44,6 +46,8 @@ namespace ChilliSource
         {
 #if defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
             return CubemapUPtr(new CSBackend::OpenGL::Cubemap());
+#elif defined CS_TARGETPLATFORM_LINUX
+            return CubemapUPtr(new CSBackend::Null::Cubemap());
 #else
             return nullptr;
 #endif
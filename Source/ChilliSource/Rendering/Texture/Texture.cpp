@@ -30,6 +30,8 @@
 
 #if defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
 #include <CSBackend/Rendering/OpenGL/Texture/Texture.h>
+#elif defined CS_TARGETPLATFORM_LINUX
+#include <CSBackend/Rendering/Null/Texture/Texture.h>
 #endif
 
 namespace ChilliSource
@@ -44,6 +46,8 @@ namespace ChilliSource
         {
 #if defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_WINDOWS)
             return TextureUPtr(new CSBackend::OpenGL::Texture());
+#elif defined CS_TARGETPLATFORM_LINUX
+            return TextureUPtr(new CSBackend::Null::Texture());
 #else
             return nullptr;
 #endif
@@ -82,18 +82,21 @@ namespace ChilliSource
         //-----------------------------------------------------------
         void Canvas::OnPointerDown(const Input::Pointer& in_pointer, f64 in_timestamp, Input::Pointer::InputType in_inputType, Input::Filter& in_filter)
         {
+            m_canvas->UpdateLayouts();
             m_canvas->OnPointerDown(in_pointer, in_timestamp, in_inputType, in_filter);
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
         void Canvas::OnPointerMoved(const Input::Pointer& in_pointer, f64 in_timestamp)
         {
+            m_canvas->UpdateLayouts();
             m_canvas->OnPointerMoved(in_pointer, in_timestamp);
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
         void Canvas::OnPointerUp(const Input::Pointer& in_pointer, f64 in_timestamp, Input::Pointer::InputType in_inputType)
         {
+            m_canvas->UpdateLayouts();
             m_canvas->OnPointerUp(in_pointer, in_timestamp, in_inputType);
         }
         //--------------------------------------------------------
@@ -131,8 +134,18 @@ namespace ChilliSource
         //----------------------------------------------------
         void Canvas::Draw(Rendering::CanvasRenderer* in_renderer) const
         {
+            m_canvas->UpdateLayouts();
+            
+            //This is flagged as valid prior to drawing so that anything invalidated during the draw is picked up next time.
+            m_canvas->m_isCanvasDrawCacheValid = true;
             m_canvas->OnDraw(in_renderer);
         }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        bool Canvas::IsDrawCacheValid() const
+        {
+            return m_canvas->m_isCanvasDrawCacheValid;
+        }
         //-------------------------------------------------------
         //-------------------------------------------------------
         void Canvas::OnBackground()
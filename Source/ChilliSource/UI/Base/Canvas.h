@@ -74,6 +74,13 @@ namespace ChilliSource
             //----------------------------------------------------
             void Draw(Rendering::CanvasRenderer* in_renderer) const;
             //----------------------------------------------------
+            /// @return Whether nothing that affects the drawn
+            /// output of the canvas has changed since it was last
+            /// drawn. If so the geometry from the previous draw
+            /// can be reused.
+            //----------------------------------------------------
+            bool IsDrawCacheValid() const;
+            //----------------------------------------------------
             /// Adds a widget to the canvas. The widget
             /// will be rendered and updated. Any relative coordinates
             /// will now be in relation to this widget.
@@ -35,6 +35,7 @@
 #include <ChilliSource/Core/Math/Vector4.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 #include <ChilliSource/UI/Base/PropertyTypes.h>
+#include <ChilliSource/UI/Base/Widget.h>
 
 
 namespace ChilliSource
@@ -84,6 +85,29 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
+        void Component::InvalidateDrawCache()
+        {
+            if (m_widget != nullptr)
+            {
+                m_widget->InvalidateDrawCache();
+            }
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Component::SetAlwaysRedrawEnabled(bool in_enabled)
+        {
+            m_isAlwaysRedrawEnabled = in_enabled;
+            
+            InvalidateDrawCache();
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        bool Component::IsAlwaysRedrawEnabled() const
+        {
+            return m_isAlwaysRedrawEnabled;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
         void Component::ApplyRegisteredProperties(const Core::PropertyMap& in_properties)
         {
             CS_ASSERT(m_propertyRegistrationComplete == false, "Registered properties have already been applied.");
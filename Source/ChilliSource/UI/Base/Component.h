@@ -125,6 +125,22 @@ namespace ChilliSource
             //----------------------------------------------------------------
             void SetProperty(const std::string& in_propertyName, const char* in_propertyValue);
             //----------------------------------------------------------------
+            /// Sets whether or not the component opts out of the draw cache.
+            /// When enabled OnDraw() is called every frame the owning widget
+            /// is drawn, without needing to call InvalidateDrawCache(). This
+            /// is intended for components whose output changes every frame,
+            /// as the other components on the owning widget will also be
+            /// redrawn each frame. Disabled by default.
+            ///
+            /// @param Whether or not always redraw is enabled.
+            //----------------------------------------------------------------
+            void SetAlwaysRedrawEnabled(bool in_enabled);
+            //----------------------------------------------------------------
+            /// @return Whether or not the component opts out of the draw
+            /// cache, and is drawn every frame.
+            //----------------------------------------------------------------
+            bool IsAlwaysRedrawEnabled() const;
+            //----------------------------------------------------------------
             /// Destructor
             ///
             /// @author Ian Copland
@@ -173,6 +189,14 @@ namespace ChilliSource
             //----------------------------------------------------------------
             void ApplyRegisteredProperties(const Core::PropertyMap& in_properties);
             //----------------------------------------------------------------
+            /// Marks the geometry drawn by the owning widget as out of date
+            /// so that OnDraw() will be called again the next time the
+            /// canvas is drawn. This should be called whenever something
+            /// that affects the output of OnDraw() changes. This does
+            /// nothing if the component has not yet been added to a widget.
+            //----------------------------------------------------------------
+            void InvalidateDrawCache();
+            //----------------------------------------------------------------
             /// A method which is called when all components owned by the parent
             /// widget have been created and added. Inheriting classes should use
             /// this for any required initialisation.
@@ -220,6 +244,11 @@ namespace ChilliSource
             /// is active and the owning widget in on the canvas. This should
             /// be used for any rendering.
             ///
+            /// The output is retained by the canvas, so this is only called
+            /// again once the owning widget or the component has invalidated
+            /// its draw cache, or every frame if always redraw is enabled.
+            /// See InvalidateDrawCache() and SetAlwaysRedrawEnabled().
+            ///
             /// @author Ian Copland
             ///
             /// @param The canvas renderer.
@@ -289,6 +318,7 @@ namespace ChilliSource
             std::unordered_map<std::string, Core::IPropertyUPtr> m_properties;
             Widget* m_widget = nullptr;
             std::string m_name;
+            bool m_isAlwaysRedrawEnabled = false;
         };
         //----------------------------------------------------------------
         //----------------------------------------------------------------
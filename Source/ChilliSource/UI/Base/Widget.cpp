@@ -35,6 +35,7 @@
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Rendering/Base/AlignmentAnchors.h>
 #include <ChilliSource/Rendering/Base/AspectRatioUtils.h>
+#include <ChilliSource/Rendering/Base/CanvasDrawCache.h>
 #include <ChilliSource/Rendering/Base/CanvasRenderer.h>
 #include <ChilliSource/UI/Base/PropertyTypes.h>
 #include <ChilliSource/UI/Drawable/Drawable.h>
@@ -636,6 +637,8 @@ namespace ChilliSource
         void Widget::SetColour(const Core::Colour& in_colour)
         {
             m_localColour = Core::Colour::Clamp(in_colour);
+            
+            InvalidateDrawCacheRecursive();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -648,6 +651,8 @@ namespace ChilliSource
         void Widget::SetVisible(bool in_visible)
         {
             m_isVisible = in_visible;
+            
+            InvalidateCanvasDrawCache();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -660,6 +665,8 @@ namespace ChilliSource
         void Widget::SetClippingEnabled(bool in_enabled)
         {
             m_isSubviewClippingEnabled = in_enabled;
+            
+            InvalidateCanvasDrawCache();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -697,9 +704,13 @@ namespace ChilliSource
         {
             CS_ASSERT(in_widget->GetParent() == nullptr, "Cannot add a widget as a child of more than 1 parent");
 
+            in_widget->m_childIndex = (s32)m_children.size();
             m_children.push_back(in_widget);
             in_widget->m_parent = this;
             
+            in_widget->InvalidateSubtreeBounds();
+            ChangePressedInputCount(in_widget->m_numPressedInputsInSubtree);
+            
             if (m_canvas != nullptr)
             {
                 in_widget->SetCanvas(m_canvas);
@@ -720,8 +731,15 @@ namespace ChilliSource
                         (*it)->SetCanvas(nullptr);
                     }
                     
+                    ChangePressedInputCount(-in_widget->m_numPressedInputsInSubtree);
+                    
                     (*it)->m_parent = nullptr;
+                    (*it)->m_childIndex = -1;
                     m_children.erase(it);
+                    
+                    InvalidateSubtreeBounds();
+                    UpdateChildIndices();
+                    InvalidateCanvasDrawCache();
                     return;
                 }
             }
@@ -904,14 +922,19 @@ namespace ChilliSource
         {
             CS_ASSERT(m_parent != nullptr, "Widget has no parent to rearrange from");
             
+            if(m_childIndex < 0)
+            {
+                return;
+            }
+            
             s32 length = m_parent->m_children.size() - 1;
-            for(s32 i=0; i<length; ++i)
+            for(s32 i=m_childIndex; i<length; ++i)
             {
-                if(m_parent->m_children[i].get() == this)
-                {
-                    std::swap(m_parent->m_children[i], m_parent->m_children[i+1]);
-                }
+                std::swap(m_parent->m_children[i], m_parent->m_children[i+1]);
             }
+            
+            m_parent->UpdateChildIndices();
+            m_parent->InvalidateCanvasDrawCache();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -919,15 +942,15 @@ namespace ChilliSource
         {
             CS_ASSERT(m_parent != nullptr, "Widget has no parent to rearrange from");
             
-            s32 length = m_parent->m_children.size() - 1;
-            for(s32 i=0; i<length; ++i)
+            if(m_childIndex < 0 || m_childIndex >= (s32)m_parent->m_children.size() - 1)
             {
-                if(m_parent->m_children[i].get() == this)
-                {
-                    std::swap(m_parent->m_children[i], m_parent->m_children[i+1]);
-                    return;
-                }
+                return;
             }
+            
+            std::swap(m_parent->m_children[m_childIndex], m_parent->m_children[m_childIndex+1]);
+            
+            m_parent->UpdateChildIndices();
+            m_parent->InvalidateCanvasDrawCache();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -935,15 +958,15 @@ namespace ChilliSource
         {
             CS_ASSERT(m_parent != nullptr, "Widget has no parent to rearrange from");
             
-            u32 length = m_parent->m_children.size();
-            for(u32 i=1; i<length; ++i)
+            if(m_childIndex <= 0)
             {
-                if(m_parent->m_children[i].get() == this)
-                {
-                    std::swap(m_parent->m_children[i], m_parent->m_children[i-1]);
-                    return;
-                }
+                return;
             }
+            
+            std::swap(m_parent->m_children[m_childIndex], m_parent->m_children[m_childIndex-1]);
+            
+            m_parent->UpdateChildIndices();
+            m_parent->InvalidateCanvasDrawCache();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -951,14 +974,18 @@ namespace ChilliSource
         {
             CS_ASSERT(m_parent != nullptr, "Widget has no parent to rearrange from");
             
-            u32 length = m_parent->m_children.size();
-            for(u32 i=1; i<length; ++i)
+            if(m_childIndex < 0)
             {
-                if(m_parent->m_children[i].get() == this)
-                {
-                    std::swap(m_parent->m_children[i], m_parent->m_children[i-1]);
-                }
+                return;
             }
+            
+            for(s32 i=m_childIndex; i>0; --i)
+            {
+                std::swap(m_parent->m_children[i], m_parent->m_children[i-1]);
+            }
+            
+            m_parent->UpdateChildIndices();
+            m_parent->InvalidateCanvasDrawCache();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -1027,7 +1054,7 @@ namespace ChilliSource
         //----------------------------------------------------------------------------------------
         Core::Vector2 Widget::ToLocalSpace(const Core::Vector2& in_point, Rendering::AlignmentAnchor in_alignmentAnchor) const
         {
-            Core::Vector2 localPointCentreRelative = in_point * Core::Matrix3::Inverse(GetFinalTransform());
+            Core::Vector2 localPointCentreRelative = in_point * GetInverseFinalTransform();
             Core::Vector2 localPointAligned = localPointCentreRelative - Rendering::GetAnchorPoint(in_alignmentAnchor, GetFinalSize());
             return localPointAligned;
         }
@@ -1262,23 +1289,15 @@ namespace ChilliSource
         //----------------------------------------------------------------------------------------
         std::pair<LayoutComponent*, s32> Widget::GetLayoutForChild(const Widget* in_child)
         {
-            LayoutComponent* layout = nullptr;
-            s32 childIndex = -1;
+            CS_ASSERT(in_child->m_parent == this, "Widget is a child of a different parent");
             
-            if (m_layoutComponent != nullptr)
+            //Internal children have no index and are never part of the layout.
+            if (m_layoutComponent == nullptr || in_child->m_childIndex < 0)
             {
-                for(u32 i=0; i<m_children.size(); ++i)
-                {
-                    if(m_children[i].get() == in_child)
-                    {
-                        childIndex = (s32)i;
-                        layout = m_layoutComponent;
-                        break;
-                    }
-                }
+                return std::make_pair(nullptr, -1);
             }
             
-            return std::make_pair(layout, childIndex);
+            return std::make_pair(m_layoutComponent, in_child->m_childIndex);
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -1316,13 +1335,16 @@ namespace ChilliSource
         {
             m_isLocalTransformCacheValid = false;
             m_isLocalSizeCacheValid = false;
+            m_isInverseFinalTransformCacheValid = false;
             
-            if(m_canvas != nullptr)
+            InvalidateDrawCache();
+            InvalidateSubtreeBounds();
+            
+            //The layout is rebuilt in the next layout pass rather than immediately, so that repeated changes only cause a single rebuild.
+            if(m_layoutComponent != nullptr)
             {
-                if(m_layoutComponent != nullptr)
-                {
-                    m_layoutComponent->BuildLayout();
-                }
+                m_layoutComponent->InvalidateLayout();
+                MarkLayoutDirty();
             }
             
             for(auto& child : m_internalChildren)
@@ -1339,6 +1361,14 @@ namespace ChilliSource
         //----------------------------------------------------------------------------------------
         void Widget::OnParentTransformChanged()
         {
+            //The parent caches can only become valid again by recalculating this widget's size or transform, which
+            //every widget below this also relies on. If they are still invalid then nothing in this hierarchy has been
+            //recalculated since it was last invalidated, so there is nothing more to do.
+            if(m_isParentTransformCacheValid == false && m_isParentSizeCacheValid == false)
+            {
+                return;
+            }
+            
             m_isParentTransformCacheValid = false;
             m_isParentSizeCacheValid = false;
             
@@ -1346,6 +1376,194 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
+        void Widget::InvalidateDrawCache()
+        {
+            m_isDrawCacheValid = false;
+            
+            InvalidateCanvasDrawCache();
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        void Widget::InvalidateDrawCacheRecursive()
+        {
+            InvalidateDrawCache();
+            
+            for(auto& child : m_internalChildren)
+            {
+                child->InvalidateDrawCacheRecursive();
+            }
+            
+            for(auto& child : m_children)
+            {
+                child->InvalidateDrawCacheRecursive();
+            }
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        void Widget::InvalidateCanvasDrawCache()
+        {
+            if(m_canvas != nullptr)
+            {
+                m_canvas->m_isCanvasDrawCacheValid = false;
+            }
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        void Widget::MarkLayoutDirty()
+        {
+            //Always walk the full chain, as a widget that was dirty when removed from its previous parent may have
+            //been added to a parent that is not.
+            Widget* widget = this;
+            while(widget != nullptr)
+            {
+                widget->m_isLayoutDirty = true;
+                widget = widget->m_parent;
+            }
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        void Widget::UpdateLayouts()
+        {
+            if(m_isLayoutDirty == false)
+            {
+                return;
+            }
+            
+            m_isLayoutDirty = false;
+            
+            if(m_layoutComponent != nullptr)
+            {
+                m_layoutComponent->UpdateLayout();
+            }
+            
+            m_internalChildren.lock();
+            for(auto& child : m_internalChildren)
+            {
+                child->UpdateLayouts();
+            }
+            m_internalChildren.unlock();
+            
+            m_children.lock();
+            for(auto& child : m_children)
+            {
+                child->UpdateLayouts();
+            }
+            m_children.unlock();
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        void Widget::UpdateChildIndices()
+        {
+            s32 index = 0;
+            for(auto& child : m_children)
+            {
+                if(child->m_childIndex != index)
+                {
+                    child->m_childIndex = index;
+                    
+                    if(m_layoutComponent != nullptr)
+                    {
+                        child->OnParentTransformChanged();
+                    }
+                }
+                
+                ++index;
+            }
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        const Core::Matrix3& Widget::GetInverseFinalTransform() const
+        {
+            if(m_isInverseFinalTransformCacheValid == false)
+            {
+                m_cachedInverseFinalTransform = Core::Matrix3::Inverse(GetFinalTransform());
+                m_isInverseFinalTransformCacheValid = true;
+            }
+            
+            return m_cachedInverseFinalTransform;
+        }
+        //----------------------------------------------------------------------------------------
+        /// A widget's bounds can only be valid if the bounds of everything below it are valid,
+        /// so the walk up the hierarchy can stop at the first ancestor that is already invalid.
+        //----------------------------------------------------------------------------------------
+        void Widget::InvalidateSubtreeBounds()
+        {
+            m_isSubtreeBoundsCacheValid = false;
+            
+            Widget* widget = m_parent;
+            while(widget != nullptr && widget->m_isSubtreeBoundsCacheValid == true)
+            {
+                widget->m_isSubtreeBoundsCacheValid = false;
+                widget = widget->m_parent;
+            }
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        bool Widget::SubtreeBoundsContains(const Core::Vector2& in_point) const
+        {
+            UpdateSubtreeBounds();
+            
+            return in_point.x >= m_cachedSubtreeBoundsMin.x && in_point.y >= m_cachedSubtreeBoundsMin.y && in_point.x <= m_cachedSubtreeBoundsMax.x && in_point.y <= m_cachedSubtreeBoundsMax.y;
+        }
+        //----------------------------------------------------------------------------------------
+        /// The bounds of the widget itself are the AABB of its transformed corners, which will
+        /// enclose the widget regardless of rotation.
+        //----------------------------------------------------------------------------------------
+        void Widget::UpdateSubtreeBounds() const
+        {
+            if(m_isSubtreeBoundsCacheValid == true)
+            {
+                return;
+            }
+            
+            Core::Vector2 halfSize = GetFinalSize() * 0.5f;
+            Core::Matrix3 finalTransform = GetFinalTransform();
+            
+            Core::Vector2 corners[4] =
+            {
+                Core::Vector2(-halfSize.x, -halfSize.y) * finalTransform,
+                Core::Vector2(halfSize.x, -halfSize.y) * finalTransform,
+                Core::Vector2(-halfSize.x, halfSize.y) * finalTransform,
+                Core::Vector2(halfSize.x, halfSize.y) * finalTransform
+            };
+            
+            m_cachedSubtreeBoundsMin = corners[0];
+            m_cachedSubtreeBoundsMax = corners[0];
+            for(u32 i = 1; i < 4; ++i)
+            {
+                m_cachedSubtreeBoundsMin = Core::Vector2::Min(m_cachedSubtreeBoundsMin, corners[i]);
+                m_cachedSubtreeBoundsMax = Core::Vector2::Max(m_cachedSubtreeBoundsMax, corners[i]);
+            }
+            
+            for(const auto& child : m_internalChildren)
+            {
+                child->UpdateSubtreeBounds();
+                m_cachedSubtreeBoundsMin = Core::Vector2::Min(m_cachedSubtreeBoundsMin, child->m_cachedSubtreeBoundsMin);
+                m_cachedSubtreeBoundsMax = Core::Vector2::Max(m_cachedSubtreeBoundsMax, child->m_cachedSubtreeBoundsMax);
+            }
+            
+            for(const auto& child : m_children)
+            {
+                child->UpdateSubtreeBounds();
+                m_cachedSubtreeBoundsMin = Core::Vector2::Min(m_cachedSubtreeBoundsMin, child->m_cachedSubtreeBoundsMin);
+                m_cachedSubtreeBoundsMax = Core::Vector2::Max(m_cachedSubtreeBoundsMax, child->m_cachedSubtreeBoundsMax);
+            }
+            
+            m_isSubtreeBoundsCacheValid = true;
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        void Widget::ChangePressedInputCount(s32 in_delta)
+        {
+            Widget* widget = this;
+            while(widget != nullptr)
+            {
+                widget->m_numPressedInputsInSubtree += in_delta;
+                widget = widget->m_parent;
+            }
+        }
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
         void Widget::OnResume()
         {
             for (const auto& component : m_components)
@@ -1424,14 +1642,40 @@ namespace ChilliSource
             
             Core::Vector2 finalSize(GetFinalSize());
             
-            if (ShouldCull(GetFinalPositionOfCentre(), finalSize, m_screen->GetResolution()) == false)
+            //Only ask the components to draw if something has changed, otherwise reuse the geometry they drew last time.
+            if (m_isDrawCacheValid == false)
             {
+                if (m_drawCache == nullptr)
+                {
+                    m_drawCache = Rendering::CanvasDrawCacheUPtr(new Rendering::CanvasDrawCache());
+                }
+                
+                m_isDrawCacheValid = true;
+                in_renderer->BeginDrawCache(m_drawCache.get());
+                
+                if (ShouldCull(GetFinalPositionOfCentre(), finalSize, m_screen->GetResolution()) == false)
+                {
+                    for (auto& component : m_components)
+                    {
+                        component->OnDraw(in_renderer, GetFinalTransform(), finalSize, GetFinalColour());
+                    }
+                }
+                
+                in_renderer->EndDrawCache();
+                
+                //Components that opt out of the cache are drawn again next frame.
                 for (auto& component : m_components)
                 {
-                    component->OnDraw(in_renderer, GetFinalTransform(), finalSize, GetFinalColour());
+                    if (component->IsAlwaysRedrawEnabled() == true)
+                    {
+                        InvalidateDrawCache();
+                        break;
+                    }
                 }
             }
             
+            in_renderer->DrawCached(*m_drawCache);
+            
             if(m_isSubviewClippingEnabled == true)
             {
                 Core::Vector2 bottomLeftPos = Rendering::GetAnchorPoint(Rendering::AlignmentAnchor::k_bottomLeft, finalSize * 0.5f);
@@ -1509,6 +1753,12 @@ namespace ChilliSource
         //----------------------------------------------------------------------------------------
         void Widget::ForceLayoutChildren()
         {
+            if(m_layoutComponent != nullptr)
+            {
+                m_layoutComponent->InvalidateLayout();
+                MarkLayoutDirty();
+            }
+            
             for(auto& child : m_children)
             {
                 child->OnParentTransformChanged();
@@ -1525,6 +1775,10 @@ namespace ChilliSource
             if(m_isInputEnabled == false)
                 return;
             
+            //Nothing in this hierarchy can contain the pointer if it is outside the hierarchy's bounds.
+            if(SubtreeBoundsContains(in_pointer.GetPosition()) == false)
+                return;
+            
             m_children.lock();
             for(auto it = m_children.rbegin(); it != m_children.rend(); ++it)
             {
@@ -1564,6 +1818,7 @@ namespace ChilliSource
 				{
 					std::set<Input::Pointer::InputType> inputTypeSet = { in_inputType };
 					m_pressedInput.emplace(in_pointer.GetId(), inputTypeSet);
+					ChangePressedInputCount(1);
 				}
                 
                 m_pressedInsideEvent.NotifyConnections(this, in_pointer, in_inputType);
@@ -1583,6 +1838,11 @@ namespace ChilliSource
             if(m_isInputEnabled == false)
                 return;
             
+            //Move events only occur if the pointer has entered, exited or is over a widget, or if the
+            //widget is pressed, so the hierarchy can be skipped if neither is possible.
+            if(m_numPressedInputsInSubtree == 0 && SubtreeBoundsContains(in_pointer.GetPreviousPosition()) == false && SubtreeBoundsContains(in_pointer.GetPosition()) == false)
+                return;
+            
             m_children.lock();
             for(auto it = m_children.rbegin(); it != m_children.rend(); ++it)
             {
@@ -1634,6 +1894,10 @@ namespace ChilliSource
             if(m_isInputEnabled == false)
                 return;
             
+            //Release events only occur on pressed widgets.
+            if(m_numPressedInputsInSubtree == 0)
+                return;
+            
             m_children.lock();
             for(auto it = m_children.rbegin(); it != m_children.rend(); ++it)
             {
@@ -1658,6 +1922,7 @@ namespace ChilliSource
 					if (itPressedInput->second.empty() == true)
 					{
 						m_pressedInput.erase(itPressedInput);
+						ChangePressedInputCount(-1);
 					}
 
 					if(Contains(in_pointer.GetPosition()) == true)
@@ -860,12 +860,20 @@ namespace ChilliSource
             //----------------------------------------------------------------------------------------
             Core::Vector2 ToLocalSpace(const Core::Vector2& in_point, Rendering::AlignmentAnchor in_alignmentAnchor) const;
             //----------------------------------------------------------------------------------------
-            /// Forces the widget to update its children.
+            /// Forces the widget to update its children. Any layout on the widget is rebuilt during
+            /// the next layout pass.
             ///
             /// @author Ian Copland
             //----------------------------------------------------------------------------------------
             void ForceLayoutChildren();
             //----------------------------------------------------------------------------------------
+            /// Marks the geometry drawn by this widget's components as out of date, so that it is
+            /// rebuilt the next time the canvas is drawn. Widget property, transform, colour and
+            /// hierarchy changes do this automatically; it only needs to be called when something
+            /// else changes the output of a component's OnDraw().
+            //----------------------------------------------------------------------------------------
+            void InvalidateDrawCache();
+            //----------------------------------------------------------------------------------------
             /// Destructor. Sends the OnDestroy event to all components.
             ///
             /// @author Ian Copland
@@ -1066,6 +1074,70 @@ namespace ChilliSource
             //----------------------------------------------------------------------------------------
             void OnParentTransformChanged();
             //----------------------------------------------------------------------------------------
+            /// Invalidates the draw cache of this widget and all widgets below it. This is used
+            /// when a property inherited by children, such as colour, changes.
+            //----------------------------------------------------------------------------------------
+            void InvalidateDrawCacheRecursive();
+            //----------------------------------------------------------------------------------------
+            /// Flags the canvas this widget is on as needing to be rebuilt, without invalidating
+            /// the geometry of this widget. This is used when only the set or order of widgets
+            /// being drawn changes.
+            //----------------------------------------------------------------------------------------
+            void InvalidateCanvasDrawCache();
+            //----------------------------------------------------------------------------------------
+            /// Flags this widget, and each of its ancestors, as having a layout below it that needs
+            /// to be rebuilt during the next layout pass.
+            //----------------------------------------------------------------------------------------
+            void MarkLayoutDirty();
+            //----------------------------------------------------------------------------------------
+            /// The layout pass. Rebuilds any invalidated layouts in this widget's hierarchy,
+            /// visiting only those parts of the hierarchy that have been flagged as dirty. This is
+            /// called on the canvas widget once per frame prior to drawing, and prior to handling
+            /// input, so any number of layout invalidations in between result in a single rebuild.
+            //----------------------------------------------------------------------------------------
+            void UpdateLayouts();
+            //----------------------------------------------------------------------------------------
+            /// Updates the cached index of each child within this widget's list of children. Any
+            /// child whose index has changed is repositioned if this widget has a layout, as its
+            /// cell in the layout is given by its index.
+            //----------------------------------------------------------------------------------------
+            void UpdateChildIndices();
+            //----------------------------------------------------------------------------------------
+            /// @return The inverse of the final transform. This is cached until the final transform
+            /// changes, so that converting pointer positions into local space doesn't require a
+            /// matrix inversion for every widget on every input event.
+            //----------------------------------------------------------------------------------------
+            const Core::Matrix3& GetInverseFinalTransform() const;
+            //----------------------------------------------------------------------------------------
+            /// Flags the screen space bounds of this widget and its hierarchy as needing to be
+            /// recalculated, along with those of each ancestor.
+            //----------------------------------------------------------------------------------------
+            void InvalidateSubtreeBounds();
+            //----------------------------------------------------------------------------------------
+            /// Checks whether the given point is within the screen space AABB enclosing this widget
+            /// and everything in its hierarchy. If it is not then neither this widget nor any widget
+            /// below it can contain the point, allowing the whole hierarchy to be skipped during
+            /// input dispatch. The bounds are recalculated only if they have been invalidated.
+            ///
+            /// @param The point in screen space
+            ///
+            /// @return Whether the point is within the bounds of the hierarchy.
+            //----------------------------------------------------------------------------------------
+            bool SubtreeBoundsContains(const Core::Vector2& in_point) const;
+            //----------------------------------------------------------------------------------------
+            /// Recalculates the screen space bounds of this widget and its hierarchy if they have
+            /// been invalidated.
+            //----------------------------------------------------------------------------------------
+            void UpdateSubtreeBounds() const;
+            //----------------------------------------------------------------------------------------
+            /// Adjusts the count of pressed inputs in the hierarchy of this widget and each of
+            /// its ancestors. This allows released events to skip hierarchies which have no
+            /// pressed input to release.
+            ///
+            /// @param The change in the number of pressed inputs.
+            //----------------------------------------------------------------------------------------
+            void ChangePressedInputCount(s32 in_delta);
+            //----------------------------------------------------------------------------------------
             /// Resumes the widget, its components and its children. This is called when the widget
             /// is attached to the canvas and every time the state that owns the canvas is resumed while
             /// the widget is attached.
@@ -1171,6 +1243,9 @@ namespace ChilliSource
             mutable Core::Matrix3 m_cachedFinalTransform;
             mutable Core::Vector2 m_cachedFinalPosition;
             mutable Core::Vector2 m_cachedFinalSize;
+            mutable Core::Matrix3 m_cachedInverseFinalTransform;
+            mutable Core::Vector2 m_cachedSubtreeBoundsMin;
+            mutable Core::Vector2 m_cachedSubtreeBoundsMax;
             
             SizePolicy m_sizePolicy = SizePolicy::k_none;
             SizePolicyDelegate m_sizePolicyDelegate;
@@ -1186,6 +1261,8 @@ namespace ChilliSource
             
             Widget* m_parent = nullptr;
             const Widget* m_canvas = nullptr;
+            s32 m_childIndex = -1;
+            s32 m_numPressedInputsInSubtree = 0;
             
             Rendering::AlignmentAnchor m_parentalAnchor = Rendering::AlignmentAnchor::k_middleCentre;
             Rendering::AlignmentAnchor m_originAnchor = Rendering::AlignmentAnchor::k_middleCentre;
@@ -1200,6 +1277,13 @@ namespace ChilliSource
             mutable bool m_isLocalTransformCacheValid = false;
             mutable bool m_isLocalSizeCacheValid = false;
             mutable bool m_isParentSizeCacheValid = false;
+            mutable bool m_isInverseFinalTransformCacheValid = false;
+            mutable bool m_isSubtreeBoundsCacheValid = false;
+            
+            Rendering::CanvasDrawCacheUPtr m_drawCache;
+            bool m_isDrawCacheValid = false;
+            mutable bool m_isCanvasDrawCacheValid = false;
+            bool m_isLayoutDirty = false;
     
             Core::Screen* m_screen = nullptr;
         };
@@ -28,10 +28,21 @@
 
 #include <ChilliSource/UI/Drawable/Drawable.h>
 
+#include <ChilliSource/UI/Drawable/DrawableComponent.h>
+
 namespace ChilliSource
 {
     namespace UI
     {
         CS_DEFINE_NAMEDTYPE(Drawable);
+        //----------------------------------------------------------------------------------------
+        //----------------------------------------------------------------------------------------
+        void Drawable::NotifyChanged()
+        {
+            if (m_owningComponent != nullptr)
+            {
+                m_owningComponent->OnDrawableChanged();
+            }
+        }
     }
 }
\ No newline at end of file
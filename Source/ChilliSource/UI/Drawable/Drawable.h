@@ -38,7 +38,9 @@ namespace ChilliSource
     namespace UI
     {
         //------------------------------------------------------------------------
-        /// Interface for rendering widgets
+        /// Interface for rendering widgets. Implementations must call
+        /// NotifyChanged() whenever a property that affects drawing changes
+        /// so the owning drawable component can redraw.
         ///
         /// @author S Downie
         //------------------------------------------------------------------------
@@ -123,6 +125,18 @@ namespace ChilliSource
             /// @author S Downie
             //----------------------------------------------------------------------------------------
             virtual ~Drawable(){};
+            
+        protected:
+            //----------------------------------------------------------------------------------------
+            /// Notifies the owning drawable component, if there is one, that the drawable has
+            /// changed and needs to be drawn again.
+            //----------------------------------------------------------------------------------------
+            void NotifyChanged();
+            
+        private:
+            friend class DrawableComponent;
+            
+            DrawableComponent* m_owningComponent = nullptr;
         };
     }
 }
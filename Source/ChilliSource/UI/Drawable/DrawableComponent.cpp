@@ -88,6 +88,9 @@ namespace ChilliSource
             
             m_drawableDef = in_drawableDef;
             m_drawable = m_drawableDef->CreateDrawable();
+            m_drawable->m_owningComponent = this;
+            
+            InvalidateDrawCache();
         }
         //-------------------------------------------------------------------
         //-------------------------------------------------------------------
@@ -95,6 +98,12 @@ namespace ChilliSource
         {
             return m_drawableDef;
         }
+        //-------------------------------------------------------------------
+        //-------------------------------------------------------------------
+        void DrawableComponent::OnDrawableChanged()
+        {
+            InvalidateDrawCache();
+        }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
         void DrawableComponent::OnDraw(Rendering::CanvasRenderer* in_renderer, const Core::Matrix3& in_transform, const Core::Vector2& in_absSize, const Core::Colour& in_absColour)
@@ -108,6 +108,7 @@ namespace ChilliSource
             
         private:
             friend class ComponentFactory;
+            friend class Drawable;
             //-------------------------------------------------------------------
             /// Constructor that builds the component from key-value properties.
             /// The properties used to create a drawable component are described
@@ -126,6 +127,11 @@ namespace ChilliSource
             /// underlying drawable object.
             //-------------------------------------------------------------------
             const DrawableDefCSPtr& GetDrawableDef() const;
+            //-------------------------------------------------------------------
+            /// Called by the drawable whenever one of its properties changes,
+            /// invalidating the draw cache so it is drawn again.
+            //-------------------------------------------------------------------
+            void OnDrawableChanged();
             //----------------------------------------------------------------
             /// This is called during the draw event whenever the application
             /// is active and the owning widget in on the canvas. This will
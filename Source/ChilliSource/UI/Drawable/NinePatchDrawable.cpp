@@ -413,6 +413,8 @@ namespace ChilliSource
             
             m_atlasFrame = DrawableUtils::BuildFrame(m_texture.get(), m_atlas.get(), m_atlasId, m_uvs);
             m_isPatchCatchValid = false;
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -423,6 +425,8 @@ namespace ChilliSource
             
             m_atlasFrame = DrawableUtils::BuildFrame(m_texture.get(), m_atlas.get(), m_atlasId, m_uvs);
             m_isPatchCatchValid = false;
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -434,6 +438,8 @@ namespace ChilliSource
             
             m_atlasFrame = DrawableUtils::BuildFrame(m_texture.get(), m_atlas.get(), m_atlasId, m_uvs);
             m_isPatchCatchValid = false;
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -443,12 +449,16 @@ namespace ChilliSource
             
             m_atlasFrame = DrawableUtils::BuildFrame(m_texture.get(), m_atlas.get(), m_atlasId, m_uvs);
             m_isPatchCatchValid = false;
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
         void NinePatchDrawable::SetColour(const Core::Colour& in_colour)
         {
             m_colour = in_colour;
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -464,6 +474,8 @@ namespace ChilliSource
             m_bottomInset = in_bottom;
             
             m_isPatchCatchValid = false;
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -72,6 +72,8 @@ namespace ChilliSource
             m_texture = in_texture;
             
             m_atlasFrame = DrawableUtils::BuildFrame(m_texture.get(), m_atlas.get(), m_atlasId, m_uvs);
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -81,6 +83,8 @@ namespace ChilliSource
             m_atlasId = "";
             
             m_atlasFrame = DrawableUtils::BuildFrame(m_texture.get(), m_atlas.get(), m_atlasId, m_uvs);
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -91,6 +95,8 @@ namespace ChilliSource
             m_atlasId = in_atlasId;
             
             m_atlasFrame = DrawableUtils::BuildFrame(m_texture.get(), m_atlas.get(), m_atlasId, m_uvs);
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -99,12 +105,16 @@ namespace ChilliSource
             m_uvs = in_UVs;
             
             m_atlasFrame = DrawableUtils::BuildFrame(m_texture.get(), m_atlas.get(), m_atlasId, m_uvs);
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
         void StandardDrawable::SetColour(const Core::Colour& in_colour)
         {
             m_colour = in_colour;
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -504,6 +504,8 @@ namespace ChilliSource
             
             m_atlasFrame = DrawableUtils::BuildFrame(m_texture.get(), m_atlas.get(), m_atlasId, m_uvs);
             m_isPatchCatchValid = false;
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -514,6 +516,8 @@ namespace ChilliSource
             
             m_atlasFrame = DrawableUtils::BuildFrame(m_texture.get(), m_atlas.get(), m_atlasId, m_uvs);
             m_isPatchCatchValid = false;
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -525,6 +529,8 @@ namespace ChilliSource
             
             m_atlasFrame = DrawableUtils::BuildFrame(m_texture.get(), m_atlas.get(), m_atlasId, m_uvs);
             m_isPatchCatchValid = false;
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -534,12 +540,16 @@ namespace ChilliSource
             
             m_atlasFrame = DrawableUtils::BuildFrame(m_texture.get(), m_atlas.get(), m_atlasId, m_uvs);
             m_isPatchCatchValid = false;
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
         void ThreePatchDrawable::SetColour(const Core::Colour& in_colour)
         {
             m_colour = in_colour;
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
@@ -552,6 +562,8 @@ namespace ChilliSource
             m_rightOrTopInset = in_rightOrTop;
             
             m_isPatchCatchValid = false;
+            
+            NotifyChanged();
         }
         //----------------------------------------------------------------------------------------
         //----------------------------------------------------------------------------------------
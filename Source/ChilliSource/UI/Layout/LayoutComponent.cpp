@@ -89,24 +89,86 @@ namespace ChilliSource
             
             m_layoutDef = in_layoutDef;
             m_layout = m_layoutDef->CreateLayout(this);
+            m_isLayoutValid = false;
+            m_cells.clear();
+            
+            if (GetWidget() != nullptr)
+            {
+                GetWidget()->ForceLayoutChildren();
+            }
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
         void LayoutComponent::BuildLayout()
         {
             m_layout->BuildLayout();
+            m_isLayoutValid = true;
+            InvalidateCells();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void LayoutComponent::InvalidateLayout()
+        {
+            m_isLayoutValid = false;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void LayoutComponent::UpdateLayout()
+        {
+            BuildLayoutIfInvalid();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void LayoutComponent::BuildLayoutIfInvalid() const
+        {
+            if (m_isLayoutValid == false)
+            {
+                m_layout->BuildLayout();
+                m_isLayoutValid = true;
+                InvalidateCells();
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void LayoutComponent::InvalidateCells() const
+        {
+            for (auto& cell : m_cells)
+            {
+                cell.m_isValid = false;
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const LayoutComponent::Cell& LayoutComponent::GetCell(u32 in_index) const
+        {
+            BuildLayoutIfInvalid();
+            
+            if (in_index >= m_cells.size())
+            {
+                m_cells.resize(in_index + 1);
+            }
+            
+            Cell& cell = m_cells[in_index];
+            if (cell.m_isValid == false)
+            {
+                cell.m_size = m_layout->GetSizeForIndex(in_index);
+                cell.m_position = m_layout->GetPositionForIndex(in_index);
+                cell.m_isValid = true;
+            }
+            
+            return cell;
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
         Core::Vector2 LayoutComponent::GetSizeForIndex(u32 in_index) const
         {
-            return m_layout->GetSizeForIndex(in_index);
+            return GetCell(in_index).m_size;
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
         Core::Vector2 LayoutComponent::GetPositionForIndex(u32 in_index) const
         {
-            return m_layout->GetPositionForIndex(in_index);
+            return GetCell(in_index).m_position;
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -118,6 +180,7 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         void LayoutComponent::OnLayoutChanged()
         {
+            InvalidateLayout();
             GetWidget()->ForceLayoutChildren();
         }
     }
@@ -37,6 +37,8 @@
 #include <ChilliSource/UI/Base/Component.h>
 #include <ChilliSource/UI/Layout/Layout.h>
 
+#include <vector>
+
 namespace ChilliSource
 {
     namespace UI
@@ -105,6 +107,17 @@ namespace ChilliSource
             //------------------------------------------------------------------------------
             void BuildLayout();
             //------------------------------------------------------------------------------
+            /// Marks the layout as out of date. Rather than being rebuilt immediately,
+            /// the layout is rebuilt the next time the canvas layout pass runs or a cell
+            /// is queried, so any number of invalidations in a frame result in a single
+            /// rebuild.
+            //------------------------------------------------------------------------------
+            void InvalidateLayout();
+            //------------------------------------------------------------------------------
+            /// Rebuilds the layout if it has been invalidated since it was last built.
+            //------------------------------------------------------------------------------
+            void UpdateLayout();
+            //------------------------------------------------------------------------------
             /// Get the final size of the widget that occupies the space at the given index
             ///
             /// @author S Downie
@@ -136,6 +149,15 @@ namespace ChilliSource
         private:
             friend class ComponentFactory;
             //------------------------------------------------------------------------------
+            /// The cached size and position of a single cell in the layout.
+            //------------------------------------------------------------------------------
+            struct Cell
+            {
+                Core::Vector2 m_size;
+                Core::Vector2 m_position;
+                bool m_isValid = false;
+            };
+            //------------------------------------------------------------------------------
             /// Constructor that builds the component from key-value properties. The
             /// properties used to create a drawable component are described in the class
             /// documentation.
@@ -153,9 +175,30 @@ namespace ChilliSource
             /// object.
             //------------------------------------------------------------------------------
             const LayoutDefCSPtr& GetLayoutDef() const;
+            //------------------------------------------------------------------------------
+            /// Rebuilds the layout if it has been invalidated. This is const so that the
+            /// cell queries can build on demand.
+            //------------------------------------------------------------------------------
+            void BuildLayoutIfInvalid() const;
+            //------------------------------------------------------------------------------
+            /// Gets the size and position of the cell at the given index, calculating and
+            /// caching it if this is the first time it has been queried since the layout
+            /// was built.
+            ///
+            /// @param The cell index.
+            ///
+            /// @return The cell.
+            //------------------------------------------------------------------------------
+            const Cell& GetCell(u32 in_index) const;
+            //------------------------------------------------------------------------------
+            /// Flags all cached cells as needing to be recalculated.
+            //------------------------------------------------------------------------------
+            void InvalidateCells() const;
             
             LayoutDefCSPtr m_layoutDef;
             LayoutUPtr m_layout;
+            mutable bool m_isLayoutValid = false;
+            mutable std::vector<Cell> m_cells;
         };
     }
 }
@@ -191,6 +191,7 @@ namespace ChilliSource
             m_font = in_font;
             
             m_invalidateCache = true;
+            InvalidateDrawCache();
         }
         //-------------------------------------------------------------------
         //-------------------------------------------------------------------
@@ -215,6 +216,7 @@ namespace ChilliSource
             }
             
             m_invalidateCache = true;
+            InvalidateDrawCache();
         }
         //-------------------------------------------------------------------
         //-------------------------------------------------------------------
@@ -232,6 +234,7 @@ namespace ChilliSource
             }
             
             m_invalidateCache = true;
+            InvalidateDrawCache();
         }
         //-------------------------------------------------------------------
         //-------------------------------------------------------------------
@@ -242,6 +245,7 @@ namespace ChilliSource
             m_text = Core::StringUtils::InsertVariables(m_localisedText->GetText(in_localisedTextId), in_params);
             
             m_invalidateCache = true;
+            InvalidateDrawCache();
         }
         //-------------------------------------------------------------------
         //-------------------------------------------------------------------
@@ -250,12 +254,15 @@ namespace ChilliSource
             m_text = in_text;
             
             m_invalidateCache = true;
+            InvalidateDrawCache();
         }
         //-------------------------------------------------------------------
         //-------------------------------------------------------------------
         void TextComponent::SetTextColour(const Core::Colour& in_textColour)
         {
             m_textColour = in_textColour;
+            
+            InvalidateDrawCache();
         }
         //-------------------------------------------------------------------
         //-------------------------------------------------------------------
@@ -264,6 +271,7 @@ namespace ChilliSource
             m_textProperties.m_horizontalJustification = in_horizontalJustification;
             
             m_invalidateCache = true;
+            InvalidateDrawCache();
         }
         //-------------------------------------------------------------------
         //-------------------------------------------------------------------
@@ -272,6 +280,7 @@ namespace ChilliSource
             m_textProperties.m_verticalJustification = in_verticalJustification;
             
             m_invalidateCache = true;
+            InvalidateDrawCache();
         }
         //-------------------------------------------------------------------
         //-------------------------------------------------------------------
@@ -280,6 +289,7 @@ namespace ChilliSource
             m_textProperties.m_absCharSpacingOffset = in_offset;
             
             m_invalidateCache = true;
+            InvalidateDrawCache();
         }
         //-------------------------------------------------------------------
         //-------------------------------------------------------------------
@@ -288,6 +298,7 @@ namespace ChilliSource
             m_textProperties.m_absLineSpacingOffset = in_offset;
             
             m_invalidateCache = true;
+            InvalidateDrawCache();
         }
         //-------------------------------------------------------------------
         //-------------------------------------------------------------------
@@ -296,6 +307,7 @@ namespace ChilliSource
             m_textProperties.m_lineSpacingScale = in_scale;
             
             m_invalidateCache = true;
+            InvalidateDrawCache();
         }
         //-------------------------------------------------------------------
         //-------------------------------------------------------------------
@@ -306,6 +318,7 @@ namespace ChilliSource
             m_textProperties.m_maxNumLines = in_numLines;
             
             m_invalidateCache = true;
+            InvalidateDrawCache();
         }
         //-------------------------------------------------------------------
         //-------------------------------------------------------------------
@@ -314,6 +327,7 @@ namespace ChilliSource
             m_textProperties.m_textScale = in_scale;
             
             m_invalidateCache = true;
+            InvalidateDrawCache();
         }
         //-------------------------------------------------------------------
         //--------------------------------------------------------------------